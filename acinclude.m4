@@ -7,6 +7,16 @@ AC_DEFUN([AX_LIBFTXF_CHECK_LOCAL],
   [dnl No additional checks.
   ])
 
+dnl Function to detect if ftxftools dependencies are available
+AC_DEFUN([AX_FTXFTOOLS_CHECK_LOCAL],
+  [AC_CHECK_HEADERS([signal.h sys/signal.h time.h unistd.h])
+
+  AC_CHECK_FUNCS([getopt])
+
+  dnl Check if tools should be build as static executables
+  AX_COMMON_CHECK_ENABLE_STATIC_EXECUTABLES
+  ])
+
 dnl Function to check if DLL support is needed
 AC_DEFUN([AX_LIBFTXF_CHECK_DLL_SUPPORT],
   [AS_IF(
@@ -0,0 +1,656 @@
+/*
+ * Diff handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "diff_handle.h"
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libftxf.h"
+#include "input_source.h"
+
+/* Creates a diff handle
+ * Make sure the value diff_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_initialize(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_initialize";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid diff handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*diff_handle = memory_allocate_structure(
+	                diff_handle_t );
+
+	if( *diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create diff handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *diff_handle,
+	     0,
+	     sizeof( diff_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear diff handle.",
+		 function );
+
+		memory_free(
+		 *diff_handle );
+
+		*diff_handle = NULL;
+
+		return( -1 );
+	}
+	if( input_source_initialize(
+	     &( ( *diff_handle )->old_input_source ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create old input source.",
+		 function );
+
+		goto on_error;
+	}
+	if( input_source_initialize(
+	     &( ( *diff_handle )->new_input_source ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create new input source.",
+		 function );
+
+		goto on_error;
+	}
+	if( libftxf_record_diff_initialize(
+	     &( ( *diff_handle )->record_diff ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record diff.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *diff_handle != NULL )
+	{
+		if( ( *diff_handle )->new_input_source != NULL )
+		{
+			input_source_free(
+			 &( ( *diff_handle )->new_input_source ),
+			 NULL );
+		}
+		if( ( *diff_handle )->old_input_source != NULL )
+		{
+			input_source_free(
+			 &( ( *diff_handle )->old_input_source ),
+			 NULL );
+		}
+		memory_free(
+		 *diff_handle );
+
+		*diff_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a diff handle
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_free(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_free";
+	int result            = 1;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff_handle != NULL )
+	{
+		if( libftxf_record_diff_free(
+		     &( ( *diff_handle )->record_diff ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record diff.",
+			 function );
+
+			result = -1;
+		}
+		if( input_source_free(
+		     &( ( *diff_handle )->new_input_source ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free new input source.",
+			 function );
+
+			result = -1;
+		}
+		if( input_source_free(
+		     &( ( *diff_handle )->old_input_source ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free old input source.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *diff_handle );
+
+		*diff_handle = NULL;
+	}
+	return( result );
+}
+
+/* Opens the old and new inputs
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_open_inputs(
+     diff_handle_t *diff_handle,
+     const system_character_t *old_filename,
+     const system_character_t *new_filename,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_open_inputs";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_source_open(
+	     diff_handle->old_input_source,
+	     old_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open old input source.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_source_open(
+	     diff_handle->new_input_source,
+	     new_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open new input source.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the output
+ * The output is written to stdout if filename is NULL
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_open_output(
+     diff_handle_t *diff_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_open_output";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( diff_handle->output_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid diff handle - output stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		diff_handle->output_stream         = stdout;
+		diff_handle->output_stream_is_open = 0;
+
+		return( 1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	diff_handle->output_stream = file_stream_open_wide(
+	                              filename,
+	                              _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	diff_handle->output_stream = file_stream_open(
+	                              filename,
+	                              FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( diff_handle->output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
+		 function );
+
+		return( -1 );
+	}
+	diff_handle->output_stream_is_open = 1;
+
+	return( 1 );
+}
+
+/* Closes the inputs and output
+ * Returns the 0 if succesful or -1 on error
+ */
+int diff_handle_close(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_close";
+	int result            = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_source_close(
+	     diff_handle->old_input_source,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close old input source.",
+		 function );
+
+		result = -1;
+	}
+	if( input_source_close(
+	     diff_handle->new_input_source,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close new input source.",
+		 function );
+
+		result = -1;
+	}
+	if( diff_handle->output_stream != NULL )
+	{
+		if( diff_handle->output_stream_is_open != 0 )
+		{
+			if( file_stream_close(
+			     diff_handle->output_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close output file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( fflush(
+		          diff_handle->output_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output stream.",
+			 function );
+
+			result = -1;
+		}
+		diff_handle->output_stream         = NULL;
+		diff_handle->output_stream_is_open = 0;
+	}
+	return( result );
+}
+
+/* Compares the records of the old and new inputs
+ * The old input is read into the record diff first, after which the new input is streamed
+ * and every added (and common) record is written in new input order, followed by every
+ * removed record in old input order
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_compare_records(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error )
+{
+	const uint8_t *record_data = NULL;
+	static char *function      = "diff_handle_compare_records";
+	size_t record_data_size    = 0;
+	uint64_t old_record_offset = 0;
+	uint64_t record_offset     = 0;
+	uint32_t number_of_records = 0;
+	uint32_t record_index      = 0;
+	uint8_t is_common          = 0;
+	int print_count            = 0;
+	int result                 = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( diff_handle->output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid diff handle - missing output stream.",
+		 function );
+
+		return( -1 );
+	}
+	while( 1 )
+	{
+		result = input_source_read_record(
+		          diff_handle->old_input_source,
+		          &record_data,
+		          &record_data_size,
+		          &record_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record from old input source.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libftxf_record_diff_append_old_record_data(
+		     diff_handle->record_diff,
+		     record_data,
+		     record_data_size,
+		     record_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append old record at offset: %" PRIu64 ".",
+			 function,
+			 record_offset );
+
+			return( -1 );
+		}
+	}
+	while( 1 )
+	{
+		result = input_source_read_record(
+		          diff_handle->new_input_source,
+		          &record_data,
+		          &record_data_size,
+		          &record_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record from new input source.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		result = libftxf_record_diff_match_new_record_data(
+		          diff_handle->record_diff,
+		          record_data,
+		          record_data_size,
+		          &old_record_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to match new record at offset: %" PRIu64 ".",
+			 function,
+			 record_offset );
+
+			return( -1 );
+		}
+		print_count = 0;
+
+		if( result == 0 )
+		{
+			print_count = fprintf(
+			               diff_handle->output_stream,
+			               "added\t%" PRIu64 "\n",
+			               record_offset );
+
+			diff_handle->number_of_added_records += 1;
+		}
+		else
+		{
+			if( diff_handle->print_common_records != 0 )
+			{
+				print_count = fprintf(
+				               diff_handle->output_stream,
+				               "common\t%" PRIu64 "\t%" PRIu64 "\n",
+				               old_record_offset,
+				               record_offset );
+			}
+			diff_handle->number_of_common_records += 1;
+		}
+		if( print_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record: %" PRIu64 ".",
+			 function,
+			 record_offset );
+
+			return( -1 );
+		}
+	}
+	if( libftxf_record_diff_get_number_of_old_records(
+	     diff_handle->record_diff,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of old records.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libftxf_record_diff_get_old_record_by_index(
+		     diff_handle->record_diff,
+		     record_index,
+		     &record_offset,
+		     &is_common,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve old record: %" PRIu32 ".",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( is_common != 0 )
+		{
+			continue;
+		}
+		print_count = fprintf(
+		               diff_handle->output_stream,
+		               "removed\t%" PRIu64 "\n",
+		               record_offset );
+
+		if( print_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record: %" PRIu64 ".",
+			 function,
+			 record_offset );
+
+			return( -1 );
+		}
+		diff_handle->number_of_removed_records += 1;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,110 @@
+/*
+ * Diff handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DIFF_HANDLE_H )
+#define _DIFF_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libftxf.h"
+#include "input_source.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct diff_handle diff_handle_t;
+
+struct diff_handle
+{
+	/* The old input source
+	 */
+	input_source_t *old_input_source;
+
+	/* The new input source
+	 */
+	input_source_t *new_input_source;
+
+	/* The record diff
+	 */
+	libftxf_record_diff_t *record_diff;
+
+	/* The output file stream
+	 */
+	FILE *output_stream;
+
+	/* Value to indicate the output stream was opened by the diff handle
+	 */
+	uint8_t output_stream_is_open;
+
+	/* Value to indicate the common records should be printed
+	 */
+	uint8_t print_common_records;
+
+	/* The number of added records
+	 */
+	uint64_t number_of_added_records;
+
+	/* The number of removed records
+	 */
+	uint64_t number_of_removed_records;
+
+	/* The number of common records
+	 */
+	uint64_t number_of_common_records;
+};
+
+int diff_handle_initialize(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_free(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_open_inputs(
+     diff_handle_t *diff_handle,
+     const system_character_t *old_filename,
+     const system_character_t *new_filename,
+     libcerror_error_t **error );
+
+int diff_handle_open_output(
+     diff_handle_t *diff_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int diff_handle_close(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_compare_records(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DIFF_HANDLE_H ) */
+
@@ -0,0 +1,1277 @@
+/*
+ * Duplicate index
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "duplicate_index.h"
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libftxf.h"
+
+/* The duplicate index bounds the memory used to detect duplicate records: the content hash
+ * and size of the records are stored in a memory bounded duplicate filter, a full duplicate
+ * filter is sorted and written to a temporary file. The records that are not in the duplicate
+ * filter are looked up in the sorted runs. As far as the memory limit allows, a run has
+ * the content hashes of the first entry of every block, so that a lookup reads a single
+ * block, and a Bloom filter, that prevents most of the lookups. To bound the number of
+ * lookups per record the runs are merged into a single run when the maximum number of
+ * runs is reached.
+ */
+
+/* Creates a duplicate index
+ * Make sure the value duplicate_index is referencing, is set to NULL
+ * The memory limit bounds the memory used by the duplicate filter and the Bloom filters
+ * Returns 1 if successful or -1 on error
+ */
+int duplicate_index_initialize(
+     duplicate_index_t **duplicate_index,
+     size_t memory_limit,
+     libcerror_error_t **error )
+{
+	static char *function            = "duplicate_index_initialize";
+	size_t hash_table_memory         = 0;
+	size_t maximum_hash_table_memory = 0;
+	uint32_t hash_table_size         = 0;
+
+	if( duplicate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *duplicate_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid duplicate index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hash table of the duplicate filter has 2 entries per record and is doubled in size
+	 * when the records no longer fit, hence requires 1.5 times its size while it is doubled.
+	 * Up to half of the memory limit is used by the hash table, the remainder by the Bloom
+	 * filters of the runs, which require far less memory per record.
+	 */
+	maximum_hash_table_memory = memory_limit / 2;
+	hash_table_size           = DUPLICATE_INDEX_INITIAL_HASH_TABLE_SIZE;
+
+	while( ( hash_table_size < (uint32_t) 0x80000000UL )
+	    && ( (size_t) hash_table_size <= ( maximum_hash_table_memory / ( 3 * DUPLICATE_INDEX_HASH_TABLE_ENTRY_SIZE ) ) ) )
+	{
+		hash_table_size *= 2;
+	}
+	hash_table_memory = (size_t) ( hash_table_size / 2 ) * 3 * DUPLICATE_INDEX_HASH_TABLE_ENTRY_SIZE;
+
+	if( ( hash_table_memory + DUPLICATE_INDEX_SPILL_BLOCK_SIZE ) > memory_limit )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid memory limit value too small.",
+		 function );
+
+		return( -1 );
+	}
+	*duplicate_index = memory_allocate_structure(
+	                    duplicate_index_t );
+
+	if( *duplicate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create duplicate index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *duplicate_index,
+	     0,
+	     sizeof( duplicate_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear duplicate index.",
+		 function );
+
+		memory_free(
+		 *duplicate_index );
+
+		*duplicate_index = NULL;
+
+		return( -1 );
+	}
+	( *duplicate_index )->block_buffer_size = DUPLICATE_INDEX_SPILL_BLOCK_SIZE;
+
+	( *duplicate_index )->block_buffer = (uint8_t *) memory_allocate(
+	                                                  sizeof( uint8_t ) * ( *duplicate_index )->block_buffer_size );
+
+	if( ( *duplicate_index )->block_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libftxf_duplicate_filter_initialize(
+	     &( ( *duplicate_index )->duplicate_filter ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create duplicate filter.",
+		 function );
+
+		goto on_error;
+	}
+	/* The duplicate filter keeps its hash table at a load factor of at most 0.5
+	 */
+	( *duplicate_index )->maximum_number_of_records = hash_table_size / 2;
+	( *duplicate_index )->maximum_run_indexes_size  = memory_limit - ( hash_table_memory + DUPLICATE_INDEX_SPILL_BLOCK_SIZE );
+	( *duplicate_index )->memory_limit              = memory_limit;
+
+	return( 1 );
+
+on_error:
+	if( *duplicate_index != NULL )
+	{
+		if( ( *duplicate_index )->block_buffer != NULL )
+		{
+			memory_free(
+			 ( *duplicate_index )->block_buffer );
+		}
+		memory_free(
+		 *duplicate_index );
+
+		*duplicate_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a duplicate index
+ * The temporary files of the runs are closed, which removes them
+ * Returns 1 if successful or -1 on error
+ */
+int duplicate_index_free(
+     duplicate_index_t **duplicate_index,
+     libcerror_error_t **error )
+{
+	static char *function = "duplicate_index_free";
+	int result            = 1;
+	int run_index         = 0;
+
+	if( duplicate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *duplicate_index != NULL )
+	{
+		for( run_index = 0;
+		     run_index < ( *duplicate_index )->number_of_runs;
+		     run_index++ )
+		{
+			file_stream_close(
+			 ( *duplicate_index )->runs[ run_index ].stream );
+
+			duplicate_index_run_free_indexes(
+			 &( ( *duplicate_index )->runs[ run_index ] ) );
+		}
+		if( libftxf_duplicate_filter_free(
+		     &( ( *duplicate_index )->duplicate_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free duplicate filter.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *duplicate_index )->block_buffer );
+
+		memory_free(
+		 *duplicate_index );
+
+		*duplicate_index = NULL;
+	}
+	return( result );
+}
+
+/* Creates the block hashes and Bloom filter of a run
+ * The block hashes are created before the Bloom filter since they require far less memory,
+ * an index is not created if it does not fit in the memory limit
+ * Returns 1 if successful or -1 on error
+ */
+int duplicate_index_run_initialize_indexes(
+     duplicate_index_t *duplicate_index,
+     duplicate_index_run_t *run,
+     uint32_t number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function     = "duplicate_index_run_initialize_indexes";
+	size_t block_hashes_size  = 0;
+	size_t bloom_filter_size  = 0;
+	uint32_t number_of_blocks = 0;
+
+	if( duplicate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( run->block_hashes != NULL )
+	 || ( run->bloom_filter != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid run - indexes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks  = ( number_of_entries / DUPLICATE_INDEX_RUN_BLOCK_NUMBER_OF_ENTRIES ) + 1;
+	block_hashes_size = sizeof( uint64_t ) * number_of_blocks;
+
+	if( ( duplicate_index->run_indexes_size + block_hashes_size ) <= duplicate_index->maximum_run_indexes_size )
+	{
+		run->block_hashes = (uint64_t *) memory_allocate(
+		                                  block_hashes_size );
+
+		if( run->block_hashes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block hashes.",
+			 function );
+
+			return( -1 );
+		}
+		duplicate_index->run_indexes_size += block_hashes_size;
+	}
+	/* The Bloom filter has at least 8 bits per entry
+	 */
+	bloom_filter_size = 1;
+
+	while( bloom_filter_size < (size_t) number_of_entries )
+	{
+		bloom_filter_size *= 2;
+	}
+	if( ( duplicate_index->run_indexes_size + bloom_filter_size ) <= duplicate_index->maximum_run_indexes_size )
+	{
+		run->bloom_filter = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * bloom_filter_size );
+
+		if( run->bloom_filter == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create Bloom filter.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     run->bloom_filter,
+		     0,
+		     sizeof( uint8_t ) * bloom_filter_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear Bloom filter.",
+			 function );
+
+			return( -1 );
+		}
+		run->bloom_filter_size = bloom_filter_size;
+
+		duplicate_index->run_indexes_size += bloom_filter_size;
+	}
+	return( 1 );
+}
+
+/* Frees the block hashes and Bloom filter of a run
+ */
+void duplicate_index_run_free_indexes(
+     duplicate_index_run_t *run )
+{
+	if( run->block_hashes != NULL )
+	{
+		memory_free(
+		 run->block_hashes );
+
+		run->block_hashes = NULL;
+	}
+	if( run->bloom_filter != NULL )
+	{
+		memory_free(
+		 run->bloom_filter );
+
+		run->bloom_filter = NULL;
+	}
+	run->number_of_blocks  = 0;
+	run->bloom_filter_size = 0;
+}
+
+/* Adds the content hash of an entry, in sorted order, to the block hashes and Bloom filter of a run
+ */
+void duplicate_index_run_index_entry(
+     duplicate_index_run_t *run,
+     uint32_t entry_index,
+     uint64_t content_hash )
+{
+	uint64_t bit_index = 0;
+	uint64_t bit_mask  = 0;
+	uint64_t hash_step = 0;
+	int hash_index     = 0;
+
+	if( ( run->block_hashes != NULL )
+	 && ( ( entry_index % DUPLICATE_INDEX_RUN_BLOCK_NUMBER_OF_ENTRIES ) == 0 ) )
+	{
+		run->block_hashes[ entry_index / DUPLICATE_INDEX_RUN_BLOCK_NUMBER_OF_ENTRIES ] = content_hash;
+
+		run->number_of_blocks = ( entry_index / DUPLICATE_INDEX_RUN_BLOCK_NUMBER_OF_ENTRIES ) + 1;
+	}
+	if( run->bloom_filter != NULL )
+	{
+		bit_mask  = ( (uint64_t) run->bloom_filter_size * 8 ) - 1;
+		hash_step = ( content_hash >> 32 ) | 1;
+		bit_index = content_hash;
+
+		for( hash_index = 0;
+		     hash_index < DUPLICATE_INDEX_BLOOM_FILTER_NUMBER_OF_HASHES;
+		     hash_index++ )
+		{
+			run->bloom_filter[ ( bit_index & bit_mask ) / 8 ] |= (uint8_t) ( 1 << ( bit_index & 7 ) );
+
+			bit_index += hash_step;
+		}
+	}
+}
+
+/* Checks if the content hash is possibly stored in the run by means of its Bloom filter
+ * Returns 1 if the content hash is possibly stored in the run or 0 if not
+ */
+int duplicate_index_run_check_bloom_filter(
+     duplicate_index_run_t *run,
+     uint64_t content_hash )
+{
+	uint64_t bit_index = 0;
+	uint64_t bit_mask  = 0;
+	uint64_t hash_step = 0;
+	int hash_index     = 0;
+
+	if( run->bloom_filter == NULL )
+	{
+		return( 1 );
+	}
+	bit_mask  = ( (uint64_t) run->bloom_filter_size * 8 ) - 1;
+	hash_step = ( content_hash >> 32 ) | 1;
+	bit_index = content_hash;
+
+	for( hash_index = 0;
+	     hash_index < DUPLICATE_INDEX_BLOOM_FILTER_NUMBER_OF_HASHES;
+	     hash_index++ )
+	{
+		if( ( run->bloom_filter[ ( bit_index & bit_mask ) / 8 ] & (uint8_t) ( 1 << ( bit_index & 7 ) ) ) == 0 )
+		{
+			return( 0 );
+		}
+		bit_index += hash_step;
+	}
+	return( 1 );
+}
+
+/* Reads entries of the run
+ * Returns 1 if successful or -1 on error
+ */
+int duplicate_index_run_read_entries(
+     duplicate_index_run_t *run,
+     uint32_t first_entry_index,
+     uint8_t *entries_data,
+     uint32_t number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "duplicate_index_run_read_entries";
+	size_t read_count     = 0;
+	size_t read_size      = 0;
+
+	if( run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_entry_index > run->number_of_entries )
+	 || ( number_of_entries > ( run->number_of_entries - first_entry_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_OFF_T <= 4
+	if( first_entry_index > ( (uint32_t) INT32_MAX / LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( file_stream_seek_offset(
+	     run->stream,
+	     (off_t) first_entry_index * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek entry: %" PRIu32 ".",
+		 function,
+		 first_entry_index );
+
+		return( -1 );
+	}
+	read_size = (size_t) number_of_entries * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE;
+
+	read_count = file_stream_read(
+	              run->stream,
+	              entries_data,
+	              read_size );
+
+	if( read_count != read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Finds the content hash and size of a record in the run
+ * If the run has block hashes only the blocks that can contain the entry are read,
+ * otherwise a binary search is done over the entries in the temporary file
+ * The block buffer must be able to contain the entries of a block
+ * Returns 1 if found, 0 if not or -1 on error
+ */
+int duplicate_index_run_find_entry(
+     duplicate_index_run_t *run,
+     uint64_t content_hash,
+     uint32_t record_size,
+     uint8_t *block_buffer,
+     libcerror_error_t **error )
+{
+	static char *function      = "duplicate_index_run_find_entry";
+	size_t byte_stream_offset  = 0;
+	uint64_t entry_hash        = 0;
+	uint32_t block_index       = 0;
+	uint32_t entry_index       = 0;
+	uint32_t entry_size        = 0;
+	uint32_t lower_bound       = 0;
+	uint32_t number_of_entries = 0;
+	uint32_t upper_bound       = 0;
+
+	if( run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run.",
+		 function );
+
+		return( -1 );
+	}
+	if( run->block_hashes != NULL )
+	{
+		/* Find the first block that can contain the entry, which is the last block
+		 * with a first content hash less than the content hash
+		 */
+		upper_bound = run->number_of_blocks;
+
+		while( lower_bound < upper_bound )
+		{
+			block_index = lower_bound + ( ( upper_bound - lower_bound ) / 2 );
+
+			if( run->block_hashes[ block_index ] < content_hash )
+			{
+				lower_bound = block_index + 1;
+			}
+			else
+			{
+				upper_bound = block_index;
+			}
+		}
+		block_index = ( lower_bound > 0 ) ? lower_bound - 1 : 0;
+
+		while( block_index < run->number_of_blocks )
+		{
+			if( run->block_hashes[ block_index ] > content_hash )
+			{
+				break;
+			}
+			entry_index       = block_index * DUPLICATE_INDEX_RUN_BLOCK_NUMBER_OF_ENTRIES;
+			number_of_entries = run->number_of_entries - entry_index;
+
+			if( number_of_entries > DUPLICATE_INDEX_RUN_BLOCK_NUMBER_OF_ENTRIES )
+			{
+				number_of_entries = DUPLICATE_INDEX_RUN_BLOCK_NUMBER_OF_ENTRIES;
+			}
+			if( duplicate_index_run_read_entries(
+			     run,
+			     entry_index,
+			     block_buffer,
+			     number_of_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read block: %" PRIu32 ".",
+				 function,
+				 block_index );
+
+				return( -1 );
+			}
+			for( byte_stream_offset = 0;
+			     byte_stream_offset < ( (size_t) number_of_entries * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE );
+			     byte_stream_offset += LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( block_buffer[ byte_stream_offset ] ),
+				 entry_hash );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 &( block_buffer[ byte_stream_offset + 8 ] ),
+				 entry_size );
+
+				if( ( entry_hash > content_hash )
+				 || ( ( entry_hash == content_hash )
+				  && ( entry_size > record_size ) ) )
+				{
+					return( 0 );
+				}
+				if( ( entry_hash == content_hash )
+				 && ( entry_size == record_size ) )
+				{
+					return( 1 );
+				}
+			}
+			block_index++;
+		}
+		return( 0 );
+	}
+	upper_bound = run->number_of_entries;
+
+	while( lower_bound < upper_bound )
+	{
+		entry_index = lower_bound + ( ( upper_bound - lower_bound ) / 2 );
+
+		if( duplicate_index_run_read_entries(
+		     run,
+		     entry_index,
+		     block_buffer,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entry: %" PRIu32 ".",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 block_buffer,
+		 entry_hash );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( block_buffer[ 8 ] ),
+		 entry_size );
+
+		if( ( entry_hash == content_hash )
+		 && ( entry_size == record_size ) )
+		{
+			return( 1 );
+		}
+		if( ( entry_hash < content_hash )
+		 || ( ( entry_hash == content_hash )
+		  && ( entry_size < record_size ) ) )
+		{
+			lower_bound = entry_index + 1;
+		}
+		else
+		{
+			upper_bound = entry_index;
+		}
+	}
+	return( 0 );
+}
+
+/* Sorts the entries of the duplicate filter and writes them to a temporary file
+ * The runs are merged into a single run when the maximum number of runs is reached
+ * Returns 1 if successful or -1 on error
+ */
+int duplicate_index_spill_run(
+     duplicate_index_t *duplicate_index,
+     libcerror_error_t **error )
+{
+	duplicate_index_run_t *run        = NULL;
+	static char *function             = "duplicate_index_spill_run";
+	size_t byte_stream_offset         = 0;
+	size_t write_count                = 0;
+	uint64_t content_hash             = 0;
+	uint32_t copied_entry_index       = 0;
+	uint32_t entry_index              = 0;
+	uint32_t number_of_copied_entries = 0;
+	uint32_t number_of_entries        = 0;
+
+	if( duplicate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( duplicate_index->number_of_runs >= DUPLICATE_INDEX_MAXIMUM_NUMBER_OF_RUNS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid duplicate index - number of runs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries = duplicate_index->number_of_records;
+
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( libftxf_duplicate_filter_sort(
+	     duplicate_index->duplicate_filter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	run = &( duplicate_index->runs[ duplicate_index->number_of_runs ] );
+
+	if( memory_set(
+	     run,
+	     0,
+	     sizeof( duplicate_index_run_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear run.",
+		 function );
+
+		return( -1 );
+	}
+	run->stream = tmpfile();
+
+	if( run->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create temporary file.",
+		 function );
+
+		return( -1 );
+	}
+	duplicate_index->number_of_runs += 1;
+
+	if( duplicate_index_run_initialize_indexes(
+	     duplicate_index,
+	     run,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create run indexes.",
+		 function );
+
+		return( -1 );
+	}
+	while( entry_index < number_of_entries )
+	{
+		if( libftxf_duplicate_filter_copy_to_byte_stream(
+		     duplicate_index->duplicate_filter,
+		     entry_index,
+		     duplicate_index->block_buffer,
+		     duplicate_index->block_buffer_size,
+		     &number_of_copied_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy entries.",
+			 function );
+
+			return( -1 );
+		}
+		write_count = file_stream_write(
+		               run->stream,
+		               duplicate_index->block_buffer,
+		               (size_t) number_of_copied_entries * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE );
+
+		if( write_count != ( (size_t) number_of_copied_entries * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write run.",
+			 function );
+
+			return( -1 );
+		}
+		for( copied_entry_index = 0;
+		     copied_entry_index < number_of_copied_entries;
+		     copied_entry_index++ )
+		{
+			byte_stream_offset = (size_t) copied_entry_index * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE;
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( duplicate_index->block_buffer[ byte_stream_offset ] ),
+			 content_hash );
+
+			duplicate_index_run_index_entry(
+			 run,
+			 entry_index + copied_entry_index,
+			 content_hash );
+		}
+		entry_index += number_of_copied_entries;
+	}
+	run->number_of_entries = number_of_entries;
+
+	if( libftxf_duplicate_filter_empty(
+	     duplicate_index->duplicate_filter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to empty duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	duplicate_index->number_of_records = 0;
+
+	if( duplicate_index->number_of_runs >= DUPLICATE_INDEX_MAXIMUM_NUMBER_OF_RUNS )
+	{
+		if( duplicate_index_merge_runs(
+		     duplicate_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to merge runs.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Merges the runs into a single run
+ * The block buffer is divided over the runs to read their entries in blocks,
+ * entries that are stored in multiple runs are written once
+ * Returns 1 if successful or -1 on error
+ */
+int duplicate_index_merge_runs(
+     duplicate_index_t *duplicate_index,
+     libcerror_error_t **error )
+{
+	uint32_t buffer_entry_indexes[ DUPLICATE_INDEX_MAXIMUM_NUMBER_OF_RUNS ];
+	uint32_t buffer_number_of_entries[ DUPLICATE_INDEX_MAXIMUM_NUMBER_OF_RUNS ];
+	uint32_t read_entry_indexes[ DUPLICATE_INDEX_MAXIMUM_NUMBER_OF_RUNS ];
+
+	duplicate_index_run_t merged_run;
+
+	uint8_t *entry_data                       = NULL;
+	static char *function                     = "duplicate_index_merge_runs";
+	size_t write_count                        = 0;
+	uint64_t content_hash                     = 0;
+	uint64_t last_content_hash                = 0;
+	uint64_t minimum_content_hash             = 0;
+	uint32_t buffer_maximum_number_of_entries = 0;
+	uint32_t last_record_size                 = 0;
+	uint32_t minimum_record_size              = 0;
+	uint32_t number_of_entries                = 0;
+	uint32_t number_of_merged_entries         = 0;
+	uint32_t record_size                      = 0;
+	int minimum_run_index                     = 0;
+	int run_index                             = 0;
+
+	if( duplicate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( duplicate_index->number_of_runs <= 1 )
+	{
+		return( 1 );
+	}
+	if( memory_set(
+	     &merged_run,
+	     0,
+	     sizeof( duplicate_index_run_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear merged run.",
+		 function );
+
+		return( -1 );
+	}
+	/* The indexes of the runs are freed first so that the memory limit can be used
+	 * for the indexes of the merged run
+	 */
+	for( run_index = 0;
+	     run_index < duplicate_index->number_of_runs;
+	     run_index++ )
+	{
+		duplicate_index_run_free_indexes(
+		 &( duplicate_index->runs[ run_index ] ) );
+
+		if( duplicate_index->runs[ run_index ].number_of_entries > ( (uint32_t) UINT32_MAX - number_of_entries ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_entries += duplicate_index->runs[ run_index ].number_of_entries;
+
+		buffer_entry_indexes[ run_index ]     = 0;
+		buffer_number_of_entries[ run_index ] = 0;
+		read_entry_indexes[ run_index ]       = 0;
+	}
+	duplicate_index->run_indexes_size = 0;
+
+	buffer_maximum_number_of_entries = (uint32_t) ( ( duplicate_index->block_buffer_size / duplicate_index->number_of_runs ) / LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE );
+
+	merged_run.stream = tmpfile();
+
+	if( merged_run.stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	if( duplicate_index_run_initialize_indexes(
+	     duplicate_index,
+	     &merged_run,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create merged run indexes.",
+		 function );
+
+		goto on_error;
+	}
+	while( number_of_merged_entries < number_of_entries )
+	{
+		minimum_run_index = -1;
+
+		for( run_index = 0;
+		     run_index < duplicate_index->number_of_runs;
+		     run_index++ )
+		{
+			if( buffer_entry_indexes[ run_index ] >= buffer_number_of_entries[ run_index ] )
+			{
+				if( read_entry_indexes[ run_index ] >= duplicate_index->runs[ run_index ].number_of_entries )
+				{
+					continue;
+				}
+				buffer_number_of_entries[ run_index ] = duplicate_index->runs[ run_index ].number_of_entries - read_entry_indexes[ run_index ];
+
+				if( buffer_number_of_entries[ run_index ] > buffer_maximum_number_of_entries )
+				{
+					buffer_number_of_entries[ run_index ] = buffer_maximum_number_of_entries;
+				}
+				if( duplicate_index_run_read_entries(
+				     &( duplicate_index->runs[ run_index ] ),
+				     read_entry_indexes[ run_index ],
+				     &( duplicate_index->block_buffer[ (size_t) run_index * buffer_maximum_number_of_entries * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE ] ),
+				     buffer_number_of_entries[ run_index ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read entries of run: %d.",
+					 function,
+					 run_index );
+
+					goto on_error;
+				}
+				read_entry_indexes[ run_index ] += buffer_number_of_entries[ run_index ];
+				buffer_entry_indexes[ run_index ] = 0;
+			}
+			entry_data = &( duplicate_index->block_buffer[ ( (size_t) run_index * buffer_maximum_number_of_entries + buffer_entry_indexes[ run_index ] ) * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE ] );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 entry_data,
+			 content_hash );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( entry_data[ 8 ] ),
+			 record_size );
+
+			if( ( minimum_run_index == -1 )
+			 || ( content_hash < minimum_content_hash )
+			 || ( ( content_hash == minimum_content_hash )
+			  && ( record_size < minimum_record_size ) ) )
+			{
+				minimum_content_hash = content_hash;
+				minimum_record_size  = record_size;
+				minimum_run_index    = run_index;
+			}
+		}
+		if( minimum_run_index == -1 )
+		{
+			break;
+		}
+		entry_data = &( duplicate_index->block_buffer[ ( (size_t) minimum_run_index * buffer_maximum_number_of_entries + buffer_entry_indexes[ minimum_run_index ] ) * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE ] );
+
+		buffer_entry_indexes[ minimum_run_index ] += 1;
+		number_of_merged_entries                  += 1;
+
+		/* Entries that are stored in multiple runs are written once
+		 */
+		if( ( merged_run.number_of_entries > 0 )
+		 && ( minimum_content_hash == last_content_hash )
+		 && ( minimum_record_size == last_record_size ) )
+		{
+			continue;
+		}
+		write_count = file_stream_write(
+		               merged_run.stream,
+		               entry_data,
+		               LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE );
+
+		if( write_count != LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write merged run.",
+			 function );
+
+			goto on_error;
+		}
+		duplicate_index_run_index_entry(
+		 &merged_run,
+		 merged_run.number_of_entries,
+		 minimum_content_hash );
+
+		merged_run.number_of_entries += 1;
+
+		last_content_hash = minimum_content_hash;
+		last_record_size  = minimum_record_size;
+	}
+	for( run_index = 0;
+	     run_index < duplicate_index->number_of_runs;
+	     run_index++ )
+	{
+		file_stream_close(
+		 duplicate_index->runs[ run_index ].stream );
+	}
+	duplicate_index->runs[ 0 ]      = merged_run;
+	duplicate_index->number_of_runs = 1;
+
+	return( 1 );
+
+on_error:
+	if( merged_run.stream != NULL )
+	{
+		file_stream_close(
+		 merged_run.stream );
+	}
+	duplicate_index_run_free_indexes(
+	 &merged_run );
+
+	return( -1 );
+}
+
+/* Checks if the record in the byte stream is a duplicate of a record that was checked before
+ * The duplicate filter is written to a temporary file when it is full
+ * Returns 1 if the record is a duplicate, 0 if not or -1 on error
+ */
+int duplicate_index_check_byte_stream(
+     duplicate_index_t *duplicate_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "duplicate_index_check_byte_stream";
+	uint64_t content_hash = 0;
+	uint32_t record_size  = 0;
+	int result            = 0;
+	int run_index         = 0;
+
+	if( duplicate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_duplicate_filter_calculate_entry(
+	     byte_stream,
+	     byte_stream_size,
+	     &content_hash,
+	     &record_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libftxf_duplicate_filter_check_entry(
+	          duplicate_index->duplicate_filter,
+	          content_hash,
+	          record_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	/* The entry was added to the duplicate filter
+	 */
+	duplicate_index->number_of_records += 1;
+
+	for( run_index = 0;
+	     run_index < duplicate_index->number_of_runs;
+	     run_index++ )
+	{
+		if( duplicate_index_run_check_bloom_filter(
+		     &( duplicate_index->runs[ run_index ] ),
+		     content_hash ) == 0 )
+		{
+			continue;
+		}
+		result = duplicate_index_run_find_entry(
+		          &( duplicate_index->runs[ run_index ] ),
+		          content_hash,
+		          record_size,
+		          duplicate_index->block_buffer,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to find entry in run: %d.",
+			 function,
+			 run_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
+	}
+	if( duplicate_index->number_of_records >= duplicate_index->maximum_number_of_records )
+	{
+		if( duplicate_index_spill_run(
+		     duplicate_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to spill run.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
@@ -0,0 +1,199 @@
+/*
+ * Duplicate index
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DUPLICATE_INDEX_H )
+#define _DUPLICATE_INDEX_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libftxf.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the blocks in which a run is written to its temporary file
+ */
+#define DUPLICATE_INDEX_SPILL_BLOCK_SIZE		4096 * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE
+
+/* The maximum number of runs, when reached the runs are merged into a single run
+ */
+#define DUPLICATE_INDEX_MAXIMUM_NUMBER_OF_RUNS		16
+
+/* The size of an entry of the hash table of the duplicate filter
+ */
+#define DUPLICATE_INDEX_HASH_TABLE_ENTRY_SIZE		16
+
+/* The initial size of the hash table of the duplicate filter
+ */
+#define DUPLICATE_INDEX_INITIAL_HASH_TABLE_SIZE		4096
+
+/* The number of entries of a block of a run
+ */
+#define DUPLICATE_INDEX_RUN_BLOCK_NUMBER_OF_ENTRIES	256
+
+/* The number of bits of a Bloom filter that are set per entry
+ */
+#define DUPLICATE_INDEX_BLOOM_FILTER_NUMBER_OF_HASHES	4
+
+typedef struct duplicate_index_run duplicate_index_run_t;
+
+struct duplicate_index_run
+{
+	/* The stream of the temporary file
+	 */
+	FILE *stream;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The Bloom filter
+	 * Contains NULL if the memory limit did not allow for a Bloom filter
+	 */
+	uint8_t *bloom_filter;
+
+	/* The Bloom filter size
+	 * Contains a power of 2
+	 */
+	size_t bloom_filter_size;
+
+	/* The content hashes of the first entry of every block
+	 * Contains NULL if the memory limit did not allow for the block hashes
+	 */
+	uint64_t *block_hashes;
+
+	/* The number of blocks
+	 */
+	uint32_t number_of_blocks;
+};
+
+typedef struct duplicate_index duplicate_index_t;
+
+struct duplicate_index
+{
+	/* The memory limit
+	 */
+	size_t memory_limit;
+
+	/* The duplicate filter
+	 * Contains the entries that have not been written to a temporary file
+	 */
+	libftxf_duplicate_filter_t *duplicate_filter;
+
+	/* The number of records in the duplicate filter
+	 */
+	uint32_t number_of_records;
+
+	/* The maximum number of records in the duplicate filter
+	 */
+	uint32_t maximum_number_of_records;
+
+	/* The runs
+	 * Contains the temporary files of the sorted runs
+	 */
+	duplicate_index_run_t runs[ DUPLICATE_INDEX_MAXIMUM_NUMBER_OF_RUNS ];
+
+	/* The number of runs
+	 */
+	int number_of_runs;
+
+	/* The size of the Bloom filters and block hashes of the runs
+	 */
+	size_t run_indexes_size;
+
+	/* The maximum size of the Bloom filters and block hashes of the runs
+	 */
+	size_t maximum_run_indexes_size;
+
+	/* The block buffer
+	 */
+	uint8_t *block_buffer;
+
+	/* The block buffer size
+	 */
+	size_t block_buffer_size;
+};
+
+int duplicate_index_initialize(
+     duplicate_index_t **duplicate_index,
+     size_t memory_limit,
+     libcerror_error_t **error );
+
+int duplicate_index_free(
+     duplicate_index_t **duplicate_index,
+     libcerror_error_t **error );
+
+int duplicate_index_run_initialize_indexes(
+     duplicate_index_t *duplicate_index,
+     duplicate_index_run_t *run,
+     uint32_t number_of_entries,
+     libcerror_error_t **error );
+
+void duplicate_index_run_free_indexes(
+     duplicate_index_run_t *run );
+
+void duplicate_index_run_index_entry(
+     duplicate_index_run_t *run,
+     uint32_t entry_index,
+     uint64_t content_hash );
+
+int duplicate_index_run_check_bloom_filter(
+     duplicate_index_run_t *run,
+     uint64_t content_hash );
+
+int duplicate_index_run_read_entries(
+     duplicate_index_run_t *run,
+     uint32_t first_entry_index,
+     uint8_t *entries_data,
+     uint32_t number_of_entries,
+     libcerror_error_t **error );
+
+int duplicate_index_run_find_entry(
+     duplicate_index_run_t *run,
+     uint64_t content_hash,
+     uint32_t record_size,
+     uint8_t *block_buffer,
+     libcerror_error_t **error );
+
+int duplicate_index_spill_run(
+     duplicate_index_t *duplicate_index,
+     libcerror_error_t **error );
+
+int duplicate_index_merge_runs(
+     duplicate_index_t *duplicate_index,
+     libcerror_error_t **error );
+
+int duplicate_index_check_byte_stream(
+     duplicate_index_t *duplicate_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DUPLICATE_INDEX_H ) */
+
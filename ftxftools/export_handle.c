@@ -0,0 +1,3228 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "export_handle.h"
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libcnotify.h"
+#include "ftxftools_libcthreads.h"
+#include "ftxftools_libftxf.h"
+#include "record_buffer.h"
+#include "reorder_buffer.h"
+#include "sqlite_writer.h"
+
+/* Creates an export handle
+ * Make sure the value export_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_initialize";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*export_handle = memory_allocate_structure(
+	                  export_handle_t );
+
+	if( *export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_handle,
+	     0,
+	     sizeof( export_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export handle.",
+		 function );
+
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+
+		return( -1 );
+	}
+	if( libftxf_record_initialize(
+	     &( ( *export_handle )->record ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_handle )->output_buffer_size = EXPORT_HANDLE_BUFFER_SIZE;
+
+	( *export_handle )->output_buffer = (uint8_t *) memory_allocate(
+	                                                 sizeof( uint8_t ) * ( *export_handle )->output_buffer_size );
+
+	if( ( *export_handle )->output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_handle )->export_format = EXPORT_FORMAT_JSONL;
+	( *export_handle )->memory_limit  = EXPORT_HANDLE_DEFAULT_MEMORY_LIMIT * 1024 * 1024;
+	( *export_handle )->notify_stream = stderr;
+
+	return( 1 );
+
+on_error:
+	if( *export_handle != NULL )
+	{
+		if( ( *export_handle )->record != NULL )
+		{
+			libftxf_record_free(
+			 &( ( *export_handle )->record ),
+			 NULL );
+		}
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_free";
+	int input_source_index = 0;
+	int result             = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		if( libftxf_record_free(
+		     &( ( *export_handle )->record ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *export_handle )->column_writer != NULL )
+		{
+			if( libftxf_column_writer_free(
+			     &( ( *export_handle )->column_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free column writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->timeline_writer != NULL )
+		{
+			if( timeline_writer_free(
+			     &( ( *export_handle )->timeline_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free timeline writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->duplicate_index != NULL )
+		{
+			if( duplicate_index_free(
+			     &( ( *export_handle )->duplicate_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free duplicate index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->name_search != NULL )
+		{
+			if( libftxf_name_search_free(
+			     &( ( *export_handle )->name_search ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free name search.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBSQLITE3 )
+		if( ( *export_handle )->sqlite_writer != NULL )
+		{
+			if( sqlite_writer_free(
+			     &( ( *export_handle )->sqlite_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SQLite writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *export_handle )->input_sources != NULL )
+		{
+			for( input_source_index = 0;
+			     input_source_index < ( *export_handle )->number_of_input_sources;
+			     input_source_index++ )
+			{
+				if( input_source_free(
+				     &( ( *export_handle )->input_sources[ input_source_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free input source: %d.",
+					 function,
+					 input_source_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *export_handle )->input_sources );
+		}
+		memory_free(
+		 ( *export_handle )->output_buffer );
+
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the export handle to abort
+ * The export stops before the next record that is read is exported
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_signal_abort";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the export format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_export_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_export_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "jsonl" ),
+		     5 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_JSONL;
+			result                       = 1;
+		}
+	}
+#if defined( HAVE_LIBSQLITE3 )
+	else if( string_length == 6 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "sqlite" ),
+		     6 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_SQLITE;
+			result                       = 1;
+		}
+	}
+#endif
+	else if( string_length == 8 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "columnar" ),
+		     8 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_COLUMNAR;
+			result                       = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "timeline" ),
+		          8 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_TIMELINE;
+			result                       = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the name pattern
+ * The pattern is matched case-insensitive and supports the * and ? wildcards
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_name_pattern(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_name_pattern";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->name_search != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - name search value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( libftxf_name_search_initialize(
+	     &( export_handle->name_search ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create name search.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libftxf_name_search_set_utf16_pattern(
+	          export_handle->name_search,
+	          (uint16_t *) string,
+	          string_length,
+	          error );
+#else
+	result = libftxf_name_search_set_utf8_pattern(
+	          export_handle->name_search,
+	          (uint8_t *) string,
+	          string_length,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name pattern.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( export_handle->name_search != NULL )
+	{
+		libftxf_name_search_free(
+		 &( export_handle->name_search ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the export handle to skip duplicate records
+ * Records with the same content hash and size as a record that was read before are skipped
+ * before they are copied
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_skip_duplicates(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_skip_duplicates";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->skip_duplicates = 1;
+
+	return( 1 );
+}
+
+/* Sets the memory limit
+ * The memory limit is specified as a decimal number of MiB
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_memory_limit(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_memory_limit";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 6 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		value_64bit *= 10;
+		value_64bit += (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > ( (uint64_t) SSIZE_MAX / ( 1024 * 1024 ) ) ) )
+	{
+		return( 0 );
+	}
+	export_handle->memory_limit = (size_t) value_64bit * 1024 * 1024;
+
+	return( 1 );
+}
+
+/* Sets the time limit
+ * The time limit is specified as a decimal number of seconds, 0 represents no time limit
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_time_limit(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_time_limit";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	uint32_t time_limit   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 9 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		time_limit *= 10;
+		time_limit += (uint32_t) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	export_handle->time_limit = time_limit;
+
+	return( 1 );
+}
+
+/* Sets the export handle to print the status of the export
+ * The status is printed to stderr at most once every second
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_print_status(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_print_status";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->status_stream = stderr;
+
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Sets the number of threads that read records
+ * 0 represents that the records are read by the main thread
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_threads = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 3 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		return( 0 );
+	}
+	export_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Opens an input
+ * Every input is added as an additional input source, the records of multiple
+ * input sources are merged in (header) timestamp order
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	input_source_t **reallocation = NULL;
+	input_source_t *input_source  = NULL;
+	static char *function         = "export_handle_open_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->number_of_input_sources < 0 )
+	 || ( (size_t) export_handle->number_of_input_sources >= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( input_source_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - number of input sources value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_source_initialize(
+	     &input_source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create input source.",
+		 function );
+
+		goto on_error;
+	}
+	if( input_source_open(
+	     input_source,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input source.",
+		 function );
+
+		goto on_error;
+	}
+	reallocation = (input_source_t **) memory_reallocate(
+	                                    export_handle->input_sources,
+	                                    sizeof( input_source_t * ) * ( export_handle->number_of_input_sources + 1 ) );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize input sources.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->input_sources = reallocation;
+
+	export_handle->input_sources[ export_handle->number_of_input_sources ] = input_source;
+
+	export_handle->number_of_input_sources += 1;
+
+	return( 1 );
+
+on_error:
+	if( input_source != NULL )
+	{
+		input_source_free(
+		 &input_source,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the output
+ * The output is written to stdout if filename is NULL, except for the SQLite export format
+ * which requires a filename
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_output";
+
+#if defined( HAVE_LIBSQLITE3 )
+	size_t memory_limit   = 0;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - output stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSQLITE3 )
+	if( export_handle->export_format == EXPORT_FORMAT_SQLITE )
+	{
+		if( filename == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid filename - SQLite export format requires a target file.",
+			 function );
+
+			return( -1 );
+		}
+		if( export_handle->sqlite_writer == NULL )
+		{
+			/* The name pool of the SQLite writer and the duplicate index share the memory limit
+			 */
+			memory_limit = export_handle->memory_limit;
+
+			if( export_handle->skip_duplicates != 0 )
+			{
+				memory_limit /= 2;
+			}
+			if( sqlite_writer_initialize(
+			     &( export_handle->sqlite_writer ),
+			     memory_limit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create SQLite writer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( sqlite_writer_open(
+		     export_handle->sqlite_writer,
+		     filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open SQLite writer.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+	if( filename == NULL )
+	{
+		export_handle->output_stream         = stdout;
+		export_handle->output_stream_is_open = 0;
+
+		return( 1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	export_handle->output_stream = file_stream_open_wide(
+	                                filename,
+	                                _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	export_handle->output_stream = file_stream_open(
+	                                filename,
+	                                FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( export_handle->output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->output_stream_is_open = 1;
+
+	return( 1 );
+}
+
+/* Closes the input and output
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_close";
+	int input_source_index = 0;
+	int result             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( input_source_index = 0;
+	     input_source_index < export_handle->number_of_input_sources;
+	     input_source_index++ )
+	{
+		if( input_source_close(
+		     export_handle->input_sources[ input_source_index ],
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input source: %d.",
+			 function,
+			 input_source_index );
+
+			result = -1;
+		}
+	}
+	if( export_handle->output_stream != NULL )
+	{
+		if( export_handle->output_stream_is_open != 0 )
+		{
+			if( file_stream_close(
+			     export_handle->output_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close output file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( fflush(
+		          export_handle->output_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output stream.",
+			 function );
+
+			result = -1;
+		}
+		export_handle->output_stream         = NULL;
+		export_handle->output_stream_is_open = 0;
+	}
+#if defined( HAVE_LIBSQLITE3 )
+	if( export_handle->sqlite_writer != NULL )
+	{
+		if( sqlite_writer_close(
+		     export_handle->sqlite_writer,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close SQLite writer.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Writes the data in the output buffer to the output stream
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_flush_output_buffer(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_flush_output_buffer";
+	size_t write_count    = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_buffer_index == 0 )
+	{
+		return( 1 );
+	}
+	write_count = file_stream_write(
+	               export_handle->output_stream,
+	               export_handle->output_buffer,
+	               export_handle->output_buffer_index );
+
+	if( write_count != export_handle->output_buffer_index )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->output_buffer_index = 0;
+
+	return( 1 );
+}
+
+/* Writes the current chunk of the column writer to the output buffer
+ * The output buffer is flushed first if the chunk does not fit and grown if the chunk is larger than the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_column_chunk(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "export_handle_write_column_chunk";
+	size_t chunk_size     = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_column_writer_get_chunk_size(
+	     export_handle->column_writer,
+	     &chunk_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == 0 )
+	{
+		return( 1 );
+	}
+	if( chunk_size > ( export_handle->output_buffer_size - export_handle->output_buffer_index ) )
+	{
+		if( export_handle_flush_output_buffer(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( chunk_size > export_handle->output_buffer_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            export_handle->output_buffer,
+		                            sizeof( uint8_t ) * chunk_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->output_buffer      = reallocation;
+		export_handle->output_buffer_size = chunk_size;
+	}
+	if( libftxf_column_writer_copy_chunk_to_byte_stream(
+	     export_handle->column_writer,
+	     &( export_handle->output_buffer[ export_handle->output_buffer_index ] ),
+	     export_handle->output_buffer_size - export_handle->output_buffer_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy chunk.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->output_buffer_index += chunk_size;
+
+	return( 1 );
+}
+
+/* Exports a single record
+ * The record and the output buffer are reused, hence no allocations are needed per record
+ * If threads are started the record is queued
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record(
+     export_handle_t *export_handle,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint64_t record_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_record";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->duplicate_index != NULL )
+	{
+		result = duplicate_index_check_byte_stream(
+		          export_handle->duplicate_index,
+		          record_data,
+		          record_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if record is a duplicate.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			export_handle->number_of_duplicate_records += 1;
+
+			return( 1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->process_thread_pool != NULL )
+	{
+		if( export_handle_queue_record(
+		     export_handle,
+		     0,
+		     record_data,
+		     record_data_size,
+		     record_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to queue record.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+	if( libftxf_record_copy_from_byte_stream(
+	     export_handle->record,
+	     record_data,
+	     record_data_size,
+	     error ) != 1 )
+	{
+		if( export_handle_report_unreadable_record(
+		     export_handle,
+		     0,
+		     record_offset,
+		     error,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( export_handle_write_record(
+	     export_handle,
+	     export_handle->record,
+	     record_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reports a record that could not be read
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_report_unreadable_record(
+     export_handle_t *export_handle,
+     int input_source_index,
+     uint64_t record_offset,
+     libcerror_error_t **read_error,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_report_unreadable_record";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->notify_stream != NULL )
+	{
+		if( export_handle->number_of_input_sources > 1 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Unable to read record at offset: %" PRIu64 " of source: %d.\n",
+			 record_offset,
+			 input_source_index );
+		}
+		else
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Unable to read record: %" PRIu64 ".\n",
+			 export_handle->number_of_exported_records + export_handle->number_of_failed_records + export_handle->number_of_skipped_records );
+		}
+	}
+	if( ( read_error != NULL )
+	 && ( *read_error != NULL ) )
+	{
+		libcnotify_print_error_backtrace(
+		 *read_error );
+
+		libcerror_error_free(
+		 read_error );
+	}
+	export_handle->number_of_failed_records += 1;
+
+	return( 1 );
+}
+
+/* Writes a record as a JSON line, appends it to the current chunk of the columnar export,
+ * inserts it into the SQLite database or appends its timestamps to the timeline
+ * Records with a name that does not match the name pattern are skipped
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_record(
+     export_handle_t *export_handle,
+     libftxf_record_t *record,
+     uint64_t record_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_record";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->name_search != NULL )
+	{
+		/* The name is matched against the UTF-16 little-endian stream
+		 * hence names of records that are skipped are never decoded
+		 */
+		result = libftxf_name_search_match_record(
+		          export_handle->name_search,
+		          record,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to match record name.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			export_handle->number_of_skipped_records += 1;
+
+			return( 1 );
+		}
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_COLUMNAR )
+	{
+		result = libftxf_column_writer_append_record(
+		          export_handle->column_writer,
+		          record,
+		          error );
+
+		if( result == 0 )
+		{
+			if( export_handle_write_column_chunk(
+			     export_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write chunk.",
+				 function );
+
+				return( -1 );
+			}
+			result = libftxf_column_writer_append_record(
+			          export_handle->column_writer,
+			          record,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record to column writer.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->number_of_exported_records += 1;
+
+		return( 1 );
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_TIMELINE )
+	{
+		if( timeline_writer_append_record(
+		     export_handle->timeline_writer,
+		     record,
+		     record_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record to timeline.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->number_of_exported_records += 1;
+
+		return( 1 );
+	}
+#if defined( HAVE_LIBSQLITE3 )
+	if( export_handle->export_format == EXPORT_FORMAT_SQLITE )
+	{
+		if( sqlite_writer_write_record(
+		     export_handle->sqlite_writer,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record to SQLite database.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->number_of_exported_records += 1;
+
+		return( 1 );
+	}
+#endif
+	result = libftxf_record_copy_to_utf8_json_string_with_index(
+	          record,
+	          export_handle->output_buffer,
+	          export_handle->output_buffer_size,
+	          &( export_handle->output_buffer_index ),
+	          error );
+
+	if( result == 0 )
+	{
+		if( export_handle_flush_output_buffer(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		result = libftxf_record_copy_to_utf8_json_string_with_index(
+		          record,
+		          export_handle->output_buffer,
+		          export_handle->output_buffer_size,
+		          &( export_handle->output_buffer_index ),
+		          error );
+
+		if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: output buffer too small.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy record to JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->number_of_exported_records += 1;
+
+	return( 1 );
+}
+
+/* Updates the progress of the export after a record was read
+ * The time limit is checked and the status is printed every EXPORT_HANDLE_PROGRESS_INTERVAL records,
+ * which keeps the overhead of retrieving the time per record low
+ * Returns 1 if the export should continue, 0 if it should stop or -1 on error
+ */
+int export_handle_update_progress(
+     export_handle_t *export_handle,
+     size_t record_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_update_progress";
+	time_t current_time   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->number_of_read_records += 1;
+	export_handle->number_of_read_bytes   += (uint64_t) record_data_size;
+
+	if( export_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	if( ( export_handle->number_of_read_records % EXPORT_HANDLE_PROGRESS_INTERVAL ) != 0 )
+	{
+		return( 1 );
+	}
+	if( ( export_handle->time_limit == 0 )
+	 && ( export_handle->status_stream == NULL ) )
+	{
+		return( 1 );
+	}
+	current_time = time(
+	                NULL );
+
+	if( ( export_handle->time_limit != 0 )
+	 && ( current_time >= export_handle->start_time )
+	 && ( (uint64_t) ( current_time - export_handle->start_time ) > (uint64_t) export_handle->time_limit ) )
+	{
+		export_handle->time_limit_exceeded = 1;
+
+		return( 0 );
+	}
+	if( ( export_handle->status_stream != NULL )
+	 && ( current_time != export_handle->last_status_time ) )
+	{
+		export_handle_print_status(
+		 export_handle,
+		 current_time );
+
+		export_handle->last_status_time = current_time;
+	}
+	return( 1 );
+}
+
+/* Prints the status of the export
+ * The status contains the number of records and bytes read and the throughput
+ */
+void export_handle_print_status(
+      export_handle_t *export_handle,
+      time_t current_time )
+{
+	uint64_t number_of_seconds = 0;
+
+	if( export_handle == NULL )
+	{
+		return;
+	}
+	if( export_handle->status_stream == NULL )
+	{
+		return;
+	}
+	if( current_time > export_handle->start_time )
+	{
+		number_of_seconds = (uint64_t) ( current_time - export_handle->start_time );
+	}
+	fprintf(
+	 export_handle->status_stream,
+	 "Status: read %" PRIu64 " records (%" PRIu64 " bytes) in %" PRIu64 " second(s)",
+	 export_handle->number_of_read_records,
+	 export_handle->number_of_read_bytes,
+	 number_of_seconds );
+
+	if( number_of_seconds > 0 )
+	{
+		fprintf(
+		 export_handle->status_stream,
+		 " with %" PRIu64 " records/second (%" PRIu64 " bytes/second)",
+		 export_handle->number_of_read_records / number_of_seconds,
+		 export_handle->number_of_read_bytes / number_of_seconds );
+	}
+	fprintf(
+	 export_handle->status_stream,
+	 ".\n" );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Starts the threads
+ * The records are exported in a pipeline: the main thread reads the record data
+ * from the input source, the process threads read the records and the output thread
+ * writes them. The stages are connected by bounded queues, when all the record buffers
+ * are in use the main thread waits until the output thread returns one
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_start_threads(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	record_buffer_t *record_buffer = NULL;
+	static char *function          = "export_handle_start_threads";
+	int record_buffer_index        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->record_buffer_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - record buffer queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_queue_initialize(
+	     &( export_handle->record_buffer_queue ),
+	     EXPORT_HANDLE_NUMBER_OF_RECORD_BUFFERS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record buffer queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_buffer_index = 0;
+	     record_buffer_index < EXPORT_HANDLE_NUMBER_OF_RECORD_BUFFERS;
+	     record_buffer_index++ )
+	{
+		if( record_buffer_initialize(
+		     &record_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record buffer: %d.",
+			 function,
+			 record_buffer_index );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_push(
+		     export_handle->record_buffer_queue,
+		     (intptr_t *) record_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push record buffer: %d onto queue.",
+			 function,
+			 record_buffer_index );
+
+			goto on_error;
+		}
+		record_buffer = NULL;
+	}
+	if( reorder_buffer_initialize(
+	     &( export_handle->reorder_buffer ),
+	     EXPORT_HANDLE_NUMBER_OF_RECORD_BUFFERS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create reorder buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( export_handle->reorder_buffer_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create reorder buffer mutex.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->number_of_queued_records = 0;
+	export_handle->threads_abort            = 0;
+
+	/* The queues of the thread pools can contain all the record buffers
+	 * so that pushing a record buffer from one stage onto the next never blocks
+	 */
+	if( libcthreads_thread_pool_create(
+	     &( export_handle->output_thread_pool ),
+	     NULL,
+	     1,
+	     EXPORT_HANDLE_NUMBER_OF_RECORD_BUFFERS,
+	     (int (*)(intptr_t *, void *)) &export_handle_output_record_buffer,
+	     (void *) export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( export_handle->process_thread_pool ),
+	     NULL,
+	     export_handle->number_of_threads,
+	     EXPORT_HANDLE_NUMBER_OF_RECORD_BUFFERS,
+	     (int (*)(intptr_t *, void *)) &export_handle_process_record_buffer,
+	     (void *) export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( export_handle->output_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( export_handle->output_thread_pool ),
+		 NULL );
+	}
+	if( export_handle->reorder_buffer_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( export_handle->reorder_buffer_mutex ),
+		 NULL );
+	}
+	if( export_handle->reorder_buffer != NULL )
+	{
+		reorder_buffer_free(
+		 &( export_handle->reorder_buffer ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &record_buffer_free,
+		 NULL );
+	}
+	if( record_buffer != NULL )
+	{
+		record_buffer_free(
+		 &record_buffer,
+		 NULL );
+	}
+	if( export_handle->record_buffer_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( export_handle->record_buffer_queue ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &record_buffer_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Stops the threads
+ * Waits for the threads to read and write the remaining record buffers
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_stop_threads(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_stop_threads";
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The process thread pool is joined first since its threads push
+	 * the record buffers onto the output thread pool
+	 */
+	if( export_handle->process_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( export_handle->process_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join process thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( export_handle->output_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( export_handle->output_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join output thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( export_handle->reorder_buffer_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( export_handle->reorder_buffer_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free reorder buffer mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* When a process thread failed the record buffers with a higher sequence number
+	 * remain in the reorder buffer
+	 */
+	if( export_handle->reorder_buffer != NULL )
+	{
+		if( reorder_buffer_free(
+		     &( export_handle->reorder_buffer ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &record_buffer_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free reorder buffer.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( export_handle->record_buffer_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( export_handle->record_buffer_queue ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &record_buffer_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record buffer queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The threads have been joined, hence the threads abort value is read without the mutex
+	 */
+	if( ( result == 1 )
+	 && ( export_handle->threads_abort != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: unable to export all records.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Sets the threads abort value
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_threads_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_threads_abort";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     export_handle->reorder_buffer_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab reorder buffer mutex.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->threads_abort = 1;
+
+	if( libcthreads_mutex_release(
+	     export_handle->reorder_buffer_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release reorder buffer mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the threads abort value
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_threads_abort(
+     export_handle_t *export_handle,
+     uint8_t *threads_abort,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_get_threads_abort";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( threads_abort == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid threads abort.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     export_handle->reorder_buffer_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab reorder buffer mutex.",
+		 function );
+
+		return( -1 );
+	}
+	*threads_abort = export_handle->threads_abort;
+
+	if( libcthreads_mutex_release(
+	     export_handle->reorder_buffer_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release reorder buffer mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Queues a record
+ * The record data is copied into a record buffer, which is read by one of the process threads
+ * and written by the output thread
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_queue_record(
+     export_handle_t *export_handle,
+     int input_source_index,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint64_t record_offset,
+     libcerror_error_t **error )
+{
+	record_buffer_t *record_buffer = NULL;
+	static char *function          = "export_handle_queue_record";
+	uint8_t threads_abort          = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->process_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing process thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	/* A thread that fails sets the threads abort value before it returns its record buffer
+	 * to the record buffer queue, hence the main thread stops reading the input instead
+	 * of queueing the remaining records
+	 */
+	if( export_handle_get_threads_abort(
+	     export_handle,
+	     &threads_abort,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve threads abort.",
+		 function );
+
+		return( -1 );
+	}
+	if( threads_abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: unable to queue record - threads aborted.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_queue_pop(
+	     export_handle->record_buffer_queue,
+	     (intptr_t **) &record_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record buffer from queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_buffer_set_data(
+	     record_buffer,
+	     record_data,
+	     record_data_size,
+	     record_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set record buffer data.",
+		 function );
+
+		goto on_error;
+	}
+	record_buffer->input_source_index = input_source_index;
+	record_buffer->sequence_number    = export_handle->number_of_queued_records;
+
+	export_handle->number_of_queued_records += 1;
+
+	if( libcthreads_thread_pool_push(
+	     export_handle->process_thread_pool,
+	     (intptr_t *) record_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push record buffer onto process thread pool queue.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_buffer != NULL )
+	{
+		libcthreads_queue_push(
+		 export_handle->record_buffer_queue,
+		 (intptr_t *) record_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the record in a record buffer
+ * Callback function for the process thread pool
+ * The process threads can finish reading records out of order, hence the record
+ * buffers are inserted into the reorder buffer, which releases them onto the output
+ * thread pool in the order they were queued
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_process_record_buffer(
+     record_buffer_t *record_buffer,
+     export_handle_t *export_handle )
+{
+	libcerror_error_t *error            = NULL;
+	record_buffer_t *next_record_buffer = NULL;
+	static char *function               = "export_handle_process_record_buffer";
+	int result                          = 0;
+
+	if( export_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( record_buffer_read_record(
+	     record_buffer,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to read record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_grab(
+	     export_handle->reorder_buffer_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab reorder buffer mutex.",
+		 function );
+
+		goto on_error;
+	}
+	result = reorder_buffer_insert_value(
+	          export_handle->reorder_buffer,
+	          record_buffer->sequence_number,
+	          (intptr_t *) record_buffer,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert record buffer into reorder buffer.",
+		 function );
+	}
+	else
+	{
+		record_buffer = NULL;
+
+		/* The record buffers are pushed while the mutex is held to preserve their order,
+		 * the output thread pool can contain all the record buffers hence this does not block
+		 */
+		while( result == 1 )
+		{
+			result = reorder_buffer_get_next_value(
+			          export_handle->reorder_buffer,
+			          (intptr_t **) &next_record_buffer,
+			          &error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next record buffer from reorder buffer.",
+				 function );
+			}
+			else if( result == 1 )
+			{
+				if( libcthreads_thread_pool_push(
+				     export_handle->output_thread_pool,
+				     (intptr_t *) next_record_buffer,
+				     &error ) != 1 )
+				{
+					libcerror_error_set(
+					 &error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push record buffer onto output thread pool queue.",
+					 function );
+
+					result = -1;
+				}
+				else
+				{
+					next_record_buffer = NULL;
+				}
+			}
+		}
+	}
+	if( libcthreads_mutex_release(
+	     export_handle->reorder_buffer_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release reorder buffer mutex.",
+		 function );
+
+		result = -1;
+	}
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	export_handle_set_threads_abort(
+	 export_handle,
+	 NULL );
+
+	if( next_record_buffer != NULL )
+	{
+		libcthreads_queue_push(
+		 export_handle->record_buffer_queue,
+		 (intptr_t *) next_record_buffer,
+		 NULL );
+	}
+	if( record_buffer != NULL )
+	{
+		libcthreads_queue_push(
+		 export_handle->record_buffer_queue,
+		 (intptr_t *) record_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the record in a record buffer
+ * Callback function for the output thread pool
+ * The record buffer is returned to the record buffer queue afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_output_record_buffer(
+     record_buffer_t *record_buffer,
+     export_handle_t *export_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "export_handle_output_record_buffer";
+	uint8_t threads_abort    = 0;
+	int result               = 1;
+
+	if( export_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		result = -1;
+	}
+	else if( export_handle_get_threads_abort(
+	          export_handle,
+	          &threads_abort,
+	          &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve threads abort.",
+		 function );
+
+		result = -1;
+	}
+	else if( threads_abort == 0 )
+	{
+		if( record_buffer->read_result != 1 )
+		{
+			result = export_handle_report_unreadable_record(
+			          export_handle,
+			          record_buffer->input_source_index,
+			          record_buffer->record_offset,
+			          &( record_buffer->read_error ),
+			          &error );
+		}
+		else
+		{
+			result = export_handle_write_record(
+			          export_handle,
+			          record_buffer->record,
+			          record_buffer->record_offset,
+			          &error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record.",
+			 function );
+		}
+	}
+	if( result != 1 )
+	{
+		if( error != NULL )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		export_handle_set_threads_abort(
+		 export_handle,
+		 NULL );
+	}
+	if( record_buffer != NULL )
+	{
+		if( libcthreads_queue_push(
+		     export_handle->record_buffer_queue,
+		     (intptr_t *) record_buffer,
+		     NULL ) != 1 )
+		{
+			export_handle_set_threads_abort(
+			 export_handle,
+			 NULL );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Exports the records of multiple input sources in (header) timestamp order
+ * The input sources are read interleaved, one record at a time, and their records
+ * are merged by means of the record merger
+ * If threads are started only the record headers are merged and the records are queued
+ * in merged order, hence the records of all input sources are read by the process
+ * threads, which take the next record buffer from a single shared queue when they
+ * are done, and a large input source does not occupy a single thread
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_merged_records(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	libftxf_record_merger_t *record_merger = NULL;
+	libftxf_record_t *record               = NULL;
+	const uint8_t *record_data             = NULL;
+	static char *function                  = "export_handle_export_merged_records";
+	size_t record_data_size                = 0;
+	uint64_t record_offset                 = 0;
+	int input_source_index                 = 0;
+	int result                             = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	const uint8_t **source_record_data     = NULL;
+	size_t *source_record_data_size        = NULL;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_record_merger_initialize(
+	     &record_merger,
+	     export_handle->number_of_input_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record merger.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->process_thread_pool != NULL )
+	{
+		/* The data of the last record of every input source remains valid until
+		 * the next record of the input source is read
+		 */
+		source_record_data = (const uint8_t **) memory_allocate(
+		                                         sizeof( const uint8_t * ) * export_handle->number_of_input_sources );
+
+		if( source_record_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create source record data.",
+			 function );
+
+			goto on_error;
+		}
+		source_record_data_size = (size_t *) memory_allocate(
+		                                      sizeof( size_t ) * export_handle->number_of_input_sources );
+
+		if( source_record_data_size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create source record data sizes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	while( 1 )
+	{
+		result = libftxf_record_merger_get_source_needing_data(
+		          record_merger,
+		          &input_source_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve input source needing data.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			result = input_source_read_record(
+			          export_handle->input_sources[ input_source_index ],
+			          &record_data,
+			          &record_data_size,
+			          &record_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record from input source: %d.",
+				 function,
+				 input_source_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				record_data      = NULL;
+				record_data_size = 0;
+			}
+			else
+			{
+				result = export_handle_update_progress(
+				          export_handle,
+				          record_data_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to update progress.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					break;
+				}
+			}
+			if( ( record_data_size != 0 )
+			 && ( export_handle->duplicate_index != NULL ) )
+			{
+				result = duplicate_index_check_byte_stream(
+				          export_handle->duplicate_index,
+				          record_data,
+				          record_data_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to determine if record is a duplicate.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					/* The input source still needs data, hence the next record
+					 * of the input source is read
+					 */
+					export_handle->number_of_duplicate_records += 1;
+
+					continue;
+				}
+			}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( source_record_data != NULL )
+			{
+				source_record_data[ input_source_index ]      = record_data;
+				source_record_data_size[ input_source_index ] = record_data_size;
+
+				result = libftxf_record_merger_set_source_record_header(
+				          record_merger,
+				          input_source_index,
+				          record_data,
+				          record_data_size,
+				          record_offset,
+				          error );
+			}
+			else
+#endif
+			{
+				result = libftxf_record_merger_set_source_record_data(
+				          record_merger,
+				          input_source_index,
+				          record_data,
+				          record_data_size,
+				          record_offset,
+				          error );
+			}
+			if( result != 1 )
+			{
+				/* The input source still needs data, hence the next record
+				 * of the input source is read
+				 */
+				if( export_handle_report_unreadable_record(
+				     export_handle,
+				     input_source_index,
+				     record_offset,
+				     error,
+				     NULL ) != 1 )
+				{
+					goto on_error;
+				}
+			}
+			continue;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( source_record_data != NULL )
+		{
+			result = libftxf_record_merger_get_next_source(
+			          record_merger,
+			          &input_source_index,
+			          &record_offset,
+			          error );
+		}
+		else
+#endif
+		{
+			result = libftxf_record_merger_get_next_record(
+			          record_merger,
+			          &input_source_index,
+			          &record_offset,
+			          &record,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next record.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( source_record_data != NULL )
+		{
+			if( export_handle_queue_record(
+			     export_handle,
+			     input_source_index,
+			     source_record_data[ input_source_index ],
+			     source_record_data_size[ input_source_index ],
+			     record_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to queue record.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+#endif
+		if( export_handle_write_record(
+		     export_handle,
+		     record,
+		     record_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( source_record_data_size != NULL )
+	{
+		memory_free(
+		 source_record_data_size );
+	}
+	if( source_record_data != NULL )
+	{
+		memory_free(
+		 source_record_data );
+	}
+#endif
+	if( libftxf_record_merger_free(
+	     &record_merger,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record merger.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( source_record_data_size != NULL )
+	{
+		memory_free(
+		 source_record_data_size );
+	}
+	if( source_record_data != NULL )
+	{
+		memory_free(
+		 source_record_data );
+	}
+#endif
+	if( record_merger != NULL )
+	{
+		libftxf_record_merger_free(
+		 &record_merger,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the records in the inputs as JSON Lines, in the columnar export format, into a SQLite database
+ * or as a timeline
+ * The records of a single input are exported in input order, those of multiple inputs
+ * are merged in (header) timestamp order
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_records(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	const uint8_t *record_data = NULL;
+	static char *function      = "export_handle_export_records";
+	size_t memory_limit        = 0;
+	size_t record_data_size    = 0;
+	uint64_t record_offset     = 0;
+	int result                 = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_input_sources == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing input sources.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_COLUMNAR )
+	{
+		if( export_handle->column_writer == NULL )
+		{
+			if( libftxf_column_writer_initialize(
+			     &( export_handle->column_writer ),
+			     0,
+			     LIBFTXF_COLUMN_WRITER_FLAG_STATISTICS,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create column writer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( export_handle->output_buffer_size - export_handle->output_buffer_index ) < LIBFTXF_COLUMN_FILE_HEADER_SIZE )
+		{
+			if( export_handle_flush_output_buffer(
+			     export_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush output buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libftxf_column_writer_copy_file_header_to_byte_stream(
+		     export_handle->column_writer,
+		     &( export_handle->output_buffer[ export_handle->output_buffer_index ] ),
+		     export_handle->output_buffer_size - export_handle->output_buffer_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy file header.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->output_buffer_index += LIBFTXF_COLUMN_FILE_HEADER_SIZE;
+	}
+	/* The timeline writer or the name pool of the SQLite writer share the memory limit
+	 * with the duplicate index
+	 */
+	memory_limit = export_handle->memory_limit;
+
+	if( ( ( export_handle->export_format == EXPORT_FORMAT_TIMELINE )
+	  ||  ( export_handle->export_format == EXPORT_FORMAT_SQLITE ) )
+	 && ( export_handle->skip_duplicates != 0 ) )
+	{
+		memory_limit /= 2;
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_TIMELINE )
+	{
+		if( export_handle->timeline_writer == NULL )
+		{
+			if( timeline_writer_initialize(
+			     &( export_handle->timeline_writer ),
+			     memory_limit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create timeline writer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( export_handle->skip_duplicates != 0 )
+	{
+		if( export_handle->duplicate_index == NULL )
+		{
+			if( duplicate_index_initialize(
+			     &( export_handle->duplicate_index ),
+			     memory_limit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create duplicate index.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	export_handle->start_time = time(
+	                             NULL );
+
+	export_handle->last_status_time = export_handle->start_time;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->number_of_threads > 0 )
+	{
+		if( export_handle_start_threads(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start threads.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( export_handle->number_of_input_sources > 1 )
+	{
+		if( export_handle_export_merged_records(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export merged records.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		while( 1 )
+		{
+			result = input_source_read_record(
+			          export_handle->input_sources[ 0 ],
+			          &record_data,
+			          &record_data_size,
+			          &record_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			result = export_handle_update_progress(
+			          export_handle,
+			          record_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to update progress.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( export_handle_export_record(
+			     export_handle,
+			     record_data,
+			     record_data_size,
+			     record_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export record.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->record_buffer_queue != NULL )
+	{
+		if( export_handle_stop_threads(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop threads.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( export_handle->export_format == EXPORT_FORMAT_COLUMNAR )
+	{
+		if( export_handle_write_column_chunk(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write chunk.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( export_handle->export_format == EXPORT_FORMAT_TIMELINE )
+	{
+		if( timeline_writer_write(
+		     export_handle->timeline_writer,
+		     export_handle->output_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write timeline.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( export_handle->status_stream != NULL )
+	{
+		export_handle_print_status(
+		 export_handle,
+		 time(
+		  NULL ) );
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_SQLITE )
+	{
+		return( 1 );
+	}
+	if( export_handle_flush_output_buffer(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->record_buffer_queue != NULL )
+	{
+		export_handle_stop_threads(
+		 export_handle,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
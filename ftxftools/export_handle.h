@@ -0,0 +1,406 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_HANDLE_H )
+#define _EXPORT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_TIME_H ) || defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "duplicate_index.h"
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libcthreads.h"
+#include "ftxftools_libftxf.h"
+#include "input_source.h"
+#include "record_buffer.h"
+#include "reorder_buffer.h"
+#include "sqlite_writer.h"
+#include "timeline_writer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default size of the output buffer
+ */
+#define EXPORT_HANDLE_BUFFER_SIZE			1024 * 1024
+
+/* The default memory limit of the timeline export format in MiB
+ */
+#define EXPORT_HANDLE_DEFAULT_MEMORY_LIMIT		64
+
+/* The number of records that are read between checks of the time limit
+ * and updates of the status
+ */
+#define EXPORT_HANDLE_PROGRESS_INTERVAL			4096
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The maximum number of threads that read records
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS		32
+
+/* The number of record buffers used by the threads
+ * This bounds the number of records that are read ahead of the export
+ */
+#define EXPORT_HANDLE_NUMBER_OF_RECORD_BUFFERS		256
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+enum EXPORT_FORMATS
+{
+	EXPORT_FORMAT_COLUMNAR			= (int) 'c',
+	EXPORT_FORMAT_JSONL			= (int) 'j',
+	EXPORT_FORMAT_SQLITE			= (int) 's',
+	EXPORT_FORMAT_TIMELINE			= (int) 't'
+};
+
+typedef struct export_handle export_handle_t;
+
+struct export_handle
+{
+	/* The input sources
+	 */
+	input_source_t **input_sources;
+
+	/* The number of input sources
+	 */
+	int number_of_input_sources;
+
+	/* The output file stream
+	 */
+	FILE *output_stream;
+
+	/* Value to indicate the output stream was opened by the export handle
+	 */
+	uint8_t output_stream_is_open;
+
+	/* The export format
+	 */
+	int export_format;
+
+	/* The column writer
+	 * Only used by the columnar export format
+	 */
+	libftxf_column_writer_t *column_writer;
+
+#if defined( HAVE_LIBSQLITE3 )
+	/* The SQLite writer
+	 * Only used by the SQLite export format
+	 */
+	sqlite_writer_t *sqlite_writer;
+#endif
+
+	/* The timeline writer
+	 * Only used by the timeline export format
+	 */
+	timeline_writer_t *timeline_writer;
+
+	/* The memory limit in bytes
+	 * Used by the timeline export format and the duplicate index
+	 */
+	size_t memory_limit;
+
+	/* The name search
+	 * Only records with a name that matches the name pattern are exported
+	 */
+	libftxf_name_search_t *name_search;
+
+	/* Value to indicate duplicate records should be skipped
+	 */
+	uint8_t skip_duplicates;
+
+	/* The duplicate index
+	 * Only the first of duplicate records is exported
+	 */
+	duplicate_index_t *duplicate_index;
+
+	/* The record
+	 * This record is reused for every record that is exported
+	 */
+	libftxf_record_t *record;
+
+	/* The output buffer
+	 */
+	uint8_t *output_buffer;
+
+	/* The output buffer size
+	 */
+	size_t output_buffer_size;
+
+	/* The output buffer index
+	 */
+	size_t output_buffer_index;
+
+	/* The number of exported records
+	 */
+	uint64_t number_of_exported_records;
+
+	/* The number of records that could not be exported
+	 */
+	uint64_t number_of_failed_records;
+
+	/* The number of records that did not match the name pattern
+	 */
+	uint64_t number_of_skipped_records;
+
+	/* The number of duplicate records that were skipped
+	 */
+	uint64_t number_of_duplicate_records;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* The status output stream
+	 * The status is not printed if not set
+	 */
+	FILE *status_stream;
+
+	/* The number of records read from the input sources
+	 */
+	uint64_t number_of_read_records;
+
+	/* The number of bytes of the records read from the input sources
+	 */
+	uint64_t number_of_read_bytes;
+
+	/* The time limit in seconds
+	 * 0 if there is no time limit
+	 */
+	uint32_t time_limit;
+
+	/* The time the export started
+	 */
+	time_t start_time;
+
+	/* The time the status was last printed
+	 */
+	time_t last_status_time;
+
+	/* Value to indicate the time limit was exceeded
+	 */
+	uint8_t time_limit_exceeded;
+
+	/* Value to indicate the export should abort
+	 * Set by the signal handler and checked between records
+	 */
+	int abort;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The number of threads that read records
+	 * 0 if the records are read by the main thread
+	 */
+	int number_of_threads;
+
+	/* The record buffer queue
+	 * Contains the record buffers that are not in use by the threads
+	 */
+	libcthreads_queue_t *record_buffer_queue;
+
+	/* The process thread pool
+	 * Reads the records from the record buffers
+	 */
+	libcthreads_thread_pool_t *process_thread_pool;
+
+	/* The output thread pool
+	 * Writes the records from the record buffers
+	 */
+	libcthreads_thread_pool_t *output_thread_pool;
+
+	/* The reorder buffer
+	 * Releases the record buffers read by the process threads in sequence order
+	 */
+	reorder_buffer_t *reorder_buffer;
+
+	/* The reorder buffer mutex
+	 * Also guards the threads abort value
+	 */
+	libcthreads_mutex_t *reorder_buffer_mutex;
+
+	/* The number of record buffers queued by the main thread
+	 * Used as the sequence number of the next record buffer
+	 */
+	uint64_t number_of_queued_records;
+
+	/* Value to indicate the threads should abort
+	 * Only accessed while the reorder buffer mutex is held
+	 */
+	uint8_t threads_abort;
+#endif
+};
+
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_set_export_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_name_pattern(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_skip_duplicates(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_set_memory_limit(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_time_limit(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_print_status(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_close(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_flush_output_buffer(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_write_column_chunk(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_record(
+     export_handle_t *export_handle,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint64_t record_offset,
+     libcerror_error_t **error );
+
+int export_handle_report_unreadable_record(
+     export_handle_t *export_handle,
+     int input_source_index,
+     uint64_t record_offset,
+     libcerror_error_t **read_error,
+     libcerror_error_t **error );
+
+int export_handle_write_record(
+     export_handle_t *export_handle,
+     libftxf_record_t *record,
+     uint64_t record_offset,
+     libcerror_error_t **error );
+
+int export_handle_update_progress(
+     export_handle_t *export_handle,
+     size_t record_data_size,
+     libcerror_error_t **error );
+
+void export_handle_print_status(
+      export_handle_t *export_handle,
+      time_t current_time );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_start_threads(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_stop_threads(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_set_threads_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_get_threads_abort(
+     export_handle_t *export_handle,
+     uint8_t *threads_abort,
+     libcerror_error_t **error );
+
+int export_handle_queue_record(
+     export_handle_t *export_handle,
+     int input_source_index,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint64_t record_offset,
+     libcerror_error_t **error );
+
+int export_handle_process_record_buffer(
+     record_buffer_t *record_buffer,
+     export_handle_t *export_handle );
+
+int export_handle_output_record_buffer(
+     record_buffer_t *record_buffer,
+     export_handle_t *export_handle );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int export_handle_export_merged_records(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_records(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_HANDLE_H ) */
+
@@ -0,0 +1,264 @@
+/*
+ * Compares the Transactional NTFS (TxF) records of two logs, for example of a volume
+ * and a volume snapshot
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "diff_handle.h"
+#include "ftxftools_getopt.h"
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libcnotify.h"
+#include "ftxftools_libftxf.h"
+#include "ftxftools_output.h"
+
+diff_handle_t *ftxfdiff_diff_handle = NULL;
+
+/* Prints usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use ftxfdiff to compare the Transactional NTFS (TxF) records\n"
+	                 "of two logs, for example of a volume and a volume snapshot.\n\n" );
+
+	fprintf( stream, "Usage: ftxfdiff [ -t target ] [ -chvV ] old new\n\n" );
+
+	fprintf( stream, "\told:    the source file that contains the consecutive TxF\n"
+	                 "\t        records of the old log\n" );
+	fprintf( stream, "\tnew:    the source file that contains the consecutive TxF\n"
+	                 "\t        records of the new log\n\n" );
+
+	fprintf( stream, "\t-c:     also print the records that are in both logs\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-t:     specify the target file to write the differences to,\n"
+	                 "\t        by default the differences are written to stdout\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error          = NULL;
+	system_character_t *option_target = NULL;
+	char *program                     = "ftxfdiff";
+	system_integer_t option           = 0;
+	uint8_t print_common_records      = 0;
+	int verbose                       = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	while( ( option = ftxftools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "cht:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				ftxftools_output_version_fprint(
+				 stderr,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				print_common_records = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				ftxftools_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 't':
+				option_target = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				ftxftools_output_version_fprint(
+				 stdout,
+				 program );
+
+				ftxftools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( argc - optind ) != 2 )
+	{
+		ftxftools_output_version_fprint(
+		 stderr,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing old and new source files.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( diff_handle_initialize(
+	     &ftxfdiff_diff_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create diff handle.\n" );
+
+		goto on_error;
+	}
+	ftxfdiff_diff_handle->print_common_records = print_common_records;
+
+	if( diff_handle_open_inputs(
+	     ftxfdiff_diff_handle,
+	     argv[ optind ],
+	     argv[ optind + 1 ],
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM " or %" PRIs_SYSTEM ".\n",
+		 argv[ optind ],
+		 argv[ optind + 1 ] );
+
+		goto on_error;
+	}
+	if( diff_handle_open_output(
+	     ftxfdiff_diff_handle,
+	     option_target,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 option_target );
+
+		goto on_error;
+	}
+	if( diff_handle_compare_records(
+	     ftxfdiff_diff_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to compare records.\n" );
+
+		goto on_error;
+	}
+	if( diff_handle_close(
+	     ftxfdiff_diff_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close diff handle.\n" );
+
+		goto on_error;
+	}
+	if( verbose != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Added records: %" PRIu64 ", removed records: %" PRIu64 ", common records: %" PRIu64 ".\n",
+		 ftxfdiff_diff_handle->number_of_added_records,
+		 ftxfdiff_diff_handle->number_of_removed_records,
+		 ftxfdiff_diff_handle->number_of_common_records );
+	}
+	if( diff_handle_free(
+	     &ftxfdiff_diff_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free diff handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( ftxfdiff_diff_handle != NULL )
+	{
+		diff_handle_close(
+		 ftxfdiff_diff_handle,
+		 NULL );
+		diff_handle_free(
+		 &ftxfdiff_diff_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,574 @@
+/*
+ * Exports Transactional NTFS (TxF) records as JSON Lines, in a columnar format, into SQLite
+ * or as a timeline
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "export_handle.h"
+#include "ftxftools_getopt.h"
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libcnotify.h"
+#include "ftxftools_libftxf.h"
+#include "ftxftools_output.h"
+#include "ftxftools_signal.h"
+#include "ftxftools_unused.h"
+
+export_handle_t *ftxfexport_export_handle = NULL;
+int ftxfexport_abort                      = 0;
+
+/* Prints usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use ftxfexport to export Transactional NTFS (TxF) records as\n"
+	                 "JSON Lines, in a columnar format or as a timeline.\n\n" );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	fprintf( stream, "Usage: ftxfexport [ -f format ] [ -j threads ] [ -l seconds ]\n"
+	                 "                  [ -m size ] [ -n pattern ] [ -t target ]\n"
+	                 "                  [ -hsuvV ] source [ source ... ]\n\n" );
+#else
+	fprintf( stream, "Usage: ftxfexport [ -f format ] [ -l seconds ] [ -m size ]\n"
+	                 "                  [ -n pattern ] [ -t target ] [ -hsuvV ]\n"
+	                 "                  source [ source ... ]\n\n" );
+#endif
+
+	fprintf( stream, "\tsource: the source file that contains consecutive TxF records,\n"
+	                 "\t        the records of multiple source files, for example of\n"
+	                 "\t        different volumes or volume snapshots, are merged\n"
+	                 "\t        in timestamp order\n\n" );
+
+#if defined( HAVE_LIBSQLITE3 )
+	fprintf( stream, "\t-f:     export format, options: columnar, jsonl (default),\n"
+	                 "\t        sqlite, timeline\n" );
+#else
+	fprintf( stream, "\t-f:     export format, options: columnar, jsonl (default),\n"
+	                 "\t        timeline\n" );
+#endif
+	fprintf( stream, "\t-h:     shows this help\n" );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	fprintf( stream, "\t-j:     the number of threads used to read records, the reading\n"
+	                 "\t        of the sources, the reading of the records and the export\n"
+	                 "\t        are then done by separate threads, default is 0 (no\n"
+	                 "\t        threads), the maximum is %d\n", EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS );
+#endif
+	fprintf( stream, "\t-l:     the time limit of the export in seconds, the export is\n"
+	                 "\t        stopped after the time limit was exceeded, default is 0\n"
+	                 "\t        (no time limit)\n" );
+	fprintf( stream, "\t-m:     the amount of memory in MiB used to sort the timeline, to\n"
+	                 "\t        detect duplicate records and to cache the decoded names of\n"
+	                 "\t        the sqlite export format, timelines and duplicate records\n"
+	                 "\t        that do not fit are stored in temporary files and the name\n"
+	                 "\t        cache is emptied, default is %d\n", EXPORT_HANDLE_DEFAULT_MEMORY_LIMIT );
+	fprintf( stream, "\t-n:     only export records with a name that matches the pattern,\n"
+	                 "\t        the pattern is case-insensitive and supports the * and ?\n"
+	                 "\t        wildcards, for example: *.docx\n" );
+	fprintf( stream, "\t-s:     print the status of the export to stderr, the number of\n"
+	                 "\t        records and bytes read and the throughput\n" );
+	fprintf( stream, "\t-t:     specify the target file to export to, by default\n"
+	                 "\t        the records are exported to stdout, the sqlite\n"
+	                 "\t        export format requires a target file\n" );
+	fprintf( stream, "\t-u:     only export unique records, records with the same\n"
+	                 "\t        content as a record that was read before, for example\n"
+	                 "\t        of carved or overlapping sources, are skipped\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for ftxfexport
+ */
+void ftxfexport_signal_handler(
+      ftxftools_signal_t signal FTXFTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "ftxfexport_signal_handler";
+
+	FTXFTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	ftxfexport_abort = 1;
+
+	if( ftxfexport_export_handle != NULL )
+	{
+		if( export_handle_signal_abort(
+		     ftxfexport_export_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal export handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                     = NULL;
+	system_character_t *option_format            = NULL;
+	system_character_t *option_memory_limit      = NULL;
+	system_character_t *option_name              = NULL;
+	system_character_t *option_target            = NULL;
+	system_character_t *option_time_limit        = NULL;
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	system_character_t *option_number_of_threads = NULL;
+#endif
+	char *program                                = "ftxfexport";
+	system_integer_t option                      = 0;
+	uint8_t option_print_status                  = 0;
+	uint8_t option_unique                        = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	while( ( option = ftxftools_getopt(
+	                   argc,
+	                   argv,
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	                   _SYSTEM_STRING( "f:hj:l:m:n:st:uvV" ) ) ) != (system_integer_t) -1 )
+#else
+	                   _SYSTEM_STRING( "f:hl:m:n:st:uvV" ) ) ) != (system_integer_t) -1 )
+#endif
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				ftxftools_output_version_fprint(
+				 stderr,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'f':
+				option_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				ftxftools_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+#endif
+
+			case (system_integer_t) 'l':
+				option_time_limit = optarg;
+
+				break;
+
+			case (system_integer_t) 'm':
+				option_memory_limit = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_name = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_print_status = 1;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target = optarg;
+
+				break;
+
+			case (system_integer_t) 'u':
+				option_unique = 1;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				ftxftools_output_version_fprint(
+				 stdout,
+				 program );
+
+				ftxftools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		ftxftools_output_version_fprint(
+		 stderr,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( export_handle_initialize(
+	     &ftxfexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create export handle.\n" );
+
+		goto on_error;
+	}
+	if( option_format != NULL )
+	{
+		result = export_handle_set_export_format(
+		          ftxfexport_export_handle,
+		          option_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set export format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported export format: %" PRIs_SYSTEM ".\n",
+			 option_format );
+
+			goto on_error;
+		}
+	}
+	if( option_memory_limit != NULL )
+	{
+		result = export_handle_set_memory_limit(
+		          ftxfexport_export_handle,
+		          option_memory_limit,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set memory limit.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported memory limit: %" PRIs_SYSTEM ".\n",
+			 option_memory_limit );
+
+			goto on_error;
+		}
+	}
+	if( option_time_limit != NULL )
+	{
+		result = export_handle_set_time_limit(
+		          ftxfexport_export_handle,
+		          option_time_limit,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set time limit.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported time limit: %" PRIs_SYSTEM ".\n",
+			 option_time_limit );
+
+			goto on_error;
+		}
+	}
+	if( option_print_status != 0 )
+	{
+		if( export_handle_set_print_status(
+		     ftxfexport_export_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set print status.\n" );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( option_number_of_threads != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+		          ftxfexport_export_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads: %" PRIs_SYSTEM ".\n",
+			 option_number_of_threads );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( option_name != NULL )
+	{
+		if( export_handle_set_name_pattern(
+		     ftxfexport_export_handle,
+		     option_name,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set name pattern.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_unique != 0 )
+	{
+		if( export_handle_set_skip_duplicates(
+		     ftxfexport_export_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set skip duplicates.\n" );
+
+			goto on_error;
+		}
+	}
+	while( optind < argc )
+	{
+		if( export_handle_open_input(
+		     ftxfexport_export_handle,
+		     argv[ optind ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open: %" PRIs_SYSTEM ".\n",
+			 argv[ optind ] );
+
+			goto on_error;
+		}
+		optind++;
+	}
+	if( export_handle_open_output(
+	     ftxfexport_export_handle,
+	     option_target,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 option_target );
+
+		goto on_error;
+	}
+	if( ftxftools_signal_attach(
+	     ftxfexport_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = export_handle_export_records(
+	          ftxfexport_export_handle,
+	          &error );
+
+	if( ftxftools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to export records.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_close(
+	     ftxfexport_export_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close export handle.\n" );
+
+		goto on_error;
+	}
+	if( ftxfexport_export_handle->number_of_failed_records > 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to export %" PRIu64 " records.\n",
+		 ftxfexport_export_handle->number_of_failed_records );
+	}
+	if( ( verbose != 0 )
+	 && ( ftxfexport_export_handle->number_of_duplicate_records > 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Skipped %" PRIu64 " duplicate records.\n",
+		 ftxfexport_export_handle->number_of_duplicate_records );
+	}
+	if( ftxfexport_export_handle->time_limit_exceeded != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Export stopped: time limit exceeded.\n" );
+
+		result = 0;
+	}
+	if( ftxfexport_abort != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Export aborted.\n" );
+
+		result = 0;
+	}
+	if( export_handle_free(
+	     &ftxfexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free export handle.\n" );
+
+		goto on_error;
+	}
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( ftxfexport_export_handle != NULL )
+	{
+		export_handle_close(
+		 ftxfexport_export_handle,
+		 NULL );
+		export_handle_free(
+		 &ftxfexport_export_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,70 @@
+/*
+ * Common output functions for the ftxftools
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "ftxftools_libftxf.h"
+#include "ftxftools_output.h"
+
+/* Prints the copyright information
+ */
+void ftxftools_output_copyright_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf(
+	 stream,
+	 "Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>.\n"
+	 "This is free software; see the source for copying conditions. There is NO\n"
+	 "warranty; not even for MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.\n" );
+
+	fprintf(
+	 stream,
+	 "Report bugs to <%s>.\n",
+	 PACKAGE_BUGREPORT );
+}
+
+/* Prints the version information
+ */
+void ftxftools_output_version_fprint(
+      FILE *stream,
+      const char *program )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	if( program == NULL )
+	{
+		return;
+	}
+	fprintf(
+	 stream,
+	 "%s %s\n\n",
+	 program,
+	 LIBFTXF_VERSION_STRING );
+}
+
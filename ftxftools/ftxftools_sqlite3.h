@@ -0,0 +1,36 @@
+/*
+ * The sqlite3 header wrapper
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FTXFTOOLS_SQLITE3_H )
+#define _FTXFTOOLS_SQLITE3_H
+
+#include <common.h>
+
+/* sqlite3 is optional and only used by the SQLite export format
+ */
+#if defined( HAVE_LIBSQLITE3 )
+
+#include <sqlite3.h>
+
+#endif /* defined( HAVE_LIBSQLITE3 ) */
+
+#endif /* !defined( _FTXFTOOLS_SQLITE3_H ) */
+
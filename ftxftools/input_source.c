@@ -0,0 +1,463 @@
+/*
+ * Input source
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "ftxftools_libcerror.h"
+#include "input_source.h"
+
+/* Creates an input source
+ * Make sure the value input_source is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int input_source_initialize(
+     input_source_t **input_source,
+     libcerror_error_t **error )
+{
+	static char *function = "input_source_initialize";
+
+	if( input_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input source.",
+		 function );
+
+		return( -1 );
+	}
+	if( *input_source != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid input source value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*input_source = memory_allocate_structure(
+	                 input_source_t );
+
+	if( *input_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input source.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *input_source,
+	     0,
+	     sizeof( input_source_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear input source.",
+		 function );
+
+		memory_free(
+		 *input_source );
+
+		*input_source = NULL;
+
+		return( -1 );
+	}
+	( *input_source )->read_buffer_size = INPUT_SOURCE_READ_BUFFER_SIZE;
+
+	( *input_source )->read_buffer = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * ( *input_source )->read_buffer_size );
+
+	if( ( *input_source )->read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *input_source != NULL )
+	{
+		memory_free(
+		 *input_source );
+
+		*input_source = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an input source
+ * Returns 1 if successful or -1 on error
+ */
+int input_source_free(
+     input_source_t **input_source,
+     libcerror_error_t **error )
+{
+	static char *function = "input_source_free";
+	int result            = 1;
+
+	if( input_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input source.",
+		 function );
+
+		return( -1 );
+	}
+	if( *input_source != NULL )
+	{
+		if( ( *input_source )->stream != NULL )
+		{
+			if( input_source_close(
+			     *input_source,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input source.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *input_source )->read_buffer );
+
+		memory_free(
+		 *input_source );
+
+		*input_source = NULL;
+	}
+	return( result );
+}
+
+/* Opens the input source
+ * Returns 1 if successful or -1 on error
+ */
+int input_source_open(
+     input_source_t *input_source,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "input_source_open";
+
+	if( input_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input source.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_source->stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid input source - stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	input_source->stream = file_stream_open_wide(
+	                        filename,
+	                        _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	input_source->stream = file_stream_open(
+	                        filename,
+	                        FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( input_source->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		return( -1 );
+	}
+	input_source->read_data_size          = 0;
+	input_source->read_buffer_offset      = 0;
+	input_source->read_buffer_file_offset = 0;
+	input_source->at_end                  = 0;
+
+	return( 1 );
+}
+
+/* Closes the input source
+ * Returns the 0 if succesful or -1 on error
+ */
+int input_source_close(
+     input_source_t *input_source,
+     libcerror_error_t **error )
+{
+	static char *function = "input_source_close";
+	int result            = 0;
+
+	if( input_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input source.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_source->stream != NULL )
+	{
+		if( file_stream_close(
+		     input_source->stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file.",
+			 function );
+
+			result = -1;
+		}
+		input_source->stream = NULL;
+	}
+	return( result );
+}
+
+/* Reads the next record from the input source
+ * The input is read in chunks and records are expected to be stored consecutively,
+ * a record size smaller than the record header size marks the end of the records
+ * The record data references the read buffer and remains valid until the next record is read
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int input_source_read_record(
+     input_source_t *input_source,
+     const uint8_t **record_data,
+     size_t *record_data_size,
+     uint64_t *record_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "input_source_read_record";
+	size_t data_index     = 0;
+	size_t read_count     = 0;
+	size_t remaining_size = 0;
+	size_t required_size  = 0;
+	uint32_t record_size  = 0;
+
+	if( input_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input source.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_source->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid input source - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record offset.",
+		 function );
+
+		return( -1 );
+	}
+	while( 1 )
+	{
+		remaining_size = input_source->read_data_size - input_source->read_buffer_offset;
+		required_size  = INPUT_SOURCE_RECORD_HEADER_SIZE;
+
+		if( remaining_size >= INPUT_SOURCE_RECORD_HEADER_SIZE )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( input_source->read_buffer[ input_source->read_buffer_offset + INPUT_SOURCE_RECORD_SIZE_OFFSET ] ),
+			 record_size );
+
+			if( record_size < INPUT_SOURCE_RECORD_HEADER_SIZE )
+			{
+				break;
+			}
+			if( (size_t) record_size <= remaining_size )
+			{
+				*record_data      = &( input_source->read_buffer[ input_source->read_buffer_offset ] );
+				*record_data_size = (size_t) record_size;
+				*record_offset    = input_source->read_buffer_file_offset + input_source->read_buffer_offset;
+
+				input_source->read_buffer_offset += (size_t) record_size;
+
+				return( 1 );
+			}
+			required_size = (size_t) record_size;
+		}
+		if( input_source->at_end != 0 )
+		{
+			break;
+		}
+		/* Move the remaining data to the start of the read buffer
+		 */
+		if( input_source->read_buffer_offset > 0 )
+		{
+			for( data_index = 0;
+			     data_index < remaining_size;
+			     data_index++ )
+			{
+				input_source->read_buffer[ data_index ] = input_source->read_buffer[ input_source->read_buffer_offset + data_index ];
+			}
+			input_source->read_buffer_file_offset += input_source->read_buffer_offset;
+			input_source->read_data_size           = remaining_size;
+			input_source->read_buffer_offset       = 0;
+		}
+		if( required_size > input_source->read_buffer_size )
+		{
+			if( required_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid record size value exceeds maximum allocation size.",
+				 function );
+
+				return( -1 );
+			}
+			reallocation = (uint8_t *) memory_reallocate(
+			                            input_source->read_buffer,
+			                            sizeof( uint8_t ) * required_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize read buffer.",
+				 function );
+
+				return( -1 );
+			}
+			input_source->read_buffer      = reallocation;
+			input_source->read_buffer_size = required_size;
+		}
+		read_count = file_stream_read(
+		              input_source->stream,
+		              &( input_source->read_buffer[ input_source->read_data_size ] ),
+		              input_source->read_buffer_size - input_source->read_data_size );
+
+		if( read_count == 0 )
+		{
+			if( ferror(
+			     input_source->stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read input data.",
+				 function );
+
+				return( -1 );
+			}
+			input_source->at_end = 1;
+		}
+		input_source->read_data_size += read_count;
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,109 @@
+/*
+ * Input source
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _INPUT_SOURCE_H )
+#define _INPUT_SOURCE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "ftxftools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the record header
+ */
+#define INPUT_SOURCE_RECORD_HEADER_SIZE			80
+
+/* The offset of the record size in the record header
+ */
+#define INPUT_SOURCE_RECORD_SIZE_OFFSET			64
+
+/* The default size of the read buffer
+ */
+#define INPUT_SOURCE_READ_BUFFER_SIZE			1024 * 1024
+
+typedef struct input_source input_source_t;
+
+struct input_source
+{
+	/* The file stream
+	 */
+	FILE *stream;
+
+	/* The read buffer
+	 */
+	uint8_t *read_buffer;
+
+	/* The read buffer size
+	 */
+	size_t read_buffer_size;
+
+	/* The size of the data in the read buffer
+	 */
+	size_t read_data_size;
+
+	/* The offset of the next record in the read buffer
+	 */
+	size_t read_buffer_offset;
+
+	/* The file offset of the start of the read buffer
+	 */
+	uint64_t read_buffer_file_offset;
+
+	/* Value to indicate the end of the file stream was reached
+	 */
+	uint8_t at_end;
+};
+
+int input_source_initialize(
+     input_source_t **input_source,
+     libcerror_error_t **error );
+
+int input_source_free(
+     input_source_t **input_source,
+     libcerror_error_t **error );
+
+int input_source_open(
+     input_source_t *input_source,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int input_source_close(
+     input_source_t *input_source,
+     libcerror_error_t **error );
+
+int input_source_read_record(
+     input_source_t *input_source,
+     const uint8_t **record_data,
+     size_t *record_data_size,
+     uint64_t *record_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _INPUT_SOURCE_H ) */
+
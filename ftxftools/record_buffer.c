@@ -0,0 +1,299 @@
+/*
+ * Record buffer
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libftxf.h"
+#include "record_buffer.h"
+
+/* Creates a record buffer
+ * Make sure the value record_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int record_buffer_initialize(
+     record_buffer_t **record_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "record_buffer_initialize";
+
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*record_buffer = memory_allocate_structure(
+	                  record_buffer_t );
+
+	if( *record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_buffer,
+	     0,
+	     sizeof( record_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record buffer.",
+		 function );
+
+		memory_free(
+		 *record_buffer );
+
+		*record_buffer = NULL;
+
+		return( -1 );
+	}
+	if( libftxf_record_initialize(
+	     &( ( *record_buffer )->record ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *record_buffer != NULL )
+	{
+		memory_free(
+		 *record_buffer );
+
+		*record_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record buffer
+ * Returns 1 if successful or -1 on error
+ */
+int record_buffer_free(
+     record_buffer_t **record_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "record_buffer_free";
+	int result            = 1;
+
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_buffer != NULL )
+	{
+		if( libftxf_record_free(
+		     &( ( *record_buffer )->record ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *record_buffer )->read_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *record_buffer )->read_error ) );
+		}
+		if( ( *record_buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *record_buffer )->data );
+		}
+		memory_free(
+		 *record_buffer );
+
+		*record_buffer = NULL;
+	}
+	return( result );
+}
+
+/* Sets the record data
+ * The data is copied, since the read buffer of the input source is reused
+ * Returns 1 if successful or -1 on error
+ */
+int record_buffer_set_data(
+     record_buffer_t *record_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t record_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "record_buffer_set_data";
+
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > record_buffer->allocated_data_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            record_buffer->data,
+		                            sizeof( uint8_t ) * data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data.",
+			 function );
+
+			return( -1 );
+		}
+		record_buffer->data                = reallocation;
+		record_buffer->allocated_data_size = data_size;
+	}
+	if( memory_copy(
+	     record_buffer->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	record_buffer->data_size     = data_size;
+	record_buffer->record_offset = record_offset;
+	record_buffer->read_result   = 0;
+
+	return( 1 );
+}
+
+/* Reads the record from the record data
+ * A record that cannot be read is not considered an error, instead the result and error
+ * are stored in the record buffer so they can be reported in record order
+ * Returns 1 if successful or -1 on error
+ */
+int record_buffer_read_record(
+     record_buffer_t *record_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "record_buffer_read_record";
+
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_buffer->read_error != NULL )
+	{
+		libcerror_error_free(
+		 &( record_buffer->read_error ) );
+	}
+	record_buffer->read_result = libftxf_record_copy_from_byte_stream(
+	                              record_buffer->record,
+	                              record_buffer->data,
+	                              record_buffer->data_size,
+	                              &( record_buffer->read_error ) );
+
+	return( 1 );
+}
+
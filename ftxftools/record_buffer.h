@@ -0,0 +1,102 @@
+/*
+ * Record buffer
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RECORD_BUFFER_H )
+#define _RECORD_BUFFER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libftxf.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct record_buffer record_buffer_t;
+
+struct record_buffer
+{
+	/* The record data
+	 */
+	uint8_t *data;
+
+	/* The record data size
+	 */
+	size_t data_size;
+
+	/* The allocated record data size
+	 */
+	size_t allocated_data_size;
+
+	/* The record offset
+	 */
+	uint64_t record_offset;
+
+	/* The index of the input source of the record
+	 */
+	int input_source_index;
+
+	/* The sequence number
+	 * The order in which the record was read from the input source
+	 */
+	uint64_t sequence_number;
+
+	/* The record
+	 */
+	libftxf_record_t *record;
+
+	/* The result of reading the record
+	 * 1 if the record was read, -1 if not
+	 */
+	int read_result;
+
+	/* The error of reading the record
+	 */
+	libcerror_error_t *read_error;
+};
+
+int record_buffer_initialize(
+     record_buffer_t **record_buffer,
+     libcerror_error_t **error );
+
+int record_buffer_free(
+     record_buffer_t **record_buffer,
+     libcerror_error_t **error );
+
+int record_buffer_set_data(
+     record_buffer_t *record_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t record_offset,
+     libcerror_error_t **error );
+
+int record_buffer_read_record(
+     record_buffer_t *record_buffer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RECORD_BUFFER_H ) */
+
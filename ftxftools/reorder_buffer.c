@@ -0,0 +1,334 @@
+/*
+ * Reorder buffer
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "ftxftools_libcerror.h"
+#include "reorder_buffer.h"
+
+/* Creates a reorder buffer
+ * Make sure the value reorder_buffer is referencing, is set to NULL
+ * The number of values must be at least the number of values that can be in use at the same time,
+ * which bounds the memory used
+ * Returns 1 if successful or -1 on error
+ */
+int reorder_buffer_initialize(
+     reorder_buffer_t **reorder_buffer,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "reorder_buffer_initialize";
+
+	if( reorder_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reorder buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *reorder_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid reorder buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_values <= 0 )
+	 || ( (size_t) number_of_values > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( intptr_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*reorder_buffer = memory_allocate_structure(
+	                   reorder_buffer_t );
+
+	if( *reorder_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create reorder buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *reorder_buffer,
+	     0,
+	     sizeof( reorder_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear reorder buffer.",
+		 function );
+
+		memory_free(
+		 *reorder_buffer );
+
+		*reorder_buffer = NULL;
+
+		return( -1 );
+	}
+	( *reorder_buffer )->values = (intptr_t **) memory_allocate(
+	                                             sizeof( intptr_t * ) * number_of_values );
+
+	if( ( *reorder_buffer )->values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *reorder_buffer )->values,
+	     0,
+	     sizeof( intptr_t * ) * number_of_values ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear values.",
+		 function );
+
+		goto on_error;
+	}
+	( *reorder_buffer )->number_of_values = number_of_values;
+
+	return( 1 );
+
+on_error:
+	if( *reorder_buffer != NULL )
+	{
+		if( ( *reorder_buffer )->values != NULL )
+		{
+			memory_free(
+			 ( *reorder_buffer )->values );
+		}
+		memory_free(
+		 *reorder_buffer );
+
+		*reorder_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a reorder buffer
+ * Uses the value free function to free the values that were not released
+ * Returns 1 if successful or -1 on error
+ */
+int reorder_buffer_free(
+     reorder_buffer_t **reorder_buffer,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "reorder_buffer_free";
+	int result            = 1;
+	int value_index       = 0;
+
+	if( reorder_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reorder buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *reorder_buffer != NULL )
+	{
+		if( value_free_function != NULL )
+		{
+			for( value_index = 0;
+			     value_index < ( *reorder_buffer )->number_of_values;
+			     value_index++ )
+			{
+				if( ( *reorder_buffer )->values[ value_index ] == NULL )
+				{
+					continue;
+				}
+				if( value_free_function(
+				     &( ( *reorder_buffer )->values[ value_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free value: %d.",
+					 function,
+					 value_index );
+
+					result = -1;
+				}
+			}
+		}
+		memory_free(
+		 ( *reorder_buffer )->values );
+
+		memory_free(
+		 *reorder_buffer );
+
+		*reorder_buffer = NULL;
+	}
+	return( result );
+}
+
+/* Inserts a value
+ * The sequence number must be within the number of values of the next sequence number
+ * Returns 1 if successful or -1 on error
+ */
+int reorder_buffer_insert_value(
+     reorder_buffer_t *reorder_buffer,
+     uint64_t sequence_number,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "reorder_buffer_insert_value";
+	int value_index       = 0;
+
+	if( reorder_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reorder buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sequence_number < reorder_buffer->next_sequence_number )
+	 || ( ( sequence_number - reorder_buffer->next_sequence_number ) >= (uint64_t) reorder_buffer->number_of_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sequence number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	value_index = (int) ( sequence_number % (uint64_t) reorder_buffer->number_of_values );
+
+	if( reorder_buffer->values[ value_index ] != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid reorder buffer - value: %d already set.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	reorder_buffer->values[ value_index ] = value;
+
+	return( 1 );
+}
+
+/* Retrieves the value with the next sequence number
+ * Returns 1 if successful, 0 if the value was not inserted yet or -1 on error
+ */
+int reorder_buffer_get_next_value(
+     reorder_buffer_t *reorder_buffer,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	static char *function = "reorder_buffer_get_next_value";
+	int value_index       = 0;
+
+	if( reorder_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reorder buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	value_index = (int) ( reorder_buffer->next_sequence_number % (uint64_t) reorder_buffer->number_of_values );
+
+	if( reorder_buffer->values[ value_index ] == NULL )
+	{
+		return( 0 );
+	}
+	*value = reorder_buffer->values[ value_index ];
+
+	reorder_buffer->values[ value_index ] = NULL;
+	reorder_buffer->next_sequence_number += 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,80 @@
+/*
+ * Reorder buffer
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _REORDER_BUFFER_H )
+#define _REORDER_BUFFER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "ftxftools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct reorder_buffer reorder_buffer_t;
+
+struct reorder_buffer
+{
+	/* The values
+	 * A value is stored at its sequence number modulo the number of values
+	 */
+	intptr_t **values;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The sequence number of the next value to release
+	 */
+	uint64_t next_sequence_number;
+};
+
+int reorder_buffer_initialize(
+     reorder_buffer_t **reorder_buffer,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int reorder_buffer_free(
+     reorder_buffer_t **reorder_buffer,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int reorder_buffer_insert_value(
+     reorder_buffer_t *reorder_buffer,
+     uint64_t sequence_number,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int reorder_buffer_get_next_value(
+     reorder_buffer_t *reorder_buffer,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _REORDER_BUFFER_H ) */
+
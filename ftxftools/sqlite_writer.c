@@ -0,0 +1,1343 @@
+/*
+ * SQLite writer
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libftxf.h"
+#include "ftxftools_sqlite3.h"
+#include "sqlite_writer.h"
+
+#if defined( HAVE_LIBSQLITE3 )
+
+/* The database is only written once and is not shared while it is being written,
+ * hence journaling and synchronous writes are disabled
+ */
+static const char *sqlite_writer_pragma_statements = \
+	"PRAGMA journal_mode = OFF;"
+	"PRAGMA synchronous = OFF;"
+	"PRAGMA locking_mode = EXCLUSIVE;"
+	"PRAGMA temp_store = MEMORY;"
+	"PRAGMA cache_size = -65536;";
+
+/* The tables are created without indexes, 64-bit unsigned values are stored
+ * as their signed 64-bit equivalent
+ */
+static const char *sqlite_writer_create_table_statements = \
+	"CREATE TABLE records ("
+	"record_number INTEGER PRIMARY KEY, "
+	"record_type INTEGER, "
+	"record_size INTEGER, "
+	"file_identifier INTEGER, "
+	"file_reference INTEGER, "
+	"guid BLOB, "
+	"timestamp INTEGER, "
+	"number_of_update_journal_entries INTEGER, "
+	"name TEXT, "
+	"creation_time INTEGER, "
+	"modification_time INTEGER, "
+	"entry_modification_time INTEGER, "
+	"access_time INTEGER, "
+	"allocated_file_size INTEGER, "
+	"file_size INTEGER, "
+	"file_attribute_flags INTEGER);"
+	"CREATE TABLE update_journal_entries ("
+	"record_number INTEGER, "
+	"entry_index INTEGER, "
+	"update_sequence_number INTEGER, "
+	"update_time INTEGER, "
+	"file_reference INTEGER, "
+	"parent_file_reference INTEGER, "
+	"update_reason_flags INTEGER, "
+	"update_source_flags INTEGER, "
+	"file_attribute_flags INTEGER, "
+	"name TEXT);";
+
+/* The indexes are created after all rows have been inserted, which is
+ * considerably faster than maintaining them during the inserts
+ */
+static const char *sqlite_writer_create_index_statements = \
+	"CREATE INDEX records_file_reference ON records (file_reference);"
+	"CREATE INDEX records_timestamp ON records (timestamp);"
+	"CREATE INDEX update_journal_entries_record_number ON update_journal_entries (record_number);"
+	"CREATE INDEX update_journal_entries_file_reference ON update_journal_entries (file_reference);"
+	"CREATE INDEX update_journal_entries_parent_file_reference ON update_journal_entries (parent_file_reference);";
+
+static const char *sqlite_writer_insert_record_statement = \
+	"INSERT INTO records VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
+
+static const char *sqlite_writer_insert_update_journal_entry_statement = \
+	"INSERT INTO update_journal_entries VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
+
+/* Creates a SQLite writer
+ * Make sure the value sqlite_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_initialize(
+     sqlite_writer_t **sqlite_writer,
+     size_t memory_limit,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_writer_initialize";
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sqlite_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid SQLite writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*sqlite_writer = memory_allocate_structure(
+	                  sqlite_writer_t );
+
+	if( *sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create SQLite writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sqlite_writer,
+	     0,
+	     sizeof( sqlite_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear SQLite writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libftxf_name_pool_initialize(
+	     &( ( *sqlite_writer )->name_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create name pool.",
+		 function );
+
+		goto on_error;
+	}
+	( *sqlite_writer )->memory_limit = memory_limit;
+
+	return( 1 );
+
+on_error:
+	if( *sqlite_writer != NULL )
+	{
+		memory_free(
+		 *sqlite_writer );
+
+		*sqlite_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a SQLite writer
+ * A database that was not closed is closed without creating the indexes
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_free(
+     sqlite_writer_t **sqlite_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_writer_free";
+	int result            = 1;
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sqlite_writer != NULL )
+	{
+		if( ( *sqlite_writer )->insert_update_journal_entry_statement != NULL )
+		{
+			sqlite3_finalize(
+			 ( *sqlite_writer )->insert_update_journal_entry_statement );
+		}
+		if( ( *sqlite_writer )->insert_record_statement != NULL )
+		{
+			sqlite3_finalize(
+			 ( *sqlite_writer )->insert_record_statement );
+		}
+		if( ( *sqlite_writer )->database != NULL )
+		{
+			sqlite3_close(
+			 ( *sqlite_writer )->database );
+		}
+		if( ( *sqlite_writer )->name != NULL )
+		{
+			memory_free(
+			 ( *sqlite_writer )->name );
+		}
+		if( libftxf_name_pool_free(
+		     &( ( *sqlite_writer )->name_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free name pool.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *sqlite_writer );
+
+		*sqlite_writer = NULL;
+	}
+	return( result );
+}
+
+/* Executes one or more SQL statements that do not return rows
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_execute(
+     sqlite_writer_t *sqlite_writer,
+     const char *statement,
+     libcerror_error_t **error )
+{
+	char *error_message   = NULL;
+	static char *function = "sqlite_writer_execute";
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer->database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid SQLite writer - missing database.",
+		 function );
+
+		return( -1 );
+	}
+	if( statement == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statement.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite3_exec(
+	     sqlite_writer->database,
+	     statement,
+	     NULL,
+	     NULL,
+	     &error_message ) != SQLITE_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to execute statement with error: %s.",
+		 function,
+		 ( error_message != NULL ) ? error_message : "unknown" );
+
+		if( error_message != NULL )
+		{
+			sqlite3_free(
+			 error_message );
+		}
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a SQLite writer
+ * Creates the tables, prepares the insert statements and starts the first transaction
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_open(
+     sqlite_writer_t *sqlite_writer,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_writer_open";
+	int result            = 0;
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer->database != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid SQLite writer - database value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = sqlite3_open16(
+	          (const void *) filename,
+	          &( sqlite_writer->database ) );
+#else
+	result = sqlite3_open_v2(
+	          filename,
+	          &( sqlite_writer->database ),
+	          SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE,
+	          NULL );
+#endif
+	if( result != SQLITE_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open database with error: %s.",
+		 function,
+		 sqlite3_errstr(
+		  result ) );
+
+		goto on_error;
+	}
+	if( sqlite_writer_execute(
+	     sqlite_writer,
+	     sqlite_writer_pragma_statements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set database options.",
+		 function );
+
+		goto on_error;
+	}
+	if( sqlite_writer_execute(
+	     sqlite_writer,
+	     sqlite_writer_create_table_statements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to create tables.",
+		 function );
+
+		goto on_error;
+	}
+	if( sqlite3_prepare_v2(
+	     sqlite_writer->database,
+	     sqlite_writer_insert_record_statement,
+	     -1,
+	     &( sqlite_writer->insert_record_statement ),
+	     NULL ) != SQLITE_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to prepare insert record statement with error: %s.",
+		 function,
+		 sqlite3_errmsg(
+		  sqlite_writer->database ) );
+
+		goto on_error;
+	}
+	if( sqlite3_prepare_v2(
+	     sqlite_writer->database,
+	     sqlite_writer_insert_update_journal_entry_statement,
+	     -1,
+	     &( sqlite_writer->insert_update_journal_entry_statement ),
+	     NULL ) != SQLITE_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to prepare insert update journal entry statement with error: %s.",
+		 function,
+		 sqlite3_errmsg(
+		  sqlite_writer->database ) );
+
+		goto on_error;
+	}
+	if( sqlite_writer_execute(
+	     sqlite_writer,
+	     "BEGIN TRANSACTION;",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to begin transaction.",
+		 function );
+
+		goto on_error;
+	}
+	sqlite_writer->transaction_is_active  = 1;
+	sqlite_writer->number_of_pending_rows = 0;
+	sqlite_writer->number_of_records      = 0;
+
+	return( 1 );
+
+on_error:
+	if( sqlite_writer->insert_update_journal_entry_statement != NULL )
+	{
+		sqlite3_finalize(
+		 sqlite_writer->insert_update_journal_entry_statement );
+
+		sqlite_writer->insert_update_journal_entry_statement = NULL;
+	}
+	if( sqlite_writer->insert_record_statement != NULL )
+	{
+		sqlite3_finalize(
+		 sqlite_writer->insert_record_statement );
+
+		sqlite_writer->insert_record_statement = NULL;
+	}
+	if( sqlite_writer->database != NULL )
+	{
+		sqlite3_close(
+		 sqlite_writer->database );
+
+		sqlite_writer->database = NULL;
+	}
+	return( -1 );
+}
+
+/* Closes a SQLite writer
+ * Commits the active transaction and creates the indexes
+ * Returns 0 if successful or -1 on error
+ */
+int sqlite_writer_close(
+     sqlite_writer_t *sqlite_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_writer_close";
+	int result            = 0;
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer->database == NULL )
+	{
+		return( 0 );
+	}
+	if( sqlite_writer->insert_update_journal_entry_statement != NULL )
+	{
+		sqlite3_finalize(
+		 sqlite_writer->insert_update_journal_entry_statement );
+
+		sqlite_writer->insert_update_journal_entry_statement = NULL;
+	}
+	if( sqlite_writer->insert_record_statement != NULL )
+	{
+		sqlite3_finalize(
+		 sqlite_writer->insert_record_statement );
+
+		sqlite_writer->insert_record_statement = NULL;
+	}
+	if( sqlite_writer->transaction_is_active != 0 )
+	{
+		sqlite_writer->transaction_is_active = 0;
+
+		if( sqlite_writer_execute(
+		     sqlite_writer,
+		     "COMMIT TRANSACTION;",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to commit transaction.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 0 )
+	{
+		if( sqlite_writer_execute(
+		     sqlite_writer,
+		     sqlite_writer_create_index_statements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to create indexes.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( sqlite3_close(
+	     sqlite_writer->database ) != SQLITE_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close database.",
+		 function );
+
+		result = -1;
+	}
+	sqlite_writer->database = NULL;
+
+	return( result );
+}
+
+/* Ends the active transaction and starts a new one once enough rows have been inserted
+ * Returns 1 if successful or -1 on error
+ */
+static int sqlite_writer_update_transaction(
+            sqlite_writer_t *sqlite_writer,
+            libcerror_error_t **error )
+{
+	static char *function = "sqlite_writer_update_transaction";
+
+	sqlite_writer->number_of_pending_rows += 1;
+
+	if( sqlite_writer->number_of_pending_rows < SQLITE_WRITER_MAXIMUM_NUMBER_OF_PENDING_ROWS )
+	{
+		return( 1 );
+	}
+	sqlite_writer->transaction_is_active = 0;
+
+	if( sqlite_writer_execute(
+	     sqlite_writer,
+	     "COMMIT TRANSACTION;",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to commit transaction.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer_execute(
+	     sqlite_writer,
+	     "BEGIN TRANSACTION;",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to begin transaction.",
+		 function );
+
+		return( -1 );
+	}
+	sqlite_writer->transaction_is_active  = 1;
+	sqlite_writer->number_of_pending_rows = 0;
+
+	return( 1 );
+}
+
+/* Writes a specific update journal (USN) entry of a record
+ * The entry refers to the last record written
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_write_update_journal_entry(
+     sqlite_writer_t *sqlite_writer,
+     libftxf_record_t *record,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	sqlite3_stmt *statement         = NULL;
+	uint8_t *reallocation           = NULL;
+	static char *function           = "sqlite_writer_write_update_journal_entry";
+	size_t name_size                = 0;
+	uint64_t file_reference         = 0;
+	uint64_t parent_file_reference  = 0;
+	uint64_t update_sequence_number = 0;
+	uint64_t update_time            = 0;
+	uint32_t file_attribute_flags   = 0;
+	uint32_t update_reason_flags    = 0;
+	uint32_t update_source_flags    = 0;
+	int result                      = 0;
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer->insert_update_journal_entry_statement == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid SQLite writer - missing insert update journal entry statement.",
+		 function );
+
+		return( -1 );
+	}
+	statement = sqlite_writer->insert_update_journal_entry_statement;
+
+	if( libftxf_record_get_update_journal_entry_values(
+	     record,
+	     entry_index,
+	     &update_sequence_number,
+	     &update_time,
+	     &file_reference,
+	     &parent_file_reference,
+	     &update_reason_flags,
+	     &update_source_flags,
+	     &file_attribute_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update journal entry: %d values.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	result = libftxf_record_get_update_journal_entry_utf8_name_size(
+	          record,
+	          entry_index,
+	          &name_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update journal entry: %d name size.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( name_size > sqlite_writer->name_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            sqlite_writer->name,
+			                            sizeof( uint8_t ) * name_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize name buffer.",
+				 function );
+
+				return( -1 );
+			}
+			sqlite_writer->name      = reallocation;
+			sqlite_writer->name_size = name_size;
+		}
+		if( libftxf_record_get_update_journal_entry_utf8_name(
+		     record,
+		     entry_index,
+		     sqlite_writer->name,
+		     sqlite_writer->name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve update journal entry: %d name.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	/* The statement is executed before the name buffer is reused, hence the name does not need to be copied
+	 */
+	result = sqlite3_bind_int64(
+	          statement,
+	          1,
+	          (sqlite3_int64) sqlite_writer->number_of_records );
+
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int(
+		          statement,
+		          2,
+		          entry_index );
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int64(
+		          statement,
+		          3,
+		          (sqlite3_int64) update_sequence_number );
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int64(
+		          statement,
+		          4,
+		          (sqlite3_int64) update_time );
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int64(
+		          statement,
+		          5,
+		          (sqlite3_int64) file_reference );
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int64(
+		          statement,
+		          6,
+		          (sqlite3_int64) parent_file_reference );
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int64(
+		          statement,
+		          7,
+		          (sqlite3_int64) update_reason_flags );
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int64(
+		          statement,
+		          8,
+		          (sqlite3_int64) update_source_flags );
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int64(
+		          statement,
+		          9,
+		          (sqlite3_int64) file_attribute_flags );
+	}
+	if( result == SQLITE_OK )
+	{
+		if( name_size > 1 )
+		{
+			result = sqlite3_bind_text(
+			          statement,
+			          10,
+			          (const char *) sqlite_writer->name,
+			          (int) ( name_size - 1 ),
+			          SQLITE_STATIC );
+		}
+		else
+		{
+			result = sqlite3_bind_null(
+			          statement,
+			          10 );
+		}
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_step(
+		          statement );
+	}
+	sqlite3_reset(
+	 statement );
+
+	if( result != SQLITE_DONE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to insert update journal entry: %d with error: %s.",
+		 function,
+		 entry_index,
+		 sqlite3_errmsg(
+		  sqlite_writer->database ) );
+
+		return( -1 );
+	}
+	if( sqlite_writer_update_transaction(
+	     sqlite_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to update transaction.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a record and its update journal (USN) entries
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_write_record(
+     sqlite_writer_t *sqlite_writer,
+     libftxf_record_t *record,
+     libcerror_error_t **error )
+{
+	uint8_t guid_data[ 16 ];
+	uint64_t file_metadata_values[ 7 ];
+
+	libftxf_file_metadata_t file_metadata;
+
+	sqlite3_stmt *statement  = NULL;
+	uint8_t *reallocation    = NULL;
+	static char *function    = "sqlite_writer_write_record";
+	size_t name_pool_size    = 0;
+	size_t name_size         = 0;
+	uint64_t file_identifier = 0;
+	uint64_t file_reference  = 0;
+	uint64_t timestamp       = 0;
+	uint32_t name_index      = 0;
+	uint32_t record_size     = 0;
+	uint16_t record_type     = 0;
+	int entry_index          = 0;
+	int has_file_metadata    = 0;
+	int number_of_entries    = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer->insert_record_statement == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid SQLite writer - missing insert record statement.",
+		 function );
+
+		return( -1 );
+	}
+	statement = sqlite_writer->insert_record_statement;
+
+	if( libftxf_record_get_type(
+	     record,
+	     &record_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_record_get_size(
+	     record,
+	     &record_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_record_get_file_identifier(
+	     record,
+	     &file_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_record_get_file_reference(
+	     record,
+	     &file_reference,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_record_get_guid(
+	     record,
+	     guid_data,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve GUID.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_record_get_timestamp(
+	     record,
+	     &timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_record_get_number_of_update_journal_entries(
+	     record,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of update journal entries.",
+		 function );
+
+		return( -1 );
+	}
+	has_file_metadata = libftxf_record_get_file_metadata(
+	                     record,
+	                     &file_metadata,
+	                     error );
+
+	if( has_file_metadata == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file metadata.",
+		 function );
+
+		return( -1 );
+	}
+	else if( has_file_metadata != 0 )
+	{
+		file_metadata_values[ 0 ] = file_metadata.creation_time;
+		file_metadata_values[ 1 ] = file_metadata.modification_time;
+		file_metadata_values[ 2 ] = file_metadata.entry_modification_time;
+		file_metadata_values[ 3 ] = file_metadata.access_time;
+		file_metadata_values[ 4 ] = file_metadata.allocated_file_size;
+		file_metadata_values[ 5 ] = file_metadata.file_size;
+		file_metadata_values[ 6 ] = file_metadata.file_attribute_flags;
+	}
+	/* The name pool only caches decoded names, hence it is emptied instead of
+	 * growing beyond the memory limit
+	 */
+	if( libftxf_name_pool_get_allocated_size(
+	     sqlite_writer->name_pool,
+	     &name_pool_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name pool allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_pool_size > sqlite_writer->memory_limit )
+	{
+		if( libftxf_name_pool_free(
+		     &( sqlite_writer->name_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free name pool.",
+			 function );
+
+			return( -1 );
+		}
+		if( libftxf_name_pool_initialize(
+		     &( sqlite_writer->name_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create name pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The same names recur in many records, hence the names are decoded by the name pool
+	 */
+	result = libftxf_name_pool_append_record_name(
+	          sqlite_writer->name_pool,
+	          record,
+	          &name_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name to name pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( libftxf_name_pool_get_utf8_name_size(
+		     sqlite_writer->name_pool,
+		     name_index,
+		     &name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name: %" PRIu32 " size.",
+			 function,
+			 name_index );
+
+			return( -1 );
+		}
+		if( name_size > sqlite_writer->name_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            sqlite_writer->name,
+			                            sizeof( uint8_t ) * name_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize name buffer.",
+				 function );
+
+				return( -1 );
+			}
+			sqlite_writer->name      = reallocation;
+			sqlite_writer->name_size = name_size;
+		}
+		if( libftxf_name_pool_get_utf8_name(
+		     sqlite_writer->name_pool,
+		     name_index,
+		     sqlite_writer->name,
+		     sqlite_writer->name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name: %" PRIu32 ".",
+			 function,
+			 name_index );
+
+			return( -1 );
+		}
+	}
+	sqlite_writer->number_of_records += 1;
+
+	result = sqlite3_bind_int64(
+	          statement,
+	          1,
+	          (sqlite3_int64) sqlite_writer->number_of_records );
+
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int(
+		          statement,
+		          2,
+		          (int) record_type );
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int64(
+		          statement,
+		          3,
+		          (sqlite3_int64) record_size );
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int64(
+		          statement,
+		          4,
+		          (sqlite3_int64) file_identifier );
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int64(
+		          statement,
+		          5,
+		          (sqlite3_int64) file_reference );
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_blob(
+		          statement,
+		          6,
+		          guid_data,
+		          16,
+		          SQLITE_STATIC );
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int64(
+		          statement,
+		          7,
+		          (sqlite3_int64) timestamp );
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_bind_int(
+		          statement,
+		          8,
+		          number_of_entries );
+	}
+	if( result == SQLITE_OK )
+	{
+		if( name_size > 1 )
+		{
+			result = sqlite3_bind_text(
+			          statement,
+			          9,
+			          (const char *) sqlite_writer->name,
+			          (int) ( name_size - 1 ),
+			          SQLITE_STATIC );
+		}
+		else
+		{
+			result = sqlite3_bind_null(
+			          statement,
+			          9 );
+		}
+	}
+	/* The file metadata columns are NULL for records without file metadata
+	 */
+	for( value_index = 0;
+	     value_index < 7;
+	     value_index++ )
+	{
+		if( result != SQLITE_OK )
+		{
+			break;
+		}
+		if( has_file_metadata != 0 )
+		{
+			result = sqlite3_bind_int64(
+			          statement,
+			          10 + value_index,
+			          (sqlite3_int64) file_metadata_values[ value_index ] );
+		}
+		else
+		{
+			result = sqlite3_bind_null(
+			          statement,
+			          10 + value_index );
+		}
+	}
+	if( result == SQLITE_OK )
+	{
+		result = sqlite3_step(
+		          statement );
+	}
+	sqlite3_reset(
+	 statement );
+
+	if( result != SQLITE_DONE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to insert record with error: %s.",
+		 function,
+		 sqlite3_errmsg(
+		  sqlite_writer->database ) );
+
+		return( -1 );
+	}
+	if( sqlite_writer_update_transaction(
+	     sqlite_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to update transaction.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( sqlite_writer_write_update_journal_entry(
+		     sqlite_writer,
+		     record,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write update journal entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBSQLITE3 ) */
+
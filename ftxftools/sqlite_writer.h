@@ -0,0 +1,132 @@
+/*
+ * SQLite writer
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SQLITE_WRITER_H )
+#define _SQLITE_WRITER_H
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libftxf.h"
+#include "ftxftools_sqlite3.h"
+
+#if defined( HAVE_LIBSQLITE3 )
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of rows inserted per transaction
+ */
+#define SQLITE_WRITER_MAXIMUM_NUMBER_OF_PENDING_ROWS	100000
+
+typedef struct sqlite_writer sqlite_writer_t;
+
+struct sqlite_writer
+{
+	/* The database
+	 */
+	sqlite3 *database;
+
+	/* The prepared statement to insert a record
+	 */
+	sqlite3_stmt *insert_record_statement;
+
+	/* The prepared statement to insert an update journal entry
+	 */
+	sqlite3_stmt *insert_update_journal_entry_statement;
+
+	/* The name pool
+	 * Contains the distinct record names, which are decoded only once
+	 */
+	libftxf_name_pool_t *name_pool;
+
+	/* The memory limit
+	 * The name pool is emptied when its allocated size exceeds the memory limit
+	 */
+	size_t memory_limit;
+
+	/* The name buffer
+	 * Contains the UTF-8 encoded name of the record or update journal entry that is being inserted
+	 */
+	uint8_t *name;
+
+	/* The name buffer size
+	 */
+	size_t name_size;
+
+	/* Value to indicate a transaction is active
+	 */
+	uint8_t transaction_is_active;
+
+	/* The number of rows inserted in the active transaction
+	 */
+	uint64_t number_of_pending_rows;
+
+	/* The number of records written
+	 */
+	uint64_t number_of_records;
+};
+
+int sqlite_writer_initialize(
+     sqlite_writer_t **sqlite_writer,
+     size_t memory_limit,
+     libcerror_error_t **error );
+
+int sqlite_writer_free(
+     sqlite_writer_t **sqlite_writer,
+     libcerror_error_t **error );
+
+int sqlite_writer_execute(
+     sqlite_writer_t *sqlite_writer,
+     const char *statement,
+     libcerror_error_t **error );
+
+int sqlite_writer_open(
+     sqlite_writer_t *sqlite_writer,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int sqlite_writer_close(
+     sqlite_writer_t *sqlite_writer,
+     libcerror_error_t **error );
+
+int sqlite_writer_write_update_journal_entry(
+     sqlite_writer_t *sqlite_writer,
+     libftxf_record_t *record,
+     int entry_index,
+     libcerror_error_t **error );
+
+int sqlite_writer_write_record(
+     sqlite_writer_t *sqlite_writer,
+     libftxf_record_t *record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* defined( HAVE_LIBSQLITE3 ) */
+
+#endif /* !defined( _SQLITE_WRITER_H ) */
+
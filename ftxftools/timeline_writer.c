@@ -0,0 +1,1030 @@
+/*
+ * Timeline writer
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libftxf.h"
+#include "timeline_writer.h"
+
+/* The timeline is sorted by means of an external merge sort: the entries are collected
+ * in a memory bounded timeline run, full runs are sorted and written to a temporary file
+ * and the sorted runs are merged when the timeline is written
+ */
+
+/* The names of the timeline entry kinds
+ */
+static const char *timeline_writer_kind_names[ 7 ] = {
+	"unknown",
+	"timestamp",
+	"creation_time",
+	"modification_time",
+	"entry_modification_time",
+	"access_time",
+	"update_time" };
+
+/* Creates a timeline writer
+ * Make sure the value timeline_writer is referencing, is set to NULL
+ * The memory limit bounds the memory used to sort and merge the runs
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_initialize(
+     timeline_writer_t **timeline_writer,
+     size_t memory_limit,
+     libcerror_error_t **error )
+{
+	static char *function                = "timeline_writer_initialize";
+	size_t maximum_number_of_run_entries = 0;
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timeline writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The timeline run requires 2 entries of memory per entry to sort
+	 */
+	maximum_number_of_run_entries = memory_limit / ( 2 * sizeof( libftxf_timeline_entry_t ) );
+
+	if( maximum_number_of_run_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libftxf_timeline_entry_t ) ) )
+	{
+		maximum_number_of_run_entries = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libftxf_timeline_entry_t );
+	}
+	if( maximum_number_of_run_entries == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid memory limit value too small.",
+		 function );
+
+		return( -1 );
+	}
+	*timeline_writer = memory_allocate_structure(
+	                    timeline_writer_t );
+
+	if( *timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timeline writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *timeline_writer,
+	     0,
+	     sizeof( timeline_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear timeline writer.",
+		 function );
+
+		memory_free(
+		 *timeline_writer );
+
+		*timeline_writer = NULL;
+
+		return( -1 );
+	}
+	( *timeline_writer )->block_buffer_size = TIMELINE_WRITER_SPILL_BLOCK_SIZE;
+
+	( *timeline_writer )->block_buffer = (uint8_t *) memory_allocate(
+	                                                  sizeof( uint8_t ) * ( *timeline_writer )->block_buffer_size );
+
+	if( ( *timeline_writer )->block_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libftxf_timeline_run_initialize(
+	     &( ( *timeline_writer )->timeline_run ),
+	     (uint32_t) maximum_number_of_run_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create timeline run.",
+		 function );
+
+		goto on_error;
+	}
+	( *timeline_writer )->memory_limit = memory_limit;
+
+	return( 1 );
+
+on_error:
+	if( *timeline_writer != NULL )
+	{
+		if( ( *timeline_writer )->block_buffer != NULL )
+		{
+			memory_free(
+			 ( *timeline_writer )->block_buffer );
+		}
+		memory_free(
+		 *timeline_writer );
+
+		*timeline_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a timeline writer
+ * The temporary files of the runs are closed, which removes them
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_free(
+     timeline_writer_t **timeline_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_writer_free";
+	int result            = 1;
+	int run_index         = 0;
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline_writer != NULL )
+	{
+		if( ( *timeline_writer )->run_streams != NULL )
+		{
+			for( run_index = 0;
+			     run_index < ( *timeline_writer )->number_of_runs;
+			     run_index++ )
+			{
+				file_stream_close(
+				 ( *timeline_writer )->run_streams[ run_index ] );
+			}
+			memory_free(
+			 ( *timeline_writer )->run_streams );
+		}
+		if( libftxf_timeline_run_free(
+		     &( ( *timeline_writer )->timeline_run ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free timeline run.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *timeline_writer )->block_buffer );
+
+		memory_free(
+		 *timeline_writer );
+
+		*timeline_writer = NULL;
+	}
+	return( result );
+}
+
+/* Sorts the entries of the timeline run and writes them to a temporary file
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_spill_run(
+     timeline_writer_t *timeline_writer,
+     libcerror_error_t **error )
+{
+	FILE **reallocation               = NULL;
+	FILE *run_stream                  = NULL;
+	static char *function             = "timeline_writer_spill_run";
+	size_t write_count                = 0;
+	uint32_t entry_index              = 0;
+	uint32_t number_of_copied_entries = 0;
+	uint32_t number_of_entries        = 0;
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_timeline_run_get_number_of_entries(
+	     timeline_writer->timeline_run,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( libftxf_timeline_run_sort(
+	     timeline_writer->timeline_run,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort timeline run.",
+		 function );
+
+		return( -1 );
+	}
+	if( timeline_writer->number_of_runs >= timeline_writer->number_of_allocated_runs )
+	{
+		reallocation = (FILE **) memory_reallocate(
+		                          timeline_writer->run_streams,
+		                          sizeof( FILE * ) * ( timeline_writer->number_of_allocated_runs + 16 ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize run streams.",
+			 function );
+
+			return( -1 );
+		}
+		timeline_writer->run_streams               = reallocation;
+		timeline_writer->number_of_allocated_runs += 16;
+	}
+	run_stream = tmpfile();
+
+	if( run_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create temporary file.",
+		 function );
+
+		return( -1 );
+	}
+	timeline_writer->run_streams[ timeline_writer->number_of_runs ] = run_stream;
+
+	timeline_writer->number_of_runs += 1;
+
+	while( entry_index < number_of_entries )
+	{
+		if( libftxf_timeline_run_copy_to_byte_stream(
+		     timeline_writer->timeline_run,
+		     entry_index,
+		     timeline_writer->block_buffer,
+		     timeline_writer->block_buffer_size,
+		     &number_of_copied_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy entries.",
+			 function );
+
+			return( -1 );
+		}
+		write_count = file_stream_write(
+		               run_stream,
+		               timeline_writer->block_buffer,
+		               (size_t) number_of_copied_entries * LIBFTXF_TIMELINE_ENTRY_SIZE );
+
+		if( write_count != ( (size_t) number_of_copied_entries * LIBFTXF_TIMELINE_ENTRY_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write run.",
+			 function );
+
+			return( -1 );
+		}
+		entry_index += number_of_copied_entries;
+	}
+	if( libftxf_timeline_run_empty(
+	     timeline_writer->timeline_run,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to empty timeline run.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the timestamps of a record to the timeline
+ * The timeline run is written to a temporary file when it is full
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_append_record(
+     timeline_writer_t *timeline_writer,
+     libftxf_record_t *record,
+     uint64_t record_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_writer_append_record";
+	int result            = 0;
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	result = libftxf_timeline_run_append_record(
+	          timeline_writer->timeline_run,
+	          record,
+	          record_offset,
+	          error );
+
+	if( result == 0 )
+	{
+		if( timeline_writer_spill_run(
+		     timeline_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write timeline run.",
+			 function );
+
+			return( -1 );
+		}
+		result = libftxf_timeline_run_append_record(
+		          timeline_writer->timeline_run,
+		          record,
+		          record_offset,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record to timeline run.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the batch entries to the output stream
+ * Every entry is written as a line that contains the ISO 8601 date and time, the kind,
+ * the record offset and the update journal entry index separated by tabs
+ * The FILETIMEs are converted per batch, if the batch contains a FILETIME that cannot
+ * be represented as an ISO 8601 date and time, such as 0, the FILETIME is written in hexadecimal
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_flush_batch(
+     timeline_writer_t *timeline_writer,
+     FILE *output_stream,
+     libcerror_error_t **error )
+{
+	libftxf_timeline_entry_t *timeline_entry = NULL;
+	const char *kind_name                    = NULL;
+	uint8_t *iso8601_string                  = NULL;
+	static char *function                    = "timeline_writer_flush_batch";
+	size_t batch_index                       = 0;
+	int print_count                          = 0;
+	int result                               = 0;
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( timeline_writer->number_of_batch_entries == 0 )
+	{
+		return( 1 );
+	}
+	for( batch_index = 0;
+	     batch_index < timeline_writer->number_of_batch_entries;
+	     batch_index++ )
+	{
+		timeline_writer->batch_filetimes[ batch_index ] = timeline_writer->batch_entries[ batch_index ].filetime;
+	}
+	result = libftxf_filetime_copy_to_utf8_iso8601_strings(
+	          timeline_writer->batch_filetimes,
+	          timeline_writer->number_of_batch_entries,
+	          timeline_writer->batch_strings,
+	          TIMELINE_WRITER_BATCH_SIZE * LIBFTXF_FILETIME_ISO8601_STRING_SIZE,
+	          NULL );
+
+	for( batch_index = 0;
+	     batch_index < timeline_writer->number_of_batch_entries;
+	     batch_index++ )
+	{
+		timeline_entry = &( timeline_writer->batch_entries[ batch_index ] );
+		iso8601_string = &( timeline_writer->batch_strings[ batch_index * LIBFTXF_FILETIME_ISO8601_STRING_SIZE ] );
+
+		if( result != 1 )
+		{
+			/* Convert the entries of a batch that failed one at a time
+			 */
+			if( libftxf_filetime_copy_to_utf8_iso8601_strings(
+			     &( timeline_entry->filetime ),
+			     1,
+			     iso8601_string,
+			     LIBFTXF_FILETIME_ISO8601_STRING_SIZE,
+			     NULL ) != 1 )
+			{
+				iso8601_string = NULL;
+			}
+		}
+		if( timeline_entry->kind <= LIBFTXF_TIMELINE_ENTRY_KIND_UPDATE_TIME )
+		{
+			kind_name = timeline_writer_kind_names[ timeline_entry->kind ];
+		}
+		else
+		{
+			kind_name = timeline_writer_kind_names[ 0 ];
+		}
+		if( iso8601_string != NULL )
+		{
+			print_count = fprintf(
+			               output_stream,
+			               "%s\t%s\t%" PRIu64 "\t%" PRIu32 "\n",
+			               (char *) iso8601_string,
+			               kind_name,
+			               timeline_entry->record_offset,
+			               timeline_entry->entry_index );
+		}
+		else
+		{
+			print_count = fprintf(
+			               output_stream,
+			               "0x%016" PRIx64 "\t%s\t%" PRIu64 "\t%" PRIu32 "\n",
+			               timeline_entry->filetime,
+			               kind_name,
+			               timeline_entry->record_offset,
+			               timeline_entry->entry_index );
+		}
+		if( print_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	timeline_writer->number_of_entries      += timeline_writer->number_of_batch_entries;
+	timeline_writer->number_of_batch_entries = 0;
+
+	return( 1 );
+}
+
+/* Writes an entry
+ * The entry is added to the batch, which is written when full
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_write_entry(
+     timeline_writer_t *timeline_writer,
+     libftxf_timeline_entry_t *timeline_entry,
+     FILE *output_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_writer_write_entry";
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( timeline_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline entry.",
+		 function );
+
+		return( -1 );
+	}
+	timeline_writer->batch_entries[ timeline_writer->number_of_batch_entries ] = *timeline_entry;
+
+	timeline_writer->number_of_batch_entries += 1;
+
+	if( timeline_writer->number_of_batch_entries >= TIMELINE_WRITER_BATCH_SIZE )
+	{
+		if( timeline_writer_flush_batch(
+		     timeline_writer,
+		     output_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write batch.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Merges the runs in the temporary files and writes the entries to the output stream
+ * The timeline run is freed first, so that its memory can be used for the read buffers of the runs
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_merge_runs(
+     timeline_writer_t *timeline_writer,
+     FILE *output_stream,
+     libcerror_error_t **error )
+{
+	libftxf_timeline_entry_t timeline_entry;
+
+	libftxf_timeline_merger_t *timeline_merger = NULL;
+	uint8_t *read_buffer                       = NULL;
+	uint8_t *run_data                          = NULL;
+	static char *function                      = "timeline_writer_merge_runs";
+	size_t read_count                          = 0;
+	size_t run_buffer_size                     = 0;
+	int result                                 = 0;
+	int run_index                              = 0;
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( timeline_writer->number_of_runs <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid timeline writer - missing runs.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_timeline_run_free(
+	     &( timeline_writer->timeline_run ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free timeline run.",
+		 function );
+
+		goto on_error;
+	}
+	/* Every run is read in blocks of an equal share of the memory limit
+	 */
+	run_buffer_size = timeline_writer->memory_limit / timeline_writer->number_of_runs;
+
+	if( run_buffer_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / timeline_writer->number_of_runs ) )
+	{
+		run_buffer_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / timeline_writer->number_of_runs;
+	}
+	run_buffer_size -= run_buffer_size % LIBFTXF_TIMELINE_ENTRY_SIZE;
+
+	if( run_buffer_size == 0 )
+	{
+		run_buffer_size = LIBFTXF_TIMELINE_ENTRY_SIZE;
+	}
+	read_buffer = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * run_buffer_size * timeline_writer->number_of_runs );
+
+	if( read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	for( run_index = 0;
+	     run_index < timeline_writer->number_of_runs;
+	     run_index++ )
+	{
+		if( file_stream_seek_offset(
+		     timeline_writer->run_streams[ run_index ],
+		     0,
+		     SEEK_SET ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek start of run: %d.",
+			 function,
+			 run_index );
+
+			goto on_error;
+		}
+	}
+	if( libftxf_timeline_merger_initialize(
+	     &timeline_merger,
+	     timeline_writer->number_of_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create timeline merger.",
+		 function );
+
+		goto on_error;
+	}
+	while( 1 )
+	{
+		do
+		{
+			result = libftxf_timeline_merger_get_run_needing_data(
+			          timeline_merger,
+			          &run_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve run needing data.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				run_data = &( read_buffer[ run_index * run_buffer_size ] );
+
+				read_count = file_stream_read(
+				              timeline_writer->run_streams[ run_index ],
+				              run_data,
+				              run_buffer_size );
+
+				if( ( ( read_count == 0 )
+				  &&  ( ferror( timeline_writer->run_streams[ run_index ] ) != 0 ) )
+				 || ( ( read_count % LIBFTXF_TIMELINE_ENTRY_SIZE ) != 0 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read run: %d.",
+					 function,
+					 run_index );
+
+					goto on_error;
+				}
+				if( libftxf_timeline_merger_set_run_data(
+				     timeline_merger,
+				     run_index,
+				     run_data,
+				     read_count,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set data of run: %d.",
+					 function,
+					 run_index );
+
+					goto on_error;
+				}
+			}
+		}
+		while( result != 0 );
+
+		result = libftxf_timeline_merger_get_next_entry(
+		          timeline_merger,
+		          &timeline_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( timeline_writer_write_entry(
+		     timeline_writer,
+		     &timeline_entry,
+		     output_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libftxf_timeline_merger_free(
+	     &timeline_merger,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free timeline merger.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 read_buffer );
+
+	return( 1 );
+
+on_error:
+	if( timeline_merger != NULL )
+	{
+		libftxf_timeline_merger_free(
+		 &timeline_merger,
+		 NULL );
+	}
+	if( read_buffer != NULL )
+	{
+		memory_free(
+		 read_buffer );
+	}
+	return( -1 );
+}
+
+/* Writes the timeline to the output stream
+ * If all entries fit in the timeline run they are sorted in memory, otherwise the last run
+ * is written to a temporary file as well and the runs are merged
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_write(
+     timeline_writer_t *timeline_writer,
+     FILE *output_stream,
+     libcerror_error_t **error )
+{
+	libftxf_timeline_entry_t timeline_entry;
+
+	static char *function      = "timeline_writer_write";
+	uint32_t entry_index       = 0;
+	uint32_t number_of_entries = 0;
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( timeline_writer->number_of_runs > 0 )
+	{
+		if( timeline_writer_spill_run(
+		     timeline_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write timeline run.",
+			 function );
+
+			return( -1 );
+		}
+		if( timeline_writer_merge_runs(
+		     timeline_writer,
+		     output_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to merge runs.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libftxf_timeline_run_sort(
+		     timeline_writer->timeline_run,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sort timeline run.",
+			 function );
+
+			return( -1 );
+		}
+		if( libftxf_timeline_run_get_number_of_entries(
+		     timeline_writer->timeline_run,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries.",
+			 function );
+
+			return( -1 );
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libftxf_timeline_run_get_entry_by_index(
+			     timeline_writer->timeline_run,
+			     entry_index,
+			     &timeline_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %" PRIu32 ".",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( timeline_writer_write_entry(
+			     timeline_writer,
+			     &timeline_entry,
+			     output_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write entry.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( timeline_writer_flush_batch(
+	     timeline_writer,
+	     output_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write batch.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,144 @@
+/*
+ * Timeline writer
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _TIMELINE_WRITER_H )
+#define _TIMELINE_WRITER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "ftxftools_libcerror.h"
+#include "ftxftools_libftxf.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of entries that are formatted per batch
+ */
+#define TIMELINE_WRITER_BATCH_SIZE			256
+
+/* The size of the blocks in which a run is written to its temporary file
+ */
+#define TIMELINE_WRITER_SPILL_BLOCK_SIZE		4096 * LIBFTXF_TIMELINE_ENTRY_SIZE
+
+typedef struct timeline_writer timeline_writer_t;
+
+struct timeline_writer
+{
+	/* The memory limit
+	 */
+	size_t memory_limit;
+
+	/* The timeline run
+	 * Contains the entries that have not been written to a temporary file
+	 */
+	libftxf_timeline_run_t *timeline_run;
+
+	/* The run streams
+	 * Contains the temporary files of the sorted runs
+	 */
+	FILE **run_streams;
+
+	/* The number of runs
+	 */
+	int number_of_runs;
+
+	/* The number of allocated runs
+	 */
+	int number_of_allocated_runs;
+
+	/* The block buffer
+	 */
+	uint8_t *block_buffer;
+
+	/* The block buffer size
+	 */
+	size_t block_buffer_size;
+
+	/* The batch entries
+	 */
+	libftxf_timeline_entry_t batch_entries[ TIMELINE_WRITER_BATCH_SIZE ];
+
+	/* The batch FILETIMEs
+	 */
+	uint64_t batch_filetimes[ TIMELINE_WRITER_BATCH_SIZE ];
+
+	/* The batch ISO 8601 strings
+	 */
+	uint8_t batch_strings[ TIMELINE_WRITER_BATCH_SIZE * LIBFTXF_FILETIME_ISO8601_STRING_SIZE ];
+
+	/* The number of batch entries
+	 */
+	size_t number_of_batch_entries;
+
+	/* The number of entries written
+	 */
+	uint64_t number_of_entries;
+};
+
+int timeline_writer_initialize(
+     timeline_writer_t **timeline_writer,
+     size_t memory_limit,
+     libcerror_error_t **error );
+
+int timeline_writer_free(
+     timeline_writer_t **timeline_writer,
+     libcerror_error_t **error );
+
+int timeline_writer_spill_run(
+     timeline_writer_t *timeline_writer,
+     libcerror_error_t **error );
+
+int timeline_writer_append_record(
+     timeline_writer_t *timeline_writer,
+     libftxf_record_t *record,
+     uint64_t record_offset,
+     libcerror_error_t **error );
+
+int timeline_writer_flush_batch(
+     timeline_writer_t *timeline_writer,
+     FILE *output_stream,
+     libcerror_error_t **error );
+
+int timeline_writer_write_entry(
+     timeline_writer_t *timeline_writer,
+     libftxf_timeline_entry_t *timeline_entry,
+     FILE *output_stream,
+     libcerror_error_t **error );
+
+int timeline_writer_merge_runs(
+     timeline_writer_t *timeline_writer,
+     FILE *output_stream,
+     libcerror_error_t **error );
+
+int timeline_writer_write(
+     timeline_writer_t *timeline_writer,
+     FILE *output_stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _TIMELINE_WRITER_H ) */
+
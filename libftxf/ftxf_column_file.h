@@ -0,0 +1,125 @@
+/*
+ * The columnar export file definition
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FTXF_COLUMN_FILE_H )
+#define _FTXF_COLUMN_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct ftxf_column_file_header ftxf_column_file_header_t;
+
+struct ftxf_column_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The number of column types
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_column_types[ 4 ];
+};
+
+typedef struct ftxf_column_chunk_header ftxf_column_chunk_header_t;
+
+struct ftxf_column_chunk_header
+{
+	/* The signature
+	 * Consists of 4 bytes
+	 */
+	uint8_t signature[ 4 ];
+
+	/* The chunk size
+	 * Includes the chunk header
+	 * Consists of 4 bytes
+	 */
+	uint8_t chunk_size[ 4 ];
+
+	/* The number of records
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_records[ 4 ];
+
+	/* The flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The number of GUIDs in the GUID dictionary
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_guids[ 4 ];
+
+	/* The number of names in the name dictionary
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_names[ 4 ];
+
+	/* The size of the name dictionary data
+	 * Consists of 4 bytes
+	 */
+	uint8_t names_data_size[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding1[ 4 ];
+
+	/* The minimum (header) timestamp
+	 * Contains a FILETIME
+	 * Consists of 8 bytes
+	 */
+	uint8_t minimum_timestamp[ 8 ];
+
+	/* The maximum (header) timestamp
+	 * Contains a FILETIME
+	 * Consists of 8 bytes
+	 */
+	uint8_t maximum_timestamp[ 8 ];
+
+	/* The minimum file reference
+	 * Consists of 8 bytes
+	 */
+	uint8_t minimum_file_reference[ 8 ];
+
+	/* The maximum file reference
+	 * Consists of 8 bytes
+	 */
+	uint8_t maximum_file_reference[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FTXF_COLUMN_FILE_H ) */
+
@@ -99,6 +99,50 @@ struct ftxf_record_header
 	uint8_t unknown10[ 8 ];
 };
 
+typedef struct ftxf_record_file_metadata ftxf_record_file_metadata_t;
+
+struct ftxf_record_file_metadata
+{
+	/* The creation time
+	 * Consists of 8 bytes
+	 * Contains a FILETIME
+	 */
+	uint8_t creation_time[ 8 ];
+
+	/* The modification time
+	 * Consists of 8 bytes
+	 * Contains a FILETIME
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* The entry modification time
+	 * Consists of 8 bytes
+	 * Contains a FILETIME
+	 */
+	uint8_t entry_modification_time[ 8 ];
+
+	/* The access time
+	 * Consists of 8 bytes
+	 * Contains a FILETIME
+	 */
+	uint8_t access_time[ 8 ];
+
+	/* The allocated file size
+	 * Consists of 8 bytes
+	 */
+	uint8_t allocated_file_size[ 8 ];
+
+	/* The file size
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The file attribute flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_attribute_flags[ 4 ];
+};
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,159 @@
+/*
+ * Allocator functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+/* The allocator functions route the allocations of an object to the allocator of the caller.
+ * An allocator without functions, as well as no allocator, uses the default memory functions.
+ */
+
+/* Checks if the allocator functions are set
+ * Either all or none of the allocator functions must be set
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_allocator_check(
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_allocator_check";
+
+	if( allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocator->allocate_function == NULL )
+	 && ( allocator->reallocate_function == NULL )
+	 && ( allocator->free_function == NULL ) )
+	{
+		return( 1 );
+	}
+	if( allocator->allocate_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocator - missing allocate function.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator->reallocate_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocator - missing reallocate function.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator->free_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocator - missing free function.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Allocates memory
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *libftxf_allocator_allocate(
+       const libftxf_allocator_t *allocator,
+       size_t size )
+{
+	if( ( allocator == NULL )
+	 || ( allocator->allocate_function == NULL ) )
+	{
+		return( memory_allocate(
+		         size ) );
+	}
+	return( allocator->allocate_function(
+	         allocator->user_context,
+	         size ) );
+}
+
+/* Reallocates memory
+ * Returns a pointer to the reallocated memory or NULL on error
+ */
+void *libftxf_allocator_reallocate(
+       const libftxf_allocator_t *allocator,
+       void *memory,
+       size_t size )
+{
+	if( ( allocator == NULL )
+	 || ( allocator->reallocate_function == NULL ) )
+	{
+		return( memory_reallocate(
+		         memory,
+		         size ) );
+	}
+	return( allocator->reallocate_function(
+	         allocator->user_context,
+	         memory,
+	         size ) );
+}
+
+/* Frees memory
+ */
+void libftxf_allocator_free(
+      const libftxf_allocator_t *allocator,
+      void *memory )
+{
+	if( memory == NULL )
+	{
+		return;
+	}
+	if( ( allocator == NULL )
+	 || ( allocator->free_function == NULL ) )
+	{
+		memory_free(
+		 memory );
+	}
+	else
+	{
+		allocator->free_function(
+		 allocator->user_context,
+		 memory );
+	}
+}
+
@@ -0,0 +1,58 @@
+/*
+ * Allocator functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_ALLOCATOR_H )
+#define _LIBFTXF_ALLOCATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libftxf_allocator_check(
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+void *libftxf_allocator_allocate(
+       const libftxf_allocator_t *allocator,
+       size_t size );
+
+void *libftxf_allocator_reallocate(
+       const libftxf_allocator_t *allocator,
+       void *memory,
+       size_t size );
+
+void libftxf_allocator_free(
+      const libftxf_allocator_t *allocator,
+      void *memory );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_ALLOCATOR_H ) */
+
@@ -0,0 +1,851 @@
+/*
+ * Block index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_block_index.h"
+#include "libftxf_definitions.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_record_filter.h"
+
+#include "ftxf_record.h"
+
+/* The number of bits set in the Bloom filter per file reference
+ */
+#define LIBFTXF_BLOCK_SUMMARY_BLOOM_FILTER_NUMBER_OF_HASHES	3
+
+/* Determines the Bloom filter bit indexes of a file reference
+ * The 64-bit finalizer of SplitMix64 is used to mix the bits of the file reference
+ * after which the indexes are derived by double hashing
+ */
+static void libftxf_block_summary_get_bloom_filter_bit_indexes(
+             uint64_t file_reference,
+             uint32_t bit_indexes[ LIBFTXF_BLOCK_SUMMARY_BLOOM_FILTER_NUMBER_OF_HASHES ] )
+{
+	uint64_t hash_value  = file_reference;
+	uint32_t hash_value1 = 0;
+	uint32_t hash_value2 = 0;
+	int hash_index       = 0;
+
+	hash_value ^= hash_value >> 30;
+	hash_value *= 0xbf58476d1ce4e5b9UL;
+	hash_value ^= hash_value >> 27;
+	hash_value *= 0x94d049bb133111ebUL;
+	hash_value ^= hash_value >> 31;
+
+	hash_value1 = (uint32_t) ( hash_value & 0xffffffffUL );
+	hash_value2 = (uint32_t) ( hash_value >> 32 ) | 1;
+
+	for( hash_index = 0;
+	     hash_index < LIBFTXF_BLOCK_SUMMARY_BLOOM_FILTER_NUMBER_OF_HASHES;
+	     hash_index++ )
+	{
+		bit_indexes[ hash_index ] = hash_value1 % ( LIBFTXF_BLOCK_SUMMARY_BLOOM_FILTER_SIZE * 8 );
+
+		hash_value1 += hash_value2;
+	}
+}
+
+/* Determines if a file reference is possibly contained in the Bloom filter of the block summary
+ * Returns 1 if the file reference is possibly contained or 0 if not
+ */
+static int libftxf_block_summary_bloom_filter_may_contain(
+            libftxf_block_summary_t *block_summary,
+            uint64_t file_reference )
+{
+	uint32_t bit_indexes[ LIBFTXF_BLOCK_SUMMARY_BLOOM_FILTER_NUMBER_OF_HASHES ];
+
+	int hash_index = 0;
+
+	libftxf_block_summary_get_bloom_filter_bit_indexes(
+	 file_reference,
+	 bit_indexes );
+
+	for( hash_index = 0;
+	     hash_index < LIBFTXF_BLOCK_SUMMARY_BLOOM_FILTER_NUMBER_OF_HASHES;
+	     hash_index++ )
+	{
+		if( ( block_summary->file_reference_bloom_filter[ bit_indexes[ hash_index ] / 8 ] & ( 1 << ( bit_indexes[ hash_index ] % 8 ) ) ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Creates a block index
+ * Make sure the value block_index is referencing, is set to NULL
+ * The block size is the size of the blocks the records are summarized in, where 0 represents the default of 64 KiB
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_block_index_initialize(
+     libftxf_block_index_t **block_index,
+     uint32_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_block_index_initialize";
+
+	if( libftxf_block_index_initialize_with_allocator(
+	     block_index,
+	     block_size,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block index.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a block index that allocates its memory using the allocator functions
+ * Make sure the value block_index is referencing, is set to NULL
+ * The block size is the size of the blocks the records are summarized in, where 0 represents the default of 64 KiB
+ * The allocator is copied into the block index, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_block_index_initialize_with_allocator(
+     libftxf_block_index_t **block_index,
+     uint32_t block_size,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	libftxf_internal_block_index_t *internal_block_index = NULL;
+	static char *function                                = "libftxf_block_index_initialize_with_allocator";
+
+	if( block_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		block_size = LIBFTXF_DEFAULT_BLOCK_INDEX_BLOCK_SIZE;
+	}
+	else if( ( block_size < sizeof( ftxf_record_header_t ) )
+	      || ( block_size > (uint32_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_block_index = (libftxf_internal_block_index_t *) libftxf_allocator_allocate(
+	                                                           allocator,
+	                                                           sizeof( libftxf_internal_block_index_t ) );
+
+	if( internal_block_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_block_index,
+	     0,
+	     sizeof( libftxf_internal_block_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block index.",
+		 function );
+
+		goto on_error;
+	}
+	if( allocator != NULL )
+	{
+		internal_block_index->allocator = *allocator;
+	}
+	internal_block_index->block_size = block_size;
+
+	*block_index = (libftxf_block_index_t *) internal_block_index;
+
+	return( 1 );
+
+on_error:
+	if( internal_block_index != NULL )
+	{
+		libftxf_allocator_free(
+		 allocator,
+		 internal_block_index );
+	}
+	return( -1 );
+}
+
+/* Frees a block index
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_block_index_free(
+     libftxf_block_index_t **block_index,
+     libcerror_error_t **error )
+{
+	libftxf_allocator_t allocator;
+
+	libftxf_internal_block_index_t *internal_block_index = NULL;
+	static char *function                                = "libftxf_block_index_free";
+
+	if( block_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_index != NULL )
+	{
+		internal_block_index = (libftxf_internal_block_index_t *) *block_index;
+		*block_index         = NULL;
+
+		if( internal_block_index->block_summaries != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_block_index->allocator ),
+			 internal_block_index->block_summaries );
+		}
+		/* The allocator is copied since it is stored in the block index that is freed
+		 */
+		allocator = internal_block_index->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
+		 internal_block_index );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific block summary
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_block_index_get_block_summary(
+     libftxf_internal_block_index_t *internal_block_index,
+     int block_number,
+     libftxf_block_summary_t **block_summary,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_internal_block_index_get_block_summary";
+
+	if( internal_block_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_number < 0 )
+	 || ( block_number >= internal_block_index->number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block summary.",
+		 function );
+
+		return( -1 );
+	}
+	*block_summary = &( internal_block_index->block_summaries[ block_number ] );
+
+	return( 1 );
+}
+
+/* Appends a record to the block index
+ * The record is summarized in the block that contains the record offset
+ * Only the record header is read from the byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_block_index_append_record(
+     libftxf_block_index_t *block_index,
+     off64_t record_offset,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	uint32_t bit_indexes[ LIBFTXF_BLOCK_SUMMARY_BLOOM_FILTER_NUMBER_OF_HASHES ];
+
+	libftxf_block_summary_t *block_summaries             = NULL;
+	libftxf_block_summary_t *block_summary               = NULL;
+	libftxf_internal_block_index_t *internal_block_index = NULL;
+	static char *function                                = "libftxf_block_index_append_record";
+	size_t block_summaries_size                          = 0;
+	uint64_t file_reference                              = 0;
+	uint64_t timestamp                                   = 0;
+	off64_t block_number                                 = 0;
+	uint16_t record_type                                 = 0;
+	int hash_index                                       = 0;
+	int number_of_allocated_blocks                       = 0;
+
+	if( block_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_index = (libftxf_internal_block_index_t *) block_index;
+
+	if( record_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid record offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < sizeof( ftxf_record_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream value too small.",
+		 function );
+
+		return( -1 );
+	}
+	block_number = record_offset / internal_block_index->block_size;
+
+	if( block_number >= (off64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_number >= (off64_t) internal_block_index->number_of_allocated_blocks )
+	{
+		if( internal_block_index->number_of_allocated_blocks == 0 )
+		{
+			number_of_allocated_blocks = 16;
+		}
+		else if( internal_block_index->number_of_allocated_blocks < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_blocks = internal_block_index->number_of_allocated_blocks * 2;
+		}
+		else
+		{
+			number_of_allocated_blocks = INT_MAX;
+		}
+		if( block_number >= (off64_t) number_of_allocated_blocks )
+		{
+			number_of_allocated_blocks = (int) block_number + 1;
+		}
+		block_summaries_size = sizeof( libftxf_block_summary_t ) * number_of_allocated_blocks;
+
+		if( ( block_summaries_size / sizeof( libftxf_block_summary_t ) ) != (size_t) number_of_allocated_blocks )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid block summaries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( block_summaries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid block summaries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		block_summaries = (libftxf_block_summary_t *) libftxf_allocator_reallocate(
+		                                               &( internal_block_index->allocator ),
+		                                               internal_block_index->block_summaries,
+		                                               block_summaries_size );
+
+		if( block_summaries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize block summaries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_block_index->block_summaries            = block_summaries;
+		internal_block_index->number_of_allocated_blocks = number_of_allocated_blocks;
+	}
+	if( block_number >= (off64_t) internal_block_index->number_of_blocks )
+	{
+		/* Blocks without records are kept empty so that they are skipped
+		 */
+		if( memory_set(
+		     &( internal_block_index->block_summaries[ internal_block_index->number_of_blocks ] ),
+		     0,
+		     sizeof( libftxf_block_summary_t ) * (size_t) ( block_number + 1 - internal_block_index->number_of_blocks ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear block summaries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_block_index->number_of_blocks = (int) block_number + 1;
+	}
+	block_summary = &( internal_block_index->block_summaries[ block_number ] );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (ftxf_record_header_t *) byte_stream )->record_type,
+	 record_type );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (ftxf_record_header_t *) byte_stream )->file_reference,
+	 file_reference );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (ftxf_record_header_t *) byte_stream )->unknown8,
+	 timestamp );
+
+	if( block_summary->number_of_records == 0 )
+	{
+		block_summary->first_timestamp = timestamp;
+		block_summary->last_timestamp  = timestamp;
+	}
+	else if( timestamp < block_summary->first_timestamp )
+	{
+		block_summary->first_timestamp = timestamp;
+	}
+	else if( timestamp > block_summary->last_timestamp )
+	{
+		block_summary->last_timestamp = timestamp;
+	}
+	if( record_type > 63 )
+	{
+		record_type = 63;
+	}
+	block_summary->record_type_mask |= (uint64_t) 1 << record_type;
+
+	libftxf_block_summary_get_bloom_filter_bit_indexes(
+	 file_reference,
+	 bit_indexes );
+
+	for( hash_index = 0;
+	     hash_index < LIBFTXF_BLOCK_SUMMARY_BLOOM_FILTER_NUMBER_OF_HASHES;
+	     hash_index++ )
+	{
+		block_summary->file_reference_bloom_filter[ bit_indexes[ hash_index ] / 8 ] |= (uint8_t) ( 1 << ( bit_indexes[ hash_index ] % 8 ) );
+	}
+	if( block_summary->number_of_records < UINT32_MAX )
+	{
+		block_summary->number_of_records += 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the block size
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_block_index_get_block_size(
+     libftxf_block_index_t *block_index,
+     uint32_t *block_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_block_index_t *internal_block_index = NULL;
+	static char *function                                = "libftxf_block_index_get_block_size";
+
+	if( block_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_index = (libftxf_internal_block_index_t *) block_index;
+
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+	*block_size = internal_block_index->block_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_block_index_get_number_of_blocks(
+     libftxf_block_index_t *block_index,
+     int *number_of_blocks,
+     libcerror_error_t **error )
+{
+	libftxf_internal_block_index_t *internal_block_index = NULL;
+	static char *function                                = "libftxf_block_index_get_number_of_blocks";
+
+	if( block_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_index = (libftxf_internal_block_index_t *) block_index;
+
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_blocks = internal_block_index->number_of_blocks;
+
+	return( 1 );
+}
+
+/* Retrieves the number of the block that contains a specific offset
+ * Returns 1 if successful, 0 if the offset is beyond the indexed blocks or -1 on error
+ */
+int libftxf_block_index_get_block_number_by_offset(
+     libftxf_block_index_t *block_index,
+     off64_t offset,
+     int *block_number,
+     libcerror_error_t **error )
+{
+	libftxf_internal_block_index_t *internal_block_index = NULL;
+	static char *function                                = "libftxf_block_index_get_block_number_by_offset";
+	off64_t safe_block_number                            = 0;
+
+	if( block_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_index = (libftxf_internal_block_index_t *) block_index;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block number.",
+		 function );
+
+		return( -1 );
+	}
+	safe_block_number = offset / internal_block_index->block_size;
+
+	if( safe_block_number >= (off64_t) internal_block_index->number_of_blocks )
+	{
+		return( 0 );
+	}
+	*block_number = (int) safe_block_number;
+
+	return( 1 );
+}
+
+/* Retrieves the (header) timestamp range of a specific block
+ * The timestamps are FILETIME values
+ * Returns 1 if successful, 0 if the block contains no records or -1 on error
+ */
+int libftxf_block_index_get_block_timestamp_range(
+     libftxf_block_index_t *block_index,
+     int block_number,
+     uint64_t *first_timestamp,
+     uint64_t *last_timestamp,
+     libcerror_error_t **error )
+{
+	libftxf_block_summary_t *block_summary = NULL;
+	static char *function                  = "libftxf_block_index_get_block_timestamp_range";
+
+	if( first_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_internal_block_index_get_block_summary(
+	     (libftxf_internal_block_index_t *) block_index,
+	     block_number,
+	     &block_summary,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block summary: %d.",
+		 function,
+		 block_number );
+
+		return( -1 );
+	}
+	if( block_summary->number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	*first_timestamp = block_summary->first_timestamp;
+	*last_timestamp  = block_summary->last_timestamp;
+
+	return( 1 );
+}
+
+/* Determines if a specific block possibly contains records that match the record filter
+ * A block that does not match can be skipped, since none of the records that start in it match
+ * A block that matches is not guaranteed to contain a matching record
+ * Returns 1 if the block possibly contains matching records, 0 if not or -1 on error
+ */
+int libftxf_block_index_block_matches_filter(
+     libftxf_block_index_t *block_index,
+     int block_number,
+     libftxf_record_filter_t *record_filter,
+     libcerror_error_t **error )
+{
+	libftxf_block_summary_t *block_summary                   = NULL;
+	libftxf_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                    = "libftxf_block_index_block_matches_filter";
+	int entry_index                                          = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libftxf_internal_record_filter_t *) record_filter;
+
+	if( libftxf_internal_block_index_get_block_summary(
+	     (libftxf_internal_block_index_t *) block_index,
+	     block_number,
+	     &block_summary,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block summary: %d.",
+		 function,
+		 block_number );
+
+		return( -1 );
+	}
+	if( block_summary->number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	if( ( internal_record_filter->flags & LIBFTXF_RECORD_FILTER_FLAG_HAS_RECORD_TYPES ) != 0 )
+	{
+		if( ( block_summary->record_type_mask & internal_record_filter->record_type_mask ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_record_filter->flags & LIBFTXF_RECORD_FILTER_FLAG_HAS_TIMESTAMP_RANGE ) != 0 )
+	{
+		if( ( block_summary->last_timestamp < internal_record_filter->first_timestamp )
+		 || ( block_summary->first_timestamp > internal_record_filter->last_timestamp ) )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_record_filter->flags & LIBFTXF_RECORD_FILTER_FLAG_HAS_FILE_REFERENCES ) != 0 )
+	{
+		for( entry_index = 0;
+		     entry_index < internal_record_filter->number_of_file_references;
+		     entry_index++ )
+		{
+			if( libftxf_block_summary_bloom_filter_may_contain(
+			     block_summary,
+			     internal_record_filter->file_references[ entry_index ] ) != 0 )
+			{
+				return( 1 );
+			}
+		}
+		return( 0 );
+	}
+	return( 1 );
+}
+
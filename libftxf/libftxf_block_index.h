@@ -0,0 +1,164 @@
+/*
+ * Block index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_INTERNAL_BLOCK_INDEX_H )
+#define _LIBFTXF_INTERNAL_BLOCK_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the file reference Bloom filter of a block summary
+ */
+#define LIBFTXF_BLOCK_SUMMARY_BLOOM_FILTER_SIZE		256
+
+typedef struct libftxf_block_summary libftxf_block_summary_t;
+
+struct libftxf_block_summary
+{
+	/* The number of records that start in the block
+	 */
+	uint32_t number_of_records;
+
+	/* The first (smallest) header timestamp
+	 */
+	uint64_t first_timestamp;
+
+	/* The last (largest) header timestamp
+	 */
+	uint64_t last_timestamp;
+
+	/* The record type mask
+	 * Bit N is set if a record of type N starts in the block
+	 * Bit 63 is also set for record types of 63 and larger
+	 */
+	uint64_t record_type_mask;
+
+	/* The file reference Bloom filter
+	 */
+	uint8_t file_reference_bloom_filter[ LIBFTXF_BLOCK_SUMMARY_BLOOM_FILTER_SIZE ];
+};
+
+typedef struct libftxf_internal_block_index libftxf_internal_block_index_t;
+
+struct libftxf_internal_block_index
+{
+	/* The block size
+	 */
+	uint32_t block_size;
+
+	/* The block summaries
+	 */
+	libftxf_block_summary_t *block_summaries;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The number of allocated blocks
+	 */
+	int number_of_allocated_blocks;
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the block index and its buffers
+	 */
+	libftxf_allocator_t allocator;
+};
+
+LIBFTXF_EXTERN \
+int libftxf_block_index_initialize(
+     libftxf_block_index_t **block_index,
+     uint32_t block_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_block_index_initialize_with_allocator(
+     libftxf_block_index_t **block_index,
+     uint32_t block_size,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_block_index_free(
+     libftxf_block_index_t **block_index,
+     libcerror_error_t **error );
+
+int libftxf_internal_block_index_get_block_summary(
+     libftxf_internal_block_index_t *internal_block_index,
+     int block_number,
+     libftxf_block_summary_t **block_summary,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_block_index_append_record(
+     libftxf_block_index_t *block_index,
+     off64_t record_offset,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_block_index_get_block_size(
+     libftxf_block_index_t *block_index,
+     uint32_t *block_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_block_index_get_number_of_blocks(
+     libftxf_block_index_t *block_index,
+     int *number_of_blocks,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_block_index_get_block_number_by_offset(
+     libftxf_block_index_t *block_index,
+     off64_t offset,
+     int *block_number,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_block_index_get_block_timestamp_range(
+     libftxf_block_index_t *block_index,
+     int block_number,
+     uint64_t *first_timestamp,
+     uint64_t *last_timestamp,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_block_index_block_matches_filter(
+     libftxf_block_index_t *block_index,
+     int block_number,
+     libftxf_record_filter_t *record_filter,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_INTERNAL_BLOCK_INDEX_H ) */
+
@@ -0,0 +1,102 @@
+/*
+ * Column chunk layout functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_column_chunk.h"
+#include "libftxf_definitions.h"
+#include "libftxf_libcerror.h"
+
+#include "ftxf_column_file.h"
+
+const uint8_t libftxf_column_file_signature[ 8 ] = { 'F', 'T', 'X', 'F', 'C', 'O', 'L', 'S' };
+
+const uint8_t libftxf_column_chunk_signature[ 4 ] = { 'C', 'H', 'N', 'K' };
+
+/* The size of the values per column type
+ * The columns are ordered by decreasing value size
+ */
+const uint8_t libftxf_column_chunk_value_sizes[ LIBFTXF_NUMBER_OF_COLUMN_TYPES ] = {
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 2, 1 };
+
+/* Determines the offset of a column relative to the start of the chunk
+ * A column type of LIBFTXF_NUMBER_OF_COLUMN_TYPES determines the offset of the dictionaries
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_chunk_get_column_offset(
+     uint32_t number_of_records,
+     int column_type,
+     size_t *column_offset,
+     libcerror_error_t **error )
+{
+	static char *function     = "libftxf_column_chunk_get_column_offset";
+	size_t safe_column_offset = 0;
+	int column_index          = 0;
+
+	if( (size_t) number_of_records > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / LIBFTXF_COLUMN_CHUNK_ROW_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of records value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_type < 0 )
+	 || ( column_type > LIBFTXF_NUMBER_OF_COLUMN_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_column_offset = sizeof( ftxf_column_chunk_header_t );
+
+	for( column_index = 0;
+	     column_index < column_type;
+	     column_index++ )
+	{
+		safe_column_offset += (size_t) libftxf_column_chunk_value_sizes[ column_index ] * number_of_records;
+	}
+	*column_offset = safe_column_offset;
+
+	return( 1 );
+}
+
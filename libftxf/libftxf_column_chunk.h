@@ -0,0 +1,64 @@
+/*
+ * Column chunk layout functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_COLUMN_CHUNK_H )
+#define _LIBFTXF_COLUMN_CHUNK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_definitions.h"
+#include "libftxf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the values of a single record in all columns
+ */
+#define LIBFTXF_COLUMN_CHUNK_ROW_SIZE		91
+
+/* The size of a GUID in the GUID dictionary
+ */
+#define LIBFTXF_COLUMN_CHUNK_GUID_SIZE		16
+
+/* The format version of the columnar export file
+ */
+#define LIBFTXF_COLUMN_FILE_FORMAT_VERSION	1
+
+extern const uint8_t libftxf_column_file_signature[ 8 ];
+
+extern const uint8_t libftxf_column_chunk_signature[ 4 ];
+
+extern const uint8_t libftxf_column_chunk_value_sizes[ LIBFTXF_NUMBER_OF_COLUMN_TYPES ];
+
+int libftxf_column_chunk_get_column_offset(
+     uint32_t number_of_records,
+     int column_type,
+     size_t *column_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_COLUMN_CHUNK_H ) */
+
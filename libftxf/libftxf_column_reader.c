@@ -0,0 +1,1498 @@
+/*
+ * Column reader functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_column_chunk.h"
+#include "libftxf_column_reader.h"
+#include "libftxf_definitions.h"
+#include "libftxf_libcerror.h"
+
+#include "ftxf_column_file.h"
+
+/* Creates a column reader
+ * Make sure the value column_reader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_reader_initialize(
+     libftxf_column_reader_t **column_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_column_reader_initialize";
+
+	if( libftxf_column_reader_initialize_with_allocator(
+	     column_reader,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column reader.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a column reader that allocates its memory using the allocator functions
+ * Make sure the value column_reader is referencing, is set to NULL
+ * The allocator is copied into the column reader, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_reader_initialize_with_allocator(
+     libftxf_column_reader_t **column_reader,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	libftxf_internal_column_reader_t *internal_column_reader = NULL;
+	static char *function                                    = "libftxf_column_reader_initialize_with_allocator";
+
+	if( column_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_column_reader = (libftxf_internal_column_reader_t *) libftxf_allocator_allocate(
+	                                                               allocator,
+	                                                               sizeof( libftxf_internal_column_reader_t ) );
+
+	if( internal_column_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_column_reader,
+	     0,
+	     sizeof( libftxf_internal_column_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( allocator != NULL )
+	{
+		internal_column_reader->allocator = *allocator;
+	}
+	*column_reader = (libftxf_column_reader_t *) internal_column_reader;
+
+	return( 1 );
+
+on_error:
+	if( internal_column_reader != NULL )
+	{
+		libftxf_allocator_free(
+		 allocator,
+		 internal_column_reader );
+	}
+	return( -1 );
+}
+
+/* Frees a column reader
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_reader_free(
+     libftxf_column_reader_t **column_reader,
+     libcerror_error_t **error )
+{
+	libftxf_allocator_t allocator;
+
+	libftxf_internal_column_reader_t *internal_column_reader = NULL;
+	static char *function                                    = "libftxf_column_reader_free";
+
+	if( column_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_reader != NULL )
+	{
+		internal_column_reader = (libftxf_internal_column_reader_t *) *column_reader;
+		*column_reader         = NULL;
+
+		if( internal_column_reader->chunk_offsets != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_column_reader->allocator ),
+			 internal_column_reader->chunk_offsets );
+		}
+		/* The allocator is copied since it is stored in the column reader that is freed
+		 */
+		allocator = internal_column_reader->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
+		 internal_column_reader );
+	}
+	return( 1 );
+}
+
+/* Opens a column reader on a byte stream that contains a columnar export file
+ * The byte stream is not copied and must remain available until the column reader is closed,
+ * which allows the caller to provide a memory-mapped file
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_reader_open_byte_stream(
+     libftxf_column_reader_t *column_reader,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_column_reader_t *internal_column_reader = NULL;
+	static char *function                                    = "libftxf_column_reader_open_byte_stream";
+	size_t byte_stream_offset                                = 0;
+	size_t chunk_size                                        = 0;
+	uint64_t total_number_of_records                         = 0;
+	uint32_t format_version                                  = 0;
+	uint32_t number_of_column_types                          = 0;
+	uint32_t number_of_records                               = 0;
+	int chunk_index                                          = 0;
+	int number_of_chunks                                     = 0;
+
+	if( column_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_column_reader = (libftxf_internal_column_reader_t *) column_reader;
+
+	if( internal_column_reader->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column reader - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < sizeof( ftxf_column_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (ftxf_column_file_header_t *) byte_stream )->signature,
+	     libftxf_column_file_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_column_file_header_t *) byte_stream )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_column_file_header_t *) byte_stream )->number_of_column_types,
+	 number_of_column_types );
+
+	if( format_version != LIBFTXF_COLUMN_FILE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( number_of_column_types != LIBFTXF_NUMBER_OF_COLUMN_TYPES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of column types: %" PRIu32 ".",
+		 function,
+		 number_of_column_types );
+
+		return( -1 );
+	}
+	/* Validate the chunks before determining the chunk offsets
+	 * so that the chunk offsets can be allocated at once
+	 */
+	byte_stream_offset = sizeof( ftxf_column_file_header_t );
+
+	while( byte_stream_offset < byte_stream_size )
+	{
+		if( number_of_chunks == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of chunks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( libftxf_internal_column_reader_read_chunk_header(
+		     &( byte_stream[ byte_stream_offset ] ),
+		     byte_stream_size - byte_stream_offset,
+		     &chunk_size,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read chunk: %d header at offset: %" PRIzd " (0x%08" PRIzx ").",
+			 function,
+			 number_of_chunks,
+			 byte_stream_offset,
+			 byte_stream_offset );
+
+			return( -1 );
+		}
+		byte_stream_offset      += chunk_size;
+		total_number_of_records += number_of_records;
+
+		number_of_chunks++;
+	}
+	if( number_of_chunks > 0 )
+	{
+		if( (size_t) number_of_chunks > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of chunks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		internal_column_reader->chunk_offsets = (size_t *) libftxf_allocator_allocate(
+		                                                    &( internal_column_reader->allocator ),
+		                                                    sizeof( size_t ) * number_of_chunks );
+
+		if( internal_column_reader->chunk_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk offsets.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_offset = sizeof( ftxf_column_file_header_t );
+
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			internal_column_reader->chunk_offsets[ chunk_index ] = byte_stream_offset;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (ftxf_column_chunk_header_t *) &( byte_stream[ byte_stream_offset ] ) )->chunk_size,
+			 chunk_size );
+
+			byte_stream_offset += chunk_size;
+		}
+	}
+	internal_column_reader->data              = byte_stream;
+	internal_column_reader->data_size         = byte_stream_size;
+	internal_column_reader->number_of_chunks  = number_of_chunks;
+	internal_column_reader->number_of_records = total_number_of_records;
+
+	return( 1 );
+}
+
+/* Closes a column reader
+ * Returns 0 if successful or -1 on error
+ */
+int libftxf_column_reader_close(
+     libftxf_column_reader_t *column_reader,
+     libcerror_error_t **error )
+{
+	libftxf_internal_column_reader_t *internal_column_reader = NULL;
+	static char *function                                    = "libftxf_column_reader_close";
+
+	if( column_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_column_reader = (libftxf_internal_column_reader_t *) column_reader;
+
+	if( internal_column_reader->chunk_offsets != NULL )
+	{
+		libftxf_allocator_free(
+		 &( internal_column_reader->allocator ),
+		 internal_column_reader->chunk_offsets );
+
+		internal_column_reader->chunk_offsets = NULL;
+	}
+	internal_column_reader->data              = NULL;
+	internal_column_reader->data_size         = 0;
+	internal_column_reader->number_of_chunks  = 0;
+	internal_column_reader->number_of_records = 0;
+
+	return( 0 );
+}
+
+/* Reads and validates a chunk header
+ * The byte stream size is the remaining size of the columnar export file
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_column_reader_read_chunk_header(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *chunk_size,
+     uint32_t *number_of_records,
+     libcerror_error_t **error )
+{
+	const uint8_t *name_offsets_data = NULL;
+	static char *function            = "libftxf_internal_column_reader_read_chunk_header";
+	size_t dictionaries_offset       = 0;
+	size_t required_chunk_size       = 0;
+	uint32_t name_index              = 0;
+	uint32_t name_offset             = 0;
+	uint32_t names_data_size         = 0;
+	uint32_t number_of_guids         = 0;
+	uint32_t number_of_names         = 0;
+	uint32_t previous_name_offset    = 0;
+	uint32_t safe_chunk_size         = 0;
+	uint32_t safe_number_of_records  = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < sizeof( ftxf_column_chunk_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (ftxf_column_chunk_header_t *) byte_stream )->signature,
+	     libftxf_column_chunk_signature,
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported chunk signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_column_chunk_header_t *) byte_stream )->chunk_size,
+	 safe_chunk_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_column_chunk_header_t *) byte_stream )->number_of_records,
+	 safe_number_of_records );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_column_chunk_header_t *) byte_stream )->number_of_guids,
+	 number_of_guids );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_column_chunk_header_t *) byte_stream )->number_of_names,
+	 number_of_names );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_column_chunk_header_t *) byte_stream )->names_data_size,
+	 names_data_size );
+
+	if( ( (size_t) safe_chunk_size < sizeof( ftxf_column_chunk_header_t ) )
+	 || ( (size_t) safe_chunk_size > byte_stream_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_number_of_records == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_guids == 0 )
+	 || ( number_of_guids > safe_number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of GUIDs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_names > safe_number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of names value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_column_chunk_get_column_offset(
+	     safe_number_of_records,
+	     LIBFTXF_NUMBER_OF_COLUMN_TYPES,
+	     &dictionaries_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve dictionaries offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of GUIDs and names do not exceed the number of records
+	 * so the required chunk size cannot overflow
+	 */
+	required_chunk_size = dictionaries_offset
+	                    + ( (size_t) number_of_guids * LIBFTXF_COLUMN_CHUNK_GUID_SIZE )
+	                    + ( ( (size_t) number_of_names + 1 ) * 4 );
+
+	if( ( required_chunk_size > (size_t) safe_chunk_size )
+	 || ( (size_t) names_data_size > ( (size_t) safe_chunk_size - required_chunk_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Validate the name dictionary offsets so that they can be used without further bounds checks
+	 */
+	name_offsets_data = &( byte_stream[ dictionaries_offset + ( (size_t) number_of_guids * LIBFTXF_COLUMN_CHUNK_GUID_SIZE ) ] );
+
+	for( name_index = 0;
+	     name_index <= number_of_names;
+	     name_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 name_offsets_data,
+		 name_offset );
+
+		name_offsets_data += 4;
+
+		if( ( ( name_index == 0 )
+		  &&  ( name_offset != 0 ) )
+		 || ( name_offset < previous_name_offset )
+		 || ( name_offset > names_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name: %" PRIu32 " offset value out of bounds.",
+			 function,
+			 name_index );
+
+			return( -1 );
+		}
+		previous_name_offset = name_offset;
+	}
+	*chunk_size        = (size_t) safe_chunk_size;
+	*number_of_records = safe_number_of_records;
+
+	return( 1 );
+}
+
+/* Retrieves the data of a specific chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_column_reader_get_chunk_data(
+     libftxf_internal_column_reader_t *internal_column_reader,
+     int chunk_index,
+     const uint8_t **chunk_data,
+     uint32_t *number_of_records,
+     libcerror_error_t **error )
+{
+	const uint8_t *safe_chunk_data = NULL;
+	static char *function          = "libftxf_internal_column_reader_get_chunk_data";
+
+	if( internal_column_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_index < 0 )
+	 || ( chunk_index >= internal_column_reader->number_of_chunks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	safe_chunk_data = &( internal_column_reader->data[ internal_column_reader->chunk_offsets[ chunk_index ] ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_column_chunk_header_t *) safe_chunk_data )->number_of_records,
+	 *number_of_records );
+
+	*chunk_data = safe_chunk_data;
+
+	return( 1 );
+}
+
+/* Retrieves the number of chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_reader_get_number_of_chunks(
+     libftxf_column_reader_t *column_reader,
+     int *number_of_chunks,
+     libcerror_error_t **error )
+{
+	libftxf_internal_column_reader_t *internal_column_reader = NULL;
+	static char *function                                    = "libftxf_column_reader_get_number_of_chunks";
+
+	if( column_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_column_reader = (libftxf_internal_column_reader_t *) column_reader;
+
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_chunks = internal_column_reader->number_of_chunks;
+
+	return( 1 );
+}
+
+/* Retrieves the number of records in all chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_reader_get_number_of_records(
+     libftxf_column_reader_t *column_reader,
+     uint64_t *number_of_records,
+     libcerror_error_t **error )
+{
+	libftxf_internal_column_reader_t *internal_column_reader = NULL;
+	static char *function                                    = "libftxf_column_reader_get_number_of_records";
+
+	if( column_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_column_reader = (libftxf_internal_column_reader_t *) column_reader;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = internal_column_reader->number_of_records;
+
+	return( 1 );
+}
+
+/* Retrieves the number of records of a specific chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_reader_get_chunk_number_of_records(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     uint32_t *number_of_records,
+     libcerror_error_t **error )
+{
+	const uint8_t *chunk_data = NULL;
+	static char *function     = "libftxf_column_reader_get_chunk_number_of_records";
+
+	if( column_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_internal_column_reader_get_chunk_data(
+	     (libftxf_internal_column_reader_t *) column_reader,
+	     chunk_index,
+	     &chunk_data,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %d data.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the (header) timestamp range of a specific chunk
+ * The timestamps contain a FILETIME
+ * Returns 1 if successful, 0 if the chunk has no statistics or -1 on error
+ */
+int libftxf_column_reader_get_chunk_timestamp_range(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     uint64_t *minimum_timestamp,
+     uint64_t *maximum_timestamp,
+     libcerror_error_t **error )
+{
+	const uint8_t *chunk_data  = NULL;
+	static char *function      = "libftxf_column_reader_get_chunk_timestamp_range";
+	uint32_t chunk_flags       = 0;
+	uint32_t number_of_records = 0;
+
+	if( column_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( minimum_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minimum timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_internal_column_reader_get_chunk_data(
+	     (libftxf_internal_column_reader_t *) column_reader,
+	     chunk_index,
+	     &chunk_data,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %d data.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_column_chunk_header_t *) chunk_data )->flags,
+	 chunk_flags );
+
+	if( ( chunk_flags & LIBFTXF_COLUMN_CHUNK_FLAG_HAS_STATISTICS ) == 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (ftxf_column_chunk_header_t *) chunk_data )->minimum_timestamp,
+	 *minimum_timestamp );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (ftxf_column_chunk_header_t *) chunk_data )->maximum_timestamp,
+	 *maximum_timestamp );
+
+	return( 1 );
+}
+
+/* Retrieves the file reference range of a specific chunk
+ * Returns 1 if successful, 0 if the chunk has no statistics or -1 on error
+ */
+int libftxf_column_reader_get_chunk_file_reference_range(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     uint64_t *minimum_file_reference,
+     uint64_t *maximum_file_reference,
+     libcerror_error_t **error )
+{
+	const uint8_t *chunk_data  = NULL;
+	static char *function      = "libftxf_column_reader_get_chunk_file_reference_range";
+	uint32_t chunk_flags       = 0;
+	uint32_t number_of_records = 0;
+
+	if( column_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( minimum_file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minimum file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_internal_column_reader_get_chunk_data(
+	     (libftxf_internal_column_reader_t *) column_reader,
+	     chunk_index,
+	     &chunk_data,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %d data.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_column_chunk_header_t *) chunk_data )->flags,
+	 chunk_flags );
+
+	if( ( chunk_flags & LIBFTXF_COLUMN_CHUNK_FLAG_HAS_STATISTICS ) == 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (ftxf_column_chunk_header_t *) chunk_data )->minimum_file_reference,
+	 *minimum_file_reference );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (ftxf_column_chunk_header_t *) chunk_data )->maximum_file_reference,
+	 *maximum_file_reference );
+
+	return( 1 );
+}
+
+/* Retrieves the data of a specific column of a specific chunk
+ * The column data refers to the byte stream and contains the little-endian values of all records in the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_reader_get_column_data(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     int column_type,
+     const uint8_t **column_data,
+     size_t *column_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *chunk_data  = NULL;
+	static char *function      = "libftxf_column_reader_get_column_data";
+	size_t column_offset       = 0;
+	uint32_t number_of_records = 0;
+
+	if( column_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_type < 0 )
+	 || ( column_type >= LIBFTXF_NUMBER_OF_COLUMN_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column data.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_internal_column_reader_get_chunk_data(
+	     (libftxf_internal_column_reader_t *) column_reader,
+	     chunk_index,
+	     &chunk_data,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %d data.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( libftxf_column_chunk_get_column_offset(
+	     number_of_records,
+	     column_type,
+	     &column_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d offset.",
+		 function,
+		 column_type );
+
+		return( -1 );
+	}
+	*column_data      = &( chunk_data[ column_offset ] );
+	*column_data_size = (size_t) number_of_records * libftxf_column_chunk_value_sizes[ column_type ];
+
+	return( 1 );
+}
+
+/* Retrieves a specific integer value of a specific column
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_reader_get_integer_value(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     int column_type,
+     uint32_t record_index,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	const uint8_t *column_data = NULL;
+	static char *function      = "libftxf_column_reader_get_integer_value";
+	size_t column_data_size    = 0;
+	size_t value_size          = 0;
+	uint32_t value_32bit       = 0;
+	uint16_t value_16bit       = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_column_reader_get_column_data(
+	     column_reader,
+	     chunk_index,
+	     column_type,
+	     &column_data,
+	     &column_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %d column: %d data.",
+		 function,
+		 chunk_index,
+		 column_type );
+
+		return( -1 );
+	}
+	value_size = (size_t) libftxf_column_chunk_value_sizes[ column_type ];
+
+	if( (size_t) record_index >= ( column_data_size / value_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	column_data += (size_t) record_index * value_size;
+
+	switch( value_size )
+	{
+		case 8:
+			byte_stream_copy_to_uint64_little_endian(
+			 column_data,
+			 *value );
+			break;
+
+		case 4:
+			byte_stream_copy_to_uint32_little_endian(
+			 column_data,
+			 value_32bit );
+
+			*value = (uint64_t) value_32bit;
+			break;
+
+		case 2:
+			byte_stream_copy_to_uint16_little_endian(
+			 column_data,
+			 value_16bit );
+
+			*value = (uint64_t) value_16bit;
+			break;
+
+		default:
+			*value = (uint64_t) column_data[ 0 ];
+			break;
+	}
+	return( 1 );
+}
+
+/* Retrieves the GUID of a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_reader_get_guid(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     uint32_t record_index,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *chunk_data  = NULL;
+	static char *function      = "libftxf_column_reader_get_guid";
+	size_t dictionaries_offset = 0;
+	uint64_t guid_index        = 0;
+	uint32_t number_of_guids   = 0;
+	uint32_t number_of_records = 0;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guid_data_size < 16 )
+	 || ( guid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_column_reader_get_integer_value(
+	     column_reader,
+	     chunk_index,
+	     LIBFTXF_COLUMN_TYPE_GUID_INDEX,
+	     record_index,
+	     &guid_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve GUID index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_internal_column_reader_get_chunk_data(
+	     (libftxf_internal_column_reader_t *) column_reader,
+	     chunk_index,
+	     &chunk_data,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %d data.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_column_chunk_header_t *) chunk_data )->number_of_guids,
+	 number_of_guids );
+
+	if( guid_index >= (uint64_t) number_of_guids )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_column_chunk_get_column_offset(
+	     number_of_records,
+	     LIBFTXF_NUMBER_OF_COLUMN_TYPES,
+	     &dictionaries_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve dictionaries offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     guid_data,
+	     &( chunk_data[ dictionaries_offset + ( (size_t) guid_index * LIBFTXF_COLUMN_CHUNK_GUID_SIZE ) ] ),
+	     LIBFTXF_COLUMN_CHUNK_GUID_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 little-endian name of a specific record
+ * The name refers to the byte stream and does not contain an end-of-string character
+ * Returns 1 if successful, 0 if the record has no name or -1 on error
+ */
+int libftxf_column_reader_get_utf16_name(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     uint32_t record_index,
+     const uint8_t **name,
+     size_t *name_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *chunk_data        = NULL;
+	const uint8_t *name_offsets_data = NULL;
+	static char *function            = "libftxf_column_reader_get_utf16_name";
+	size_t dictionaries_offset       = 0;
+	size_t names_data_offset         = 0;
+	uint64_t name_index              = 0;
+	uint32_t name_end_offset         = 0;
+	uint32_t name_start_offset       = 0;
+	uint32_t number_of_guids         = 0;
+	uint32_t number_of_names         = 0;
+	uint32_t number_of_records       = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_column_reader_get_integer_value(
+	     column_reader,
+	     chunk_index,
+	     LIBFTXF_COLUMN_TYPE_NAME_INDEX,
+	     record_index,
+	     &name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index == (uint64_t) LIBFTXF_COLUMN_NAME_INDEX_NONE )
+	{
+		return( 0 );
+	}
+	if( libftxf_internal_column_reader_get_chunk_data(
+	     (libftxf_internal_column_reader_t *) column_reader,
+	     chunk_index,
+	     &chunk_data,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %d data.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_column_chunk_header_t *) chunk_data )->number_of_guids,
+	 number_of_guids );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_column_chunk_header_t *) chunk_data )->number_of_names,
+	 number_of_names );
+
+	if( name_index >= (uint64_t) number_of_names )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_column_chunk_get_column_offset(
+	     number_of_records,
+	     LIBFTXF_NUMBER_OF_COLUMN_TYPES,
+	     &dictionaries_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve dictionaries offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The name offsets were validated when the column reader was opened
+	 */
+	name_offsets_data = &( chunk_data[ dictionaries_offset + ( (size_t) number_of_guids * LIBFTXF_COLUMN_CHUNK_GUID_SIZE ) ] );
+	names_data_offset = dictionaries_offset
+	                  + ( (size_t) number_of_guids * LIBFTXF_COLUMN_CHUNK_GUID_SIZE )
+	                  + ( ( (size_t) number_of_names + 1 ) * 4 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( name_offsets_data[ (size_t) name_index * 4 ] ),
+	 name_start_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( name_offsets_data[ ( (size_t) name_index + 1 ) * 4 ] ),
+	 name_end_offset );
+
+	*name      = &( chunk_data[ names_data_offset + name_start_offset ] );
+	*name_size = (size_t) ( name_end_offset - name_start_offset );
+
+	return( 1 );
+}
+
@@ -0,0 +1,185 @@
+/*
+ * Column reader functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_COLUMN_READER_H )
+#define _LIBFTXF_COLUMN_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libftxf_internal_column_reader libftxf_internal_column_reader_t;
+
+struct libftxf_internal_column_reader
+{
+	/* The data
+	 * Refers to the caller provided byte stream
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The chunk offsets
+	 */
+	size_t *chunk_offsets;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The number of records
+	 */
+	uint64_t number_of_records;
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the column reader and its buffers
+	 */
+	libftxf_allocator_t allocator;
+};
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_initialize(
+     libftxf_column_reader_t **column_reader,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_initialize_with_allocator(
+     libftxf_column_reader_t **column_reader,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_free(
+     libftxf_column_reader_t **column_reader,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_open_byte_stream(
+     libftxf_column_reader_t *column_reader,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_close(
+     libftxf_column_reader_t *column_reader,
+     libcerror_error_t **error );
+
+int libftxf_internal_column_reader_read_chunk_header(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *chunk_size,
+     uint32_t *number_of_records,
+     libcerror_error_t **error );
+
+int libftxf_internal_column_reader_get_chunk_data(
+     libftxf_internal_column_reader_t *internal_column_reader,
+     int chunk_index,
+     const uint8_t **chunk_data,
+     uint32_t *number_of_records,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_get_number_of_chunks(
+     libftxf_column_reader_t *column_reader,
+     int *number_of_chunks,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_get_number_of_records(
+     libftxf_column_reader_t *column_reader,
+     uint64_t *number_of_records,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_get_chunk_number_of_records(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     uint32_t *number_of_records,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_get_chunk_timestamp_range(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     uint64_t *minimum_timestamp,
+     uint64_t *maximum_timestamp,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_get_chunk_file_reference_range(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     uint64_t *minimum_file_reference,
+     uint64_t *maximum_file_reference,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_get_column_data(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     int column_type,
+     const uint8_t **column_data,
+     size_t *column_data_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_get_integer_value(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     int column_type,
+     uint32_t record_index,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_get_guid(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     uint32_t record_index,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_reader_get_utf16_name(
+     libftxf_column_reader_t *column_reader,
+     int chunk_index,
+     uint32_t record_index,
+     const uint8_t **name,
+     size_t *name_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_COLUMN_READER_H ) */
+
@@ -0,0 +1,1244 @@
+/*
+ * Column writer functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_column_chunk.h"
+#include "libftxf_column_writer.h"
+#include "libftxf_definitions.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_libcthreads.h"
+#include "libftxf_record.h"
+
+#include "ftxf_column_file.h"
+
+/* The initial allocated size of the name dictionary data
+ */
+#define LIBFTXF_COLUMN_WRITER_INITIAL_NAMES_DATA_SIZE	4096
+
+/* Calculates the FNV-1a hash of a dictionary value
+ * Returns the hash
+ */
+static uint32_t libftxf_column_writer_calculate_hash(
+                 const uint8_t *data,
+                 size_t data_size )
+{
+	uint32_t hash = 0x811c9dc5UL;
+
+	while( data_size > 0 )
+	{
+		hash ^= *data++;
+		hash *= 0x01000193UL;
+
+		data_size--;
+	}
+	return( hash );
+}
+
+/* Creates a column writer
+ * Make sure the value column_writer is referencing, is set to NULL
+ * The maximum number of records is the number of records per chunk, where 0 represents the default of 65536
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_writer_initialize(
+     libftxf_column_writer_t **column_writer,
+     uint32_t maximum_number_of_records,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_column_writer_initialize";
+
+	if( libftxf_column_writer_initialize_with_allocator(
+	     column_writer,
+	     maximum_number_of_records,
+	     flags,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column writer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a column writer that allocates its memory using the allocator functions
+ * Make sure the value column_writer is referencing, is set to NULL
+ * The maximum number of records is the number of records per chunk, where 0 represents the default of 65536
+ * The allocator is copied into the column writer, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_writer_initialize_with_allocator(
+     libftxf_column_writer_t **column_writer,
+     uint32_t maximum_number_of_records,
+     uint8_t flags,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	libftxf_internal_column_writer_t *internal_column_writer = NULL;
+	static char *function                                    = "libftxf_column_writer_initialize_with_allocator";
+	size_t column_data_size                                  = 0;
+
+	if( column_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_records == 0 )
+	{
+		maximum_number_of_records = LIBFTXF_DEFAULT_COLUMN_WRITER_MAXIMUM_NUMBER_OF_RECORDS;
+	}
+	else if( (size_t) maximum_number_of_records > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / LIBFTXF_COLUMN_CHUNK_ROW_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of records value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBFTXF_COLUMN_WRITER_FLAG_STATISTICS ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_column_writer = (libftxf_internal_column_writer_t *) libftxf_allocator_allocate(
+	                                                               allocator,
+	                                                               sizeof( libftxf_internal_column_writer_t ) );
+
+	if( internal_column_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_column_writer,
+	     0,
+	     sizeof( libftxf_internal_column_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column writer.",
+		 function );
+
+		libftxf_allocator_free(
+		 allocator,
+		 internal_column_writer );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		internal_column_writer->allocator = *allocator;
+	}
+	internal_column_writer->maximum_number_of_records = maximum_number_of_records;
+	internal_column_writer->flags                     = flags;
+
+	column_data_size = (size_t) maximum_number_of_records * LIBFTXF_COLUMN_CHUNK_ROW_SIZE;
+
+	internal_column_writer->column_data = (uint8_t *) libftxf_allocator_allocate(
+	                                                   &( internal_column_writer->allocator ),
+	                                                   sizeof( uint8_t ) * column_data_size );
+
+	if( internal_column_writer->column_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_column_writer->guids = (uint8_t *) libftxf_allocator_allocate(
+	                                             &( internal_column_writer->allocator ),
+	                                             sizeof( uint8_t ) * LIBFTXF_COLUMN_CHUNK_GUID_SIZE * maximum_number_of_records );
+
+	if( internal_column_writer->guids == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create GUID dictionary.",
+		 function );
+
+		goto on_error;
+	}
+	internal_column_writer->name_offsets = (uint32_t *) libftxf_allocator_allocate(
+	                                                     &( internal_column_writer->allocator ),
+	                                                     sizeof( uint32_t ) * ( (size_t) maximum_number_of_records + 1 ) );
+
+	if( internal_column_writer->name_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name dictionary offsets.",
+		 function );
+
+		goto on_error;
+	}
+	internal_column_writer->name_offsets[ 0 ] = 0;
+
+	/* Use a hash table of at least twice the maximum number of dictionary values
+	 * to keep the number of linear probes low
+	 */
+	internal_column_writer->hash_table_size = 1;
+
+	while( internal_column_writer->hash_table_size < ( maximum_number_of_records * 2 ) )
+	{
+		internal_column_writer->hash_table_size <<= 1;
+	}
+	internal_column_writer->guid_hash_table = (uint32_t *) libftxf_allocator_allocate(
+	                                                        &( internal_column_writer->allocator ),
+	                                                        sizeof( uint32_t ) * internal_column_writer->hash_table_size );
+
+	if( internal_column_writer->guid_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create GUID dictionary hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_column_writer->guid_hash_table,
+	     0,
+	     sizeof( uint32_t ) * internal_column_writer->hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear GUID dictionary hash table.",
+		 function );
+
+		goto on_error;
+	}
+	internal_column_writer->name_hash_table = (uint32_t *) libftxf_allocator_allocate(
+	                                                        &( internal_column_writer->allocator ),
+	                                                        sizeof( uint32_t ) * internal_column_writer->hash_table_size );
+
+	if( internal_column_writer->name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name dictionary hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_column_writer->name_hash_table,
+	     0,
+	     sizeof( uint32_t ) * internal_column_writer->hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name dictionary hash table.",
+		 function );
+
+		goto on_error;
+	}
+	*column_writer = (libftxf_column_writer_t *) internal_column_writer;
+
+	return( 1 );
+
+on_error:
+	if( internal_column_writer != NULL )
+	{
+		if( internal_column_writer->name_hash_table != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_column_writer->allocator ),
+			 internal_column_writer->name_hash_table );
+		}
+		if( internal_column_writer->guid_hash_table != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_column_writer->allocator ),
+			 internal_column_writer->guid_hash_table );
+		}
+		if( internal_column_writer->name_offsets != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_column_writer->allocator ),
+			 internal_column_writer->name_offsets );
+		}
+		if( internal_column_writer->guids != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_column_writer->allocator ),
+			 internal_column_writer->guids );
+		}
+		if( internal_column_writer->column_data != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_column_writer->allocator ),
+			 internal_column_writer->column_data );
+		}
+		libftxf_allocator_free(
+		 allocator,
+		 internal_column_writer );
+	}
+	return( -1 );
+}
+
+/* Frees a column writer
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_writer_free(
+     libftxf_column_writer_t **column_writer,
+     libcerror_error_t **error )
+{
+	libftxf_allocator_t allocator;
+
+	libftxf_internal_column_writer_t *internal_column_writer = NULL;
+	static char *function                                    = "libftxf_column_writer_free";
+
+	if( column_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_writer != NULL )
+	{
+		internal_column_writer = (libftxf_internal_column_writer_t *) *column_writer;
+		*column_writer         = NULL;
+
+		if( internal_column_writer->names_data != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_column_writer->allocator ),
+			 internal_column_writer->names_data );
+		}
+		libftxf_allocator_free(
+		 &( internal_column_writer->allocator ),
+		 internal_column_writer->name_hash_table );
+
+		libftxf_allocator_free(
+		 &( internal_column_writer->allocator ),
+		 internal_column_writer->guid_hash_table );
+
+		libftxf_allocator_free(
+		 &( internal_column_writer->allocator ),
+		 internal_column_writer->name_offsets );
+
+		libftxf_allocator_free(
+		 &( internal_column_writer->allocator ),
+		 internal_column_writer->guids );
+
+		libftxf_allocator_free(
+		 &( internal_column_writer->allocator ),
+		 internal_column_writer->column_data );
+
+		/* The allocator is copied since it is stored in the column writer that is freed
+		 */
+		allocator = internal_column_writer->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
+		 internal_column_writer );
+	}
+	return( 1 );
+}
+
+/* Copies the file header to a byte stream
+ * The file header precedes the chunks and is LIBFTXF_COLUMN_FILE_HEADER_SIZE bytes of size
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_writer_copy_file_header_to_byte_stream(
+     libftxf_column_writer_t *column_writer,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_column_writer_copy_file_header_to_byte_stream";
+
+	if( column_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < sizeof( ftxf_column_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( (ftxf_column_file_header_t *) byte_stream )->signature,
+	     libftxf_column_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (ftxf_column_file_header_t *) byte_stream )->format_version,
+	 LIBFTXF_COLUMN_FILE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (ftxf_column_file_header_t *) byte_stream )->number_of_column_types,
+	 LIBFTXF_NUMBER_OF_COLUMN_TYPES );
+
+	return( 1 );
+}
+
+/* Appends a record to the current chunk
+ * GUIDs and names are stored in per chunk dictionaries and the columns refer to them by index
+ * Returns 1 if successful, 0 if the chunk is full or -1 on error
+ */
+int libftxf_column_writer_append_record(
+     libftxf_column_writer_t *column_writer,
+     libftxf_record_t *record,
+     libcerror_error_t **error )
+{
+	uint64_t column_values[ LIBFTXF_NUMBER_OF_COLUMN_TYPES ];
+
+	libftxf_internal_column_writer_t *internal_column_writer = NULL;
+	libftxf_internal_record_t *internal_record               = NULL;
+	uint8_t *column_value_data                               = NULL;
+	uint8_t *reallocation                                    = NULL;
+	static char *function                                    = "libftxf_column_writer_append_record";
+	size_t allocated_names_data_size                         = 0;
+	size_t column_offset                                     = 0;
+	size_t column_value_size                                 = 0;
+	uint32_t dictionary_index                                = 0;
+	uint32_t guid_index                                      = 0;
+	uint32_t hash_table_index                                = 0;
+	uint32_t hash_table_mask                                 = 0;
+	uint32_t name_index                                      = LIBFTXF_COLUMN_NAME_INDEX_NONE;
+	uint32_t name_hash_table_index                           = 0;
+	int column_type                                          = 0;
+
+	if( column_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column writer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_column_writer = (libftxf_internal_column_writer_t *) column_writer;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( internal_column_writer->number_of_records >= internal_column_writer->maximum_number_of_records )
+	{
+		return( 0 );
+	}
+	hash_table_mask = internal_column_writer->hash_table_size - 1;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Look up the name before changing the chunk since the name dictionary can be full
+	 */
+	if( ( internal_record->name != NULL )
+	 && ( internal_record->name_size > 0 ) )
+	{
+		hash_table_index = libftxf_column_writer_calculate_hash(
+		                    internal_record->name,
+		                    internal_record->name_size ) & hash_table_mask;
+
+		while( internal_column_writer->name_hash_table[ hash_table_index ] != 0 )
+		{
+			dictionary_index = internal_column_writer->name_hash_table[ hash_table_index ] - 1;
+
+			if( ( (size_t) ( internal_column_writer->name_offsets[ dictionary_index + 1 ] - internal_column_writer->name_offsets[ dictionary_index ] ) == internal_record->name_size )
+			 && ( memory_compare(
+			       &( internal_column_writer->names_data[ internal_column_writer->name_offsets[ dictionary_index ] ] ),
+			       internal_record->name,
+			       internal_record->name_size ) == 0 ) )
+			{
+				name_index = dictionary_index;
+
+				break;
+			}
+			hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+		}
+		if( name_index == LIBFTXF_COLUMN_NAME_INDEX_NONE )
+		{
+			if( internal_record->name_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - internal_column_writer->names_data_size ) )
+			{
+				if( internal_column_writer->number_of_records > 0 )
+				{
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+					if( libcthreads_read_write_lock_release_for_read(
+					     internal_record->read_write_lock,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to release read/write lock for reading.",
+						 function );
+
+						return( -1 );
+					}
+#endif
+					return( 0 );
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid name size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( internal_column_writer->names_data_size + internal_record->name_size ) > internal_column_writer->allocated_names_data_size )
+			{
+				allocated_names_data_size = internal_column_writer->allocated_names_data_size;
+
+				if( allocated_names_data_size == 0 )
+				{
+					allocated_names_data_size = LIBFTXF_COLUMN_WRITER_INITIAL_NAMES_DATA_SIZE;
+				}
+				while( allocated_names_data_size < ( internal_column_writer->names_data_size + internal_record->name_size ) )
+				{
+					allocated_names_data_size *= 2;
+				}
+				if( allocated_names_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+				{
+					allocated_names_data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+				}
+				reallocation = (uint8_t *) libftxf_allocator_reallocate(
+				                            &( internal_column_writer->allocator ),
+				                            internal_column_writer->names_data,
+				                            sizeof( uint8_t ) * allocated_names_data_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize name dictionary data.",
+					 function );
+
+					goto on_error;
+				}
+				internal_column_writer->names_data                = reallocation;
+				internal_column_writer->allocated_names_data_size = allocated_names_data_size;
+			}
+			name_hash_table_index = hash_table_index;
+		}
+	}
+	/* Look up or add the GUID
+	 */
+	hash_table_index = libftxf_column_writer_calculate_hash(
+	                    internal_record->guid,
+	                    LIBFTXF_COLUMN_CHUNK_GUID_SIZE ) & hash_table_mask;
+
+	while( internal_column_writer->guid_hash_table[ hash_table_index ] != 0 )
+	{
+		dictionary_index = internal_column_writer->guid_hash_table[ hash_table_index ] - 1;
+
+		if( memory_compare(
+		     &( internal_column_writer->guids[ dictionary_index * LIBFTXF_COLUMN_CHUNK_GUID_SIZE ] ),
+		     internal_record->guid,
+		     LIBFTXF_COLUMN_CHUNK_GUID_SIZE ) == 0 )
+		{
+			break;
+		}
+		hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+	}
+	if( internal_column_writer->guid_hash_table[ hash_table_index ] != 0 )
+	{
+		guid_index = internal_column_writer->guid_hash_table[ hash_table_index ] - 1;
+	}
+	else
+	{
+		guid_index = internal_column_writer->number_of_guids;
+
+		if( memory_copy(
+		     &( internal_column_writer->guids[ guid_index * LIBFTXF_COLUMN_CHUNK_GUID_SIZE ] ),
+		     internal_record->guid,
+		     LIBFTXF_COLUMN_CHUNK_GUID_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy GUID.",
+			 function );
+
+			goto on_error;
+		}
+		internal_column_writer->number_of_guids += 1;
+
+		internal_column_writer->guid_hash_table[ hash_table_index ] = internal_column_writer->number_of_guids;
+	}
+	/* Add the name
+	 */
+	if( ( internal_record->name != NULL )
+	 && ( internal_record->name_size > 0 )
+	 && ( name_index == LIBFTXF_COLUMN_NAME_INDEX_NONE ) )
+	{
+		name_index = internal_column_writer->number_of_names;
+
+		if( memory_copy(
+		     &( internal_column_writer->names_data[ internal_column_writer->names_data_size ] ),
+		     internal_record->name,
+		     internal_record->name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			goto on_error;
+		}
+		internal_column_writer->names_data_size += internal_record->name_size;
+
+		internal_column_writer->number_of_names += 1;
+
+		internal_column_writer->name_offsets[ internal_column_writer->number_of_names ] = (uint32_t) internal_column_writer->names_data_size;
+
+		internal_column_writer->name_hash_table[ name_hash_table_index ] = internal_column_writer->number_of_names;
+	}
+	column_values[ LIBFTXF_COLUMN_TYPE_FILE_IDENTIFIER ]         = internal_record->file_identifier;
+	column_values[ LIBFTXF_COLUMN_TYPE_FILE_REFERENCE ]          = internal_record->file_reference;
+	column_values[ LIBFTXF_COLUMN_TYPE_TIMESTAMP ]               = internal_record->timestamp;
+	column_values[ LIBFTXF_COLUMN_TYPE_CREATION_TIME ]           = internal_record->file_metadata.creation_time;
+	column_values[ LIBFTXF_COLUMN_TYPE_MODIFICATION_TIME ]       = internal_record->file_metadata.modification_time;
+	column_values[ LIBFTXF_COLUMN_TYPE_ENTRY_MODIFICATION_TIME ] = internal_record->file_metadata.entry_modification_time;
+	column_values[ LIBFTXF_COLUMN_TYPE_ACCESS_TIME ]             = internal_record->file_metadata.access_time;
+	column_values[ LIBFTXF_COLUMN_TYPE_ALLOCATED_FILE_SIZE ]     = internal_record->file_metadata.allocated_file_size;
+	column_values[ LIBFTXF_COLUMN_TYPE_FILE_SIZE ]               = internal_record->file_metadata.file_size;
+	column_values[ LIBFTXF_COLUMN_TYPE_RECORD_SIZE ]             = internal_record->size;
+	column_values[ LIBFTXF_COLUMN_TYPE_FILE_ATTRIBUTE_FLAGS ]    = internal_record->file_metadata.file_attribute_flags;
+	column_values[ LIBFTXF_COLUMN_TYPE_GUID_INDEX ]              = guid_index;
+	column_values[ LIBFTXF_COLUMN_TYPE_NAME_INDEX ]              = name_index;
+	column_values[ LIBFTXF_COLUMN_TYPE_RECORD_TYPE ]             = internal_record->record_type;
+	column_values[ LIBFTXF_COLUMN_TYPE_RECORD_FLAGS ]            = internal_record->flags;
+
+	if( ( internal_record->flags & LIBFTXF_RECORD_FLAG_HAS_FILE_METADATA ) == 0 )
+	{
+		column_values[ LIBFTXF_COLUMN_TYPE_CREATION_TIME ]           = 0;
+		column_values[ LIBFTXF_COLUMN_TYPE_MODIFICATION_TIME ]       = 0;
+		column_values[ LIBFTXF_COLUMN_TYPE_ENTRY_MODIFICATION_TIME ] = 0;
+		column_values[ LIBFTXF_COLUMN_TYPE_ACCESS_TIME ]             = 0;
+		column_values[ LIBFTXF_COLUMN_TYPE_ALLOCATED_FILE_SIZE ]     = 0;
+		column_values[ LIBFTXF_COLUMN_TYPE_FILE_SIZE ]               = 0;
+		column_values[ LIBFTXF_COLUMN_TYPE_FILE_ATTRIBUTE_FLAGS ]    = 0;
+	}
+	/* The column data is laid out for the maximum number of records
+	 */
+	for( column_type = 0;
+	     column_type < LIBFTXF_NUMBER_OF_COLUMN_TYPES;
+	     column_type++ )
+	{
+		column_value_size = (size_t) libftxf_column_chunk_value_sizes[ column_type ];
+		column_value_data = &( internal_column_writer->column_data[ column_offset + ( (size_t) internal_column_writer->number_of_records * column_value_size ) ] );
+
+		switch( column_value_size )
+		{
+			case 8:
+				byte_stream_copy_from_uint64_little_endian(
+				 column_value_data,
+				 column_values[ column_type ] );
+				break;
+
+			case 4:
+				byte_stream_copy_from_uint32_little_endian(
+				 column_value_data,
+				 (uint32_t) column_values[ column_type ] );
+				break;
+
+			case 2:
+				byte_stream_copy_from_uint16_little_endian(
+				 column_value_data,
+				 (uint16_t) column_values[ column_type ] );
+				break;
+
+			default:
+				column_value_data[ 0 ] = (uint8_t) column_values[ column_type ];
+				break;
+		}
+		column_offset += (size_t) internal_column_writer->maximum_number_of_records * column_value_size;
+	}
+	if( internal_column_writer->number_of_records == 0 )
+	{
+		internal_column_writer->minimum_timestamp      = internal_record->timestamp;
+		internal_column_writer->maximum_timestamp      = internal_record->timestamp;
+		internal_column_writer->minimum_file_reference = internal_record->file_reference;
+		internal_column_writer->maximum_file_reference = internal_record->file_reference;
+	}
+	else
+	{
+		if( internal_record->timestamp < internal_column_writer->minimum_timestamp )
+		{
+			internal_column_writer->minimum_timestamp = internal_record->timestamp;
+		}
+		if( internal_record->timestamp > internal_column_writer->maximum_timestamp )
+		{
+			internal_column_writer->maximum_timestamp = internal_record->timestamp;
+		}
+		if( internal_record->file_reference < internal_column_writer->minimum_file_reference )
+		{
+			internal_column_writer->minimum_file_reference = internal_record->file_reference;
+		}
+		if( internal_record->file_reference > internal_column_writer->maximum_file_reference )
+		{
+			internal_column_writer->maximum_file_reference = internal_record->file_reference;
+		}
+	}
+	internal_column_writer->number_of_records += 1;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_record->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the size of the current chunk
+ * The chunk size is 0 if the chunk contains no records
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_writer_get_chunk_size(
+     libftxf_column_writer_t *column_writer,
+     size_t *chunk_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_column_writer_t *internal_column_writer = NULL;
+	static char *function                                    = "libftxf_column_writer_get_chunk_size";
+	size_t safe_chunk_size                                   = 0;
+
+	if( column_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column writer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_column_writer = (libftxf_internal_column_writer_t *) column_writer;
+
+	if( chunk_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_column_writer->number_of_records == 0 )
+	{
+		*chunk_size = 0;
+
+		return( 1 );
+	}
+	if( libftxf_column_chunk_get_column_offset(
+	     internal_column_writer->number_of_records,
+	     LIBFTXF_NUMBER_OF_COLUMN_TYPES,
+	     &safe_chunk_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve dictionaries offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_chunk_size += (size_t) internal_column_writer->number_of_guids * LIBFTXF_COLUMN_CHUNK_GUID_SIZE;
+	safe_chunk_size += ( (size_t) internal_column_writer->number_of_names + 1 ) * 4;
+	safe_chunk_size += internal_column_writer->names_data_size;
+
+	/* The chunk size is padded to a multiple of 8
+	 */
+	safe_chunk_size = ( safe_chunk_size + 7 ) & ~( (size_t) 7 );
+
+	*chunk_size = safe_chunk_size;
+
+	return( 1 );
+}
+
+/* Copies the current chunk to a byte stream
+ * The column writer is reset afterwards so it can be used for the next chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_column_writer_copy_chunk_to_byte_stream(
+     libftxf_column_writer_t *column_writer,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_column_writer_t *internal_column_writer = NULL;
+	ftxf_column_chunk_header_t *chunk_header                 = NULL;
+	static char *function                                    = "libftxf_column_writer_copy_chunk_to_byte_stream";
+	size_t byte_stream_offset                                = 0;
+	size_t chunk_size                                        = 0;
+	size_t column_data_offset                                = 0;
+	size_t column_data_size                                  = 0;
+	uint32_t chunk_flags                                     = 0;
+	uint32_t name_index                                      = 0;
+	int column_type                                          = 0;
+
+	if( column_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column writer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_column_writer = (libftxf_internal_column_writer_t *) column_writer;
+
+	if( internal_column_writer->number_of_records == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid column writer - missing records.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_column_writer_get_chunk_size(
+	     column_writer,
+	     &chunk_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size > (size_t) UINT32_MAX )
+	 || ( byte_stream_size < chunk_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_column_writer->flags & LIBFTXF_COLUMN_WRITER_FLAG_STATISTICS ) != 0 )
+	{
+		chunk_flags |= LIBFTXF_COLUMN_CHUNK_FLAG_HAS_STATISTICS;
+	}
+	chunk_header = (ftxf_column_chunk_header_t *) byte_stream;
+
+	if( memory_set(
+	     chunk_header,
+	     0,
+	     sizeof( ftxf_column_chunk_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     chunk_header->signature,
+	     libftxf_column_chunk_signature,
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 chunk_header->chunk_size,
+	 (uint32_t) chunk_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 chunk_header->number_of_records,
+	 internal_column_writer->number_of_records );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 chunk_header->flags,
+	 chunk_flags );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 chunk_header->number_of_guids,
+	 internal_column_writer->number_of_guids );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 chunk_header->number_of_names,
+	 internal_column_writer->number_of_names );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 chunk_header->names_data_size,
+	 (uint32_t) internal_column_writer->names_data_size );
+
+	if( ( chunk_flags & LIBFTXF_COLUMN_CHUNK_FLAG_HAS_STATISTICS ) != 0 )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 chunk_header->minimum_timestamp,
+		 internal_column_writer->minimum_timestamp );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 chunk_header->maximum_timestamp,
+		 internal_column_writer->maximum_timestamp );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 chunk_header->minimum_file_reference,
+		 internal_column_writer->minimum_file_reference );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 chunk_header->maximum_file_reference,
+		 internal_column_writer->maximum_file_reference );
+	}
+	byte_stream_offset = sizeof( ftxf_column_chunk_header_t );
+
+	for( column_type = 0;
+	     column_type < LIBFTXF_NUMBER_OF_COLUMN_TYPES;
+	     column_type++ )
+	{
+		column_data_size = (size_t) internal_column_writer->number_of_records * libftxf_column_chunk_value_sizes[ column_type ];
+
+		if( memory_copy(
+		     &( byte_stream[ byte_stream_offset ] ),
+		     &( internal_column_writer->column_data[ column_data_offset ] ),
+		     column_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy column: %d data.",
+			 function,
+			 column_type );
+
+			return( -1 );
+		}
+		byte_stream_offset += column_data_size;
+		column_data_offset += (size_t) internal_column_writer->maximum_number_of_records * libftxf_column_chunk_value_sizes[ column_type ];
+	}
+	if( memory_copy(
+	     &( byte_stream[ byte_stream_offset ] ),
+	     internal_column_writer->guids,
+	     (size_t) internal_column_writer->number_of_guids * LIBFTXF_COLUMN_CHUNK_GUID_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset += (size_t) internal_column_writer->number_of_guids * LIBFTXF_COLUMN_CHUNK_GUID_SIZE;
+
+	for( name_index = 0;
+	     name_index <= internal_column_writer->number_of_names;
+	     name_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 internal_column_writer->name_offsets[ name_index ] );
+
+		byte_stream_offset += 4;
+	}
+	if( internal_column_writer->names_data_size > 0 )
+	{
+		if( memory_copy(
+		     &( byte_stream[ byte_stream_offset ] ),
+		     internal_column_writer->names_data,
+		     internal_column_writer->names_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name dictionary data.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_offset += internal_column_writer->names_data_size;
+	}
+	if( byte_stream_offset < chunk_size )
+	{
+		if( memory_set(
+		     &( byte_stream[ byte_stream_offset ] ),
+		     0,
+		     chunk_size - byte_stream_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear padding.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Reset the column writer for the next chunk
+	 */
+	if( memory_set(
+	     internal_column_writer->guid_hash_table,
+	     0,
+	     sizeof( uint32_t ) * internal_column_writer->hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear GUID dictionary hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_column_writer->name_hash_table,
+	     0,
+	     sizeof( uint32_t ) * internal_column_writer->hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name dictionary hash table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_column_writer->number_of_records = 0;
+	internal_column_writer->number_of_guids   = 0;
+	internal_column_writer->number_of_names   = 0;
+	internal_column_writer->names_data_size   = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,174 @@
+/*
+ * Column writer functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_COLUMN_WRITER_H )
+#define _LIBFTXF_COLUMN_WRITER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libftxf_internal_column_writer libftxf_internal_column_writer_t;
+
+struct libftxf_internal_column_writer
+{
+	/* The maximum number of records per chunk
+	 */
+	uint32_t maximum_number_of_records;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The number of records in the current chunk
+	 */
+	uint32_t number_of_records;
+
+	/* The column data
+	 * Contains the little-endian column values laid out for the maximum number of records
+	 */
+	uint8_t *column_data;
+
+	/* The GUID dictionary
+	 */
+	uint8_t *guids;
+
+	/* The number of GUIDs
+	 */
+	uint32_t number_of_guids;
+
+	/* The name dictionary offsets
+	 */
+	uint32_t *name_offsets;
+
+	/* The number of names
+	 */
+	uint32_t number_of_names;
+
+	/* The name dictionary data
+	 * Contains the UTF-16 little-endian names without end-of-string character
+	 */
+	uint8_t *names_data;
+
+	/* The name dictionary data size
+	 */
+	size_t names_data_size;
+
+	/* The allocated name dictionary data size
+	 */
+	size_t allocated_names_data_size;
+
+	/* The dictionary hash table size
+	 * Contains a power of 2
+	 */
+	uint32_t hash_table_size;
+
+	/* The GUID dictionary hash table
+	 * Contains the GUID index + 1 or 0 for an unused entry
+	 */
+	uint32_t *guid_hash_table;
+
+	/* The name dictionary hash table
+	 * Contains the name index + 1 or 0 for an unused entry
+	 */
+	uint32_t *name_hash_table;
+
+	/* The minimum (header) timestamp
+	 */
+	uint64_t minimum_timestamp;
+
+	/* The maximum (header) timestamp
+	 */
+	uint64_t maximum_timestamp;
+
+	/* The minimum file reference
+	 */
+	uint64_t minimum_file_reference;
+
+	/* The maximum file reference
+	 */
+	uint64_t maximum_file_reference;
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the column writer and its buffers
+	 */
+	libftxf_allocator_t allocator;
+};
+
+LIBFTXF_EXTERN \
+int libftxf_column_writer_initialize(
+     libftxf_column_writer_t **column_writer,
+     uint32_t maximum_number_of_records,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_writer_initialize_with_allocator(
+     libftxf_column_writer_t **column_writer,
+     uint32_t maximum_number_of_records,
+     uint8_t flags,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_writer_free(
+     libftxf_column_writer_t **column_writer,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_writer_copy_file_header_to_byte_stream(
+     libftxf_column_writer_t *column_writer,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_writer_append_record(
+     libftxf_column_writer_t *column_writer,
+     libftxf_record_t *txf_record,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_writer_get_chunk_size(
+     libftxf_column_writer_t *column_writer,
+     size_t *chunk_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_column_writer_copy_chunk_to_byte_stream(
+     libftxf_column_writer_t *column_writer,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_COLUMN_WRITER_H ) */
+
@@ -0,0 +1,1123 @@
+/*
+ * Duplicate filter functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_definitions.h"
+#include "libftxf_duplicate_filter.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_libcthreads.h"
+#include "libftxf_record.h"
+#include "libftxf_record_hash.h"
+
+#include "ftxf_record.h"
+
+/* The initial hash table size, must be a power of 2
+ */
+#define LIBFTXF_DUPLICATE_FILTER_INITIAL_HASH_TABLE_SIZE	4096
+
+/* The duplicate filter detects records that were seen before, such as records that are
+ * stored multiple times in carved or overlapping sources. Only the content hash and size
+ * of every distinct record are stored. Records are considered equal if the content hash
+ * and size of their data are equal.
+ *
+ * To bound the memory used, the entries can be sorted, copied to a byte stream and the
+ * duplicate filter emptied, for example to store the entries in a temporary file.
+ */
+
+/* Compares two duplicate filter entries by content hash and record size
+ * Returns -1 if the first entry is less, 0 if equal or 1 if greater than the second entry
+ */
+int libftxf_duplicate_filter_entry_compare(
+     const libftxf_duplicate_filter_entry_t *first_entry,
+     const libftxf_duplicate_filter_entry_t *second_entry )
+{
+	if( first_entry->content_hash < second_entry->content_hash )
+	{
+		return( -1 );
+	}
+	if( first_entry->content_hash > second_entry->content_hash )
+	{
+		return( 1 );
+	}
+	if( first_entry->record_size < second_entry->record_size )
+	{
+		return( -1 );
+	}
+	if( first_entry->record_size > second_entry->record_size )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Moves an entry down the heap until none of its children is greater
+ */
+void libftxf_duplicate_filter_entries_sift_down(
+     libftxf_duplicate_filter_entry_t *entries,
+     uint32_t entry_index,
+     uint32_t number_of_entries )
+{
+	libftxf_duplicate_filter_entry_t entry;
+
+	uint32_t child_index = 0;
+
+	entry = entries[ entry_index ];
+
+	while( entry_index < ( number_of_entries / 2 ) )
+	{
+		child_index = ( 2 * entry_index ) + 1;
+
+		if( ( ( child_index + 1 ) < number_of_entries )
+		 && ( libftxf_duplicate_filter_entry_compare(
+		       &( entries[ child_index ] ),
+		       &( entries[ child_index + 1 ] ) ) < 0 ) )
+		{
+			child_index += 1;
+		}
+		if( libftxf_duplicate_filter_entry_compare(
+		     &entry,
+		     &( entries[ child_index ] ) ) >= 0 )
+		{
+			break;
+		}
+		entries[ entry_index ] = entries[ child_index ];
+
+		entry_index = child_index;
+	}
+	entries[ entry_index ] = entry;
+}
+
+/* Creates a duplicate filter
+ * Make sure the value duplicate_filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_duplicate_filter_initialize(
+     libftxf_duplicate_filter_t **duplicate_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_duplicate_filter_initialize";
+
+	if( libftxf_duplicate_filter_initialize_with_allocator(
+	     duplicate_filter,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a duplicate filter that allocates its memory using the allocator functions
+ * Make sure the value duplicate_filter is referencing, is set to NULL
+ * The allocator is copied into the duplicate filter, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_duplicate_filter_initialize_with_allocator(
+     libftxf_duplicate_filter_t **duplicate_filter,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	libftxf_internal_duplicate_filter_t *internal_duplicate_filter = NULL;
+	static char *function                                          = "libftxf_duplicate_filter_initialize_with_allocator";
+
+	if( duplicate_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *duplicate_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid duplicate filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_duplicate_filter = (libftxf_internal_duplicate_filter_t *) libftxf_allocator_allocate(
+	                                                                     allocator,
+	                                                                     sizeof( libftxf_internal_duplicate_filter_t ) );
+
+	if( internal_duplicate_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create duplicate filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_duplicate_filter,
+	     0,
+	     sizeof( libftxf_internal_duplicate_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear duplicate filter.",
+		 function );
+
+		libftxf_allocator_free(
+		 allocator,
+		 internal_duplicate_filter );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		internal_duplicate_filter->allocator = *allocator;
+	}
+	internal_duplicate_filter->hash_table_size = LIBFTXF_DUPLICATE_FILTER_INITIAL_HASH_TABLE_SIZE;
+
+	internal_duplicate_filter->hash_table = (libftxf_duplicate_filter_entry_t *) libftxf_allocator_allocate(
+	                                                                              &( internal_duplicate_filter->allocator ),
+	                                                                              sizeof( libftxf_duplicate_filter_entry_t ) * internal_duplicate_filter->hash_table_size );
+
+	if( internal_duplicate_filter->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_duplicate_filter->hash_table,
+	     0,
+	     sizeof( libftxf_duplicate_filter_entry_t ) * internal_duplicate_filter->hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		goto on_error;
+	}
+	*duplicate_filter = (libftxf_duplicate_filter_t *) internal_duplicate_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_duplicate_filter != NULL )
+	{
+		if( internal_duplicate_filter->hash_table != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_duplicate_filter->allocator ),
+			 internal_duplicate_filter->hash_table );
+		}
+		libftxf_allocator_free(
+		 allocator,
+		 internal_duplicate_filter );
+	}
+	return( -1 );
+}
+
+/* Frees a duplicate filter
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_duplicate_filter_free(
+     libftxf_duplicate_filter_t **duplicate_filter,
+     libcerror_error_t **error )
+{
+	libftxf_allocator_t allocator;
+
+	libftxf_internal_duplicate_filter_t *internal_duplicate_filter = NULL;
+	static char *function                                          = "libftxf_duplicate_filter_free";
+
+	if( duplicate_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *duplicate_filter != NULL )
+	{
+		internal_duplicate_filter = (libftxf_internal_duplicate_filter_t *) *duplicate_filter;
+		*duplicate_filter         = NULL;
+
+		libftxf_allocator_free(
+		 &( internal_duplicate_filter->allocator ),
+		 internal_duplicate_filter->hash_table );
+
+		/* The allocator is copied since it is stored in the duplicate filter that is freed
+		 */
+		allocator = internal_duplicate_filter->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
+		 internal_duplicate_filter );
+	}
+	return( 1 );
+}
+
+/* Empties a duplicate filter
+ * The hash table is retained
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_duplicate_filter_empty(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     libcerror_error_t **error )
+{
+	libftxf_internal_duplicate_filter_t *internal_duplicate_filter = NULL;
+	static char *function                                          = "libftxf_duplicate_filter_empty";
+
+	if( duplicate_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_duplicate_filter = (libftxf_internal_duplicate_filter_t *) duplicate_filter;
+
+	if( memory_set(
+	     internal_duplicate_filter->hash_table,
+	     0,
+	     sizeof( libftxf_duplicate_filter_entry_t ) * internal_duplicate_filter->hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_duplicate_filter->number_of_records = 0;
+	internal_duplicate_filter->is_sorted         = 0;
+
+	return( 1 );
+}
+
+/* Doubles the size of the hash table and re-inserts the entries
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_duplicate_filter_resize_hash_table(
+     libftxf_internal_duplicate_filter_t *internal_duplicate_filter,
+     libcerror_error_t **error )
+{
+	libftxf_duplicate_filter_entry_t *hash_table = NULL;
+	libftxf_duplicate_filter_entry_t *entry      = NULL;
+	static char *function                        = "libftxf_internal_duplicate_filter_resize_hash_table";
+	uint32_t entry_index                         = 0;
+	uint32_t hash_table_index                    = 0;
+	uint32_t hash_table_mask                     = 0;
+	uint32_t hash_table_size                     = 0;
+
+	if( internal_duplicate_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_duplicate_filter->hash_table_size > ( (uint32_t) INT32_MAX ) )
+	 || ( (size_t) internal_duplicate_filter->hash_table_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libftxf_duplicate_filter_entry_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid duplicate filter - hash table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_size = internal_duplicate_filter->hash_table_size * 2;
+	hash_table_mask = hash_table_size - 1;
+
+	hash_table = (libftxf_duplicate_filter_entry_t *) libftxf_allocator_allocate(
+	                                                   &( internal_duplicate_filter->allocator ),
+	                                                   sizeof( libftxf_duplicate_filter_entry_t ) * hash_table_size );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( libftxf_duplicate_filter_entry_t ) * hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		libftxf_allocator_free(
+		 &( internal_duplicate_filter->allocator ),
+		 hash_table );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_duplicate_filter->hash_table_size;
+	     entry_index++ )
+	{
+		entry = &( internal_duplicate_filter->hash_table[ entry_index ] );
+
+		if( entry->record_size == 0 )
+		{
+			continue;
+		}
+		hash_table_index = (uint32_t) entry->content_hash & hash_table_mask;
+
+		while( hash_table[ hash_table_index ].record_size != 0 )
+		{
+			hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+		}
+		hash_table[ hash_table_index ] = *entry;
+	}
+	libftxf_allocator_free(
+	 &( internal_duplicate_filter->allocator ),
+	 internal_duplicate_filter->hash_table );
+
+	internal_duplicate_filter->hash_table      = hash_table;
+	internal_duplicate_filter->hash_table_size = hash_table_size;
+
+	return( 1 );
+}
+
+/* Inserts the content hash and size of a record
+ * Returns 1 if the record was inserted, 0 if the record was already present or -1 on error
+ */
+int libftxf_internal_duplicate_filter_insert(
+     libftxf_internal_duplicate_filter_t *internal_duplicate_filter,
+     uint64_t content_hash,
+     uint32_t record_size,
+     libcerror_error_t **error )
+{
+	libftxf_duplicate_filter_entry_t *entry = NULL;
+	static char *function                   = "libftxf_internal_duplicate_filter_insert";
+	uint32_t hash_table_index               = 0;
+	uint32_t hash_table_mask                = 0;
+
+	if( internal_duplicate_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_duplicate_filter->is_sorted != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid duplicate filter - entries are sorted.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid record size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_mask  = internal_duplicate_filter->hash_table_size - 1;
+	hash_table_index = (uint32_t) content_hash & hash_table_mask;
+
+	entry = &( internal_duplicate_filter->hash_table[ hash_table_index ] );
+
+	while( entry->record_size != 0 )
+	{
+		if( ( entry->content_hash == content_hash )
+		 && ( entry->record_size == record_size ) )
+		{
+			return( 0 );
+		}
+		hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+
+		entry = &( internal_duplicate_filter->hash_table[ hash_table_index ] );
+	}
+	entry->content_hash = content_hash;
+	entry->record_size  = record_size;
+
+	internal_duplicate_filter->number_of_records += 1;
+
+	/* Keep the load factor of the hash table at or below 0.5
+	 */
+	if( ( internal_duplicate_filter->number_of_records * 2 ) > internal_duplicate_filter->hash_table_size )
+	{
+		if( libftxf_internal_duplicate_filter_resize_hash_table(
+		     internal_duplicate_filter,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Calculates the content hash and size of the record in the byte stream
+ * Only the record header is read and the content hash is calculated over the record data
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_duplicate_filter_calculate_entry(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint64_t *content_hash,
+     uint32_t *record_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_duplicate_filter_calculate_entry";
+	uint32_t safe_size    = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < sizeof( ftxf_record_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( content_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid content hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record size.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_record_header_t *) byte_stream )->record_size,
+	 safe_size );
+
+	if( ( (size_t) safe_size < sizeof( ftxf_record_header_t ) )
+	 || ( (size_t) safe_size > byte_stream_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: record size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_record_hash_calculate(
+	     content_hash,
+	     byte_stream,
+	     (size_t) safe_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate content hash.",
+		 function );
+
+		return( -1 );
+	}
+	*record_size = safe_size;
+
+	return( 1 );
+}
+
+/* Checks if the content hash and size of a record were checked before
+ * Returns 1 if the record is a duplicate, 0 if not or -1 on error
+ */
+int libftxf_duplicate_filter_check_entry(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     uint64_t content_hash,
+     uint32_t record_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_duplicate_filter_check_entry";
+	int result            = 0;
+
+	if( duplicate_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	result = libftxf_internal_duplicate_filter_insert(
+	          (libftxf_internal_duplicate_filter_t *) duplicate_filter,
+	          content_hash,
+	          record_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert record.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Checks if the record in the byte stream is a duplicate of a record that was checked before
+ * Only the record header is read and the content hash is calculated over the record data,
+ * hence duplicate records can be skipped before they are copied
+ * Returns 1 if the record is a duplicate, 0 if not or -1 on error
+ */
+int libftxf_duplicate_filter_check_byte_stream(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_duplicate_filter_check_byte_stream";
+	uint64_t content_hash = 0;
+	uint32_t record_size  = 0;
+	int result            = 0;
+
+	if( duplicate_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_duplicate_filter_calculate_entry(
+	     byte_stream,
+	     byte_stream_size,
+	     &content_hash,
+	     &record_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libftxf_internal_duplicate_filter_insert(
+	          (libftxf_internal_duplicate_filter_t *) duplicate_filter,
+	          content_hash,
+	          record_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert record.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Checks if the record is a duplicate of a record that was checked before
+ * The content hash that was calculated when the record was copied is used
+ * Returns 1 if the record is a duplicate, 0 if not or -1 on error
+ */
+int libftxf_duplicate_filter_check_record(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     libftxf_record_t *record,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_duplicate_filter_check_record";
+	int result                                 = 0;
+
+	if( duplicate_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_record->size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing size.",
+		 function );
+
+		goto on_error;
+	}
+	result = libftxf_internal_duplicate_filter_insert(
+	          (libftxf_internal_duplicate_filter_t *) duplicate_filter,
+	          internal_record->content_hash,
+	          internal_record->size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert record.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+
+on_error:
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_record->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the number of distinct records
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_duplicate_filter_get_number_of_records(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     uint32_t *number_of_records,
+     libcerror_error_t **error )
+{
+	libftxf_internal_duplicate_filter_t *internal_duplicate_filter = NULL;
+	static char *function                                          = "libftxf_duplicate_filter_get_number_of_records";
+
+	if( duplicate_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_duplicate_filter = (libftxf_internal_duplicate_filter_t *) duplicate_filter;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = internal_duplicate_filter->number_of_records;
+
+	return( 1 );
+}
+
+/* Sorts the entries by content hash and record size
+ * The entries are moved to the start of the hash table and sorted in place by means of a heap sort,
+ * hence no additional memory is needed. The duplicate filter cannot be used to check records
+ * until it is emptied.
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_duplicate_filter_sort(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     libcerror_error_t **error )
+{
+	libftxf_duplicate_filter_entry_t entry;
+
+	libftxf_duplicate_filter_entry_t *hash_table                   = NULL;
+	libftxf_internal_duplicate_filter_t *internal_duplicate_filter = NULL;
+	static char *function                                          = "libftxf_duplicate_filter_sort";
+	uint32_t entry_index                                           = 0;
+	uint32_t number_of_entries                                     = 0;
+
+	if( duplicate_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_duplicate_filter = (libftxf_internal_duplicate_filter_t *) duplicate_filter;
+
+	if( internal_duplicate_filter->is_sorted != 0 )
+	{
+		return( 1 );
+	}
+	hash_table = internal_duplicate_filter->hash_table;
+
+	/* Move the entries to the start of the hash table
+	 */
+	for( entry_index = 0;
+	     entry_index < internal_duplicate_filter->hash_table_size;
+	     entry_index++ )
+	{
+		if( hash_table[ entry_index ].record_size == 0 )
+		{
+			continue;
+		}
+		if( entry_index != number_of_entries )
+		{
+			hash_table[ number_of_entries ] = hash_table[ entry_index ];
+
+			hash_table[ entry_index ].record_size = 0;
+		}
+		number_of_entries++;
+	}
+	for( entry_index = number_of_entries / 2;
+	     entry_index > 0;
+	     entry_index-- )
+	{
+		libftxf_duplicate_filter_entries_sift_down(
+		 hash_table,
+		 entry_index - 1,
+		 number_of_entries );
+	}
+	for( entry_index = number_of_entries;
+	     entry_index > 1;
+	     entry_index-- )
+	{
+		entry                         = hash_table[ 0 ];
+		hash_table[ 0 ]               = hash_table[ entry_index - 1 ];
+		hash_table[ entry_index - 1 ] = entry;
+
+		libftxf_duplicate_filter_entries_sift_down(
+		 hash_table,
+		 0,
+		 entry_index - 1 );
+	}
+	internal_duplicate_filter->is_sorted = 1;
+
+	return( 1 );
+}
+
+/* Copies sorted entries to a byte stream
+ * Copies as many entries, starting with the first entry index, as fit in the byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_duplicate_filter_copy_to_byte_stream(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     uint32_t first_entry_index,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error )
+{
+	libftxf_duplicate_filter_entry_t *entry                        = NULL;
+	libftxf_internal_duplicate_filter_t *internal_duplicate_filter = NULL;
+	static char *function                                          = "libftxf_duplicate_filter_copy_to_byte_stream";
+	size_t byte_stream_offset                                      = 0;
+	uint32_t entry_index                                           = 0;
+	uint32_t number_of_copied_entries                              = 0;
+
+	if( duplicate_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid duplicate filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_duplicate_filter = (libftxf_internal_duplicate_filter_t *) duplicate_filter;
+
+	if( internal_duplicate_filter->is_sorted == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid duplicate filter - entries are not sorted.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_entry_index > internal_duplicate_filter->number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size < LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_copied_entries = internal_duplicate_filter->number_of_records - first_entry_index;
+
+	if( (size_t) number_of_copied_entries > ( byte_stream_size / LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE ) )
+	{
+		number_of_copied_entries = (uint32_t) ( byte_stream_size / LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE );
+	}
+	for( entry_index = first_entry_index;
+	     entry_index < ( first_entry_index + number_of_copied_entries );
+	     entry_index++ )
+	{
+		entry = &( internal_duplicate_filter->hash_table[ entry_index ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 entry->content_hash );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset + 8 ] ),
+		 entry->record_size );
+
+		byte_stream_offset += LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE;
+	}
+	*number_of_entries = number_of_copied_entries;
+
+	return( 1 );
+}
+
@@ -0,0 +1,171 @@
+/*
+ * Duplicate filter functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_DUPLICATE_FILTER_H )
+#define _LIBFTXF_DUPLICATE_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libftxf_duplicate_filter_entry libftxf_duplicate_filter_entry_t;
+
+struct libftxf_duplicate_filter_entry
+{
+	/* The content hash of the record data
+	 */
+	uint64_t content_hash;
+
+	/* The record size
+	 * Contains 0 for an unused entry
+	 */
+	uint32_t record_size;
+};
+
+typedef struct libftxf_internal_duplicate_filter libftxf_internal_duplicate_filter_t;
+
+struct libftxf_internal_duplicate_filter
+{
+	/* The hash table
+	 */
+	libftxf_duplicate_filter_entry_t *hash_table;
+
+	/* The hash table size
+	 * Contains a power of 2
+	 */
+	uint32_t hash_table_size;
+
+	/* The number of records
+	 */
+	uint32_t number_of_records;
+
+	/* Value to indicate the entries are sorted
+	 * The entries are then stored at the start of the hash table
+	 */
+	uint8_t is_sorted;
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the duplicate filter and its buffers
+	 */
+	libftxf_allocator_t allocator;
+};
+
+int libftxf_duplicate_filter_entry_compare(
+     const libftxf_duplicate_filter_entry_t *first_entry,
+     const libftxf_duplicate_filter_entry_t *second_entry );
+
+void libftxf_duplicate_filter_entries_sift_down(
+     libftxf_duplicate_filter_entry_t *entries,
+     uint32_t entry_index,
+     uint32_t number_of_entries );
+
+LIBFTXF_EXTERN \
+int libftxf_duplicate_filter_initialize(
+     libftxf_duplicate_filter_t **duplicate_filter,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_duplicate_filter_initialize_with_allocator(
+     libftxf_duplicate_filter_t **duplicate_filter,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_duplicate_filter_free(
+     libftxf_duplicate_filter_t **duplicate_filter,
+     libcerror_error_t **error );
+
+int libftxf_internal_duplicate_filter_resize_hash_table(
+     libftxf_internal_duplicate_filter_t *internal_duplicate_filter,
+     libcerror_error_t **error );
+
+int libftxf_internal_duplicate_filter_insert(
+     libftxf_internal_duplicate_filter_t *internal_duplicate_filter,
+     uint64_t content_hash,
+     uint32_t record_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_duplicate_filter_empty(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_duplicate_filter_calculate_entry(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint64_t *content_hash,
+     uint32_t *record_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_duplicate_filter_check_entry(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     uint64_t content_hash,
+     uint32_t record_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_duplicate_filter_check_byte_stream(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_duplicate_filter_check_record(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     libftxf_record_t *txf_record,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_duplicate_filter_get_number_of_records(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     uint32_t *number_of_records,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_duplicate_filter_sort(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_duplicate_filter_copy_to_byte_stream(
+     libftxf_duplicate_filter_t *duplicate_filter,
+     uint32_t first_entry_index,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_DUPLICATE_FILTER_H ) */
+
@@ -0,0 +1,314 @@
+/*
+ * FILETIME functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_definitions.h"
+#include "libftxf_filetime.h"
+#include "libftxf_libcerror.h"
+
+/* A FILETIME contains the number of 100 nano seconds intervals since 1601-01-01 00:00:00
+ * The values are converted with integer arithmetic only, without creating a libfdatetime
+ * FILETIME per value
+ */
+
+/* The decimal representation of the values 0 to 99
+ */
+static const char libftxf_filetime_decimal_digits[ 201 ] = \
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+/* Copies the decimal representation of a value of 0 to 99 as 2 characters
+ */
+#define libftxf_filetime_copy_2_digits( utf8_string, value ) \
+	( utf8_string )[ 0 ] = (uint8_t) libftxf_filetime_decimal_digits[ ( value ) * 2 ]; \
+	( utf8_string )[ 1 ] = (uint8_t) libftxf_filetime_decimal_digits[ ( ( value ) * 2 ) + 1 ]
+
+/* Copies FILETIMEs to POSIX times in nano seconds since 1970-01-01 00:00:00
+ * FILETIMEs that are out of the range of a signed 64-bit POSIX time, such as 0,
+ * are clamped to the smallest or largest signed 64-bit value
+ * The loop contains no branches so that it can be vectorized by the compiler
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_filetime_copy_to_posix_times(
+     const uint64_t *filetimes,
+     int64_t *posix_times,
+     size_t number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_filetime_copy_to_posix_times";
+	size_t value_index    = 0;
+	uint64_t filetime     = 0;
+	int64_t posix_time    = 0;
+
+	if( filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIMEs.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX times.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		filetime = filetimes[ value_index ];
+
+		/* The subtraction is done unsigned to prevent a signed overflow,
+		 * the result is only used if the FILETIME is within range
+		 */
+		posix_time = (int64_t) ( ( filetime - LIBFTXF_FILETIME_POSIX_EPOCH ) * 100 );
+
+		posix_time = ( filetime < LIBFTXF_FILETIME_MINIMUM_POSIX_TIME_FILETIME ) ? (int64_t) INT64_MIN : posix_time;
+		posix_time = ( filetime > LIBFTXF_FILETIME_MAXIMUM_POSIX_TIME_FILETIME ) ? (int64_t) INT64_MAX : posix_time;
+
+		posix_times[ value_index ] = posix_time;
+	}
+	return( 1 );
+}
+
+/* Copies a FILETIME to an ISO 8601 UTF-8 string
+ * The string is formatted as "YYYY-MM-DDThh:mm:ss.fffffffZ" and must be
+ * at least LIBFTXF_FILETIME_ISO8601_STRING_SIZE bytes of size
+ * Returns 1 if successful or 0 if the FILETIME is out of bounds
+ */
+int libftxf_filetime_copy_to_utf8_iso8601_string(
+     uint64_t filetime,
+     uint8_t *utf8_string )
+{
+	uint64_t number_of_days     = 0;
+	uint32_t day_of_era         = 0;
+	uint32_t day_of_year        = 0;
+	uint32_t era                = 0;
+	uint32_t fraction_of_second = 0;
+	uint32_t month_of_year      = 0;
+	uint32_t seconds_of_day     = 0;
+	uint32_t year               = 0;
+	uint32_t year_of_era        = 0;
+
+	if( filetime > LIBFTXF_FILETIME_MAXIMUM_ISO8601_FILETIME )
+	{
+		return( 0 );
+	}
+	fraction_of_second = (uint32_t) ( filetime % 10000000UL );
+	filetime          /= 10000000UL;
+	seconds_of_day     = (uint32_t) ( filetime % 86400 );
+	number_of_days     = ( filetime / 86400 ) + LIBFTXF_FILETIME_DAYS_FROM_MARCH_0000;
+
+	/* Determine the date in the proleptic Gregorian calendar using eras of 400 years,
+	 * where the years start on March 1 so that the leap day is the last day of a year
+	 */
+	era         = (uint32_t) ( number_of_days / 146097 );
+	day_of_era  = (uint32_t) ( number_of_days - ( (uint64_t) era * 146097 ) );
+	year_of_era = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+	day_of_year = day_of_era - ( ( 365 * year_of_era ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+
+	month_of_year = ( ( 5 * day_of_year ) + 2 ) / 153;
+	day_of_year   = day_of_year - ( ( ( 153 * month_of_year ) + 2 ) / 5 );
+	year          = year_of_era + ( era * 400 );
+
+	if( month_of_year < 10 )
+	{
+		month_of_year += 3;
+	}
+	else
+	{
+		month_of_year -= 9;
+		year          += 1;
+	}
+	libftxf_filetime_copy_2_digits(
+	 &( utf8_string[ 0 ] ),
+	 year / 100 );
+
+	libftxf_filetime_copy_2_digits(
+	 &( utf8_string[ 2 ] ),
+	 year % 100 );
+
+	utf8_string[ 4 ] = (uint8_t) '-';
+
+	libftxf_filetime_copy_2_digits(
+	 &( utf8_string[ 5 ] ),
+	 month_of_year );
+
+	utf8_string[ 7 ] = (uint8_t) '-';
+
+	libftxf_filetime_copy_2_digits(
+	 &( utf8_string[ 8 ] ),
+	 day_of_year + 1 );
+
+	utf8_string[ 10 ] = (uint8_t) 'T';
+
+	libftxf_filetime_copy_2_digits(
+	 &( utf8_string[ 11 ] ),
+	 seconds_of_day / 3600 );
+
+	utf8_string[ 13 ] = (uint8_t) ':';
+
+	libftxf_filetime_copy_2_digits(
+	 &( utf8_string[ 14 ] ),
+	 ( seconds_of_day / 60 ) % 60 );
+
+	utf8_string[ 16 ] = (uint8_t) ':';
+
+	libftxf_filetime_copy_2_digits(
+	 &( utf8_string[ 17 ] ),
+	 seconds_of_day % 60 );
+
+	utf8_string[ 19 ] = (uint8_t) '.';
+
+	libftxf_filetime_copy_2_digits(
+	 &( utf8_string[ 20 ] ),
+	 fraction_of_second / 100000 );
+
+	libftxf_filetime_copy_2_digits(
+	 &( utf8_string[ 22 ] ),
+	 ( fraction_of_second / 1000 ) % 100 );
+
+	libftxf_filetime_copy_2_digits(
+	 &( utf8_string[ 24 ] ),
+	 ( fraction_of_second / 10 ) % 100 );
+
+	utf8_string[ 26 ] = (uint8_t) ( '0' + ( fraction_of_second % 10 ) );
+	utf8_string[ 27 ] = (uint8_t) 'Z';
+	utf8_string[ 28 ] = 0;
+
+	return( 1 );
+}
+
+/* Copies FILETIMEs to ISO 8601 UTF-8 strings
+ * Every string is formatted as "YYYY-MM-DDThh:mm:ss.fffffffZ" and is stored in
+ * LIBFTXF_FILETIME_ISO8601_STRING_SIZE bytes including the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_filetime_copy_to_utf8_iso8601_strings(
+     const uint64_t *filetimes,
+     size_t number_of_filetimes,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_filetime_copy_to_utf8_iso8601_strings";
+	size_t filetime_index = 0;
+	size_t string_offset  = 0;
+
+	if( filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIMEs.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filetimes > (size_t) ( SSIZE_MAX / LIBFTXF_FILETIME_ISO8601_STRING_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of FILETIMEs value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_strings_size > (size_t) SSIZE_MAX )
+	 || ( utf8_strings_size < ( number_of_filetimes * LIBFTXF_FILETIME_ISO8601_STRING_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 strings size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( filetime_index = 0;
+	     filetime_index < number_of_filetimes;
+	     filetime_index++ )
+	{
+		if( libftxf_filetime_copy_to_utf8_iso8601_string(
+		     filetimes[ filetime_index ],
+		     &( utf8_strings[ string_offset ] ) ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid FILETIME: %" PRIzd " value out of bounds.",
+			 function,
+			 filetime_index );
+
+			return( -1 );
+		}
+		string_offset += LIBFTXF_FILETIME_ISO8601_STRING_SIZE;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,79 @@
+/*
+ * FILETIME functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_FILETIME_H )
+#define _LIBFTXF_FILETIME_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_definitions.h"
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The FILETIME of the POSIX epoch 1970-01-01 00:00:00
+ */
+#define LIBFTXF_FILETIME_POSIX_EPOCH			0x019db1ded53e8000UL
+
+/* The smallest and largest FILETIME that can be represented as a signed 64-bit
+ * POSIX time in nanoseconds
+ */
+#define LIBFTXF_FILETIME_MINIMUM_POSIX_TIME_FILETIME	0x005603ca5a5d3852UL
+#define LIBFTXF_FILETIME_MAXIMUM_POSIX_TIME_FILETIME	0x02e55ff3501fc7aeUL
+
+/* The largest FILETIME that can be represented as an ISO 8601 string
+ * 9999-12-31 23:59:59.9999999
+ */
+#define LIBFTXF_FILETIME_MAXIMUM_ISO8601_FILETIME	0x24c85a5ed1c03fffUL
+
+/* The number of days between 0000-03-01 and 1601-01-01
+ */
+#define LIBFTXF_FILETIME_DAYS_FROM_MARCH_0000		584694
+
+LIBFTXF_EXTERN \
+int libftxf_filetime_copy_to_posix_times(
+     const uint64_t *filetimes,
+     int64_t *posix_times,
+     size_t number_of_values,
+     libcerror_error_t **error );
+
+int libftxf_filetime_copy_to_utf8_iso8601_string(
+     uint64_t filetime,
+     uint8_t *utf8_string );
+
+LIBFTXF_EXTERN \
+int libftxf_filetime_copy_to_utf8_iso8601_strings(
+     const uint64_t *filetimes,
+     size_t number_of_filetimes,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_FILETIME_H ) */
+
@@ -0,0 +1,465 @@
+/*
+ * JSON functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_json.h"
+
+/* The JSON string functions operate on (sub) strings of a fixed size UTF-8 string buffer
+ * The functions return 0 if the buffer is too small, in which case the index is not changed,
+ * so that the caller can flush the buffer and retry
+ */
+
+/* The lower case hexadecimal digits
+ */
+static const uint8_t libftxf_json_hexadecimal_digits[ 16 ] = {
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+/* Appends an escaped character
+ * Returns 1 if successful or 0 if the UTF-8 string is too small
+ */
+static int libftxf_json_append_escaped_character(
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            size_t *utf8_string_index,
+            uint16_t character )
+{
+	size_t safe_utf8_string_index = *utf8_string_index;
+	uint8_t escape_character      = 0;
+
+	switch( character )
+	{
+		case '"':
+		case '\\':
+			escape_character = (uint8_t) character;
+			break;
+
+		case '\b':
+			escape_character = 'b';
+			break;
+
+		case '\f':
+			escape_character = 'f';
+			break;
+
+		case '\n':
+			escape_character = 'n';
+			break;
+
+		case '\r':
+			escape_character = 'r';
+			break;
+
+		case '\t':
+			escape_character = 't';
+			break;
+
+		default:
+			break;
+	}
+	if( escape_character != 0 )
+	{
+		if( ( safe_utf8_string_index + 2 ) > utf8_string_size )
+		{
+			return( 0 );
+		}
+		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '\\';
+		utf8_string[ safe_utf8_string_index++ ] = escape_character;
+	}
+	else
+	{
+		if( ( safe_utf8_string_index + 6 ) > utf8_string_size )
+		{
+			return( 0 );
+		}
+		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '\\';
+		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'u';
+		utf8_string[ safe_utf8_string_index++ ] = libftxf_json_hexadecimal_digits[ ( character >> 12 ) & 0x0f ];
+		utf8_string[ safe_utf8_string_index++ ] = libftxf_json_hexadecimal_digits[ ( character >> 8 ) & 0x0f ];
+		utf8_string[ safe_utf8_string_index++ ] = libftxf_json_hexadecimal_digits[ ( character >> 4 ) & 0x0f ];
+		utf8_string[ safe_utf8_string_index++ ] = libftxf_json_hexadecimal_digits[ character & 0x0f ];
+	}
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+}
+
+/* Appends characters without escaping
+ * Returns 1 if successful or 0 if the UTF-8 string is too small
+ */
+int libftxf_json_append_characters(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const char *characters,
+     size_t number_of_characters )
+{
+	size_t safe_utf8_string_index = *utf8_string_index;
+
+	if( number_of_characters > ( utf8_string_size - safe_utf8_string_index ) )
+	{
+		return( 0 );
+	}
+	while( number_of_characters > 0 )
+	{
+		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) *characters++;
+
+		number_of_characters--;
+	}
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+}
+
+/* Appends an unsigned integer as a decimal number
+ * Returns 1 if successful or 0 if the UTF-8 string is too small
+ */
+int libftxf_json_append_integer(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint64_t value )
+{
+	uint8_t digits[ 20 ];
+
+	size_t safe_utf8_string_index = *utf8_string_index;
+	uint8_t number_of_digits      = 0;
+
+	do
+	{
+		digits[ number_of_digits++ ] = (uint8_t) ( '0' + ( value % 10 ) );
+
+		value /= 10;
+	}
+	while( value > 0 );
+
+	if( (size_t) number_of_digits > ( utf8_string_size - safe_utf8_string_index ) )
+	{
+		return( 0 );
+	}
+	while( number_of_digits > 0 )
+	{
+		utf8_string[ safe_utf8_string_index++ ] = digits[ --number_of_digits ];
+	}
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+}
+
+/* Appends a little-endian GUID as a quoted lower case string
+ * Returns 1 if successful or 0 if the UTF-8 string is too small
+ */
+int libftxf_json_append_guid(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *guid_data )
+{
+	/* The order in which the GUID bytes are printed, where -1 represents a separator
+	 */
+	static const int8_t guid_byte_order[ 20 ] = {
+		3, 2, 1, 0, -1, 5, 4, -1, 7, 6, -1, 8, 9, -1, 10, 11, 12, 13, 14, 15 };
+
+	size_t safe_utf8_string_index = *utf8_string_index;
+	int order_index               = 0;
+
+	if( ( utf8_string_size - safe_utf8_string_index ) < 38 )
+	{
+		return( 0 );
+	}
+	utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '"';
+
+	for( order_index = 0;
+	     order_index < 20;
+	     order_index++ )
+	{
+		if( guid_byte_order[ order_index ] == -1 )
+		{
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '-';
+		}
+		else
+		{
+			utf8_string[ safe_utf8_string_index++ ] = libftxf_json_hexadecimal_digits[ guid_data[ guid_byte_order[ order_index ] ] >> 4 ];
+			utf8_string[ safe_utf8_string_index++ ] = libftxf_json_hexadecimal_digits[ guid_data[ guid_byte_order[ order_index ] ] & 0x0f ];
+		}
+	}
+	utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '"';
+
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+}
+
+/* Appends an UTF-8 string as a quoted and escaped JSON string
+ * Runs of 8 bytes that do not require escaping are copied at once
+ * Returns 1 if successful or 0 if the UTF-8 string is too small
+ */
+int libftxf_json_append_utf8_string(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *value_utf8_string,
+     size_t value_utf8_string_length )
+{
+	size_t safe_utf8_string_index = *utf8_string_index;
+	size_t value_string_index     = 0;
+	uint64_t test_value           = 0;
+	uint64_t value_64bit          = 0;
+	uint64_t xor_value            = 0;
+	uint8_t byte_value            = 0;
+
+	if( safe_utf8_string_index >= utf8_string_size )
+	{
+		return( 0 );
+	}
+	utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '"';
+
+	while( value_string_index < value_utf8_string_length )
+	{
+		if( ( ( value_string_index + 8 ) <= value_utf8_string_length )
+		 && ( ( safe_utf8_string_index + 8 ) <= utf8_string_size ) )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( value_utf8_string[ value_string_index ] ),
+			 value_64bit );
+
+			/* Determine if any of the bytes is a control character, a quote or a backslash
+			 */
+			test_value = ( value_64bit - 0x2020202020202020UL ) & ~value_64bit;
+
+			xor_value   = value_64bit ^ 0x2222222222222222UL;
+			test_value |= ( xor_value - 0x0101010101010101UL ) & ~xor_value;
+
+			xor_value   = value_64bit ^ 0x5c5c5c5c5c5c5c5cUL;
+			test_value |= ( xor_value - 0x0101010101010101UL ) & ~xor_value;
+
+			if( ( test_value & 0x8080808080808080UL ) == 0 )
+			{
+				byte_stream_copy_from_uint64_little_endian(
+				 &( utf8_string[ safe_utf8_string_index ] ),
+				 value_64bit );
+
+				safe_utf8_string_index += 8;
+				value_string_index     += 8;
+
+				continue;
+			}
+		}
+		byte_value = value_utf8_string[ value_string_index++ ];
+
+		if( ( byte_value < 0x20 )
+		 || ( byte_value == (uint8_t) '"' )
+		 || ( byte_value == (uint8_t) '\\' ) )
+		{
+			if( libftxf_json_append_escaped_character(
+			     utf8_string,
+			     utf8_string_size,
+			     &safe_utf8_string_index,
+			     (uint16_t) byte_value ) != 1 )
+			{
+				return( 0 );
+			}
+		}
+		else
+		{
+			if( safe_utf8_string_index >= utf8_string_size )
+			{
+				return( 0 );
+			}
+			utf8_string[ safe_utf8_string_index++ ] = byte_value;
+		}
+	}
+	if( safe_utf8_string_index >= utf8_string_size )
+	{
+		return( 0 );
+	}
+	utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '"';
+
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+}
+
+/* Appends an UTF-16 little-endian stream as a quoted and escaped JSON string
+ * Runs of 4 ASCII characters that do not require escaping are converted at once
+ * Unpaired surrogates are escaped
+ * Returns 1 if successful or 0 if the UTF-8 string is too small
+ */
+int libftxf_json_append_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size )
+{
+	size_t safe_utf8_string_index = *utf8_string_index;
+	size_t utf16_stream_index     = 0;
+	uint64_t test_value           = 0;
+	uint64_t value_64bit          = 0;
+	uint64_t xor_value            = 0;
+	uint32_t unicode_character    = 0;
+	uint16_t low_surrogate        = 0;
+	uint16_t value_16bit          = 0;
+
+	if( safe_utf8_string_index >= utf8_string_size )
+	{
+		return( 0 );
+	}
+	utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '"';
+
+	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+		if( ( ( utf16_stream_index + 8 ) <= utf16_stream_size )
+		 && ( ( safe_utf8_string_index + 4 ) <= utf8_string_size ) )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( utf16_stream[ utf16_stream_index ] ),
+			 value_64bit );
+
+			/* Determine if all 4 UTF-16 code units are ASCII characters
+			 * and none of them is a control character, a quote or a backslash
+			 */
+			if( ( value_64bit & 0xff80ff80ff80ff80UL ) == 0 )
+			{
+				test_value = ( value_64bit - 0x0020002000200020UL ) & ~value_64bit;
+
+				xor_value   = value_64bit ^ 0x0022002200220022UL;
+				test_value |= ( xor_value - 0x0001000100010001UL ) & ~xor_value;
+
+				xor_value   = value_64bit ^ 0x005c005c005c005cUL;
+				test_value |= ( xor_value - 0x0001000100010001UL ) & ~xor_value;
+
+				if( ( test_value & 0x8000800080008000UL ) == 0 )
+				{
+					utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( value_64bit & 0xff );
+					utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( ( value_64bit >> 16 ) & 0xff );
+					utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( ( value_64bit >> 32 ) & 0xff );
+					utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( ( value_64bit >> 48 ) & 0xff );
+
+					utf16_stream_index += 8;
+
+					continue;
+				}
+			}
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 value_16bit );
+
+		utf16_stream_index += 2;
+
+		unicode_character = value_16bit;
+
+		if( ( value_16bit >= 0xd800 )
+		 && ( value_16bit <= 0xdfff ) )
+		{
+			low_surrogate = 0;
+
+			if( ( value_16bit <= 0xdbff )
+			 && ( ( utf16_stream_index + 1 ) < utf16_stream_size ) )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( utf16_stream[ utf16_stream_index ] ),
+				 low_surrogate );
+			}
+			if( ( low_surrogate < 0xdc00 )
+			 || ( low_surrogate > 0xdfff ) )
+			{
+				if( libftxf_json_append_escaped_character(
+				     utf8_string,
+				     utf8_string_size,
+				     &safe_utf8_string_index,
+				     value_16bit ) != 1 )
+				{
+					return( 0 );
+				}
+				continue;
+			}
+			utf16_stream_index += 2;
+
+			unicode_character = 0x10000 + ( ( (uint32_t) value_16bit - 0xd800 ) << 10 ) + ( (uint32_t) low_surrogate - 0xdc00 );
+		}
+		if( ( unicode_character < 0x20 )
+		 || ( unicode_character == (uint32_t) '"' )
+		 || ( unicode_character == (uint32_t) '\\' ) )
+		{
+			if( libftxf_json_append_escaped_character(
+			     utf8_string,
+			     utf8_string_size,
+			     &safe_utf8_string_index,
+			     (uint16_t) unicode_character ) != 1 )
+			{
+				return( 0 );
+			}
+		}
+		else if( unicode_character < 0x80 )
+		{
+			if( ( safe_utf8_string_index + 1 ) > utf8_string_size )
+			{
+				return( 0 );
+			}
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) unicode_character;
+		}
+		else if( unicode_character < 0x800 )
+		{
+			if( ( safe_utf8_string_index + 2 ) > utf8_string_size )
+			{
+				return( 0 );
+			}
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0xc0 | ( unicode_character >> 6 ) );
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+		else if( unicode_character < 0x10000 )
+		{
+			if( ( safe_utf8_string_index + 3 ) > utf8_string_size )
+			{
+				return( 0 );
+			}
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0xe0 | ( unicode_character >> 12 ) );
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+		else
+		{
+			if( ( safe_utf8_string_index + 4 ) > utf8_string_size )
+			{
+				return( 0 );
+			}
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0xf0 | ( unicode_character >> 18 ) );
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 12 ) & 0x3f ) );
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+	}
+	if( safe_utf8_string_index >= utf8_string_size )
+	{
+		return( 0 );
+	}
+	utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '"';
+
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+}
+
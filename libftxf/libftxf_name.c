@@ -0,0 +1,581 @@
+/*
+ * Name functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libftxf_libcerror.h"
+#include "libftxf_libuna.h"
+#include "libftxf_name.h"
+
+/* The names are stored as UTF-16 little-endian streams without end-of-string character.
+ * Runs of ASCII characters are converted 16 and 4 code units at a time, other characters
+ * of the Basic Multilingual Plane are converted one at a time and the remainder of a name
+ * that contains a surrogate is converted by libuna
+ */
+
+/* The mask of the bits that are not set in 4 UTF-16 code units that are all ASCII characters
+ */
+#define LIBFTXF_NAME_ASCII_MASK			0xff80ff80ff80ff80UL
+
+/* Determines if any of 4 UTF-16 code units is part of a surrogate pair
+ */
+#define libftxf_name_has_surrogate( value_64bit ) \
+	( ( ( ( ( value_64bit ) & 0xf800f800f800f800UL ) ^ 0xd800d800d800d800UL ) - 0x0001000100010001UL ) \
+	  & ~( ( ( value_64bit ) & 0xf800f800f800f800UL ) ^ 0xd800d800d800d800UL ) & 0x8000800080008000UL )
+
+/* Packs 4 UTF-16 code units that are all ASCII characters into 4 bytes
+ * The first character is stored in the least significant byte
+ */
+#define libftxf_name_pack_ascii( value_64bit ) \
+	(uint32_t) ( ( ( ( value_64bit ) | ( ( value_64bit ) >> 8 ) ) & 0x0000ffffUL ) \
+	           | ( ( ( ( value_64bit ) | ( ( value_64bit ) >> 8 ) ) >> 16 ) & 0xffff0000UL ) )
+
+/* Determines if 16 UTF-16 code units are all ASCII characters
+ * Returns 1 if all ASCII characters or 0 if not
+ */
+static int libftxf_name_is_ascii_block(
+            const uint8_t *utf16_stream )
+{
+	uint64_t combined_value_64bit = 0;
+	uint64_t value_64bit          = 0;
+	size_t block_index            = 0;
+
+	for( block_index = 0;
+	     block_index < 32;
+	     block_index += 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( utf16_stream[ block_index ] ),
+		 value_64bit );
+
+		combined_value_64bit |= value_64bit;
+	}
+	return( ( combined_value_64bit & LIBFTXF_NAME_ASCII_MASK ) == 0 );
+}
+
+/* Checks the UTF-16 stream arguments
+ * Returns 1 if valid or -1 on error
+ */
+static int libftxf_name_check_utf16_stream(
+            const uint8_t *utf16_stream,
+            size_t utf16_stream_size,
+            const char *function,
+            libcerror_error_t **error )
+{
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size > (size_t) SSIZE_MAX )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the size of the UTF-8 string of an UTF-16 little-endian name
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_get_utf8_string_size(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libftxf_name_get_utf8_string_size";
+	size_t remaining_string_size = 0;
+	size_t safe_utf8_string_size = 0;
+	size_t utf16_stream_index    = 0;
+	uint64_t value_64bit         = 0;
+	uint16_t value_16bit         = 0;
+
+	if( libftxf_name_check_utf16_stream(
+	     utf16_stream,
+	     utf16_stream_size,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf16_stream_index < utf16_stream_size )
+	{
+		if( ( ( utf16_stream_index + 32 ) <= utf16_stream_size )
+		 && ( libftxf_name_is_ascii_block(
+		       &( utf16_stream[ utf16_stream_index ] ) ) != 0 ) )
+		{
+			safe_utf8_string_size += 16;
+			utf16_stream_index    += 32;
+
+			continue;
+		}
+		if( ( utf16_stream_index + 8 ) <= utf16_stream_size )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( utf16_stream[ utf16_stream_index ] ),
+			 value_64bit );
+
+			if( ( value_64bit & LIBFTXF_NAME_ASCII_MASK ) == 0 )
+			{
+				safe_utf8_string_size += 4;
+				utf16_stream_index    += 8;
+
+				continue;
+			}
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 value_16bit );
+
+		if( ( value_16bit >= 0xd800 )
+		 && ( value_16bit <= 0xdfff ) )
+		{
+			if( libuna_utf8_string_size_from_utf16_stream(
+			     &( utf16_stream[ utf16_stream_index ] ),
+			     utf16_stream_size - utf16_stream_index,
+			     LIBUNA_ENDIAN_LITTLE,
+			     &remaining_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine size of UTF-8 string of remainder of name.",
+				 function );
+
+				return( -1 );
+			}
+			*utf8_string_size = safe_utf8_string_size + remaining_string_size;
+
+			return( 1 );
+		}
+		else if( value_16bit < 0x0080 )
+		{
+			safe_utf8_string_size += 1;
+		}
+		else if( value_16bit < 0x0800 )
+		{
+			safe_utf8_string_size += 2;
+		}
+		else
+		{
+			safe_utf8_string_size += 3;
+		}
+		utf16_stream_index += 2;
+	}
+	*utf8_string_size = safe_utf8_string_size + 1;
+
+	return( 1 );
+}
+
+/* Copies an UTF-16 little-endian name to an UTF-8 string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_copy_to_utf8_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libftxf_name_copy_to_utf8_string";
+	size_t block_index        = 0;
+	size_t utf16_stream_index = 0;
+	size_t utf8_string_index  = 0;
+	uint64_t value_64bit      = 0;
+	uint16_t value_16bit      = 0;
+
+	if( libftxf_name_check_utf16_stream(
+	     utf16_stream,
+	     utf16_stream_size,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf16_stream_index < utf16_stream_size )
+	{
+		if( ( ( utf16_stream_index + 32 ) <= utf16_stream_size )
+		 && ( ( utf8_string_index + 16 ) <= utf8_string_size )
+		 && ( libftxf_name_is_ascii_block(
+		       &( utf16_stream[ utf16_stream_index ] ) ) != 0 ) )
+		{
+			for( block_index = 0;
+			     block_index < 32;
+			     block_index += 8 )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( utf16_stream[ utf16_stream_index + block_index ] ),
+				 value_64bit );
+
+				byte_stream_copy_from_uint32_little_endian(
+				 &( utf8_string[ utf8_string_index ] ),
+				 libftxf_name_pack_ascii( value_64bit ) );
+
+				utf8_string_index += 4;
+			}
+			utf16_stream_index += 32;
+
+			continue;
+		}
+		if( ( ( utf16_stream_index + 8 ) <= utf16_stream_size )
+		 && ( ( utf8_string_index + 4 ) <= utf8_string_size ) )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( utf16_stream[ utf16_stream_index ] ),
+			 value_64bit );
+
+			if( ( value_64bit & LIBFTXF_NAME_ASCII_MASK ) == 0 )
+			{
+				byte_stream_copy_from_uint32_little_endian(
+				 &( utf8_string[ utf8_string_index ] ),
+				 libftxf_name_pack_ascii( value_64bit ) );
+
+				utf8_string_index  += 4;
+				utf16_stream_index += 8;
+
+				continue;
+			}
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 value_16bit );
+
+		if( ( value_16bit >= 0xd800 )
+		 && ( value_16bit <= 0xdfff ) )
+		{
+			if( libuna_utf8_string_copy_from_utf16_stream(
+			     (libuna_utf8_character_t *) &( utf8_string[ utf8_string_index ] ),
+			     utf8_string_size - utf8_string_index,
+			     &( utf16_stream[ utf16_stream_index ] ),
+			     utf16_stream_size - utf16_stream_index,
+			     LIBUNA_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy remainder of name to UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		else if( value_16bit < 0x0080 )
+		{
+			if( ( utf8_string_index + 1 ) > utf8_string_size )
+			{
+				break;
+			}
+			utf8_string[ utf8_string_index++ ] = (uint8_t) value_16bit;
+		}
+		else if( value_16bit < 0x0800 )
+		{
+			if( ( utf8_string_index + 2 ) > utf8_string_size )
+			{
+				break;
+			}
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xc0 | ( value_16bit >> 6 ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( value_16bit & 0x3f ) );
+		}
+		else
+		{
+			if( ( utf8_string_index + 3 ) > utf8_string_size )
+			{
+				break;
+			}
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xe0 | ( value_16bit >> 12 ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( value_16bit >> 6 ) & 0x3f ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( value_16bit & 0x3f ) );
+		}
+		utf16_stream_index += 2;
+	}
+	if( ( utf16_stream_index < utf16_stream_size )
+	 || ( utf8_string_index >= utf8_string_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string[ utf8_string_index ] = 0;
+
+	return( 1 );
+}
+
+/* Determines the size of the UTF-16 string of an UTF-16 little-endian name
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_get_utf16_string_size(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libftxf_name_get_utf16_string_size";
+	size_t remaining_string_size = 0;
+	size_t utf16_stream_index    = 0;
+	uint64_t value_64bit         = 0;
+	uint16_t value_16bit         = 0;
+
+	if( libftxf_name_check_utf16_stream(
+	     utf16_stream,
+	     utf16_stream_size,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf16_stream_index < utf16_stream_size )
+	{
+		if( ( utf16_stream_index + 8 ) <= utf16_stream_size )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( utf16_stream[ utf16_stream_index ] ),
+			 value_64bit );
+
+			if( libftxf_name_has_surrogate( value_64bit ) == 0 )
+			{
+				utf16_stream_index += 8;
+
+				continue;
+			}
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 value_16bit );
+
+		if( ( value_16bit >= 0xd800 )
+		 && ( value_16bit <= 0xdfff ) )
+		{
+			if( libuna_utf16_string_size_from_utf16_stream(
+			     &( utf16_stream[ utf16_stream_index ] ),
+			     utf16_stream_size - utf16_stream_index,
+			     LIBUNA_ENDIAN_LITTLE,
+			     &remaining_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine size of UTF-16 string of remainder of name.",
+				 function );
+
+				return( -1 );
+			}
+			*utf16_string_size = ( utf16_stream_index / 2 ) + remaining_string_size;
+
+			return( 1 );
+		}
+		utf16_stream_index += 2;
+	}
+	*utf16_string_size = ( utf16_stream_size / 2 ) + 1;
+
+	return( 1 );
+}
+
+/* Copies an UTF-16 little-endian name to an UTF-16 string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_copy_to_utf16_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libftxf_name_copy_to_utf16_string";
+	size_t utf16_stream_index = 0;
+	size_t utf16_string_index = 0;
+	uint64_t value_64bit      = 0;
+	uint16_t value_16bit      = 0;
+
+	if( libftxf_name_check_utf16_stream(
+	     utf16_stream,
+	     utf16_stream_size,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) ( SSIZE_MAX / sizeof( uint16_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( utf16_stream_index < utf16_stream_size )
+	    && ( utf16_string_index < utf16_string_size ) )
+	{
+		if( ( ( utf16_stream_index + 8 ) <= utf16_stream_size )
+		 && ( ( utf16_string_index + 4 ) <= utf16_string_size ) )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( utf16_stream[ utf16_stream_index ] ),
+			 value_64bit );
+
+			if( libftxf_name_has_surrogate( value_64bit ) == 0 )
+			{
+				utf16_string[ utf16_string_index++ ] = (uint16_t) ( value_64bit & 0xffff );
+				utf16_string[ utf16_string_index++ ] = (uint16_t) ( ( value_64bit >> 16 ) & 0xffff );
+				utf16_string[ utf16_string_index++ ] = (uint16_t) ( ( value_64bit >> 32 ) & 0xffff );
+				utf16_string[ utf16_string_index++ ] = (uint16_t) ( ( value_64bit >> 48 ) & 0xffff );
+
+				utf16_stream_index += 8;
+
+				continue;
+			}
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 value_16bit );
+
+		if( ( value_16bit >= 0xd800 )
+		 && ( value_16bit <= 0xdfff ) )
+		{
+			if( libuna_utf16_string_copy_from_utf16_stream(
+			     (libuna_utf16_character_t *) &( utf16_string[ utf16_string_index ] ),
+			     utf16_string_size - utf16_string_index,
+			     &( utf16_stream[ utf16_stream_index ] ),
+			     utf16_stream_size - utf16_stream_index,
+			     LIBUNA_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy remainder of name to UTF-16 string.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		utf16_string[ utf16_string_index++ ] = value_16bit;
+
+		utf16_stream_index += 2;
+	}
+	if( ( utf16_stream_index < utf16_stream_size )
+	 || ( utf16_string_index >= utf16_string_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-16 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	utf16_string[ utf16_string_index ] = 0;
+
+	return( 1 );
+}
+
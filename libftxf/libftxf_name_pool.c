@@ -0,0 +1,1195 @@
+/*
+ * Name pool functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_libcthreads.h"
+#include "libftxf_name.h"
+#include "libftxf_name_pool.h"
+#include "libftxf_record.h"
+
+/* The initial allocated size of the UTF-16 and UTF-8 data
+ */
+#define LIBFTXF_NAME_POOL_INITIAL_DATA_SIZE		4096
+
+/* The initial allocated number of entries
+ */
+#define LIBFTXF_NAME_POOL_INITIAL_NUMBER_OF_ENTRIES	256
+
+/* The initial hash table size, must be a power of 2
+ */
+#define LIBFTXF_NAME_POOL_INITIAL_HASH_TABLE_SIZE	1024
+
+/* Calculates the FNV-1a hash of an UTF-16 little-endian stream
+ * Returns the hash
+ */
+static uint32_t libftxf_name_pool_calculate_hash(
+                 const uint8_t *data,
+                 size_t data_size )
+{
+	uint32_t hash = 0x811c9dc5UL;
+
+	while( data_size > 0 )
+	{
+		hash ^= *data++;
+		hash *= 0x01000193UL;
+
+		data_size--;
+	}
+	return( hash );
+}
+
+/* Creates a name pool
+ * Make sure the value name_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_pool_initialize(
+     libftxf_name_pool_t **name_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_name_pool_initialize";
+
+	if( libftxf_name_pool_initialize_with_allocator(
+	     name_pool,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create name pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a name pool that allocates its memory using the allocator functions
+ * Make sure the value name_pool is referencing, is set to NULL
+ * The allocator is copied into the name pool, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_pool_initialize_with_allocator(
+     libftxf_name_pool_t **name_pool,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	libftxf_internal_name_pool_t *internal_name_pool = NULL;
+	static char *function                            = "libftxf_name_pool_initialize_with_allocator";
+
+	if( name_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_name_pool = (libftxf_internal_name_pool_t *) libftxf_allocator_allocate(
+	                                                       allocator,
+	                                                       sizeof( libftxf_internal_name_pool_t ) );
+
+	if( internal_name_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_name_pool,
+	     0,
+	     sizeof( libftxf_internal_name_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name pool.",
+		 function );
+
+		libftxf_allocator_free(
+		 allocator,
+		 internal_name_pool );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		internal_name_pool->allocator = *allocator;
+	}
+	internal_name_pool->hash_table_size = LIBFTXF_NAME_POOL_INITIAL_HASH_TABLE_SIZE;
+
+	internal_name_pool->hash_table = (uint32_t *) libftxf_allocator_allocate(
+	                                               &( internal_name_pool->allocator ),
+	                                               sizeof( uint32_t ) * internal_name_pool->hash_table_size );
+
+	if( internal_name_pool->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_name_pool->hash_table,
+	     0,
+	     sizeof( uint32_t ) * internal_name_pool->hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		goto on_error;
+	}
+	*name_pool = (libftxf_name_pool_t *) internal_name_pool;
+
+	return( 1 );
+
+on_error:
+	if( internal_name_pool != NULL )
+	{
+		if( internal_name_pool->hash_table != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_name_pool->allocator ),
+			 internal_name_pool->hash_table );
+		}
+		libftxf_allocator_free(
+		 allocator,
+		 internal_name_pool );
+	}
+	return( -1 );
+}
+
+/* Frees a name pool
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_pool_free(
+     libftxf_name_pool_t **name_pool,
+     libcerror_error_t **error )
+{
+	libftxf_allocator_t allocator;
+
+	libftxf_internal_name_pool_t *internal_name_pool = NULL;
+	static char *function                            = "libftxf_name_pool_free";
+
+	if( name_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_pool != NULL )
+	{
+		internal_name_pool = (libftxf_internal_name_pool_t *) *name_pool;
+		*name_pool         = NULL;
+
+		if( internal_name_pool->utf8_data != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_name_pool->allocator ),
+			 internal_name_pool->utf8_data );
+		}
+		if( internal_name_pool->utf16_data != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_name_pool->allocator ),
+			 internal_name_pool->utf16_data );
+		}
+		if( internal_name_pool->entries != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_name_pool->allocator ),
+			 internal_name_pool->entries );
+		}
+		libftxf_allocator_free(
+		 &( internal_name_pool->allocator ),
+		 internal_name_pool->hash_table );
+
+		/* The allocator is copied since it is stored in the name pool that is freed
+		 */
+		allocator = internal_name_pool->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
+		 internal_name_pool );
+	}
+	return( 1 );
+}
+
+/* Resizes name pool data to hold at least the required data size
+ * The allocated data size is doubled to keep the number of reallocations low
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_name_pool_resize_data(
+     const libftxf_allocator_t *allocator,
+     uint8_t **data,
+     size_t *allocated_data_size,
+     size_t required_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation           = NULL;
+	static char *function           = "libftxf_internal_name_pool_resize_data";
+	size_t safe_allocated_data_size = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_data_size <= *allocated_data_size )
+	{
+		return( 1 );
+	}
+	safe_allocated_data_size = *allocated_data_size;
+
+	if( safe_allocated_data_size == 0 )
+	{
+		safe_allocated_data_size = LIBFTXF_NAME_POOL_INITIAL_DATA_SIZE;
+	}
+	while( safe_allocated_data_size < required_data_size )
+	{
+		safe_allocated_data_size *= 2;
+	}
+	if( safe_allocated_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		safe_allocated_data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+	}
+	reallocation = (uint8_t *) libftxf_allocator_reallocate(
+	                            allocator,
+	                            *data,
+	                            sizeof( uint8_t ) * safe_allocated_data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	*data                = reallocation;
+	*allocated_data_size = safe_allocated_data_size;
+
+	return( 1 );
+}
+
+/* Doubles the size of the hash table and re-inserts the entries
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_name_pool_resize_hash_table(
+     libftxf_internal_name_pool_t *internal_name_pool,
+     libcerror_error_t **error )
+{
+	uint32_t *hash_table      = NULL;
+	static char *function     = "libftxf_internal_name_pool_resize_hash_table";
+	uint32_t entry_index      = 0;
+	uint32_t hash_table_index = 0;
+	uint32_t hash_table_mask  = 0;
+	uint32_t hash_table_size  = 0;
+
+	if( internal_name_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_name_pool->hash_table_size > ( (uint32_t) INT32_MAX ) )
+	 || ( (size_t) internal_name_pool->hash_table_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( uint32_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name pool - hash table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_size = internal_name_pool->hash_table_size * 2;
+	hash_table_mask = hash_table_size - 1;
+
+	hash_table = (uint32_t *) libftxf_allocator_allocate(
+	                           &( internal_name_pool->allocator ),
+	                           sizeof( uint32_t ) * hash_table_size );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( uint32_t ) * hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		libftxf_allocator_free(
+		 &( internal_name_pool->allocator ),
+		 hash_table );
+
+		return( -1 );
+	}
+	/* The stored hashes are reused, the names do not need to be compared
+	 * since they are unique
+	 */
+	for( entry_index = 0;
+	     entry_index < internal_name_pool->number_of_entries;
+	     entry_index++ )
+	{
+		hash_table_index = internal_name_pool->entries[ entry_index ].hash & hash_table_mask;
+
+		while( hash_table[ hash_table_index ] != 0 )
+		{
+			hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+		}
+		hash_table[ hash_table_index ] = entry_index + 1;
+	}
+	libftxf_allocator_free(
+	 &( internal_name_pool->allocator ),
+	 internal_name_pool->hash_table );
+
+	internal_name_pool->hash_table      = hash_table;
+	internal_name_pool->hash_table_size = hash_table_size;
+
+	return( 1 );
+}
+
+/* Appends an UTF-16 little-endian stream to the name pool
+ * If the name is already in the pool the index of the existing name is returned
+ * The name index remains valid for the lifetime of the name pool
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_pool_append_utf16_stream(
+     libftxf_name_pool_t *name_pool,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint32_t *name_index,
+     libcerror_error_t **error )
+{
+	libftxf_internal_name_pool_t *internal_name_pool = NULL;
+	libftxf_name_pool_entry_t *entry                 = NULL;
+	void *reallocation                               = NULL;
+	static char *function                            = "libftxf_name_pool_append_utf16_stream";
+	size_t utf8_string_size                          = 0;
+	uint32_t allocated_number_of_entries             = 0;
+	uint32_t entry_index                             = 0;
+	uint32_t hash                                    = 0;
+	uint32_t hash_table_index                        = 0;
+	uint32_t hash_table_mask                         = 0;
+
+	if( name_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_pool = (libftxf_internal_name_pool_t *) name_pool;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size == 0 )
+	 || ( utf16_stream_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libftxf_name_pool_calculate_hash(
+	        utf16_stream,
+	        utf16_stream_size );
+
+	hash_table_mask  = internal_name_pool->hash_table_size - 1;
+	hash_table_index = hash & hash_table_mask;
+
+	while( internal_name_pool->hash_table[ hash_table_index ] != 0 )
+	{
+		entry_index = internal_name_pool->hash_table[ hash_table_index ] - 1;
+		entry       = &( internal_name_pool->entries[ entry_index ] );
+
+		if( ( entry->hash == hash )
+		 && ( (size_t) entry->utf16_stream_size == utf16_stream_size )
+		 && ( memory_compare(
+		       &( internal_name_pool->utf16_data[ entry->utf16_stream_offset ] ),
+		       utf16_stream,
+		       utf16_stream_size ) == 0 ) )
+		{
+			*name_index = entry_index;
+
+			return( 1 );
+		}
+		hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+	}
+	if( internal_name_pool->number_of_entries >= ( (uint32_t) INT32_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name pool - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The name is decoded once when it is added to the pool, which also
+	 * validates the UTF-16 stream
+	 */
+	if( libftxf_name_get_utf8_string_size(
+	     utf16_stream,
+	     utf16_stream_size,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size > (size_t) UINT32_MAX )
+	 || ( utf8_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - internal_name_pool->utf8_data_size ) )
+	 || ( utf16_stream_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - internal_name_pool->utf16_data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_name_pool->number_of_entries >= internal_name_pool->allocated_number_of_entries )
+	{
+		allocated_number_of_entries = internal_name_pool->allocated_number_of_entries * 2;
+
+		if( allocated_number_of_entries == 0 )
+		{
+			allocated_number_of_entries = LIBFTXF_NAME_POOL_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		if( (size_t) allocated_number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libftxf_name_pool_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = libftxf_allocator_reallocate(
+		                &( internal_name_pool->allocator ),
+		                internal_name_pool->entries,
+		                sizeof( libftxf_name_pool_entry_t ) * allocated_number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_name_pool->entries                     = (libftxf_name_pool_entry_t *) reallocation;
+		internal_name_pool->allocated_number_of_entries = allocated_number_of_entries;
+	}
+	if( libftxf_internal_name_pool_resize_data(
+	     &( internal_name_pool->allocator ),
+	     &( internal_name_pool->utf16_data ),
+	     &( internal_name_pool->allocated_utf16_data_size ),
+	     internal_name_pool->utf16_data_size + utf16_stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize UTF-16 data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_internal_name_pool_resize_data(
+	     &( internal_name_pool->allocator ),
+	     &( internal_name_pool->utf8_data ),
+	     &( internal_name_pool->allocated_utf8_data_size ),
+	     internal_name_pool->utf8_data_size + utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize UTF-8 data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_name_copy_to_utf8_string(
+	     utf16_stream,
+	     utf16_stream_size,
+	     &( internal_name_pool->utf8_data[ internal_name_pool->utf8_data_size ] ),
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( internal_name_pool->utf16_data[ internal_name_pool->utf16_data_size ] ),
+	     utf16_stream,
+	     utf16_stream_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = internal_name_pool->number_of_entries;
+	entry       = &( internal_name_pool->entries[ entry_index ] );
+
+	entry->utf16_stream_offset = internal_name_pool->utf16_data_size;
+	entry->utf8_string_offset  = internal_name_pool->utf8_data_size;
+	entry->utf16_stream_size   = (uint32_t) utf16_stream_size;
+	entry->utf8_string_size    = (uint32_t) utf8_string_size;
+	entry->hash                = hash;
+
+	internal_name_pool->utf16_data_size += utf16_stream_size;
+	internal_name_pool->utf8_data_size  += utf8_string_size;
+
+	internal_name_pool->hash_table[ hash_table_index ] = entry_index + 1;
+
+	internal_name_pool->number_of_entries += 1;
+
+	/* Keep the load factor of the hash table at or below 0.5
+	 */
+	if( ( internal_name_pool->number_of_entries * 2 ) > internal_name_pool->hash_table_size )
+	{
+		if( libftxf_internal_name_pool_resize_hash_table(
+		     internal_name_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*name_index = entry_index;
+
+	return( 1 );
+}
+
+/* Appends the name of a record to the name pool
+ * If the name is already in the pool the index of the existing name is returned
+ * The name index remains valid for the lifetime of the name pool
+ * Returns 1 if successful, 0 if the record has no name or -1 on error
+ */
+int libftxf_name_pool_append_record_name(
+     libftxf_name_pool_t *name_pool,
+     libftxf_record_t *record,
+     uint32_t *name_index,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_name_pool_append_record_name";
+	int result                                 = 1;
+
+	if( name_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_record->name_size == 0 )
+	{
+		result = 0;
+	}
+	else if( libftxf_name_pool_append_utf16_stream(
+	          name_pool,
+	          internal_record->name,
+	          internal_record->name_size,
+	          name_index,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of names
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_pool_get_number_of_names(
+     libftxf_name_pool_t *name_pool,
+     uint32_t *number_of_names,
+     libcerror_error_t **error )
+{
+	libftxf_internal_name_pool_t *internal_name_pool = NULL;
+	static char *function                            = "libftxf_name_pool_get_number_of_names";
+
+	if( name_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_pool = (libftxf_internal_name_pool_t *) name_pool;
+
+	if( number_of_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of names.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_names = internal_name_pool->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the allocated size
+ * The allocated size contains the size of the entries, the UTF-16 and UTF-8 data and the hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_pool_get_allocated_size(
+     libftxf_name_pool_t *name_pool,
+     size_t *allocated_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_name_pool_t *internal_name_pool = NULL;
+	static char *function                            = "libftxf_name_pool_get_allocated_size";
+
+	if( name_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_pool = (libftxf_internal_name_pool_t *) name_pool;
+
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	*allocated_size = sizeof( libftxf_internal_name_pool_t )
+	                + ( sizeof( libftxf_name_pool_entry_t ) * (size_t) internal_name_pool->allocated_number_of_entries )
+	                + internal_name_pool->allocated_utf16_data_size
+	                + internal_name_pool->allocated_utf8_data_size
+	                + ( sizeof( uint32_t ) * (size_t) internal_name_pool->hash_table_size );
+
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded name
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_pool_get_utf8_name_size(
+     libftxf_name_pool_t *name_pool,
+     uint32_t name_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_name_pool_t *internal_name_pool = NULL;
+	libftxf_name_pool_entry_t *entry                 = NULL;
+	static char *function                            = "libftxf_name_pool_get_utf8_name_size";
+
+	if( name_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_pool = (libftxf_internal_name_pool_t *) name_pool;
+
+	if( name_index >= internal_name_pool->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_name_pool->entries[ name_index ] );
+
+	*utf8_string_size = (size_t) entry->utf8_string_size;
+
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded name
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_pool_get_utf8_name(
+     libftxf_name_pool_t *name_pool,
+     uint32_t name_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_name_pool_t *internal_name_pool = NULL;
+	libftxf_name_pool_entry_t *entry                 = NULL;
+	static char *function                            = "libftxf_name_pool_get_utf8_name";
+
+	if( name_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_pool = (libftxf_internal_name_pool_t *) name_pool;
+
+	if( name_index >= internal_name_pool->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_name_pool->entries[ name_index ] );
+
+	if( utf8_string_size < (size_t) entry->utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     utf8_string,
+	     &( internal_name_pool->utf8_data[ entry->utf8_string_offset ] ),
+	     (size_t) entry->utf8_string_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-16 encoded name
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_pool_get_utf16_name_size(
+     libftxf_name_pool_t *name_pool,
+     uint32_t name_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_name_pool_t *internal_name_pool = NULL;
+	libftxf_name_pool_entry_t *entry                 = NULL;
+	static char *function                            = "libftxf_name_pool_get_utf16_name_size";
+
+	if( name_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_pool = (libftxf_internal_name_pool_t *) name_pool;
+
+	if( name_index >= internal_name_pool->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_name_pool->entries[ name_index ] );
+
+	if( libftxf_name_get_utf16_string_size(
+	     &( internal_name_pool->utf16_data[ entry->utf16_stream_offset ] ),
+	     (size_t) entry->utf16_stream_size,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-16 encoded name
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_pool_get_utf16_name(
+     libftxf_name_pool_t *name_pool,
+     uint32_t name_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_name_pool_t *internal_name_pool = NULL;
+	libftxf_name_pool_entry_t *entry                 = NULL;
+	static char *function                            = "libftxf_name_pool_get_utf16_name";
+
+	if( name_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_pool = (libftxf_internal_name_pool_t *) name_pool;
+
+	if( name_index >= internal_name_pool->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_name_pool->entries[ name_index ] );
+
+	if( libftxf_name_copy_to_utf16_string(
+	     &( internal_name_pool->utf16_data[ entry->utf16_stream_offset ] ),
+	     (size_t) entry->utf16_stream_size,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
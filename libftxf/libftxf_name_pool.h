@@ -0,0 +1,208 @@
+/*
+ * Name pool functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_NAME_POOL_H )
+#define _LIBFTXF_NAME_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libftxf_name_pool_entry libftxf_name_pool_entry_t;
+
+struct libftxf_name_pool_entry
+{
+	/* The offset of the UTF-16 little-endian stream in the UTF-16 data
+	 */
+	size_t utf16_stream_offset;
+
+	/* The offset of the UTF-8 string in the UTF-8 data
+	 */
+	size_t utf8_string_offset;
+
+	/* The UTF-16 little-endian stream size
+	 */
+	uint32_t utf16_stream_size;
+
+	/* The UTF-8 string size
+	 * Includes the end-of-string character
+	 */
+	uint32_t utf8_string_size;
+
+	/* The hash of the UTF-16 little-endian stream
+	 */
+	uint32_t hash;
+};
+
+typedef struct libftxf_internal_name_pool libftxf_internal_name_pool_t;
+
+struct libftxf_internal_name_pool
+{
+	/* The entries
+	 */
+	libftxf_name_pool_entry_t *entries;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The allocated number of entries
+	 */
+	uint32_t allocated_number_of_entries;
+
+	/* The UTF-16 data
+	 * Contains the UTF-16 little-endian names without end-of-string character
+	 */
+	uint8_t *utf16_data;
+
+	/* The UTF-16 data size
+	 */
+	size_t utf16_data_size;
+
+	/* The allocated UTF-16 data size
+	 */
+	size_t allocated_utf16_data_size;
+
+	/* The UTF-8 data
+	 * Contains the UTF-8 names with end-of-string character
+	 */
+	uint8_t *utf8_data;
+
+	/* The UTF-8 data size
+	 */
+	size_t utf8_data_size;
+
+	/* The allocated UTF-8 data size
+	 */
+	size_t allocated_utf8_data_size;
+
+	/* The hash table
+	 * Contains the entry index + 1 or 0 for an unused entry
+	 */
+	uint32_t *hash_table;
+
+	/* The hash table size
+	 * Contains a power of 2
+	 */
+	uint32_t hash_table_size;
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the name pool and its buffers
+	 */
+	libftxf_allocator_t allocator;
+};
+
+LIBFTXF_EXTERN \
+int libftxf_name_pool_initialize(
+     libftxf_name_pool_t **name_pool,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_pool_initialize_with_allocator(
+     libftxf_name_pool_t **name_pool,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_pool_free(
+     libftxf_name_pool_t **name_pool,
+     libcerror_error_t **error );
+
+int libftxf_internal_name_pool_resize_data(
+     const libftxf_allocator_t *allocator,
+     uint8_t **data,
+     size_t *allocated_data_size,
+     size_t required_data_size,
+     libcerror_error_t **error );
+
+int libftxf_internal_name_pool_resize_hash_table(
+     libftxf_internal_name_pool_t *internal_name_pool,
+     libcerror_error_t **error );
+
+int libftxf_name_pool_append_utf16_stream(
+     libftxf_name_pool_t *name_pool,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint32_t *name_index,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_pool_append_record_name(
+     libftxf_name_pool_t *name_pool,
+     libftxf_record_t *txf_record,
+     uint32_t *name_index,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_pool_get_number_of_names(
+     libftxf_name_pool_t *name_pool,
+     uint32_t *number_of_names,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_pool_get_allocated_size(
+     libftxf_name_pool_t *name_pool,
+     size_t *allocated_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_pool_get_utf8_name_size(
+     libftxf_name_pool_t *name_pool,
+     uint32_t name_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_pool_get_utf8_name(
+     libftxf_name_pool_t *name_pool,
+     uint32_t name_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_pool_get_utf16_name_size(
+     libftxf_name_pool_t *name_pool,
+     uint32_t name_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_pool_get_utf16_name(
+     libftxf_name_pool_t *name_pool,
+     uint32_t name_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_NAME_POOL_H ) */
+
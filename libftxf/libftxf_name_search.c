@@ -0,0 +1,1125 @@
+/*
+ * Name search functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_libcthreads.h"
+#include "libftxf_libuna.h"
+#include "libftxf_name_search.h"
+#include "libftxf_record.h"
+
+/* Determines if any of the 4 16-bit lanes of a 64-bit value is 0
+ */
+#define libftxf_name_search_has_zero_code_unit( value ) \
+	( ( ( value ) - 0x0001000100010001UL ) & ~( value ) & 0x8000800080008000UL )
+
+/* Initializes the default upcase table
+ * The default table only maps the Basic Latin and Latin-1 Supplement characters,
+ * the upcase table of the volume ($UpCase) is needed to compare other characters the way NTFS does
+ */
+static void libftxf_name_search_initialize_default_upcase_table(
+             uint16_t *upcase_table )
+{
+	uint32_t code_unit = 0;
+
+	for( code_unit = 0;
+	     code_unit < LIBFTXF_NAME_SEARCH_UPCASE_TABLE_NUMBER_OF_ENTRIES;
+	     code_unit++ )
+	{
+		upcase_table[ code_unit ] = (uint16_t) code_unit;
+	}
+	for( code_unit = 0x0061;
+	     code_unit <= 0x007a;
+	     code_unit++ )
+	{
+		upcase_table[ code_unit ] = (uint16_t) ( code_unit - 0x0020 );
+	}
+	for( code_unit = 0x00e0;
+	     code_unit <= 0x00fe;
+	     code_unit++ )
+	{
+		if( code_unit != 0x00f7 )
+		{
+			upcase_table[ code_unit ] = (uint16_t) ( code_unit - 0x0020 );
+		}
+	}
+	upcase_table[ 0x00ff ] = 0x0178;
+}
+
+/* Creates a name search
+ * Make sure the value name_search is referencing, is set to NULL
+ * The name search uses a default upcase table until one is set
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_search_initialize(
+     libftxf_name_search_t **name_search,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_name_search_initialize";
+
+	if( libftxf_name_search_initialize_with_allocator(
+	     name_search,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create name search.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a name search that allocates its memory using the allocator functions
+ * Make sure the value name_search is referencing, is set to NULL
+ * The name search uses a default upcase table until one is set
+ * The allocator is copied into the name search, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_search_initialize_with_allocator(
+     libftxf_name_search_t **name_search,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	libftxf_internal_name_search_t *internal_name_search = NULL;
+	static char *function                                = "libftxf_name_search_initialize_with_allocator";
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_search != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name search value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_name_search = (libftxf_internal_name_search_t *) libftxf_allocator_allocate(
+	                                                           allocator,
+	                                                           sizeof( libftxf_internal_name_search_t ) );
+
+	if( internal_name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name search.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_name_search,
+	     0,
+	     sizeof( libftxf_internal_name_search_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name search.",
+		 function );
+
+		libftxf_allocator_free(
+		 allocator,
+		 internal_name_search );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		internal_name_search->allocator = *allocator;
+	}
+	internal_name_search->upcase_table = (uint16_t *) libftxf_allocator_allocate(
+	                                                   &( internal_name_search->allocator ),
+	                                                   sizeof( uint16_t ) * LIBFTXF_NAME_SEARCH_UPCASE_TABLE_NUMBER_OF_ENTRIES );
+
+	if( internal_name_search->upcase_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create upcase table.",
+		 function );
+
+		goto on_error;
+	}
+	libftxf_name_search_initialize_default_upcase_table(
+	 internal_name_search->upcase_table );
+
+	*name_search = (libftxf_name_search_t *) internal_name_search;
+
+	return( 1 );
+
+on_error:
+	if( internal_name_search != NULL )
+	{
+		libftxf_allocator_free(
+		 allocator,
+		 internal_name_search );
+	}
+	return( -1 );
+}
+
+/* Frees a name search
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_search_free(
+     libftxf_name_search_t **name_search,
+     libcerror_error_t **error )
+{
+	libftxf_allocator_t allocator;
+
+	libftxf_internal_name_search_t *internal_name_search = NULL;
+	static char *function                                = "libftxf_name_search_free";
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_search != NULL )
+	{
+		internal_name_search = (libftxf_internal_name_search_t *) *name_search;
+		*name_search         = NULL;
+
+		if( internal_name_search->upcased_pattern != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_name_search->allocator ),
+			 internal_name_search->upcased_pattern );
+		}
+		if( internal_name_search->pattern != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_name_search->allocator ),
+			 internal_name_search->pattern );
+		}
+		libftxf_allocator_free(
+		 &( internal_name_search->allocator ),
+		 internal_name_search->upcase_table );
+
+		/* The allocator is copied since it is stored in the name search that is freed
+		 */
+		allocator = internal_name_search->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
+		 internal_name_search );
+	}
+	return( 1 );
+}
+
+/* Sets the upcase table
+ * The upcase table data contains the 65536 little-endian 16-bit values of the NTFS $UpCase file
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_search_set_upcase_table(
+     libftxf_name_search_t *name_search,
+     const uint8_t *upcase_table_data,
+     size_t upcase_table_data_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_name_search_t *internal_name_search = NULL;
+	static char *function                                = "libftxf_name_search_set_upcase_table";
+	size_t data_offset                                   = 0;
+	uint32_t code_unit                                   = 0;
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_search = (libftxf_internal_name_search_t *) name_search;
+
+	if( upcase_table_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid upcase table data.",
+		 function );
+
+		return( -1 );
+	}
+	if( upcase_table_data_size != ( sizeof( uint16_t ) * LIBFTXF_NAME_SEARCH_UPCASE_TABLE_NUMBER_OF_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid upcase table data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( code_unit = 0;
+	     code_unit < LIBFTXF_NAME_SEARCH_UPCASE_TABLE_NUMBER_OF_ENTRIES;
+	     code_unit++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( upcase_table_data[ data_offset ] ),
+		 internal_name_search->upcase_table[ code_unit ] );
+
+		data_offset += 2;
+	}
+	/* The upcased pattern and the prefilter depend on the upcase table
+	 */
+	if( libftxf_internal_name_search_update_pattern(
+	     internal_name_search ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update pattern.",
+		 function );
+
+		return( -1 );
+	}
+
+	return( 1 );
+}
+
+/* Sets the pattern
+ * The pattern supports the '*' and '?' wildcards, where '?' matches a single UTF-16 code unit
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_name_search_set_pattern(
+     libftxf_internal_name_search_t *internal_name_search,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	uint16_t *pattern         = NULL;
+	uint16_t *upcased_pattern = NULL;
+	static char *function     = "libftxf_internal_name_search_set_pattern";
+
+	if( internal_name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	pattern = (uint16_t *) libftxf_allocator_allocate(
+	                        &( internal_name_search->allocator ),
+	                        sizeof( uint16_t ) * utf16_string_length );
+
+	if( pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pattern.",
+		 function );
+
+		goto on_error;
+	}
+	upcased_pattern = (uint16_t *) libftxf_allocator_allocate(
+	                                &( internal_name_search->allocator ),
+	                                sizeof( uint16_t ) * utf16_string_length );
+
+	if( upcased_pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create upcased pattern.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     pattern,
+	     utf16_string,
+	     sizeof( uint16_t ) * utf16_string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy pattern.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_name_search->upcased_pattern != NULL )
+	{
+		libftxf_allocator_free(
+		 &( internal_name_search->allocator ),
+		 internal_name_search->upcased_pattern );
+	}
+	if( internal_name_search->pattern != NULL )
+	{
+		libftxf_allocator_free(
+		 &( internal_name_search->allocator ),
+		 internal_name_search->pattern );
+	}
+	internal_name_search->pattern         = pattern;
+	internal_name_search->upcased_pattern = upcased_pattern;
+	internal_name_search->pattern_length  = utf16_string_length;
+
+	if( libftxf_internal_name_search_update_pattern(
+	     internal_name_search ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update pattern.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( upcased_pattern != NULL )
+	{
+		libftxf_allocator_free(
+		 &( internal_name_search->allocator ),
+		 upcased_pattern );
+	}
+	if( pattern != NULL )
+	{
+		libftxf_allocator_free(
+		 &( internal_name_search->allocator ),
+		 pattern );
+	}
+	return( -1 );
+}
+
+/* Updates the upcased pattern and the values derived from it
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_name_search_update_pattern(
+     libftxf_internal_name_search_t *internal_name_search )
+{
+	size_t pattern_index         = 0;
+	size_t first_asterisk_index  = 0;
+	size_t last_asterisk_index   = 0;
+	uint32_t code_unit           = 0;
+	uint16_t prefilter_code_unit = 0;
+	uint8_t number_of_code_units = 0;
+
+	if( internal_name_search == NULL )
+	{
+		return( -1 );
+	}
+	internal_name_search->minimum_name_length            = 0;
+	internal_name_search->prefix_length                  = 0;
+	internal_name_search->suffix_length                  = 0;
+	internal_name_search->has_asterisk                   = 0;
+	internal_name_search->number_of_prefilter_code_units = 0;
+
+	if( internal_name_search->pattern == NULL )
+	{
+		return( 1 );
+	}
+	for( pattern_index = 0;
+	     pattern_index < internal_name_search->pattern_length;
+	     pattern_index++ )
+	{
+		internal_name_search->upcased_pattern[ pattern_index ] = internal_name_search->upcase_table[ internal_name_search->pattern[ pattern_index ] ];
+
+		if( internal_name_search->pattern[ pattern_index ] != (uint16_t) '*' )
+		{
+			internal_name_search->minimum_name_length += 1;
+		}
+		else
+		{
+			if( internal_name_search->has_asterisk == 0 )
+			{
+				first_asterisk_index = pattern_index;
+			}
+			last_asterisk_index                = pattern_index;
+			internal_name_search->has_asterisk = 1;
+		}
+	}
+	if( internal_name_search->has_asterisk == 0 )
+	{
+		/* Without '*' the pattern is matched as a whole
+		 */
+		internal_name_search->prefix_length = internal_name_search->pattern_length;
+
+		return( 1 );
+	}
+	internal_name_search->prefix_length = first_asterisk_index;
+	internal_name_search->suffix_length = internal_name_search->pattern_length - last_asterisk_index - 1;
+
+	/* The prefilter uses a literal code unit between the first and last '*',
+	 * which can only be used if few code units upcase to it
+	 */
+	for( pattern_index = first_asterisk_index + 1;
+	     pattern_index < last_asterisk_index;
+	     pattern_index++ )
+	{
+		prefilter_code_unit = internal_name_search->upcased_pattern[ pattern_index ];
+
+		if( ( internal_name_search->pattern[ pattern_index ] == (uint16_t) '*' )
+		 || ( internal_name_search->pattern[ pattern_index ] == (uint16_t) '?' ) )
+		{
+			continue;
+		}
+		number_of_code_units = 0;
+
+		for( code_unit = 0;
+		     code_unit < LIBFTXF_NAME_SEARCH_UPCASE_TABLE_NUMBER_OF_ENTRIES;
+		     code_unit++ )
+		{
+			if( internal_name_search->upcase_table[ code_unit ] == prefilter_code_unit )
+			{
+				if( number_of_code_units >= 2 )
+				{
+					number_of_code_units = 3;
+
+					break;
+				}
+				internal_name_search->prefilter_code_units[ number_of_code_units++ ] = (uint16_t) code_unit;
+			}
+		}
+		if( ( number_of_code_units >= 1 )
+		 && ( number_of_code_units <= 2 ) )
+		{
+			internal_name_search->number_of_prefilter_code_units = number_of_code_units;
+
+			break;
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the UTF-8 encoded pattern
+ * The pattern supports the '*' and '?' wildcards, where '?' matches a single UTF-16 code unit
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_search_set_utf8_pattern(
+     libftxf_name_search_t *name_search,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libftxf_internal_name_search_t *internal_name_search = NULL;
+	uint16_t *utf16_string                               = NULL;
+	static char *function                                = "libftxf_name_search_set_utf8_pattern";
+	size_t utf16_string_size                             = 0;
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_search = (libftxf_internal_name_search_t *) name_search;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_size_from_utf8(
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_length,
+	     &utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf16_string_size < 2 )
+	 || ( utf16_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf16_string = (uint16_t *) libftxf_allocator_allocate(
+	                             &( internal_name_search->allocator ),
+	                             sizeof( uint16_t ) * utf16_string_size );
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf16_string_copy_from_utf8(
+	     (libuna_utf16_character_t *) utf16_string,
+	     utf16_string_size,
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string to UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libftxf_internal_name_search_set_pattern(
+	     internal_name_search,
+	     utf16_string,
+	     utf16_string_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set pattern.",
+		 function );
+
+		goto on_error;
+	}
+	libftxf_allocator_free(
+	 &( internal_name_search->allocator ),
+	 utf16_string );
+
+	return( 1 );
+
+on_error:
+	if( utf16_string != NULL )
+	{
+		libftxf_allocator_free(
+		 &( internal_name_search->allocator ),
+		 utf16_string );
+	}
+	return( -1 );
+}
+
+/* Sets the UTF-16 encoded pattern
+ * The pattern supports the '*' and '?' wildcards, where '?' matches a single UTF-16 code unit
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_name_search_set_utf16_pattern(
+     libftxf_name_search_t *name_search,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_name_search_set_utf16_pattern";
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_internal_name_search_set_pattern(
+	     (libftxf_internal_name_search_t *) name_search,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set pattern.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if an UTF-16 little-endian stream can match the pattern
+ * The checks operate on the raw stream, a name that passes can still not match
+ * Returns 1 if the name can match or 0 if not
+ */
+int libftxf_internal_name_search_prefilter_utf16_stream(
+     libftxf_internal_name_search_t *internal_name_search,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size )
+{
+	const uint16_t *upcase_table = NULL;
+	size_t name_index            = 0;
+	size_t name_length           = 0;
+	size_t middle_end_index      = 0;
+	size_t pattern_index         = 0;
+	uint64_t prefilter_value1    = 0;
+	uint64_t prefilter_value2    = 0;
+	uint64_t value_64bit         = 0;
+	uint16_t code_unit           = 0;
+	uint16_t pattern_code_unit   = 0;
+
+	upcase_table = internal_name_search->upcase_table;
+	name_length  = utf16_stream_size / 2;
+
+	if( name_length < internal_name_search->minimum_name_length )
+	{
+		return( 0 );
+	}
+	if( ( internal_name_search->has_asterisk == 0 )
+	 && ( name_length != internal_name_search->pattern_length ) )
+	{
+		return( 0 );
+	}
+	/* Compare the code units before the first and after the last '*'
+	 */
+	for( pattern_index = 0;
+	     pattern_index < internal_name_search->prefix_length;
+	     pattern_index++ )
+	{
+		pattern_code_unit = internal_name_search->upcased_pattern[ pattern_index ];
+
+		if( internal_name_search->pattern[ pattern_index ] != (uint16_t) '?' )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ pattern_index * 2 ] ),
+			 code_unit );
+
+			if( upcase_table[ code_unit ] != pattern_code_unit )
+			{
+				return( 0 );
+			}
+		}
+	}
+	name_index = name_length - internal_name_search->suffix_length;
+
+	for( pattern_index = internal_name_search->pattern_length - internal_name_search->suffix_length;
+	     pattern_index < internal_name_search->pattern_length;
+	     pattern_index++ )
+	{
+		pattern_code_unit = internal_name_search->upcased_pattern[ pattern_index ];
+
+		if( internal_name_search->pattern[ pattern_index ] != (uint16_t) '?' )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ name_index * 2 ] ),
+			 code_unit );
+
+			if( upcase_table[ code_unit ] != pattern_code_unit )
+			{
+				return( 0 );
+			}
+		}
+		name_index++;
+	}
+	if( internal_name_search->number_of_prefilter_code_units == 0 )
+	{
+		return( 1 );
+	}
+	/* Scan the part of the name between the prefix and suffix for the prefilter code units
+	 * 4 code units at a time
+	 */
+	prefilter_value1 = 0x0001000100010001UL * internal_name_search->prefilter_code_units[ 0 ];
+	prefilter_value2 = prefilter_value1;
+
+	if( internal_name_search->number_of_prefilter_code_units == 2 )
+	{
+		prefilter_value2 = 0x0001000100010001UL * internal_name_search->prefilter_code_units[ 1 ];
+	}
+	name_index       = internal_name_search->prefix_length;
+	middle_end_index = name_length - internal_name_search->suffix_length;
+
+	while( ( name_index + 4 ) <= middle_end_index )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( utf16_stream[ name_index * 2 ] ),
+		 value_64bit );
+
+		if( ( libftxf_name_search_has_zero_code_unit( value_64bit ^ prefilter_value1 ) != 0 )
+		 || ( libftxf_name_search_has_zero_code_unit( value_64bit ^ prefilter_value2 ) != 0 ) )
+		{
+			return( 1 );
+		}
+		name_index += 4;
+	}
+	while( name_index < middle_end_index )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ name_index * 2 ] ),
+		 code_unit );
+
+		if( ( code_unit == internal_name_search->prefilter_code_units[ 0 ] )
+		 || ( code_unit == internal_name_search->prefilter_code_units[ internal_name_search->number_of_prefilter_code_units - 1 ] ) )
+		{
+			return( 1 );
+		}
+		name_index++;
+	}
+	return( 0 );
+}
+
+/* Matches an UTF-16 little-endian stream against the pattern
+ * Returns 1 if the name matches or 0 if not
+ */
+int libftxf_internal_name_search_match_utf16_stream(
+     libftxf_internal_name_search_t *internal_name_search,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size )
+{
+	const uint16_t *upcase_table    = NULL;
+	const uint16_t *upcased_pattern = NULL;
+	size_t asterisk_name_index      = 0;
+	size_t asterisk_pattern_index   = 0;
+	size_t name_index               = 0;
+	size_t name_length              = 0;
+	size_t pattern_index            = 0;
+	size_t pattern_length           = 0;
+	uint16_t code_unit              = 0;
+	uint8_t has_asterisk            = 0;
+
+	if( libftxf_internal_name_search_prefilter_utf16_stream(
+	     internal_name_search,
+	     utf16_stream,
+	     utf16_stream_size ) == 0 )
+	{
+		return( 0 );
+	}
+	upcase_table    = internal_name_search->upcase_table;
+	upcased_pattern = internal_name_search->upcased_pattern;
+	name_length     = utf16_stream_size / 2;
+	pattern_length  = internal_name_search->pattern_length;
+
+	/* On a mismatch the last '*' is extended by one code unit
+	 */
+	while( name_index < name_length )
+	{
+		if( pattern_index < pattern_length )
+		{
+			if( internal_name_search->pattern[ pattern_index ] == (uint16_t) '*' )
+			{
+				has_asterisk           = 1;
+				asterisk_pattern_index = pattern_index++;
+				asterisk_name_index    = name_index;
+
+				continue;
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ name_index * 2 ] ),
+			 code_unit );
+
+			if( ( internal_name_search->pattern[ pattern_index ] == (uint16_t) '?' )
+			 || ( upcase_table[ code_unit ] == upcased_pattern[ pattern_index ] ) )
+			{
+				pattern_index++;
+				name_index++;
+
+				continue;
+			}
+		}
+		if( has_asterisk == 0 )
+		{
+			return( 0 );
+		}
+		pattern_index = asterisk_pattern_index + 1;
+		name_index    = ++asterisk_name_index;
+	}
+	while( ( pattern_index < pattern_length )
+	    && ( internal_name_search->pattern[ pattern_index ] == (uint16_t) '*' ) )
+	{
+		pattern_index++;
+	}
+	if( pattern_index != pattern_length )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Matches an UTF-16 little-endian stream against the pattern
+ * Returns 1 if the name matches, 0 if not or -1 on error
+ */
+int libftxf_name_search_match_utf16_stream(
+     libftxf_name_search_t *name_search,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_name_search_t *internal_name_search = NULL;
+	static char *function                                = "libftxf_name_search_match_utf16_stream";
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_search = (libftxf_internal_name_search_t *) name_search;
+
+	if( internal_name_search->pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid name search - missing pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size > (size_t) SSIZE_MAX )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( libftxf_internal_name_search_match_utf16_stream(
+	         internal_name_search,
+	         utf16_stream,
+	         utf16_stream_size ) );
+}
+
+/* Matches the name of a record against the pattern
+ * The name is compared without decoding it
+ * Returns 1 if the name matches, 0 if not or if the record has no name or -1 on error
+ */
+int libftxf_name_search_match_record(
+     libftxf_name_search_t *name_search,
+     libftxf_record_t *record,
+     libcerror_error_t **error )
+{
+	libftxf_internal_name_search_t *internal_name_search = NULL;
+	libftxf_internal_record_t *internal_record           = NULL;
+	static char *function                                = "libftxf_name_search_match_record";
+	int result                                           = 0;
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_search = (libftxf_internal_name_search_t *) name_search;
+
+	if( internal_name_search->pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid name search - missing pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_record->name_size > 0 )
+	{
+		result = libftxf_internal_name_search_match_utf16_stream(
+		          internal_name_search,
+		          internal_record->name,
+		          internal_record->name_size );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,173 @@
+/*
+ * Name search functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_NAME_SEARCH_H )
+#define _LIBFTXF_NAME_SEARCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of entries in an upcase table
+ */
+#define LIBFTXF_NAME_SEARCH_UPCASE_TABLE_NUMBER_OF_ENTRIES	65536
+
+typedef struct libftxf_internal_name_search libftxf_internal_name_search_t;
+
+struct libftxf_internal_name_search
+{
+	/* The upcase table
+	 * Contains the upper case equivalent of every UTF-16 code unit
+	 */
+	uint16_t *upcase_table;
+
+	/* The pattern
+	 * Contains the UTF-16 code units of the pattern as provided
+	 */
+	uint16_t *pattern;
+
+	/* The upcased pattern
+	 * Contains the UTF-16 code units of the pattern mapped by the upcase table
+	 */
+	uint16_t *upcased_pattern;
+
+	/* The pattern length
+	 * Contains the number of UTF-16 code units
+	 */
+	size_t pattern_length;
+
+	/* The minimum name length
+	 * Contains the number of UTF-16 code units of the pattern without '*'
+	 */
+	size_t minimum_name_length;
+
+	/* The prefix length
+	 * Contains the number of UTF-16 code units before the first '*'
+	 */
+	size_t prefix_length;
+
+	/* The suffix length
+	 * Contains the number of UTF-16 code units after the last '*'
+	 */
+	size_t suffix_length;
+
+	/* Value to indicate the pattern contains a '*'
+	 */
+	uint8_t has_asterisk;
+
+	/* The number of prefilter code units
+	 * Contains 0 if the prefilter is not used
+	 */
+	uint8_t number_of_prefilter_code_units;
+
+	/* The prefilter code units
+	 * A name that matches the pattern contains at least one of these code units
+	 */
+	uint16_t prefilter_code_units[ 2 ];
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the name search and its buffers
+	 */
+	libftxf_allocator_t allocator;
+};
+
+LIBFTXF_EXTERN \
+int libftxf_name_search_initialize(
+     libftxf_name_search_t **name_search,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_search_initialize_with_allocator(
+     libftxf_name_search_t **name_search,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_search_free(
+     libftxf_name_search_t **name_search,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_search_set_upcase_table(
+     libftxf_name_search_t *name_search,
+     const uint8_t *upcase_table_data,
+     size_t upcase_table_data_size,
+     libcerror_error_t **error );
+
+int libftxf_internal_name_search_set_pattern(
+     libftxf_internal_name_search_t *internal_name_search,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+int libftxf_internal_name_search_update_pattern(
+     libftxf_internal_name_search_t *internal_name_search );
+
+LIBFTXF_EXTERN \
+int libftxf_name_search_set_utf8_pattern(
+     libftxf_name_search_t *name_search,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_search_set_utf16_pattern(
+     libftxf_name_search_t *name_search,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+int libftxf_internal_name_search_prefilter_utf16_stream(
+     libftxf_internal_name_search_t *internal_name_search,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size );
+
+int libftxf_internal_name_search_match_utf16_stream(
+     libftxf_internal_name_search_t *internal_name_search,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size );
+
+LIBFTXF_EXTERN \
+int libftxf_name_search_match_utf16_stream(
+     libftxf_name_search_t *name_search,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_name_search_match_record(
+     libftxf_name_search_t *name_search,
+     libftxf_record_t *txf_record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_NAME_SEARCH_H ) */
+
@@ -0,0 +1,1502 @@
+/*
+ * Path resolver functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_path_resolver.h"
+
+/* The initial allocated number of entries
+ */
+#define LIBFTXF_PATH_RESOLVER_INITIAL_NUMBER_OF_ENTRIES		1024
+
+/* The initial allocated names data size
+ */
+#define LIBFTXF_PATH_RESOLVER_INITIAL_NAMES_DATA_SIZE		65536
+
+/* The initial hash table size, must be a power of 2
+ */
+#define LIBFTXF_PATH_RESOLVER_INITIAL_HASH_TABLE_SIZE		4096
+
+/* The maximum number of cache entries, must be a power of 2
+ */
+#define LIBFTXF_PATH_RESOLVER_MAXIMUM_NUMBER_OF_CACHE_ENTRIES	1024
+
+/* The maximum number of directories in a path, used to detect a parent chain that contains a loop
+ */
+#define LIBFTXF_PATH_RESOLVER_MAXIMUM_PATH_DEPTH		4096
+
+/* The MFT entry index of the root directory
+ */
+#define LIBFTXF_PATH_RESOLVER_ROOT_DIRECTORY_MFT_ENTRY_INDEX	5
+
+/* Calculates the hash of a file reference
+ */
+#define libftxf_path_resolver_hash( file_reference, hash_mask ) \
+	( (uint32_t) ( ( ( file_reference ) * 0xff51afd7ed558ccdUL ) >> 32 ) & ( hash_mask ) )
+
+/* The path resolver stores the file reference, parent file reference and name of the file
+ * entries of a volume, for example read from the $MFT, in a single entries array and names
+ * data buffer with an open addressing hash table keyed on the file reference. A path is
+ * resolved by walking the parent chain up to the root directory, the paths of the directories
+ * in the parent chain are stored in a least recently used (LRU) cache so that the paths of
+ * files in the same or a nearby directory only require a walk up to the first cached directory.
+ *
+ * Paths use \ as separator, the path of the root directory is \. If the parent chain does not
+ * end at the root directory, because a parent is missing, the path is relative to the first
+ * missing parent and does not start with a separator.
+ */
+
+/* Creates a path resolver
+ * Make sure the value path_resolver is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_path_resolver_initialize(
+     libftxf_path_resolver_t **path_resolver,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_path_resolver_initialize";
+
+	if( libftxf_path_resolver_initialize_with_allocator(
+	     path_resolver,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create path resolver.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a path resolver that allocates its memory using the allocator functions
+ * Make sure the value path_resolver is referencing, is set to NULL
+ * The allocator is copied into the path resolver, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_path_resolver_initialize_with_allocator(
+     libftxf_path_resolver_t **path_resolver,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	libftxf_internal_path_resolver_t *internal_path_resolver = NULL;
+	static char *function                                    = "libftxf_path_resolver_initialize_with_allocator";
+	int bucket_index                                         = 0;
+
+	if( path_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path resolver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_resolver != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path resolver value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_path_resolver = (libftxf_internal_path_resolver_t *) libftxf_allocator_allocate(
+	                                                               allocator,
+	                                                               sizeof( libftxf_internal_path_resolver_t ) );
+
+	if( internal_path_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path resolver.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_path_resolver,
+	     0,
+	     sizeof( libftxf_internal_path_resolver_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path resolver.",
+		 function );
+
+		libftxf_allocator_free(
+		 allocator,
+		 internal_path_resolver );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		internal_path_resolver->allocator = *allocator;
+	}
+	internal_path_resolver->hash_table_size = LIBFTXF_PATH_RESOLVER_INITIAL_HASH_TABLE_SIZE;
+
+	internal_path_resolver->hash_table = (uint32_t *) libftxf_allocator_allocate(
+	                                                   &( internal_path_resolver->allocator ),
+	                                                   sizeof( uint32_t ) * internal_path_resolver->hash_table_size );
+
+	if( internal_path_resolver->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_path_resolver->hash_table,
+	     0,
+	     sizeof( uint32_t ) * internal_path_resolver->hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		goto on_error;
+	}
+	internal_path_resolver->cache_entries = (libftxf_path_resolver_cache_entry_t *) libftxf_allocator_allocate(
+	                                                                                 &( internal_path_resolver->allocator ),
+	                                                                                 sizeof( libftxf_path_resolver_cache_entry_t ) * LIBFTXF_PATH_RESOLVER_MAXIMUM_NUMBER_OF_CACHE_ENTRIES );
+
+	if( internal_path_resolver->cache_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_path_resolver->cache_entries,
+	     0,
+	     sizeof( libftxf_path_resolver_cache_entry_t ) * LIBFTXF_PATH_RESOLVER_MAXIMUM_NUMBER_OF_CACHE_ENTRIES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache entries.",
+		 function );
+
+		goto on_error;
+	}
+	internal_path_resolver->cache_hash_buckets = (int *) libftxf_allocator_allocate(
+	                                                      &( internal_path_resolver->allocator ),
+	                                                      sizeof( int ) * LIBFTXF_PATH_RESOLVER_MAXIMUM_NUMBER_OF_CACHE_ENTRIES );
+
+	if( internal_path_resolver->cache_hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < LIBFTXF_PATH_RESOLVER_MAXIMUM_NUMBER_OF_CACHE_ENTRIES;
+	     bucket_index++ )
+	{
+		internal_path_resolver->cache_hash_buckets[ bucket_index ] = -1;
+	}
+	internal_path_resolver->most_recently_used_index  = -1;
+	internal_path_resolver->least_recently_used_index = -1;
+
+	*path_resolver = (libftxf_path_resolver_t *) internal_path_resolver;
+
+	return( 1 );
+
+on_error:
+	if( internal_path_resolver != NULL )
+	{
+		if( internal_path_resolver->cache_entries != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_path_resolver->allocator ),
+			 internal_path_resolver->cache_entries );
+		}
+		if( internal_path_resolver->hash_table != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_path_resolver->allocator ),
+			 internal_path_resolver->hash_table );
+		}
+		libftxf_allocator_free(
+		 allocator,
+		 internal_path_resolver );
+	}
+	return( -1 );
+}
+
+/* Frees a path resolver
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_path_resolver_free(
+     libftxf_path_resolver_t **path_resolver,
+     libcerror_error_t **error )
+{
+	libftxf_allocator_t allocator;
+
+	libftxf_internal_path_resolver_t *internal_path_resolver = NULL;
+	static char *function                                    = "libftxf_path_resolver_free";
+	int cache_index                                          = 0;
+
+	if( path_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path resolver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_resolver != NULL )
+	{
+		internal_path_resolver = (libftxf_internal_path_resolver_t *) *path_resolver;
+		*path_resolver         = NULL;
+
+		for( cache_index = 0;
+		     cache_index < LIBFTXF_PATH_RESOLVER_MAXIMUM_NUMBER_OF_CACHE_ENTRIES;
+		     cache_index++ )
+		{
+			if( internal_path_resolver->cache_entries[ cache_index ].path != NULL )
+			{
+				libftxf_allocator_free(
+				 &( internal_path_resolver->allocator ),
+				 internal_path_resolver->cache_entries[ cache_index ].path );
+			}
+		}
+		if( internal_path_resolver->parent_chain != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_path_resolver->allocator ),
+			 internal_path_resolver->parent_chain );
+		}
+		if( internal_path_resolver->path_buffer != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_path_resolver->allocator ),
+			 internal_path_resolver->path_buffer );
+		}
+		if( internal_path_resolver->names_data != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_path_resolver->allocator ),
+			 internal_path_resolver->names_data );
+		}
+		if( internal_path_resolver->entries != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_path_resolver->allocator ),
+			 internal_path_resolver->entries );
+		}
+		libftxf_allocator_free(
+		 &( internal_path_resolver->allocator ),
+		 internal_path_resolver->cache_hash_buckets );
+
+		libftxf_allocator_free(
+		 &( internal_path_resolver->allocator ),
+		 internal_path_resolver->cache_entries );
+
+		libftxf_allocator_free(
+		 &( internal_path_resolver->allocator ),
+		 internal_path_resolver->hash_table );
+
+		/* The allocator is copied since it is stored in the path resolver that is freed
+		 */
+		allocator = internal_path_resolver->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
+		 internal_path_resolver );
+	}
+	return( 1 );
+}
+
+/* Doubles the size of the hash table and re-inserts the entries
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_path_resolver_resize_hash_table(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     libcerror_error_t **error )
+{
+	uint32_t *hash_table      = NULL;
+	static char *function     = "libftxf_internal_path_resolver_resize_hash_table";
+	uint32_t entry_index      = 0;
+	uint32_t hash_table_index = 0;
+	uint32_t hash_table_mask  = 0;
+	uint32_t hash_table_size  = 0;
+
+	if( internal_path_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path resolver.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_path_resolver->hash_table_size > ( (uint32_t) INT32_MAX ) )
+	 || ( (size_t) internal_path_resolver->hash_table_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( uint32_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path resolver - hash table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_size = internal_path_resolver->hash_table_size * 2;
+	hash_table_mask = hash_table_size - 1;
+
+	hash_table = (uint32_t *) libftxf_allocator_allocate(
+	                           &( internal_path_resolver->allocator ),
+	                           sizeof( uint32_t ) * hash_table_size );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( uint32_t ) * hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		libftxf_allocator_free(
+		 &( internal_path_resolver->allocator ),
+		 hash_table );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_path_resolver->number_of_entries;
+	     entry_index++ )
+	{
+		hash_table_index = libftxf_path_resolver_hash(
+		                    internal_path_resolver->entries[ entry_index ].file_reference,
+		                    hash_table_mask );
+
+		while( hash_table[ hash_table_index ] != 0 )
+		{
+			hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+		}
+		hash_table[ hash_table_index ] = entry_index + 1;
+	}
+	libftxf_allocator_free(
+	 &( internal_path_resolver->allocator ),
+	 internal_path_resolver->hash_table );
+
+	internal_path_resolver->hash_table      = hash_table;
+	internal_path_resolver->hash_table_size = hash_table_size;
+
+	return( 1 );
+}
+
+/* Removes all the paths from the cache
+ * The allocated paths of the cache entries are reused
+ */
+void libftxf_internal_path_resolver_clear_cache(
+      libftxf_internal_path_resolver_t *internal_path_resolver )
+{
+	int bucket_index = 0;
+
+	if( internal_path_resolver == NULL )
+	{
+		return;
+	}
+	for( bucket_index = 0;
+	     bucket_index < LIBFTXF_PATH_RESOLVER_MAXIMUM_NUMBER_OF_CACHE_ENTRIES;
+	     bucket_index++ )
+	{
+		internal_path_resolver->cache_hash_buckets[ bucket_index ] = -1;
+	}
+	internal_path_resolver->number_of_cache_entries   = 0;
+	internal_path_resolver->most_recently_used_index  = -1;
+	internal_path_resolver->least_recently_used_index = -1;
+}
+
+/* Appends the file reference, parent file reference and name of a file entry
+ * If the same file reference is appended multiple times the first entry is used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_path_resolver_append_entry(
+     libftxf_path_resolver_t *path_resolver,
+     uint64_t file_reference,
+     uint64_t parent_file_reference,
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
+     libcerror_error_t **error )
+{
+	libftxf_internal_path_resolver_t *internal_path_resolver = NULL;
+	libftxf_path_resolver_entry_t *entry                     = NULL;
+	void *reallocation                                       = NULL;
+	static char *function                                    = "libftxf_path_resolver_append_entry";
+	size_t allocated_names_data_size                         = 0;
+	uint32_t allocated_number_of_entries                     = 0;
+	uint32_t entry_index                                     = 0;
+	uint32_t hash_table_index                                = 0;
+	uint32_t hash_table_mask                                 = 0;
+
+	if( path_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path resolver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_resolver = (libftxf_internal_path_resolver_t *) path_resolver;
+
+	if( utf8_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name_length > (size_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_path_resolver->number_of_entries >= ( (uint32_t) INT32_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path resolver - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_path_resolver->number_of_entries >= internal_path_resolver->allocated_number_of_entries )
+	{
+		allocated_number_of_entries = internal_path_resolver->allocated_number_of_entries * 2;
+
+		if( allocated_number_of_entries == 0 )
+		{
+			allocated_number_of_entries = LIBFTXF_PATH_RESOLVER_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		if( (size_t) allocated_number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libftxf_path_resolver_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = libftxf_allocator_reallocate(
+		                &( internal_path_resolver->allocator ),
+		                internal_path_resolver->entries,
+		                sizeof( libftxf_path_resolver_entry_t ) * allocated_number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_path_resolver->entries                     = (libftxf_path_resolver_entry_t *) reallocation;
+		internal_path_resolver->allocated_number_of_entries = allocated_number_of_entries;
+	}
+	if( utf8_name_length > ( internal_path_resolver->allocated_names_data_size - internal_path_resolver->names_data_size ) )
+	{
+		allocated_names_data_size = internal_path_resolver->allocated_names_data_size * 2;
+
+		if( allocated_names_data_size == 0 )
+		{
+			allocated_names_data_size = LIBFTXF_PATH_RESOLVER_INITIAL_NAMES_DATA_SIZE;
+		}
+		if( allocated_names_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid names data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = libftxf_allocator_reallocate(
+		                &( internal_path_resolver->allocator ),
+		                internal_path_resolver->names_data,
+		                allocated_names_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize names data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_path_resolver->names_data                = (uint8_t *) reallocation;
+		internal_path_resolver->allocated_names_data_size = allocated_names_data_size;
+	}
+	if( utf8_name_length > 0 )
+	{
+		if( memory_copy(
+		     &( internal_path_resolver->names_data[ internal_path_resolver->names_data_size ] ),
+		     utf8_name,
+		     utf8_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	entry_index = internal_path_resolver->number_of_entries;
+	entry       = &( internal_path_resolver->entries[ entry_index ] );
+
+	entry->file_reference        = file_reference;
+	entry->parent_file_reference = parent_file_reference;
+	entry->name_offset           = (uint32_t) internal_path_resolver->names_data_size;
+	entry->name_length           = (uint32_t) utf8_name_length;
+
+	internal_path_resolver->names_data_size += utf8_name_length;
+
+	hash_table_mask  = internal_path_resolver->hash_table_size - 1;
+	hash_table_index = libftxf_path_resolver_hash(
+	                    file_reference,
+	                    hash_table_mask );
+
+	while( internal_path_resolver->hash_table[ hash_table_index ] != 0 )
+	{
+		hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+	}
+	internal_path_resolver->hash_table[ hash_table_index ] = entry_index + 1;
+
+	internal_path_resolver->number_of_entries += 1;
+
+	/* The entry can be the parent of a directory that was cached with a relative path
+	 */
+	libftxf_internal_path_resolver_clear_cache(
+	 internal_path_resolver );
+
+	/* Keep the load factor of the hash table at or below 0.5
+	 */
+	if( ( internal_path_resolver->number_of_entries * 2 ) > internal_path_resolver->hash_table_size )
+	{
+		if( libftxf_internal_path_resolver_resize_hash_table(
+		     internal_path_resolver,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_path_resolver_get_number_of_entries(
+     libftxf_path_resolver_t *path_resolver,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error )
+{
+	libftxf_internal_path_resolver_t *internal_path_resolver = NULL;
+	static char *function                                    = "libftxf_path_resolver_get_number_of_entries";
+
+	if( path_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path resolver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_resolver = (libftxf_internal_path_resolver_t *) path_resolver;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = internal_path_resolver->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the entry with a specific file reference
+ * Returns 1 if successful or 0 if no such entry
+ */
+int libftxf_internal_path_resolver_get_entry_index(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     uint64_t file_reference,
+     uint32_t *entry_index )
+{
+	uint32_t hash_table_index = 0;
+	uint32_t hash_table_mask  = 0;
+
+	hash_table_mask  = internal_path_resolver->hash_table_size - 1;
+	hash_table_index = libftxf_path_resolver_hash(
+	                    file_reference,
+	                    hash_table_mask );
+
+	while( internal_path_resolver->hash_table[ hash_table_index ] != 0 )
+	{
+		if( internal_path_resolver->entries[ internal_path_resolver->hash_table[ hash_table_index ] - 1 ].file_reference == file_reference )
+		{
+			*entry_index = internal_path_resolver->hash_table[ hash_table_index ] - 1;
+
+			return( 1 );
+		}
+		hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+	}
+	return( 0 );
+}
+
+/* Appends a segment to the path in the path buffer
+ * A separator is added if the path is not empty and does not end with a separator
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_path_resolver_append_path_segment(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     const uint8_t *segment,
+     size_t segment_length,
+     libcerror_error_t **error )
+{
+	void *reallocation      = NULL;
+	static char *function   = "libftxf_internal_path_resolver_append_path_segment";
+	size_t path_buffer_size = 0;
+	size_t required_size    = 0;
+	uint8_t add_separator   = 0;
+
+	if( internal_path_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path resolver.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_path_resolver->path_length > 0 )
+	 && ( internal_path_resolver->path_buffer[ internal_path_resolver->path_length - 1 ] != (uint8_t) '\\' ) )
+	{
+		add_separator = 1;
+	}
+	/* Reserve space for the end-of-string character
+	 */
+	required_size = internal_path_resolver->path_length + add_separator + segment_length + 1;
+
+	if( required_size > internal_path_resolver->path_buffer_size )
+	{
+		path_buffer_size = 256;
+
+		while( path_buffer_size < required_size )
+		{
+			path_buffer_size *= 2;
+		}
+		if( path_buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid path buffer size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = libftxf_allocator_reallocate(
+		                &( internal_path_resolver->allocator ),
+		                internal_path_resolver->path_buffer,
+		                path_buffer_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize path buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_path_resolver->path_buffer      = (uint8_t *) reallocation;
+		internal_path_resolver->path_buffer_size = path_buffer_size;
+	}
+	if( add_separator != 0 )
+	{
+		internal_path_resolver->path_buffer[ internal_path_resolver->path_length++ ] = (uint8_t) '\\';
+	}
+	if( segment_length > 0 )
+	{
+		if( memory_copy(
+		     &( internal_path_resolver->path_buffer[ internal_path_resolver->path_length ] ),
+		     segment,
+		     segment_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy segment.",
+			 function );
+
+			return( -1 );
+		}
+		internal_path_resolver->path_length += segment_length;
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the cache entry of a specific directory
+ * Returns 1 if successful or 0 if the directory is not cached
+ */
+int libftxf_internal_path_resolver_get_cache_entry(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     uint64_t file_reference,
+     int *cache_index )
+{
+	int safe_cache_index = 0;
+
+	safe_cache_index = internal_path_resolver->cache_hash_buckets[ libftxf_path_resolver_hash( file_reference, LIBFTXF_PATH_RESOLVER_MAXIMUM_NUMBER_OF_CACHE_ENTRIES - 1 ) ];
+
+	while( safe_cache_index != -1 )
+	{
+		if( internal_path_resolver->cache_entries[ safe_cache_index ].file_reference == file_reference )
+		{
+			*cache_index = safe_cache_index;
+
+			return( 1 );
+		}
+		safe_cache_index = internal_path_resolver->cache_entries[ safe_cache_index ].hash_next_index;
+	}
+	return( 0 );
+}
+
+/* Marks a cache entry as the most recently used
+ * The cache entry is linked into the list of cache entries if it is not linked yet
+ */
+void libftxf_internal_path_resolver_use_cache_entry(
+      libftxf_internal_path_resolver_t *internal_path_resolver,
+      int cache_index )
+{
+	libftxf_path_resolver_cache_entry_t *cache_entry = NULL;
+
+	if( internal_path_resolver->most_recently_used_index == cache_index )
+	{
+		return;
+	}
+	cache_entry = &( internal_path_resolver->cache_entries[ cache_index ] );
+
+	/* Unlink the cache entry
+	 */
+	if( cache_entry->previous_index != -1 )
+	{
+		internal_path_resolver->cache_entries[ cache_entry->previous_index ].next_index = cache_entry->next_index;
+	}
+	if( cache_entry->next_index != -1 )
+	{
+		internal_path_resolver->cache_entries[ cache_entry->next_index ].previous_index = cache_entry->previous_index;
+	}
+	else if( internal_path_resolver->least_recently_used_index == cache_index )
+	{
+		internal_path_resolver->least_recently_used_index = cache_entry->previous_index;
+	}
+	/* Link the cache entry at the front
+	 */
+	cache_entry->previous_index = -1;
+	cache_entry->next_index     = internal_path_resolver->most_recently_used_index;
+
+	if( internal_path_resolver->most_recently_used_index != -1 )
+	{
+		internal_path_resolver->cache_entries[ internal_path_resolver->most_recently_used_index ].previous_index = cache_index;
+	}
+	internal_path_resolver->most_recently_used_index = cache_index;
+
+	if( internal_path_resolver->least_recently_used_index == -1 )
+	{
+		internal_path_resolver->least_recently_used_index = cache_index;
+	}
+}
+
+/* Caches the path in the path buffer as the path of a specific directory
+ * If the cache is full the least recently used cache entry is reused
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_path_resolver_cache_path(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     uint64_t file_reference,
+     libcerror_error_t **error )
+{
+	libftxf_path_resolver_cache_entry_t *cache_entry = NULL;
+	void *reallocation                               = NULL;
+	static char *function                            = "libftxf_internal_path_resolver_cache_path";
+	uint32_t bucket_index                            = 0;
+	int cache_index                                  = 0;
+	int *hash_next_index                             = NULL;
+
+	if( internal_path_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path resolver.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_internal_path_resolver_get_cache_entry(
+	     internal_path_resolver,
+	     file_reference,
+	     &cache_index ) == 0 )
+	{
+		if( internal_path_resolver->number_of_cache_entries < LIBFTXF_PATH_RESOLVER_MAXIMUM_NUMBER_OF_CACHE_ENTRIES )
+		{
+			cache_index = internal_path_resolver->number_of_cache_entries;
+			cache_entry = &( internal_path_resolver->cache_entries[ cache_index ] );
+
+			cache_entry->previous_index = -1;
+			cache_entry->next_index     = -1;
+
+			internal_path_resolver->number_of_cache_entries += 1;
+		}
+		else
+		{
+			cache_index = internal_path_resolver->least_recently_used_index;
+			cache_entry = &( internal_path_resolver->cache_entries[ cache_index ] );
+
+			/* Remove the least recently used cache entry from its hash bucket
+			 */
+			bucket_index    = libftxf_path_resolver_hash( cache_entry->file_reference, LIBFTXF_PATH_RESOLVER_MAXIMUM_NUMBER_OF_CACHE_ENTRIES - 1 );
+			hash_next_index = &( internal_path_resolver->cache_hash_buckets[ bucket_index ] );
+
+			while( *hash_next_index != cache_index )
+			{
+				hash_next_index = &( internal_path_resolver->cache_entries[ *hash_next_index ].hash_next_index );
+			}
+			*hash_next_index = cache_entry->hash_next_index;
+		}
+		cache_entry->file_reference = file_reference;
+
+		bucket_index = libftxf_path_resolver_hash( file_reference, LIBFTXF_PATH_RESOLVER_MAXIMUM_NUMBER_OF_CACHE_ENTRIES - 1 );
+
+		cache_entry->hash_next_index = internal_path_resolver->cache_hash_buckets[ bucket_index ];
+
+		internal_path_resolver->cache_hash_buckets[ bucket_index ] = cache_index;
+	}
+	cache_entry = &( internal_path_resolver->cache_entries[ cache_index ] );
+
+	libftxf_internal_path_resolver_use_cache_entry(
+	 internal_path_resolver,
+	 cache_index );
+
+	if( internal_path_resolver->path_length >= cache_entry->path_size )
+	{
+		reallocation = libftxf_allocator_reallocate(
+		                &( internal_path_resolver->allocator ),
+		                cache_entry->path,
+		                internal_path_resolver->path_buffer_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize cache entry path.",
+			 function );
+
+			cache_entry->path_length = 0;
+
+			return( -1 );
+		}
+		cache_entry->path      = (uint8_t *) reallocation;
+		cache_entry->path_size = internal_path_resolver->path_buffer_size;
+	}
+	if( internal_path_resolver->path_length > 0 )
+	{
+		if( memory_copy(
+		     cache_entry->path,
+		     internal_path_resolver->path_buffer,
+		     internal_path_resolver->path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			cache_entry->path_length = 0;
+
+			return( -1 );
+		}
+	}
+	cache_entry->path_length = internal_path_resolver->path_length;
+
+	return( 1 );
+}
+
+/* Resolves the path of a specific directory into the path buffer
+ * The paths of the directories in the parent chain are cached
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_path_resolver_resolve_directory(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     uint64_t file_reference,
+     libcerror_error_t **error )
+{
+	libftxf_path_resolver_cache_entry_t *cache_entry = NULL;
+	libftxf_path_resolver_entry_t *entry             = NULL;
+	void *reallocation                               = NULL;
+	static char *function                            = "libftxf_internal_path_resolver_resolve_directory";
+	uint32_t allocated_parent_chain_size             = 0;
+	uint32_t entry_index                             = 0;
+	uint32_t parent_chain_size                       = 0;
+	int cache_index                                  = 0;
+	int result                                       = 0;
+
+	if( internal_path_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path resolver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_resolver->path_length = 0;
+
+	/* Walk the parent chain up to the first cached directory, the root directory
+	 * or a missing parent
+	 */
+	while( libftxf_internal_path_resolver_get_cache_entry(
+	        internal_path_resolver,
+	        file_reference,
+	        &cache_index ) == 0 )
+	{
+		result = libftxf_internal_path_resolver_get_entry_index(
+		          internal_path_resolver,
+		          file_reference,
+		          &entry_index );
+
+		if( ( ( file_reference & 0x0000ffffffffffffUL ) == LIBFTXF_PATH_RESOLVER_ROOT_DIRECTORY_MFT_ENTRY_INDEX )
+		 || ( ( result != 0 )
+		  &&  ( internal_path_resolver->entries[ entry_index ].parent_file_reference == file_reference ) ) )
+		{
+			if( libftxf_internal_path_resolver_append_path_segment(
+			     internal_path_resolver,
+			     (uint8_t *) "\\",
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append root directory to path.",
+				 function );
+
+				return( -1 );
+			}
+			cache_index = -1;
+
+			break;
+		}
+		else if( result == 0 )
+		{
+			cache_index = -1;
+
+			break;
+		}
+		entry = &( internal_path_resolver->entries[ entry_index ] );
+
+		if( parent_chain_size >= LIBFTXF_PATH_RESOLVER_MAXIMUM_PATH_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid parent chain - too many directories or contains a loop.",
+			 function );
+
+			return( -1 );
+		}
+		if( parent_chain_size >= internal_path_resolver->allocated_parent_chain_size )
+		{
+			allocated_parent_chain_size = internal_path_resolver->allocated_parent_chain_size * 2;
+
+			if( allocated_parent_chain_size == 0 )
+			{
+				allocated_parent_chain_size = 64;
+			}
+			reallocation = libftxf_allocator_reallocate(
+			                &( internal_path_resolver->allocator ),
+			                internal_path_resolver->parent_chain,
+			                sizeof( uint32_t ) * allocated_parent_chain_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize parent chain.",
+				 function );
+
+				return( -1 );
+			}
+			internal_path_resolver->parent_chain                = (uint32_t *) reallocation;
+			internal_path_resolver->allocated_parent_chain_size = allocated_parent_chain_size;
+		}
+		internal_path_resolver->parent_chain[ parent_chain_size++ ] = entry_index;
+
+		file_reference = entry->parent_file_reference;
+	}
+	if( cache_index != -1 )
+	{
+		cache_entry = &( internal_path_resolver->cache_entries[ cache_index ] );
+
+		libftxf_internal_path_resolver_use_cache_entry(
+		 internal_path_resolver,
+		 cache_index );
+
+		if( libftxf_internal_path_resolver_append_path_segment(
+		     internal_path_resolver,
+		     cache_entry->path,
+		     cache_entry->path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append cached path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Build the path down the parent chain and cache the path of every directory
+	 */
+	while( parent_chain_size > 0 )
+	{
+		parent_chain_size--;
+
+		entry = &( internal_path_resolver->entries[ internal_path_resolver->parent_chain[ parent_chain_size ] ] );
+
+		if( libftxf_internal_path_resolver_append_path_segment(
+		     internal_path_resolver,
+		     &( internal_path_resolver->names_data[ entry->name_offset ] ),
+		     (size_t) entry->name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append name to path.",
+			 function );
+
+			return( -1 );
+		}
+		if( libftxf_internal_path_resolver_cache_path(
+		     internal_path_resolver,
+		     entry->file_reference,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to cache path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Resolves the path of a specific file entry into the path buffer
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libftxf_internal_path_resolver_resolve(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     uint64_t file_reference,
+     libcerror_error_t **error )
+{
+	libftxf_path_resolver_entry_t *entry = NULL;
+	static char *function                = "libftxf_internal_path_resolver_resolve";
+	uint32_t entry_index                 = 0;
+
+	if( internal_path_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path resolver.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_internal_path_resolver_get_entry_index(
+	     internal_path_resolver,
+	     file_reference,
+	     &entry_index ) == 0 )
+	{
+		return( 0 );
+	}
+	entry = &( internal_path_resolver->entries[ entry_index ] );
+
+	/* The root directory is resolved as a directory since it has no parent
+	 */
+	if( ( entry->parent_file_reference == file_reference )
+	 || ( ( file_reference & 0x0000ffffffffffffUL ) == LIBFTXF_PATH_RESOLVER_ROOT_DIRECTORY_MFT_ENTRY_INDEX ) )
+	{
+		if( libftxf_internal_path_resolver_resolve_directory(
+		     internal_path_resolver,
+		     file_reference,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to resolve root directory.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libftxf_internal_path_resolver_resolve_directory(
+	     internal_path_resolver,
+	     entry->parent_file_reference,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve parent directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_internal_path_resolver_append_path_segment(
+	     internal_path_resolver,
+	     &( internal_path_resolver->names_data[ entry->name_offset ] ),
+	     (size_t) entry->name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name to path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded path of a specific file entry
+ * The returned size includes the end-of-string character
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libftxf_path_resolver_get_utf8_path_size(
+     libftxf_path_resolver_t *path_resolver,
+     uint64_t file_reference,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_path_resolver_t *internal_path_resolver = NULL;
+	static char *function                                    = "libftxf_path_resolver_get_utf8_path_size";
+	int result                                               = 0;
+
+	if( path_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path resolver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_resolver = (libftxf_internal_path_resolver_t *) path_resolver;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libftxf_internal_path_resolver_resolve(
+	          internal_path_resolver,
+	          file_reference,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve path.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*utf8_string_size = internal_path_resolver->path_length + 1;
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded path of a specific file entry
+ * The size should include the end-of-string character
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libftxf_path_resolver_get_utf8_path(
+     libftxf_path_resolver_t *path_resolver,
+     uint64_t file_reference,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_path_resolver_t *internal_path_resolver = NULL;
+	static char *function                                    = "libftxf_path_resolver_get_utf8_path";
+	int result                                               = 0;
+
+	if( path_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path resolver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_resolver = (libftxf_internal_path_resolver_t *) path_resolver;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libftxf_internal_path_resolver_resolve(
+	          internal_path_resolver,
+	          file_reference,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve path.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( utf8_string_size < ( internal_path_resolver->path_length + 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_path_resolver->path_length > 0 )
+		{
+			if( memory_copy(
+			     utf8_string,
+			     internal_path_resolver->path_buffer,
+			     internal_path_resolver->path_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy path.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		utf8_string[ internal_path_resolver->path_length ] = 0;
+	}
+	return( result );
+}
+
@@ -0,0 +1,276 @@
+/*
+ * Path resolver functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_PATH_RESOLVER_H )
+#define _LIBFTXF_PATH_RESOLVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libftxf_path_resolver_entry libftxf_path_resolver_entry_t;
+
+/* A file reference, parent file reference and name of a file entry
+ */
+struct libftxf_path_resolver_entry
+{
+	/* The file reference
+	 */
+	uint64_t file_reference;
+
+	/* The parent file reference
+	 */
+	uint64_t parent_file_reference;
+
+	/* The offset of the UTF-8 encoded name in the names data
+	 */
+	uint32_t name_offset;
+
+	/* The length of the UTF-8 encoded name
+	 * Does not include the end-of-string character
+	 */
+	uint32_t name_length;
+};
+
+typedef struct libftxf_path_resolver_cache_entry libftxf_path_resolver_cache_entry_t;
+
+/* A cached path of a directory
+ */
+struct libftxf_path_resolver_cache_entry
+{
+	/* The file reference of the directory
+	 */
+	uint64_t file_reference;
+
+	/* The UTF-8 encoded path
+	 */
+	uint8_t *path;
+
+	/* The length of the UTF-8 encoded path
+	 * Does not include the end-of-string character
+	 */
+	size_t path_length;
+
+	/* The allocated size of the path
+	 */
+	size_t path_size;
+
+	/* The index of the previous (more recently used) cache entry or -1 if none
+	 */
+	int previous_index;
+
+	/* The index of the next (less recently used) cache entry or -1 if none
+	 */
+	int next_index;
+
+	/* The index of the next cache entry in the same hash bucket or -1 if none
+	 */
+	int hash_next_index;
+};
+
+typedef struct libftxf_internal_path_resolver libftxf_internal_path_resolver_t;
+
+struct libftxf_internal_path_resolver
+{
+	/* The entries
+	 */
+	libftxf_path_resolver_entry_t *entries;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The allocated number of entries
+	 */
+	uint32_t allocated_number_of_entries;
+
+	/* The names data
+	 * Contains the UTF-8 encoded names without end-of-string character
+	 */
+	uint8_t *names_data;
+
+	/* The names data size
+	 */
+	size_t names_data_size;
+
+	/* The allocated names data size
+	 */
+	size_t allocated_names_data_size;
+
+	/* The hash table
+	 * Contains the entry index + 1 or 0 for an unused entry, keyed on file reference
+	 */
+	uint32_t *hash_table;
+
+	/* The hash table size
+	 * Contains a power of 2
+	 */
+	uint32_t hash_table_size;
+
+	/* The cache entries
+	 */
+	libftxf_path_resolver_cache_entry_t *cache_entries;
+
+	/* The number of cache entries
+	 */
+	int number_of_cache_entries;
+
+	/* The cache hash buckets
+	 * Contains the index of the first cache entry in the bucket or -1 if none
+	 */
+	int *cache_hash_buckets;
+
+	/* The index of the most recently used cache entry or -1 if none
+	 */
+	int most_recently_used_index;
+
+	/* The index of the least recently used cache entry or -1 if none
+	 */
+	int least_recently_used_index;
+
+	/* The path buffer
+	 */
+	uint8_t *path_buffer;
+
+	/* The length of the path in the path buffer
+	 */
+	size_t path_length;
+
+	/* The allocated size of the path buffer
+	 */
+	size_t path_buffer_size;
+
+	/* The parent chain
+	 * Contains the indexes of the entries of the directories that are not cached
+	 */
+	uint32_t *parent_chain;
+
+	/* The allocated number of entries in the parent chain
+	 */
+	uint32_t allocated_parent_chain_size;
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the path resolver and its buffers
+	 */
+	libftxf_allocator_t allocator;
+};
+
+LIBFTXF_EXTERN \
+int libftxf_path_resolver_initialize(
+     libftxf_path_resolver_t **path_resolver,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_path_resolver_initialize_with_allocator(
+     libftxf_path_resolver_t **path_resolver,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_path_resolver_free(
+     libftxf_path_resolver_t **path_resolver,
+     libcerror_error_t **error );
+
+int libftxf_internal_path_resolver_resize_hash_table(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     libcerror_error_t **error );
+
+void libftxf_internal_path_resolver_clear_cache(
+      libftxf_internal_path_resolver_t *internal_path_resolver );
+
+LIBFTXF_EXTERN \
+int libftxf_path_resolver_append_entry(
+     libftxf_path_resolver_t *path_resolver,
+     uint64_t file_reference,
+     uint64_t parent_file_reference,
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_path_resolver_get_number_of_entries(
+     libftxf_path_resolver_t *path_resolver,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error );
+
+int libftxf_internal_path_resolver_get_entry_index(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     uint64_t file_reference,
+     uint32_t *entry_index );
+
+int libftxf_internal_path_resolver_append_path_segment(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     const uint8_t *segment,
+     size_t segment_length,
+     libcerror_error_t **error );
+
+int libftxf_internal_path_resolver_get_cache_entry(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     uint64_t file_reference,
+     int *cache_index );
+
+void libftxf_internal_path_resolver_use_cache_entry(
+      libftxf_internal_path_resolver_t *internal_path_resolver,
+      int cache_index );
+
+int libftxf_internal_path_resolver_cache_path(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     uint64_t file_reference,
+     libcerror_error_t **error );
+
+int libftxf_internal_path_resolver_resolve_directory(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     uint64_t file_reference,
+     libcerror_error_t **error );
+
+int libftxf_internal_path_resolver_resolve(
+     libftxf_internal_path_resolver_t *internal_path_resolver,
+     uint64_t file_reference,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_path_resolver_get_utf8_path_size(
+     libftxf_path_resolver_t *path_resolver,
+     uint64_t file_reference,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_path_resolver_get_utf8_path(
+     libftxf_path_resolver_t *path_resolver,
+     uint64_t file_reference,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_PATH_RESOLVER_H ) */
+
@@ -27,15 +27,20 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libftxf_allocator.h"
 #include "libftxf_debug.h"
 #include "libftxf_definitions.h"
+#include "libftxf_json.h"
 #include "libftxf_libcerror.h"
 #include "libftxf_libcnotify.h"
 #include "libftxf_libfdatetime.h"
 #include "libftxf_libfguid.h"
 #include "libftxf_libfusn.h"
 #include "libftxf_libuna.h"
+#include "libftxf_name.h"
 #include "libftxf_record.h"
+#include "libftxf_record_filter.h"
+#include "libftxf_record_hash.h"
 
 #include "ftxf_record.h"
 
@@ -46,9 +51,39 @@
 int libftxf_record_initialize(
      libftxf_record_t **record,
      libcerror_error_t **error )
+{
+	static char *function = "libftxf_record_initialize";
+
+	if( libftxf_record_initialize_with_allocator(
+	     record,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a record that allocates its memory using the allocator functions
+ * Make sure the value record is referencing, is set to NULL
+ * The allocator is copied into the record, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_initialize_with_allocator(
+     libftxf_record_t **record,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
 {
 	libftxf_internal_record_t *internal_record = NULL;
-	static char *function                      = "libftxf_record_initialize";
+	static char *function                      = "libftxf_record_initialize_with_allocator";
 
 	if( record == NULL )
 	{
@@ -72,8 +107,25 @@ int libftxf_record_initialize(
 
 		return( -1 );
 	}
-	internal_record = memory_allocate_structure(
-	                   libftxf_internal_record_t );
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_record = (libftxf_internal_record_t *) libftxf_allocator_allocate(
+	                                                 allocator,
+	                                                 sizeof( libftxf_internal_record_t ) );
 
 	if( internal_record == NULL )
 	{
@@ -100,6 +152,28 @@ int libftxf_record_initialize(
 
 		goto on_error;
 	}
+	internal_record->notify_verbose = LIBFTXF_NOTIFY_VERBOSE_DEFAULT;
+
+	if( allocator != NULL )
+	{
+		internal_record->allocator = *allocator;
+	}
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_record->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*record = (libftxf_record_t *) internal_record;
 
 	return( 1 );
@@ -107,7 +181,8 @@ int libftxf_record_initialize(
 on_error:
 	if( internal_record != NULL )
 	{
-		memory_free(
+		libftxf_allocator_free(
+		 allocator,
 		 internal_record );
 	}
 	return( -1 );
@@ -120,8 +195,11 @@ int libftxf_record_free(
      libftxf_record_t **record,
      libcerror_error_t **error )
 {
+	libftxf_allocator_t allocator;
+
 	libftxf_internal_record_t *internal_record = NULL;
 	static char *function                      = "libftxf_record_free";
+	int result                                 = 1;
 
 	if( record == NULL )
 	{
@@ -139,544 +217,1143 @@ int libftxf_record_free(
 		internal_record = (libftxf_internal_record_t *) *record;
 		*record         = NULL;
 
-		memory_free(
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_record->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_record->name != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_record->allocator ),
+			 internal_record->name );
+		}
+		if( internal_record->update_journal_entries != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_record->allocator ),
+			 internal_record->update_journal_entries );
+		}
+		if( internal_record->update_journal_entry_names != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_record->allocator ),
+			 internal_record->update_journal_entry_names );
+		}
+		/* The allocator is copied since it is stored in the record that is freed
+		 */
+		allocator = internal_record->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
 		 internal_record );
 	}
-	return( 1 );
+	return( result );
 }
 
-/* Reads the update journal entry list
+/* Sets the verbose notification of the record
+ * The verbose notification of the record overrides the library wide verbose notification
  * Returns 1 if successful or -1 on error
  */
-int libftxf_internal_record_read_update_journal_entry_list_data(
-     libftxf_internal_record_t *internal_record,
-     const uint8_t *record_data,
-     size_t record_data_size,
+int libftxf_record_set_notify_verbose(
+     libftxf_record_t *record,
+     int verbose,
      libcerror_error_t **error )
 {
-	libfusn_record_t *usn_record              = NULL;
-	static char *function                     = "libftxf_internal_record_read_update_journal_entry_list_data";
-	size_t record_data_offset                 = 0;
-	uint64_t record_chain_next_lsn            = 0;
-	uint32_t update_journal_entry_list_offset = 0;
-	uint32_t update_journal_entry_list_size   = 0;
-	uint32_t usn_record_size                  = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit                      = 0;
-#endif
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_set_notify_verbose";
 
-	if( internal_record == NULL )
+	if( record == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal record.",
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_data == NULL )
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( ( verbose != LIBFTXF_NOTIFY_VERBOSE_DEFAULT )
+	 && ( verbose != LIBFTXF_NOTIFY_VERBOSE_DISABLED )
+	 && ( verbose != LIBFTXF_NOTIFY_VERBOSE_ENABLED ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record data.",
-		 function );
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported verbose value: %d.",
+		 function,
+		 verbose );
 
 		return( -1 );
 	}
-	if( record_data_size > (size_t) SSIZE_MAX )
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid record data size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_data_size < ( sizeof( ftxf_record_header_t ) + 16 ) )
+#endif
+	internal_record->notify_verbose = verbose;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid record data value too small.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	record_data_offset = sizeof( ftxf_record_header_t );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: journal entry list data:\n",
-		 function );
-		libcnotify_print_data(
-		 &( record_data[ record_data_offset ] ),
-		 16,
-		 0 );
-	}
 #endif
-	byte_stream_copy_to_uint64_little_endian(
-	 &( record_data[ record_data_offset ] ),
-	 record_chain_next_lsn );
-
-	record_data_offset += 8;
-
-	byte_stream_copy_to_uint32_little_endian(
-	 &( record_data[ record_data_offset ] ),
-	 update_journal_entry_list_offset );
-
-	record_data_offset += 4;
-
-	byte_stream_copy_to_uint32_little_endian(
-	 &( record_data[ record_data_offset ] ),
-	 update_journal_entry_list_size );
+	return( 1 );
+}
 
-	record_data_offset += 4;
+/* Sets the name
+ * The name buffer is reused when the record is copied from another byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_record_set_name(
+     libftxf_internal_record_t *internal_record,
+     const uint8_t *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocated_name = NULL;
+	static char *function     = "libftxf_internal_record_set_name";
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( internal_record == NULL )
 	{
-		libcnotify_printf(
-		 "%s: next record lsn\t\t: 0x%08" PRIx64 "\n",
-		 function,
-		 record_chain_next_lsn );
-
-		libcnotify_printf(
-		 "%s: list entries offset\t: 0x%08" PRIx32 "\n",
-		 function,
-		 update_journal_entry_list_offset );
-
-		libcnotify_printf(
-		 "%s: list entries size\t\t: %" PRIu32 "\n",
-		 function,
-		 update_journal_entry_list_size );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal record.",
+		 function );
 
-		libcnotify_printf(
-		 "\n" );
+		return( -1 );
 	}
-#endif
-	if( ( (size_t) update_journal_entry_list_offset < record_data_offset )
-	 || ( (size_t) update_journal_entry_list_offset > record_data_size ) )
+	if( name == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: update journal entry list offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( (size_t) update_journal_entry_list_offset + (size_t) update_journal_entry_list_size ) < record_data_size )
+	if( ( name_size == 0 )
+	 || ( name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: update journal entry list size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( (size_t) update_journal_entry_list_offset > record_data_offset )
+	if( name_size > internal_record->allocated_name_size )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		reallocated_name = (uint8_t *) libftxf_allocator_reallocate(
+		                                &( internal_record->allocator ),
+		                                internal_record->name,
+		                                sizeof( uint8_t ) * name_size );
+
+		if( reallocated_name == NULL )
 		{
-			libcnotify_printf(
-			 "%s: update journal entry list trailing data:\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize name.",
 			 function );
-			libcnotify_print_data(
-			 &( record_data[ record_data_offset ] ),
-			 (size_t) update_journal_entry_list_offset - record_data_offset,
-			 0 );
+
+			return( -1 );
 		}
-#endif
-		record_data_offset = (size_t) update_journal_entry_list_offset;
+		internal_record->name                = reallocated_name;
+		internal_record->allocated_name_size = name_size;
 	}
-	while( record_data_offset < record_data_size )
+	if( memory_copy(
+	     internal_record->name,
+	     name,
+	     name_size ) == NULL )
 	{
-/* TODO print entry number */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		return( -1 );
+	}
+	internal_record->name_size = name_size;
+
+	return( 1 );
+}
+
+/* Appends the values of an USN record as an update journal entry
+ * The update journal entries are reused when the record is copied from another byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_record_append_update_journal_entry(
+     libftxf_internal_record_t *internal_record,
+     libfusn_record_t *usn_record,
+     libcerror_error_t **error )
+{
+	libftxf_update_journal_entry_t *reallocated_entries  = NULL;
+	libftxf_update_journal_entry_t *update_journal_entry = NULL;
+	uint8_t *reallocated_names                           = NULL;
+	static char *function                                = "libftxf_internal_record_append_update_journal_entry";
+	size_t allocated_names_size                          = 0;
+	size_t entries_size                                  = 0;
+	size_t name_size                                     = 0;
+	int number_of_allocated_entries                      = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->number_of_update_journal_entries >= internal_record->number_of_allocated_update_journal_entries )
+	{
+		if( internal_record->number_of_allocated_update_journal_entries >= ( INT_MAX / 2 ) )
 		{
-			libcnotify_printf(
-			 "%s: unknown:\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated update journal entries value exceeds maximum.",
 			 function );
-			libcnotify_print_data(
-			 &( record_data[ record_data_offset ] ),
-			 8,
-			 0 );
+
+			return( -1 );
 		}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( internal_record->number_of_allocated_update_journal_entries == 0 )
 		{
-			byte_stream_copy_to_uint64_little_endian(
-			 &( record_data[ record_data_offset ] ),
-			 value_64bit );
-			libcnotify_printf(
-			 "%s: unknown\t\t\t: 0x%08" PRIx64 "\n",
-			 function,
-			 value_64bit );
+			number_of_allocated_entries = 4;
 		}
-#endif
-		record_data_offset += 8;
+		else
+		{
+			number_of_allocated_entries = internal_record->number_of_allocated_update_journal_entries * 2;
+		}
+		entries_size = sizeof( libftxf_update_journal_entry_t ) * number_of_allocated_entries;
 
-		if( libfusn_record_initialize(
-		     &usn_record,
-		     error ) != 1 )
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create USN record.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid update journal entries size value exceeds maximum.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfusn_record_copy_from_byte_stream(
-		     usn_record,
-		     &( record_data[ record_data_offset ] ),
-		     record_data_size - record_data_offset,
-		     error ) != 1 )
+		reallocated_entries = (libftxf_update_journal_entry_t *) libftxf_allocator_reallocate(
+		                                                          &( internal_record->allocator ),
+		                                                          internal_record->update_journal_entries,
+		                                                          entries_size );
+
+		if( reallocated_entries == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read USN record.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize update journal entries.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfusn_record_get_size(
-		     usn_record,
-		     &usn_record_size,
-		     error ) != 1 )
+		internal_record->update_journal_entries                     = reallocated_entries;
+		internal_record->number_of_allocated_update_journal_entries = number_of_allocated_entries;
+	}
+	update_journal_entry = &( internal_record->update_journal_entries[ internal_record->number_of_update_journal_entries ] );
+
+	if( memory_set(
+	     update_journal_entry,
+	     0,
+	     sizeof( libftxf_update_journal_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear update journal entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_update_sequence_number(
+	     usn_record,
+	     &( update_journal_entry->update_sequence_number ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_update_time(
+	     usn_record,
+	     &( update_journal_entry->update_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_file_reference(
+	     usn_record,
+	     &( update_journal_entry->file_reference ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_parent_file_reference(
+	     usn_record,
+	     &( update_journal_entry->parent_file_reference ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_update_reason_flags(
+	     usn_record,
+	     &( update_journal_entry->update_reason_flags ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update reason flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_update_source_flags(
+	     usn_record,
+	     &( update_journal_entry->update_source_flags ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update source flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_file_attribute_flags(
+	     usn_record,
+	     &( update_journal_entry->file_attribute_flags ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file attribute flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_utf8_name_size(
+	     usn_record,
+	     &name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > 0 )
+	{
+		if( name_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - internal_record->update_journal_entry_names_size ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve USN record size.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 name size value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		record_data_offset += (size_t) usn_record_size;
+		if( ( internal_record->update_journal_entry_names_size + name_size ) > internal_record->allocated_update_journal_entry_names_size )
+		{
+			allocated_names_size = internal_record->allocated_update_journal_entry_names_size;
 
-/* TODO do something with USN records */
-		if( libfusn_record_free(
-		     &usn_record,
+			if( allocated_names_size == 0 )
+			{
+				allocated_names_size = 256;
+			}
+			while( allocated_names_size < ( internal_record->update_journal_entry_names_size + name_size ) )
+			{
+				if( allocated_names_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+				{
+					allocated_names_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+
+					break;
+				}
+				allocated_names_size *= 2;
+			}
+			reallocated_names = (uint8_t *) libftxf_allocator_reallocate(
+			                                 &( internal_record->allocator ),
+			                                 internal_record->update_journal_entry_names,
+			                                 sizeof( uint8_t ) * allocated_names_size );
+
+			if( reallocated_names == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize update journal entry names.",
+				 function );
+
+				return( -1 );
+			}
+			internal_record->update_journal_entry_names                = reallocated_names;
+			internal_record->allocated_update_journal_entry_names_size = allocated_names_size;
+		}
+		if( libfusn_record_get_utf8_name(
+		     usn_record,
+		     &( internal_record->update_journal_entry_names[ internal_record->update_journal_entry_names_size ] ),
+		     name_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free USN record.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-	}
-	return( 1 );
+		update_journal_entry->name_offset = internal_record->update_journal_entry_names_size;
+		update_journal_entry->name_size   = name_size;
 
-on_error:
-	if( usn_record != NULL )
-	{
-		libfusn_record_free(
-		 &usn_record,
-		 NULL );
+		internal_record->update_journal_entry_names_size += name_size;
 	}
-	return( -1 );
+	internal_record->number_of_update_journal_entries += 1;
+
+	return( 1 );
 }
 
-/* Copies the record from the byte stream
+/* Reads the update journal entry list
  * Returns 1 if successful or -1 on error
  */
-int libftxf_record_copy_from_byte_stream(
-     libftxf_record_t *record,
-     const uint8_t *byte_stream,
-     size_t byte_stream_size,
+int libftxf_internal_record_read_update_journal_entry_list_data(
+     libftxf_internal_record_t *internal_record,
+     const uint8_t *record_data,
+     size_t record_data_size,
      libcerror_error_t **error )
 {
-	libftxf_internal_record_t *internal_record = NULL;
-	static char *function                      = "libftxf_record_read";
-	size_t byte_stream_offset                  = 0;
-	uint16_t record_type                       = 0;
-	uint16_t name_offset                       = 0;
-	uint16_t name_size                         = 0;
+	libfusn_record_t *usn_record              = NULL;
+	static char *function                     = "libftxf_internal_record_read_update_journal_entry_list_data";
+	size_t record_data_offset                 = 0;
+	uint64_t record_chain_next_lsn            = 0;
+	uint32_t update_journal_entry_list_offset = 0;
+	uint32_t update_journal_entry_list_size   = 0;
+	uint32_t usn_record_size                  = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit                       = 0;
-	uint32_t value_32bit                       = 0;
-	uint16_t value_16bit                       = 0;
+	uint64_t value_64bit                      = 0;
 #endif
 
-	if( record == NULL )
+	if( internal_record == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid internal record.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libftxf_internal_record_t *) record;
-
-	if( byte_stream == NULL )
+	if( record_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid byte stream.",
+		 "%s: invalid record data.",
 		 function );
 
 		return( -1 );
 	}
-	if( byte_stream_size > (size_t) SSIZE_MAX )
+	if( record_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid byte stream size value exceeds maximum.",
+		 "%s: invalid record data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( byte_stream_size < sizeof( ftxf_record_header_t ) )
+	if( record_data_size < ( sizeof( ftxf_record_header_t ) + 16 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid byte stream value too small.",
+		 "%s: invalid record data value too small.",
 		 function );
 
 		return( -1 );
 	}
+	record_data_offset = sizeof( ftxf_record_header_t );
+
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
 	{
 		libcnotify_printf(
-		 "%s: record header data:\n",
+		 "%s: journal entry list data:\n",
 		 function );
 		libcnotify_print_data(
-		 byte_stream,
-		 sizeof( ftxf_record_header_t ),
+		 &( record_data[ record_data_offset ] ),
+		 16,
 		 0 );
 	}
 #endif
-	byte_stream_copy_to_uint16_little_endian(
-	 ( (ftxf_record_header_t *) byte_stream )->record_type,
-	 record_type );
+	byte_stream_copy_to_uint64_little_endian(
+	 &( record_data[ record_data_offset ] ),
+	 record_chain_next_lsn );
+
+	record_data_offset += 8;
 
 	byte_stream_copy_to_uint32_little_endian(
-	 ( (ftxf_record_header_t *) byte_stream )->record_size,
-	 internal_record->size );
+	 &( record_data[ record_data_offset ] ),
+	 update_journal_entry_list_offset );
+
+	record_data_offset += 4;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( record_data[ record_data_offset ] ),
+	 update_journal_entry_list_size );
+
+	record_data_offset += 4;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (ftxf_record_header_t *) byte_stream )->unknown1,
-		 value_32bit );
 		libcnotify_printf(
-		 "%s: unknown1\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 "%s: next record lsn\t\t: 0x%08" PRIx64 "\n",
 		 function,
-		 value_32bit );
+		 record_chain_next_lsn );
 
 		libcnotify_printf(
-		 "%s: record type\t\t\t\t\t: 0x%04" PRIx16 "\n",
+		 "%s: list entries offset\t: 0x%08" PRIx32 "\n",
 		 function,
-		 record_type );
+		 update_journal_entry_list_offset );
 
-		byte_stream_copy_to_uint16_little_endian(
-		 ( (ftxf_record_header_t *) byte_stream )->unknown2,
-		 value_16bit );
 		libcnotify_printf(
-		 "%s: unknown2\t\t\t\t\t\t: 0x%04" PRIx16 "\n",
+		 "%s: list entries size\t\t: %" PRIu32 "\n",
 		 function,
-		 value_16bit );
+		 update_journal_entry_list_size );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (ftxf_record_header_t *) byte_stream )->file_identifier,
-		 value_64bit );
 		libcnotify_printf(
-		 "%s: file identifier\t\t\t\t\t: 0x%08" PRIx64 "\n",
-		 function,
-		 value_64bit );
+		 "\n" );
+	}
+#endif
+	if( ( (size_t) update_journal_entry_list_offset < record_data_offset )
+	 || ( (size_t) update_journal_entry_list_offset > record_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: update journal entry list offset value out of bounds.",
+		 function );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (ftxf_record_header_t *) byte_stream )->file_reference,
-		 value_64bit );
-		libcnotify_printf(
-		 "%s: file reference\t\t\t\t\t: MFT entry: %" PRIu64 ", sequence: %" PRIu64 "\n",
-		 function,
-		 value_64bit & 0xffffffffffffUL,
-		 value_64bit >> 48 );
+		goto on_error;
+	}
+	if( ( (size_t) update_journal_entry_list_offset + (size_t) update_journal_entry_list_size ) < record_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: update journal entry list size value out of bounds.",
+		 function );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (ftxf_record_header_t *) byte_stream )->unknown4,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown4\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
+		goto on_error;
+	}
+	if( (size_t) update_journal_entry_list_offset > record_data_offset )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: update journal entry list trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( record_data[ record_data_offset ] ),
+			 (size_t) update_journal_entry_list_offset - record_data_offset,
+			 0 );
+		}
+#endif
+		record_data_offset = (size_t) update_journal_entry_list_offset;
+	}
+	while( record_data_offset < record_data_size )
+	{
+/* TODO print entry number */
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (ftxf_record_header_t *) byte_stream )->unknown5,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown5\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unknown:\n",
+			 function );
+			libcnotify_print_data(
+			 &( record_data[ record_data_offset ] ),
+			 8,
+			 0 );
+		}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( record_data[ record_data_offset ] ),
+			 value_64bit );
+			libcnotify_printf(
+			 "%s: unknown\t\t\t: 0x%08" PRIx64 "\n",
+			 function,
+			 value_64bit );
+		}
+#endif
+		record_data_offset += 8;
 
-		if( libftxf_debug_print_guid_value(
-		     function,
-		     "unknown6 guid\t\t\t\t\t",
-		     ( (ftxf_record_header_t *) byte_stream )->unknown6,
-		     16,
-		     LIBFGUID_ENDIAN_LITTLE,
-		     LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+		if( libfusn_record_initialize(
+		     &usn_record,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print GUID value.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create USN record.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (ftxf_record_header_t *) byte_stream )->unknown7,
-		 value_64bit );
-		libcnotify_printf(
-		 "%s: unknown7\t\t\t\t\t\t: 0x%08" PRIx64 "\n",
-		 function,
-		 value_64bit );
+		if( libfusn_record_copy_from_byte_stream(
+		     usn_record,
+		     &( record_data[ record_data_offset ] ),
+		     record_data_size - record_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read USN record.",
+			 function );
 
-		if( libftxf_debug_print_filetime_value(
-		     function,
-		     "unknown8 filetime\t\t\t\t\t",
-		     ( (ftxf_record_header_t *) byte_stream )->unknown8,
-		     8,
-		     LIBFDATETIME_ENDIAN_LITTLE,
-		     LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+			goto on_error;
+		}
+		if( libfusn_record_get_size(
+		     usn_record,
+		     &usn_record_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print FILETIME value.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve USN record size.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		libcnotify_printf(
-		 "%s: record size\t\t\t\t\t: %" PRIu32 "\n",
-		 function,
-		 internal_record->size );
+		if( libftxf_internal_record_append_update_journal_entry(
+		     internal_record,
+		     usn_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append update journal entry.",
+			 function );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (ftxf_record_header_t *) byte_stream )->unknown9,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown9\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
+			goto on_error;
+		}
+		record_data_offset += (size_t) usn_record_size;
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (ftxf_record_header_t *) byte_stream )->unknown10,
-		 value_64bit );
-		libcnotify_printf(
-		 "%s: unknown10\t\t\t\t\t\t: 0x%08" PRIx64 "\n",
-		 function,
-		 value_64bit );
+		if( libfusn_record_free(
+		     &usn_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free USN record.",
+			 function );
 
-		libcnotify_printf(
-		 "\n" );
+			goto on_error;
+		}
 	}
-#endif
-	byte_stream_offset = sizeof( ftxf_record_header_t );
+	return( 1 );
 
-	if( ( (size_t) internal_record->size < sizeof( ftxf_record_header_t ) )
-	 || ( (size_t) internal_record->size > byte_stream_size ) )
+on_error:
+	if( usn_record != NULL )
+	{
+		libfusn_record_free(
+		 &usn_record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Copies the record from the byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_copy_from_byte_stream(
+     libftxf_record_t *record,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_record_copy_from_byte_stream";
+
+	if( libftxf_record_copy_from_byte_stream_with_filter(
+	     record,
+	     byte_stream,
+	     byte_stream_size,
+	     NULL,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: record size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy record from byte stream.",
 		 function );
 
 		return( -1 );
 	}
-	switch( record_type )
+	return( 1 );
+}
+
+/* Copies the record from the byte stream if it matches the record filter
+ * Returns 1 if successful, 0 if the record does not match the filter or -1 on error
+ */
+int libftxf_internal_record_read_data(
+     libftxf_internal_record_t *internal_record,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libftxf_record_filter_t *record_filter,
+     libcerror_error_t **error )
+{
+	static char *function     = "libftxf_internal_record_read_data";
+	size_t byte_stream_offset = 0;
+	uint16_t record_type      = 0;
+	uint16_t name_offset      = 0;
+	uint16_t name_size        = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint64_t value_64bit      = 0;
+	uint32_t value_32bit      = 0;
+	uint16_t value_16bit      = 0;
+#endif
+
+	if( internal_record == NULL )
 	{
-		case LIBFTXF_RECORD_TYPE_UPDATE_JOURNAL_ENTRIES_LIST:
-			if( libftxf_internal_record_read_update_journal_entry_list_data(
-			     internal_record,
-			     byte_stream,
-			     (size_t) internal_record->size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read update journal entry list.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal record.",
+		 function );
 
-				return( -1 );
-			}
-			break;
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
 
-		default:
-			break;
+		return( -1 );
 	}
-/* TODO refactor */
-	if( record_type == LIBFTXF_RECORD_TYPE_UPDATE_JOURNAL_ENTRIES_LIST )
+	if( byte_stream_size > (size_t) SSIZE_MAX )
 	{
-		return( 1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < sizeof( ftxf_record_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream value too small.",
+		 function );
+
+		return( -1 );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
 	{
 		libcnotify_printf(
-		 "%s: record data:\n",
+		 "%s: record header data:\n",
 		 function );
 		libcnotify_print_data(
-		 &( byte_stream[ byte_stream_offset ] ),
-		 (size_t) internal_record->size - sizeof( ftxf_record_header_t ),
+		 byte_stream,
+		 sizeof( ftxf_record_header_t ),
 		 0 );
 	}
 #endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		byte_stream_copy_to_uint64_little_endian(
-		 &( byte_stream[ byte_stream_offset ] ),
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (ftxf_record_header_t *) byte_stream )->record_type,
+	 record_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ftxf_record_header_t *) byte_stream )->record_size,
+	 internal_record->size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (ftxf_record_header_t *) byte_stream )->unknown1,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown1\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: record type\t\t\t\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 record_type );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (ftxf_record_header_t *) byte_stream )->unknown2,
+		 value_16bit );
+		libcnotify_printf(
+		 "%s: unknown2\t\t\t\t\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 value_16bit );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ftxf_record_header_t *) byte_stream )->file_identifier,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: file identifier\t\t\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 value_64bit );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ftxf_record_header_t *) byte_stream )->file_reference,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: file reference\t\t\t\t\t: MFT entry: %" PRIu64 ", sequence: %" PRIu64 "\n",
+		 function,
+		 value_64bit & 0xffffffffffffUL,
+		 value_64bit >> 48 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (ftxf_record_header_t *) byte_stream )->unknown4,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown4\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (ftxf_record_header_t *) byte_stream )->unknown5,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown5\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		if( libftxf_debug_print_guid_value(
+		     function,
+		     "unknown6 guid\t\t\t\t\t",
+		     ( (ftxf_record_header_t *) byte_stream )->unknown6,
+		     16,
+		     LIBFGUID_ENDIAN_LITTLE,
+		     LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print GUID value.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ftxf_record_header_t *) byte_stream )->unknown7,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: unknown7\t\t\t\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 value_64bit );
+
+		if( libftxf_debug_print_filetime_value(
+		     function,
+		     "unknown8 filetime\t\t\t\t\t",
+		     ( (ftxf_record_header_t *) byte_stream )->unknown8,
+		     8,
+		     LIBFDATETIME_ENDIAN_LITTLE,
+		     LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print FILETIME value.",
+			 function );
+
+			return( -1 );
+		}
+		libcnotify_printf(
+		 "%s: record size\t\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 internal_record->size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (ftxf_record_header_t *) byte_stream )->unknown9,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown9\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ftxf_record_header_t *) byte_stream )->unknown10,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: unknown10\t\t\t\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 value_64bit );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	byte_stream_offset = sizeof( ftxf_record_header_t );
+
+	if( ( (size_t) internal_record->size < sizeof( ftxf_record_header_t ) )
+	 || ( (size_t) internal_record->size > byte_stream_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: record size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The values of the previous record are cleared before the filter is applied,
+	 * so that a record that does not match the filter does not expose them
+	 */
+	internal_record->content_hash                     = 0;
+	internal_record->record_type                      = record_type;
+	internal_record->flags                            = 0;
+	internal_record->name_size                        = 0;
+	internal_record->number_of_update_journal_entries = 0;
+	internal_record->update_journal_entry_names_size  = 0;
+
+	if( record_filter != NULL )
+	{
+		if( libftxf_internal_record_filter_match_header_data(
+		     (libftxf_internal_record_filter_t *) record_filter,
+		     byte_stream ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( libftxf_record_hash_calculate(
+	     &( internal_record->content_hash ),
+	     byte_stream,
+	     (size_t) internal_record->size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate content hash.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (ftxf_record_header_t *) byte_stream )->file_identifier,
+	 internal_record->file_identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (ftxf_record_header_t *) byte_stream )->file_reference,
+	 internal_record->file_reference );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (ftxf_record_header_t *) byte_stream )->unknown8,
+	 internal_record->timestamp );
+
+	if( memory_copy(
+	     internal_record->guid,
+	     ( (ftxf_record_header_t *) byte_stream )->unknown6,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID.",
+		 function );
+
+		return( -1 );
+	}
+	switch( record_type )
+	{
+		case LIBFTXF_RECORD_TYPE_UPDATE_JOURNAL_ENTRIES_LIST:
+			if( libftxf_internal_record_read_update_journal_entry_list_data(
+			     internal_record,
+			     byte_stream,
+			     (size_t) internal_record->size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read update journal entry list.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		default:
+			break;
+	}
+/* TODO refactor */
+	if( record_type == LIBFTXF_RECORD_TYPE_UPDATE_JOURNAL_ENTRIES_LIST )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
+	{
+		libcnotify_printf(
+		 "%s: record data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 (size_t) internal_record->size - sizeof( ftxf_record_header_t ),
+		 0 );
+	}
+#endif
+	if( record_type != 0x00 )
+	{
+		if( ( byte_stream_offset + 16 ) > (size_t) internal_record->size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: record size value too small.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
 		 value_64bit );
 		libcnotify_printf(
 		 "%s: unknown11\t\t\t\t\t\t: 0x%08" PRIx64 "\n",
@@ -693,7 +1370,7 @@ int libftxf_record_copy_from_byte_stream(
 		 name_size );
 
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
 		{
 			libcnotify_printf(
 			 "%s: name size\t\t\t\t\t\t: %" PRIu16 "\n",
@@ -709,16 +1386,16 @@ int libftxf_record_copy_from_byte_stream(
 		 &( byte_stream[ byte_stream_offset ] ),
 		 name_offset );
 
+		byte_stream_offset += 2;
+
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
 		{
 			libcnotify_printf(
 			 "%s: name offset\t\t\t\t\t: 0x%04" PRIx16 "\n",
 			 function,
 			 name_offset );
 
-			byte_stream_offset += 2;
-
 			byte_stream_copy_to_uint32_little_endian(
 			 &( byte_stream[ byte_stream_offset ] ),
 			 value_32bit );
@@ -726,29 +1403,68 @@ int libftxf_record_copy_from_byte_stream(
 			 "%s: unknown13\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
 			 function,
 			 value_32bit );
-
-			byte_stream_offset += 4;
 		}
 #endif
+		byte_stream_offset += 4;
 	}
 	if( record_type == 0x02 )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
 		{
 			libcnotify_printf(
 			 "...\n\n" );
-
 /* TODO print debug */
-			byte_stream_offset += 24;
 		}
 #endif
+		byte_stream_offset += 24;
 	}
 	if( ( record_type == 0x02 )
 	 || ( record_type == 0x07 ) )
 	{
+		if( ( byte_stream_offset + sizeof( ftxf_record_file_metadata_t ) ) > (size_t) internal_record->size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: record size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ftxf_record_file_metadata_t *) &( byte_stream[ byte_stream_offset ] ) )->creation_time,
+		 internal_record->file_metadata.creation_time );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ftxf_record_file_metadata_t *) &( byte_stream[ byte_stream_offset ] ) )->modification_time,
+		 internal_record->file_metadata.modification_time );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ftxf_record_file_metadata_t *) &( byte_stream[ byte_stream_offset ] ) )->entry_modification_time,
+		 internal_record->file_metadata.entry_modification_time );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ftxf_record_file_metadata_t *) &( byte_stream[ byte_stream_offset ] ) )->access_time,
+		 internal_record->file_metadata.access_time );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ftxf_record_file_metadata_t *) &( byte_stream[ byte_stream_offset ] ) )->allocated_file_size,
+		 internal_record->file_metadata.allocated_file_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ftxf_record_file_metadata_t *) &( byte_stream[ byte_stream_offset ] ) )->file_size,
+		 internal_record->file_metadata.file_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (ftxf_record_file_metadata_t *) &( byte_stream[ byte_stream_offset ] ) )->file_attribute_flags,
+		 internal_record->file_metadata.file_attribute_flags );
+
+		internal_record->flags |= LIBFTXF_RECORD_FLAG_HAS_FILE_METADATA;
+
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
 		{
 			if( libftxf_debug_print_filetime_value(
 			     function,
@@ -768,12 +1484,10 @@ int libftxf_record_copy_from_byte_stream(
 
 				return( -1 );
 			}
-			byte_stream_offset += 8;
-
 			if( libftxf_debug_print_filetime_value(
 			     function,
 			     "modification time\t\t\t\t\t",
-			     &( byte_stream[ byte_stream_offset ] ),
+			     &( byte_stream[ byte_stream_offset + 8 ] ),
 			     8,
 			     LIBFDATETIME_ENDIAN_LITTLE,
 			     LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
@@ -788,12 +1502,10 @@ int libftxf_record_copy_from_byte_stream(
 
 				return( -1 );
 			}
-			byte_stream_offset += 8;
-
 			if( libftxf_debug_print_filetime_value(
 			     function,
 			     "entry modification time\t\t\t\t",
-			     &( byte_stream[ byte_stream_offset ] ),
+			     &( byte_stream[ byte_stream_offset + 16 ] ),
 			     8,
 			     LIBFDATETIME_ENDIAN_LITTLE,
 			     LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
@@ -808,12 +1520,10 @@ int libftxf_record_copy_from_byte_stream(
 
 				return( -1 );
 			}
-			byte_stream_offset += 8;
-
 			if( libftxf_debug_print_filetime_value(
 			     function,
 			     "access time\t\t\t\t\t",
-			     &( byte_stream[ byte_stream_offset ] ),
+			     &( byte_stream[ byte_stream_offset + 24 ] ),
 			     8,
 			     LIBFDATETIME_ENDIAN_LITTLE,
 			     LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
@@ -828,66 +1538,53 @@ int libftxf_record_copy_from_byte_stream(
 
 				return( -1 );
 			}
-			byte_stream_offset += 8;
-
-			byte_stream_copy_to_uint64_little_endian(
-			 &( byte_stream[ byte_stream_offset ] ),
-			 value_64bit );
 			libcnotify_printf(
 			 "%s: allocated file size\t\t\t\t: %" PRIu64 "\n",
 			 function,
-			 value_64bit );
+			 internal_record->file_metadata.allocated_file_size );
 
-			byte_stream_offset += 8;
-
-			byte_stream_copy_to_uint64_little_endian(
-			 &( byte_stream[ byte_stream_offset ] ),
-			 value_64bit );
 			libcnotify_printf(
 			 "%s: file size\t\t\t\t\t\t: %" PRIu64 "\n",
 			 function,
-			 value_64bit );
-
-			byte_stream_offset += 8;
+			 internal_record->file_metadata.file_size );
 
-			byte_stream_copy_to_uint32_little_endian(
-			 &( byte_stream[ byte_stream_offset ] ),
-			 value_32bit );
 			libcnotify_printf(
 			 "%s: file attribute flags\t\t\t\t: 0x%08" PRIx32 "\n",
 			 function,
-			 value_32bit );
+			 internal_record->file_metadata.file_attribute_flags );
 			libftxf_debug_print_file_attribute_flags(
-			 value_32bit );
+			 internal_record->file_metadata.file_attribute_flags );
 			libcnotify_printf(
 			 "\n" );
 
-			byte_stream_offset += 4;
-
 			libcnotify_printf(
 			 "...\n\n" );
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		byte_stream_offset += sizeof( ftxf_record_file_metadata_t );
 	}
 	else if( record_type == 0x0b )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
 		{
-			byte_stream_copy_to_uint64_little_endian(
-			 &( byte_stream[ byte_stream_offset ] ),
-			 value_64bit );
-			libcnotify_printf(
-			 "%s: unknown14\t\t\t\t\t\t: 0x%08" PRIx64 "\n",
-			 function,
-			 value_64bit );
-
-			byte_stream_offset += 8;
+			if( ( byte_stream_offset + 8 ) <= (size_t) internal_record->size )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( byte_stream[ byte_stream_offset ] ),
+				 value_64bit );
+				libcnotify_printf(
+				 "%s: unknown14\t\t\t\t\t\t: 0x%08" PRIx64 "\n",
+				 function,
+				 value_64bit );
+			}
 		}
 #endif
+		byte_stream_offset += 8;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
-	else if( libcnotify_verbose != 0 )
+	else if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
 	{
 		libcnotify_printf(
 		 "...\n\n" );
@@ -899,11 +1596,21 @@ int libftxf_record_copy_from_byte_stream(
 	}
 	if( name_size > 0 )
 	{
-		/* TODO check if name size is within bounds */
-		/* TODO check if name offset is within bounds */
+		if( ( (size_t) name_offset < sizeof( ftxf_record_header_t ) )
+		 || ( (size_t) name_offset > (size_t) internal_record->size )
+		 || ( (size_t) name_size > ( (size_t) internal_record->size - name_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: name offset or size value out of bounds.",
+			 function );
 
+			return( -1 );
+		}
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
 		{
 			if( libftxf_debug_print_utf16_string_value(
 			     function,
@@ -924,9 +1631,25 @@ int libftxf_record_copy_from_byte_stream(
 			}
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		if( libftxf_internal_record_set_name(
+		     internal_record,
+		     &( byte_stream[ name_offset ] ),
+		     (size_t) name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name.",
+			 function );
+
+			return( -1 );
+		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libftxf_internal_record_notify_verbose( internal_record ) != 0 )
 	{
 		libcnotify_printf(
 		 "\n" );
@@ -935,3 +1658,2079 @@ int libftxf_record_copy_from_byte_stream(
 	return( 1 );
 }
 
+/* Copies the record from the byte stream if it matches the record filter
+ * The record filter is evaluated on the record header before the record data is read
+ * If the record does not match only the record size is set, to allow the caller to skip the record
+ * Returns 1 if successful, 0 if the record does not match the filter or -1 on error
+ */
+int libftxf_record_copy_from_byte_stream_with_filter(
+     libftxf_record_t *record,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libftxf_record_filter_t *record_filter,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_copy_from_byte_stream_with_filter";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libftxf_internal_record_read_data(
+	          internal_record,
+	          byte_stream,
+	          byte_stream_size,
+	          record_filter,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record data.",
+		 function );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_get_size(
+     libftxf_record_t *record,
+     uint32_t *size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_get_size";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*size = internal_record->size;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the content hash
+ * The content hash is the 64-bit xxHash (XXH64) of the record data, records with
+ * the same content hash and size can be considered duplicates
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_get_content_hash(
+     libftxf_record_t *record,
+     uint64_t *content_hash,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_get_content_hash";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( content_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid content hash.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*content_hash = internal_record->content_hash;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the type
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_get_type(
+     libftxf_record_t *record,
+     uint16_t *type,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_get_type";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*type = internal_record->record_type;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the file identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_get_file_identifier(
+     libftxf_record_t *record,
+     uint64_t *file_identifier,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_get_file_identifier";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( file_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file identifier.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*file_identifier = internal_record->file_identifier;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the file reference
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_get_file_reference(
+     libftxf_record_t *record,
+     uint64_t *file_reference,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_get_file_reference";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*file_reference = internal_record->file_reference;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the (header) timestamp
+ * The timestamp is a FILETIME value
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_get_timestamp(
+     libftxf_record_t *record,
+     uint64_t *timestamp,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_get_timestamp";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*timestamp = internal_record->timestamp;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the (header) GUID
+ * The GUID is stored as a little-endian 16-byte sequence
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_get_guid(
+     libftxf_record_t *record,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_get_guid";
+	int result                                 = 1;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guid_data_size < 16 )
+	 || ( guid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( memory_copy(
+	     guid_data,
+	     internal_record->guid,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file metadata
+ * The file metadata is only available for records of type 0x02 and 0x07
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libftxf_record_get_file_metadata(
+     libftxf_record_t *record,
+     libftxf_file_metadata_t *file_metadata,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_get_file_metadata";
+	int result                                 = 1;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( file_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metadata.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_record->flags & LIBFTXF_RECORD_FLAG_HAS_FILE_METADATA ) == 0 )
+	{
+		result = 0;
+	}
+	else if( memory_copy(
+	          file_metadata,
+	          &( internal_record->file_metadata ),
+	          sizeof( libftxf_file_metadata_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file metadata.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libftxf_record_get_utf8_name_size(
+     libftxf_record_t *record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_get_utf8_name_size";
+	int result                                 = 1;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_record->name_size == 0 )
+	{
+		result = 0;
+	}
+	else if( libftxf_name_get_utf8_string_size(
+	          internal_record->name,
+	          internal_record->name_size,
+	          utf8_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libftxf_record_get_utf8_name(
+     libftxf_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_get_utf8_name";
+	int result                                 = 1;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_record->name_size == 0 )
+	{
+		result = 0;
+	}
+	else if( libftxf_name_copy_to_utf8_string(
+	          internal_record->name,
+	          internal_record->name_size,
+	          utf8_string,
+	          utf8_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to UTF-8 string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libftxf_record_get_utf16_name_size(
+     libftxf_record_t *record,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_get_utf16_name_size";
+	int result                                 = 1;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_record->name_size == 0 )
+	{
+		result = 0;
+	}
+	else if( libftxf_name_get_utf16_string_size(
+	          internal_record->name,
+	          internal_record->name_size,
+	          utf16_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libftxf_record_get_utf16_name(
+     libftxf_record_t *record,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_get_utf16_name";
+	int result                                 = 1;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_record->name_size == 0 )
+	{
+		result = 0;
+	}
+	else if( libftxf_name_copy_to_utf16_string(
+	          internal_record->name,
+	          internal_record->name_size,
+	          utf16_string,
+	          utf16_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to UTF-16 string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of update journal (USN) entries
+ * Only update journal entries list records (type 0x17) contain update journal entries
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_get_number_of_update_journal_entries(
+     libftxf_record_t *record,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record = NULL;
+	static char *function                      = "libftxf_record_get_number_of_update_journal_entries";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_entries = internal_record->number_of_update_journal_entries;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific update journal (USN) entry
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_record_get_update_journal_entry_by_index(
+     libftxf_internal_record_t *internal_record,
+     int entry_index,
+     libftxf_update_journal_entry_t **update_journal_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_internal_record_get_update_journal_entry_by_index";
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_record->number_of_update_journal_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_journal_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update journal entry.",
+		 function );
+
+		return( -1 );
+	}
+	*update_journal_entry = &( internal_record->update_journal_entries[ entry_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the values of a specific update journal (USN) entry
+ * The update time is a FILETIME value
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_get_update_journal_entry_values(
+     libftxf_record_t *record,
+     int entry_index,
+     uint64_t *update_sequence_number,
+     uint64_t *update_time,
+     uint64_t *file_reference,
+     uint64_t *parent_file_reference,
+     uint32_t *update_reason_flags,
+     uint32_t *update_source_flags,
+     uint32_t *file_attribute_flags,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record           = NULL;
+	libftxf_update_journal_entry_t *update_journal_entry = NULL;
+	static char *function                                = "libftxf_record_get_update_journal_entry_values";
+	int result                                           = 1;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( update_sequence_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update time.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_reason_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update reason flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_source_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update source flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_attribute_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file attribute flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libftxf_internal_record_get_update_journal_entry_by_index(
+	     internal_record,
+	     entry_index,
+	     &update_journal_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update journal entry: %d.",
+		 function,
+		 entry_index );
+
+		result = -1;
+	}
+	else
+	{
+		*update_sequence_number = update_journal_entry->update_sequence_number;
+		*update_time            = update_journal_entry->update_time;
+		*file_reference         = update_journal_entry->file_reference;
+		*parent_file_reference  = update_journal_entry->parent_file_reference;
+		*update_reason_flags    = update_journal_entry->update_reason_flags;
+		*update_source_flags    = update_journal_entry->update_source_flags;
+		*file_attribute_flags   = update_journal_entry->file_attribute_flags;
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded name of a specific update journal (USN) entry
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libftxf_record_get_update_journal_entry_utf8_name_size(
+     libftxf_record_t *record,
+     int entry_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record           = NULL;
+	libftxf_update_journal_entry_t *update_journal_entry = NULL;
+	static char *function                                = "libftxf_record_get_update_journal_entry_utf8_name_size";
+	int result                                           = 1;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libftxf_internal_record_get_update_journal_entry_by_index(
+	     internal_record,
+	     entry_index,
+	     &update_journal_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update journal entry: %d.",
+		 function,
+		 entry_index );
+
+		result = -1;
+	}
+	else if( update_journal_entry->name_size == 0 )
+	{
+		result = 0;
+	}
+	else
+	{
+		*utf8_string_size = update_journal_entry->name_size;
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded name of a specific update journal (USN) entry
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libftxf_record_get_update_journal_entry_utf8_name(
+     libftxf_record_t *record,
+     int entry_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record           = NULL;
+	libftxf_update_journal_entry_t *update_journal_entry = NULL;
+	static char *function                                = "libftxf_record_get_update_journal_entry_utf8_name";
+	int result                                           = 1;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libftxf_internal_record_get_update_journal_entry_by_index(
+	     internal_record,
+	     entry_index,
+	     &update_journal_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update journal entry: %d.",
+		 function,
+		 entry_index );
+
+		result = -1;
+	}
+	else if( update_journal_entry->name_size == 0 )
+	{
+		result = 0;
+	}
+	else if( utf8_string_size < update_journal_entry->name_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		result = -1;
+	}
+	else if( memory_copy(
+	          utf8_string,
+	          &( internal_record->update_journal_entry_names[ update_journal_entry->name_offset ] ),
+	          update_journal_entry->name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Copies the record to an UTF-8 encoded JSON string
+ * The record is written as a single JSON object followed by a line feed, which makes
+ * consecutive records form JSON Lines, the string is not terminated by an end-of-string character
+ * Returns 1 if successful, 0 if the UTF-8 string is too small or -1 on error
+ */
+int libftxf_record_copy_to_utf8_json_string_with_index(
+     libftxf_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record           = NULL;
+	libftxf_update_journal_entry_t *update_journal_entry = NULL;
+	static char *function                                = "libftxf_record_copy_to_utf8_json_string_with_index";
+	size_t safe_utf8_string_index                        = 0;
+	int entry_index                                      = 0;
+	int result                                           = 1;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *utf8_string_index > utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	safe_utf8_string_index = *utf8_string_index;
+
+	if( result == 1 )
+	{
+		result = libftxf_json_append_characters(
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          "{\"record_type\":",
+		          15 );
+	}
+	if( result == 1 )
+	{
+		result = libftxf_json_append_integer(
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          internal_record->record_type );
+	}
+	if( result == 1 )
+	{
+		result = libftxf_json_append_characters(
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          ",\"record_size\":",
+		          15 );
+	}
+	if( result == 1 )
+	{
+		result = libftxf_json_append_integer(
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          internal_record->size );
+	}
+	if( result == 1 )
+	{
+		result = libftxf_json_append_characters(
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          ",\"file_identifier\":",
+		          19 );
+	}
+	if( result == 1 )
+	{
+		result = libftxf_json_append_integer(
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          internal_record->file_identifier );
+	}
+	if( result == 1 )
+	{
+		result = libftxf_json_append_characters(
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          ",\"file_reference\":",
+		          18 );
+	}
+	if( result == 1 )
+	{
+		result = libftxf_json_append_integer(
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          internal_record->file_reference );
+	}
+	if( result == 1 )
+	{
+		result = libftxf_json_append_characters(
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          ",\"guid\":",
+		          8 );
+	}
+	if( result == 1 )
+	{
+		result = libftxf_json_append_guid(
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          internal_record->guid );
+	}
+	if( result == 1 )
+	{
+		result = libftxf_json_append_characters(
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          ",\"timestamp\":",
+		          13 );
+	}
+	if( result == 1 )
+	{
+		result = libftxf_json_append_integer(
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          internal_record->timestamp );
+	}
+	if( internal_record->name_size > 0 )
+	{
+		if( result == 1 )
+		{
+			result = libftxf_json_append_characters(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          ",\"name\":",
+			          8 );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_utf16_stream(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          internal_record->name,
+			          internal_record->name_size );
+		}
+	}
+	if( ( internal_record->flags & LIBFTXF_RECORD_FLAG_HAS_FILE_METADATA ) != 0 )
+	{
+		if( result == 1 )
+		{
+			result = libftxf_json_append_characters(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          ",\"creation_time\":",
+			          17 );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_integer(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          internal_record->file_metadata.creation_time );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_characters(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          ",\"modification_time\":",
+			          21 );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_integer(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          internal_record->file_metadata.modification_time );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_characters(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          ",\"entry_modification_time\":",
+			          27 );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_integer(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          internal_record->file_metadata.entry_modification_time );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_characters(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          ",\"access_time\":",
+			          15 );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_integer(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          internal_record->file_metadata.access_time );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_characters(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          ",\"allocated_file_size\":",
+			          23 );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_integer(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          internal_record->file_metadata.allocated_file_size );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_characters(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          ",\"file_size\":",
+			          13 );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_integer(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          internal_record->file_metadata.file_size );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_characters(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          ",\"file_attribute_flags\":",
+			          24 );
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_integer(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          internal_record->file_metadata.file_attribute_flags );
+		}
+	}
+	if( internal_record->number_of_update_journal_entries > 0 )
+	{
+		if( result == 1 )
+		{
+			result = libftxf_json_append_characters(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          ",\"update_journal_entries\":[",
+			          27 );
+		}
+		for( entry_index = 0;
+		     entry_index < internal_record->number_of_update_journal_entries;
+		     entry_index++ )
+		{
+			update_journal_entry = &( internal_record->update_journal_entries[ entry_index ] );
+
+			if( ( result == 1 )
+			 && ( entry_index > 0 ) )
+			{
+				result = libftxf_json_append_characters(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          ",",
+				          1 );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_characters(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          "{\"update_sequence_number\":",
+				          26 );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_integer(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          update_journal_entry->update_sequence_number );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_characters(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          ",\"update_time\":",
+				          15 );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_integer(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          update_journal_entry->update_time );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_characters(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          ",\"file_reference\":",
+				          18 );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_integer(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          update_journal_entry->file_reference );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_characters(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          ",\"parent_file_reference\":",
+				          25 );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_integer(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          update_journal_entry->parent_file_reference );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_characters(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          ",\"update_reason_flags\":",
+				          23 );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_integer(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          update_journal_entry->update_reason_flags );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_characters(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          ",\"update_source_flags\":",
+				          23 );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_integer(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          update_journal_entry->update_source_flags );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_characters(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          ",\"file_attribute_flags\":",
+				          24 );
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_integer(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          update_journal_entry->file_attribute_flags );
+			}
+			if( update_journal_entry->name_size > 1 )
+			{
+				if( result == 1 )
+				{
+					result = libftxf_json_append_characters(
+					          utf8_string,
+					          utf8_string_size,
+					          &safe_utf8_string_index,
+					          ",\"name\":",
+					          8 );
+				}
+				if( result == 1 )
+				{
+					result = libftxf_json_append_utf8_string(
+					          utf8_string,
+					          utf8_string_size,
+					          &safe_utf8_string_index,
+					          &( internal_record->update_journal_entry_names[ update_journal_entry->name_offset ] ),
+					          update_journal_entry->name_size - 1 );
+				}
+			}
+			if( result == 1 )
+			{
+				result = libftxf_json_append_characters(
+				          utf8_string,
+				          utf8_string_size,
+				          &safe_utf8_string_index,
+				          "}",
+				          1 );
+			}
+		}
+		if( result == 1 )
+		{
+			result = libftxf_json_append_characters(
+			          utf8_string,
+			          utf8_string_size,
+			          &safe_utf8_string_index,
+			          "]",
+			          1 );
+		}
+	}
+	if( result == 1 )
+	{
+		result = libftxf_json_append_characters(
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          "}\n",
+		          2 );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		return( 0 );
+	}
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+}
+
@@ -25,9 +25,14 @@
 #include <common.h>
 #include <types.h>
 
+#include "libftxf_definitions.h"
 #include "libftxf_extern.h"
 #include "libftxf_libcerror.h"
+#include "libftxf_libcnotify.h"
+#include "libftxf_libcthreads.h"
+#include "libftxf_libfusn.h"
 #include "libftxf_types.h"
+#include "libftxf_update_journal_entry.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -40,18 +45,139 @@ struct libftxf_internal_record
 	/* The size
 	 */
 	uint32_t size;
+
+	/* The content hash
+	 * Contains the hash of the record data
+	 */
+	uint64_t content_hash;
+
+	/* The record type
+	 */
+	uint16_t record_type;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The file identifier
+	 */
+	uint64_t file_identifier;
+
+	/* The file reference
+	 */
+	uint64_t file_reference;
+
+	/* The (header) GUID
+	 */
+	uint8_t guid[ 16 ];
+
+	/* The (header) timestamp
+	 * Contains a FILETIME
+	 */
+	uint64_t timestamp;
+
+	/* The name
+	 * Contains an UTF-16 little-endian string without end-of-string character
+	 */
+	uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The allocated name size
+	 */
+	size_t allocated_name_size;
+
+	/* The file metadata
+	 * Only set for records of type 0x02 and 0x07
+	 */
+	libftxf_file_metadata_t file_metadata;
+
+	/* The update journal entries
+	 */
+	libftxf_update_journal_entry_t *update_journal_entries;
+
+	/* The number of update journal entries
+	 */
+	int number_of_update_journal_entries;
+
+	/* The number of allocated update journal entries
+	 */
+	int number_of_allocated_update_journal_entries;
+
+	/* The update journal entry names
+	 * Contains the UTF-8 encoded names including end-of-string character
+	 */
+	uint8_t *update_journal_entry_names;
+
+	/* The update journal entry names size
+	 */
+	size_t update_journal_entry_names_size;
+
+	/* The allocated update journal entry names size
+	 */
+	size_t allocated_update_journal_entry_names_size;
+
+	/* The verbose notification
+	 * LIBFTXF_NOTIFY_VERBOSE_DEFAULT if the library wide verbose notification is used
+	 */
+	int notify_verbose;
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the record and its buffers
+	 */
+	libftxf_allocator_t allocator;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
+#if defined( HAVE_DEBUG_OUTPUT )
+
+/* Determines if verbose notification is enabled for the record
+ */
+#define libftxf_internal_record_notify_verbose( internal_record ) \
+	( ( ( internal_record )->notify_verbose == LIBFTXF_NOTIFY_VERBOSE_DEFAULT ) ? libcnotify_verbose : ( internal_record )->notify_verbose )
+
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
 LIBFTXF_EXTERN \
 int libftxf_record_initialize(
      libftxf_record_t **txf_record,
      libcerror_error_t **error );
 
+LIBFTXF_EXTERN \
+int libftxf_record_initialize_with_allocator(
+     libftxf_record_t **txf_record,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
 LIBFTXF_EXTERN \
 int libftxf_record_free(
      libftxf_record_t **txf_record,
      libcerror_error_t **error );
 
+LIBFTXF_EXTERN \
+int libftxf_record_set_notify_verbose(
+     libftxf_record_t *txf_record,
+     int verbose,
+     libcerror_error_t **error );
+
+int libftxf_internal_record_set_name(
+     libftxf_internal_record_t *internal_record,
+     const uint8_t *name,
+     size_t name_size,
+     libcerror_error_t **error );
+
+int libftxf_internal_record_append_update_journal_entry(
+     libftxf_internal_record_t *internal_record,
+     libfusn_record_t *usn_record,
+     libcerror_error_t **error );
+
 int libftxf_internal_record_read_update_journal_entry_list_data(
      libftxf_internal_record_t *internal_record,
      const uint8_t *data,
@@ -65,6 +191,144 @@ int libftxf_record_copy_from_byte_stream(
      size_t byte_stream_size,
      libcerror_error_t **error );
 
+int libftxf_internal_record_read_data(
+     libftxf_internal_record_t *internal_record,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libftxf_record_filter_t *record_filter,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_copy_from_byte_stream_with_filter(
+     libftxf_record_t *txf_record,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libftxf_record_filter_t *record_filter,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_size(
+     libftxf_record_t *txf_record,
+     uint32_t *size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_content_hash(
+     libftxf_record_t *txf_record,
+     uint64_t *content_hash,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_type(
+     libftxf_record_t *txf_record,
+     uint16_t *type,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_file_identifier(
+     libftxf_record_t *txf_record,
+     uint64_t *file_identifier,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_file_reference(
+     libftxf_record_t *txf_record,
+     uint64_t *file_reference,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_timestamp(
+     libftxf_record_t *txf_record,
+     uint64_t *timestamp,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_guid(
+     libftxf_record_t *txf_record,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_file_metadata(
+     libftxf_record_t *txf_record,
+     libftxf_file_metadata_t *file_metadata,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_utf8_name_size(
+     libftxf_record_t *txf_record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_utf8_name(
+     libftxf_record_t *txf_record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_utf16_name_size(
+     libftxf_record_t *txf_record,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_utf16_name(
+     libftxf_record_t *txf_record,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_number_of_update_journal_entries(
+     libftxf_record_t *txf_record,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libftxf_internal_record_get_update_journal_entry_by_index(
+     libftxf_internal_record_t *internal_record,
+     int entry_index,
+     libftxf_update_journal_entry_t **update_journal_entry,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_update_journal_entry_values(
+     libftxf_record_t *txf_record,
+     int entry_index,
+     uint64_t *update_sequence_number,
+     uint64_t *update_time,
+     uint64_t *file_reference,
+     uint64_t *parent_file_reference,
+     uint32_t *update_reason_flags,
+     uint32_t *update_source_flags,
+     uint32_t *file_attribute_flags,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_update_journal_entry_utf8_name_size(
+     libftxf_record_t *txf_record,
+     int entry_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_get_update_journal_entry_utf8_name(
+     libftxf_record_t *txf_record,
+     int entry_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_copy_to_utf8_json_string_with_index(
+     libftxf_record_t *txf_record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
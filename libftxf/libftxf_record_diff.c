@@ -0,0 +1,730 @@
+/*
+ * Record diff functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_record_diff.h"
+#include "libftxf_record_hash.h"
+
+/* The initial allocated number of entries
+ */
+#define LIBFTXF_RECORD_DIFF_INITIAL_NUMBER_OF_ENTRIES	1024
+
+/* The initial hash table size, must be a power of 2
+ */
+#define LIBFTXF_RECORD_DIFF_INITIAL_HASH_TABLE_SIZE	4096
+
+/* The record diff compares the records of an old log, such as a log in a volume snapshot,
+ * with those of a new log, such as the live log, in linear time. Only a hash, the offset
+ * and the size of every record of the old log are stored, the records of the new log
+ * are matched one at a time. Records are considered equal if the hash and size of their
+ * data are equal.
+ */
+
+/* Creates a record diff
+ * Make sure the value record_diff is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_diff_initialize(
+     libftxf_record_diff_t **record_diff,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_record_diff_initialize";
+
+	if( libftxf_record_diff_initialize_with_allocator(
+	     record_diff,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record diff.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a record diff that allocates its memory using the allocator functions
+ * Make sure the value record_diff is referencing, is set to NULL
+ * The allocator is copied into the record diff, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_diff_initialize_with_allocator(
+     libftxf_record_diff_t **record_diff,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_diff_t *internal_record_diff = NULL;
+	static char *function                                = "libftxf_record_diff_initialize_with_allocator";
+
+	if( record_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_diff != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record diff value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_record_diff = (libftxf_internal_record_diff_t *) libftxf_allocator_allocate(
+	                                                           allocator,
+	                                                           sizeof( libftxf_internal_record_diff_t ) );
+
+	if( internal_record_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record diff.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_diff,
+	     0,
+	     sizeof( libftxf_internal_record_diff_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record diff.",
+		 function );
+
+		libftxf_allocator_free(
+		 allocator,
+		 internal_record_diff );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		internal_record_diff->allocator = *allocator;
+	}
+	internal_record_diff->hash_table_size = LIBFTXF_RECORD_DIFF_INITIAL_HASH_TABLE_SIZE;
+
+	internal_record_diff->hash_table = (uint32_t *) libftxf_allocator_allocate(
+	                                                 &( internal_record_diff->allocator ),
+	                                                 sizeof( uint32_t ) * internal_record_diff->hash_table_size );
+
+	if( internal_record_diff->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_diff->hash_table,
+	     0,
+	     sizeof( uint32_t ) * internal_record_diff->hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		goto on_error;
+	}
+	*record_diff = (libftxf_record_diff_t *) internal_record_diff;
+
+	return( 1 );
+
+on_error:
+	if( internal_record_diff != NULL )
+	{
+		if( internal_record_diff->hash_table != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_record_diff->allocator ),
+			 internal_record_diff->hash_table );
+		}
+		libftxf_allocator_free(
+		 allocator,
+		 internal_record_diff );
+	}
+	return( -1 );
+}
+
+/* Frees a record diff
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_diff_free(
+     libftxf_record_diff_t **record_diff,
+     libcerror_error_t **error )
+{
+	libftxf_allocator_t allocator;
+
+	libftxf_internal_record_diff_t *internal_record_diff = NULL;
+	static char *function                                = "libftxf_record_diff_free";
+
+	if( record_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_diff != NULL )
+	{
+		internal_record_diff = (libftxf_internal_record_diff_t *) *record_diff;
+		*record_diff         = NULL;
+
+		if( internal_record_diff->entries != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_record_diff->allocator ),
+			 internal_record_diff->entries );
+		}
+		libftxf_allocator_free(
+		 &( internal_record_diff->allocator ),
+		 internal_record_diff->hash_table );
+
+		/* The allocator is copied since it is stored in the record diff that is freed
+		 */
+		allocator = internal_record_diff->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
+		 internal_record_diff );
+	}
+	return( 1 );
+}
+
+/* Doubles the size of the hash table and re-inserts the entries
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_record_diff_resize_hash_table(
+     libftxf_internal_record_diff_t *internal_record_diff,
+     libcerror_error_t **error )
+{
+	uint32_t *hash_table      = NULL;
+	static char *function     = "libftxf_internal_record_diff_resize_hash_table";
+	uint32_t entry_index      = 0;
+	uint32_t hash_table_index = 0;
+	uint32_t hash_table_mask  = 0;
+	uint32_t hash_table_size  = 0;
+
+	if( internal_record_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_record_diff->hash_table_size > ( (uint32_t) INT32_MAX ) )
+	 || ( (size_t) internal_record_diff->hash_table_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( uint32_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record diff - hash table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_size = internal_record_diff->hash_table_size * 2;
+	hash_table_mask = hash_table_size - 1;
+
+	hash_table = (uint32_t *) libftxf_allocator_allocate(
+	                           &( internal_record_diff->allocator ),
+	                           sizeof( uint32_t ) * hash_table_size );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( uint32_t ) * hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		libftxf_allocator_free(
+		 &( internal_record_diff->allocator ),
+		 hash_table );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_record_diff->number_of_entries;
+	     entry_index++ )
+	{
+		hash_table_index = (uint32_t) internal_record_diff->entries[ entry_index ].hash & hash_table_mask;
+
+		while( hash_table[ hash_table_index ] != 0 )
+		{
+			hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+		}
+		hash_table[ hash_table_index ] = entry_index + 1;
+	}
+	libftxf_allocator_free(
+	 &( internal_record_diff->allocator ),
+	 internal_record_diff->hash_table );
+
+	internal_record_diff->hash_table      = hash_table;
+	internal_record_diff->hash_table_size = hash_table_size;
+
+	return( 1 );
+}
+
+/* Appends the data of a record of the old log
+ * Records that are stored multiple times in the old log are appended multiple times
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_diff_append_old_record_data(
+     libftxf_record_diff_t *record_diff,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint64_t record_offset,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_diff_t *internal_record_diff = NULL;
+	libftxf_record_diff_entry_t *entry                   = NULL;
+	void *reallocation                                   = NULL;
+	static char *function                                = "libftxf_record_diff_append_old_record_data";
+	uint64_t hash                                        = 0;
+	uint32_t allocated_number_of_entries                 = 0;
+	uint32_t entry_index                                 = 0;
+	uint32_t hash_table_index                            = 0;
+	uint32_t hash_table_mask                             = 0;
+
+	if( record_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_diff = (libftxf_internal_record_diff_t *) record_diff;
+
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_size == 0 )
+	 || ( record_data_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_diff->number_of_entries >= ( (uint32_t) INT32_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record diff - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_diff->number_of_entries >= internal_record_diff->allocated_number_of_entries )
+	{
+		allocated_number_of_entries = internal_record_diff->allocated_number_of_entries * 2;
+
+		if( allocated_number_of_entries == 0 )
+		{
+			allocated_number_of_entries = LIBFTXF_RECORD_DIFF_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		if( (size_t) allocated_number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libftxf_record_diff_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = libftxf_allocator_reallocate(
+		                &( internal_record_diff->allocator ),
+		                internal_record_diff->entries,
+		                sizeof( libftxf_record_diff_entry_t ) * allocated_number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_record_diff->entries                     = (libftxf_record_diff_entry_t *) reallocation;
+		internal_record_diff->allocated_number_of_entries = allocated_number_of_entries;
+	}
+	if( libftxf_record_hash_calculate(
+	     &hash,
+	     record_data,
+	     record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate record hash.",
+		 function );
+
+		return( -1 );
+	}
+
+	hash_table_mask  = internal_record_diff->hash_table_size - 1;
+	hash_table_index = (uint32_t) hash & hash_table_mask;
+
+	while( internal_record_diff->hash_table[ hash_table_index ] != 0 )
+	{
+		hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+	}
+	entry_index = internal_record_diff->number_of_entries;
+	entry       = &( internal_record_diff->entries[ entry_index ] );
+
+	entry->hash          = hash;
+	entry->record_offset = record_offset;
+	entry->record_size   = (uint32_t) record_data_size;
+	entry->is_common     = 0;
+
+	internal_record_diff->hash_table[ hash_table_index ] = entry_index + 1;
+
+	internal_record_diff->number_of_entries += 1;
+
+	/* Keep the load factor of the hash table at or below 0.5
+	 */
+	if( ( internal_record_diff->number_of_entries * 2 ) > internal_record_diff->hash_table_size )
+	{
+		if( libftxf_internal_record_diff_resize_hash_table(
+		     internal_record_diff,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Matches the data of a record of the new log against the records of the old log
+ * The records of the new log should be matched after all records of the old log were appended
+ * Every record of the old log is matched at most once, so that a record stored multiple times
+ * in the new log but once in the old log is reported as added
+ * Returns 1 if the record is common, 0 if the record was added or -1 on error
+ */
+int libftxf_record_diff_match_new_record_data(
+     libftxf_record_diff_t *record_diff,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint64_t *old_record_offset,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_diff_t *internal_record_diff = NULL;
+	libftxf_record_diff_entry_t *entry                   = NULL;
+	static char *function                                = "libftxf_record_diff_match_new_record_data";
+	uint64_t hash                                        = 0;
+	uint32_t hash_table_index                            = 0;
+	uint32_t hash_table_mask                             = 0;
+
+	if( record_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_diff = (libftxf_internal_record_diff_t *) record_diff;
+
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_size == 0 )
+	 || ( record_data_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( old_record_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid old record offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libftxf_record_hash_calculate(
+	     &hash,
+	     record_data,
+	     record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate record hash.",
+		 function );
+
+		return( -1 );
+	}
+
+	hash_table_mask  = internal_record_diff->hash_table_size - 1;
+	hash_table_index = (uint32_t) hash & hash_table_mask;
+
+	while( internal_record_diff->hash_table[ hash_table_index ] != 0 )
+	{
+		entry = &( internal_record_diff->entries[ internal_record_diff->hash_table[ hash_table_index ] - 1 ] );
+
+		if( ( entry->hash == hash )
+		 && ( (size_t) entry->record_size == record_data_size )
+		 && ( entry->is_common == 0 ) )
+		{
+			entry->is_common = 1;
+
+			*old_record_offset = entry->record_offset;
+
+			return( 1 );
+		}
+		hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of records of the old log
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_diff_get_number_of_old_records(
+     libftxf_record_diff_t *record_diff,
+     uint32_t *number_of_records,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_diff_t *internal_record_diff = NULL;
+	static char *function                                = "libftxf_record_diff_get_number_of_old_records";
+
+	if( record_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_diff = (libftxf_internal_record_diff_t *) record_diff;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = internal_record_diff->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific record of the old log
+ * Records of the old log that are not common after all records of the new log
+ * were matched have been removed
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_diff_get_old_record_by_index(
+     libftxf_record_diff_t *record_diff,
+     uint32_t record_index,
+     uint64_t *record_offset,
+     uint8_t *is_common,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_diff_t *internal_record_diff = NULL;
+	static char *function                                = "libftxf_record_diff_get_old_record_by_index";
+
+	if( record_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_diff = (libftxf_internal_record_diff_t *) record_diff;
+
+	if( record_index >= internal_record_diff->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_common == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is common.",
+		 function );
+
+		return( -1 );
+	}
+	*record_offset = internal_record_diff->entries[ record_index ].record_offset;
+	*is_common     = internal_record_diff->entries[ record_index ].is_common;
+
+	return( 1 );
+}
+
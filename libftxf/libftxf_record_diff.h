@@ -0,0 +1,145 @@
+/*
+ * Record diff functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_RECORD_DIFF_H )
+#define _LIBFTXF_RECORD_DIFF_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libftxf_record_diff_entry libftxf_record_diff_entry_t;
+
+struct libftxf_record_diff_entry
+{
+	/* The hash of the record data
+	 */
+	uint64_t hash;
+
+	/* The record offset
+	 */
+	uint64_t record_offset;
+
+	/* The record size
+	 */
+	uint32_t record_size;
+
+	/* Value to indicate the record is also in the new log
+	 */
+	uint8_t is_common;
+};
+
+typedef struct libftxf_internal_record_diff libftxf_internal_record_diff_t;
+
+struct libftxf_internal_record_diff
+{
+	/* The entries
+	 * Contains an entry per record of the old log
+	 */
+	libftxf_record_diff_entry_t *entries;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The allocated number of entries
+	 */
+	uint32_t allocated_number_of_entries;
+
+	/* The hash table
+	 * Contains the entry index + 1 or 0 for an unused entry
+	 */
+	uint32_t *hash_table;
+
+	/* The hash table size
+	 * Contains a power of 2
+	 */
+	uint32_t hash_table_size;
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the record diff and its buffers
+	 */
+	libftxf_allocator_t allocator;
+};
+
+LIBFTXF_EXTERN \
+int libftxf_record_diff_initialize(
+     libftxf_record_diff_t **record_diff,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_diff_initialize_with_allocator(
+     libftxf_record_diff_t **record_diff,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_diff_free(
+     libftxf_record_diff_t **record_diff,
+     libcerror_error_t **error );
+
+int libftxf_internal_record_diff_resize_hash_table(
+     libftxf_internal_record_diff_t *internal_record_diff,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_diff_append_old_record_data(
+     libftxf_record_diff_t *record_diff,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint64_t record_offset,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_diff_match_new_record_data(
+     libftxf_record_diff_t *record_diff,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint64_t *old_record_offset,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_diff_get_number_of_old_records(
+     libftxf_record_diff_t *record_diff,
+     uint32_t *number_of_records,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_diff_get_old_record_by_index(
+     libftxf_record_diff_t *record_diff,
+     uint32_t record_index,
+     uint64_t *record_offset,
+     uint8_t *is_common,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_RECORD_DIFF_H ) */
+
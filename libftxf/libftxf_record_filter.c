@@ -0,0 +1,542 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_definitions.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_record_filter.h"
+
+#include "ftxf_record.h"
+
+/* Creates a record filter
+ * Make sure the value record_filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_filter_initialize(
+     libftxf_record_filter_t **record_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_record_filter_initialize";
+
+	if( libftxf_record_filter_initialize_with_allocator(
+	     record_filter,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record filter.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a record filter that allocates its memory using the allocator functions
+ * Make sure the value record_filter is referencing, is set to NULL
+ * The allocator is copied into the record filter, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_filter_initialize_with_allocator(
+     libftxf_record_filter_t **record_filter,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                    = "libftxf_record_filter_initialize_with_allocator";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_record_filter = (libftxf_internal_record_filter_t *) libftxf_allocator_allocate(
+	                                                               allocator,
+	                                                               sizeof( libftxf_internal_record_filter_t ) );
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_filter,
+	     0,
+	     sizeof( libftxf_internal_record_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( allocator != NULL )
+	{
+		internal_record_filter->allocator = *allocator;
+	}
+	*record_filter = (libftxf_record_filter_t *) internal_record_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_record_filter != NULL )
+	{
+		libftxf_allocator_free(
+		 allocator,
+		 internal_record_filter );
+	}
+	return( -1 );
+}
+
+/* Frees a record filter
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_filter_free(
+     libftxf_record_filter_t **record_filter,
+     libcerror_error_t **error )
+{
+	libftxf_allocator_t allocator;
+
+	libftxf_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                    = "libftxf_record_filter_free";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_filter != NULL )
+	{
+		internal_record_filter = (libftxf_internal_record_filter_t *) *record_filter;
+		*record_filter         = NULL;
+
+		if( internal_record_filter->file_references != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_record_filter->allocator ),
+			 internal_record_filter->file_references );
+		}
+		/* The allocator is copied since it is stored in the record filter that is freed
+		 */
+		allocator = internal_record_filter->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
+		 internal_record_filter );
+	}
+	return( 1 );
+}
+
+/* Appends a record type to the record filter
+ * Records match if their record type is one of the appended record types
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_filter_append_record_type(
+     libftxf_record_filter_t *record_filter,
+     uint16_t record_type,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                    = "libftxf_record_filter_append_record_type";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libftxf_internal_record_filter_t *) record_filter;
+
+	if( record_type > 63 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record type value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter->record_type_mask |= (uint64_t) 1 << record_type;
+	internal_record_filter->flags            |= LIBFTXF_RECORD_FILTER_FLAG_HAS_RECORD_TYPES;
+
+	return( 1 );
+}
+
+/* Appends a file reference to the record filter
+ * Records match if their file reference is one of the appended file references
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_filter_append_file_reference(
+     libftxf_record_filter_t *record_filter,
+     uint64_t file_reference,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_filter_t *internal_record_filter = NULL;
+	uint64_t *file_references                                = NULL;
+	static char *function                                    = "libftxf_record_filter_append_file_reference";
+	size_t file_references_size                              = 0;
+	int entry_index                                          = 0;
+	int maximum_index                                        = 0;
+	int minimum_index                                        = 0;
+	int number_of_allocated_file_references                  = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libftxf_internal_record_filter_t *) record_filter;
+
+	/* Determine the insertion point to keep the file references sorted
+	 */
+	minimum_index = 0;
+	maximum_index = internal_record_filter->number_of_file_references;
+
+	while( minimum_index < maximum_index )
+	{
+		entry_index = minimum_index + ( ( maximum_index - minimum_index ) / 2 );
+
+		if( internal_record_filter->file_references[ entry_index ] == file_reference )
+		{
+			return( 1 );
+		}
+		else if( internal_record_filter->file_references[ entry_index ] < file_reference )
+		{
+			minimum_index = entry_index + 1;
+		}
+		else
+		{
+			maximum_index = entry_index;
+		}
+	}
+	if( internal_record_filter->number_of_file_references >= internal_record_filter->number_of_allocated_file_references )
+	{
+		if( internal_record_filter->number_of_allocated_file_references >= ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated file references value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_record_filter->number_of_allocated_file_references == 0 )
+		{
+			number_of_allocated_file_references = 16;
+		}
+		else
+		{
+			number_of_allocated_file_references = internal_record_filter->number_of_allocated_file_references * 2;
+		}
+		file_references_size = sizeof( uint64_t ) * number_of_allocated_file_references;
+
+		if( file_references_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid file references size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		file_references = (uint64_t *) libftxf_allocator_reallocate(
+		                                &( internal_record_filter->allocator ),
+		                                internal_record_filter->file_references,
+		                                file_references_size );
+
+		if( file_references == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize file references.",
+			 function );
+
+			return( -1 );
+		}
+		internal_record_filter->file_references                     = file_references;
+		internal_record_filter->number_of_allocated_file_references = number_of_allocated_file_references;
+	}
+	for( entry_index = internal_record_filter->number_of_file_references;
+	     entry_index > minimum_index;
+	     entry_index-- )
+	{
+		internal_record_filter->file_references[ entry_index ] = internal_record_filter->file_references[ entry_index - 1 ];
+	}
+	internal_record_filter->file_references[ minimum_index ] = file_reference;
+
+	internal_record_filter->number_of_file_references += 1;
+	internal_record_filter->flags                     |= LIBFTXF_RECORD_FILTER_FLAG_HAS_FILE_REFERENCES;
+
+	return( 1 );
+}
+
+/* Sets the (header) timestamp range of the record filter
+ * The timestamps are FILETIME values and the range includes both the first and last timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_filter_set_timestamp_range(
+     libftxf_record_filter_t *record_filter,
+     uint64_t first_timestamp,
+     uint64_t last_timestamp,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                    = "libftxf_record_filter_set_timestamp_range";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libftxf_internal_record_filter_t *) record_filter;
+
+	if( first_timestamp > last_timestamp )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first timestamp value exceeds last timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter->first_timestamp = first_timestamp;
+	internal_record_filter->last_timestamp  = last_timestamp;
+	internal_record_filter->flags          |= LIBFTXF_RECORD_FILTER_FLAG_HAS_TIMESTAMP_RANGE;
+
+	return( 1 );
+}
+
+/* Determines if the record header data matches the record filter
+ * The header data must contain at least sizeof( ftxf_record_header_t ) bytes
+ * Only the record type, file reference and timestamp are read from the header data
+ * Returns 1 if the record matches or 0 if not
+ */
+int libftxf_internal_record_filter_match_header_data(
+     libftxf_internal_record_filter_t *internal_record_filter,
+     const uint8_t *header_data )
+{
+	uint64_t file_reference = 0;
+	uint64_t timestamp      = 0;
+	uint16_t record_type    = 0;
+	int entry_index         = 0;
+	int maximum_index       = 0;
+	int minimum_index       = 0;
+
+	if( ( internal_record_filter->flags & LIBFTXF_RECORD_FILTER_FLAG_HAS_RECORD_TYPES ) != 0 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (ftxf_record_header_t *) header_data )->record_type,
+		 record_type );
+
+		if( ( record_type > 63 )
+		 || ( ( internal_record_filter->record_type_mask & ( (uint64_t) 1 << record_type ) ) == 0 ) )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_record_filter->flags & LIBFTXF_RECORD_FILTER_FLAG_HAS_TIMESTAMP_RANGE ) != 0 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ftxf_record_header_t *) header_data )->unknown8,
+		 timestamp );
+
+		if( ( timestamp < internal_record_filter->first_timestamp )
+		 || ( timestamp > internal_record_filter->last_timestamp ) )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_record_filter->flags & LIBFTXF_RECORD_FILTER_FLAG_HAS_FILE_REFERENCES ) != 0 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ftxf_record_header_t *) header_data )->file_reference,
+		 file_reference );
+
+		minimum_index = 0;
+		maximum_index = internal_record_filter->number_of_file_references;
+
+		while( minimum_index < maximum_index )
+		{
+			entry_index = minimum_index + ( ( maximum_index - minimum_index ) / 2 );
+
+			if( internal_record_filter->file_references[ entry_index ] == file_reference )
+			{
+				return( 1 );
+			}
+			else if( internal_record_filter->file_references[ entry_index ] < file_reference )
+			{
+				minimum_index = entry_index + 1;
+			}
+			else
+			{
+				maximum_index = entry_index;
+			}
+		}
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if the record in the byte stream matches the record filter
+ * Only the record header is read from the byte stream
+ * Returns 1 if the record matches, 0 if not or -1 on error
+ */
+int libftxf_record_filter_match_byte_stream(
+     libftxf_record_filter_t *record_filter,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_record_filter_match_byte_stream";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < sizeof( ftxf_record_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream value too small.",
+		 function );
+
+		return( -1 );
+	}
+	return( libftxf_internal_record_filter_match_header_data(
+	         (libftxf_internal_record_filter_t *) record_filter,
+	         byte_stream ) );
+}
+
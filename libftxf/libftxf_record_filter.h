@@ -0,0 +1,127 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_INTERNAL_RECORD_FILTER_H )
+#define _LIBFTXF_INTERNAL_RECORD_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libftxf_internal_record_filter libftxf_internal_record_filter_t;
+
+struct libftxf_internal_record_filter
+{
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The record type mask
+	 * Bit N is set if record type N matches
+	 */
+	uint64_t record_type_mask;
+
+	/* The file references
+	 * The file references are stored in ascending order
+	 */
+	uint64_t *file_references;
+
+	/* The number of file references
+	 */
+	int number_of_file_references;
+
+	/* The number of allocated file references
+	 */
+	int number_of_allocated_file_references;
+
+	/* The first (header) timestamp in the range
+	 */
+	uint64_t first_timestamp;
+
+	/* The last (header) timestamp in the range
+	 */
+	uint64_t last_timestamp;
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the record filter and its buffers
+	 */
+	libftxf_allocator_t allocator;
+};
+
+LIBFTXF_EXTERN \
+int libftxf_record_filter_initialize(
+     libftxf_record_filter_t **record_filter,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_filter_initialize_with_allocator(
+     libftxf_record_filter_t **record_filter,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_filter_free(
+     libftxf_record_filter_t **record_filter,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_filter_append_record_type(
+     libftxf_record_filter_t *record_filter,
+     uint16_t record_type,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_filter_append_file_reference(
+     libftxf_record_filter_t *record_filter,
+     uint64_t file_reference,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_filter_set_timestamp_range(
+     libftxf_record_filter_t *record_filter,
+     uint64_t first_timestamp,
+     uint64_t last_timestamp,
+     libcerror_error_t **error );
+
+int libftxf_internal_record_filter_match_header_data(
+     libftxf_internal_record_filter_t *internal_record_filter,
+     const uint8_t *header_data );
+
+LIBFTXF_EXTERN \
+int libftxf_record_filter_match_byte_stream(
+     libftxf_record_filter_t *record_filter,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_INTERNAL_RECORD_FILTER_H ) */
+
@@ -0,0 +1,241 @@
+/*
+ * Record hash functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libftxf_libcerror.h"
+#include "libftxf_record_hash.h"
+
+/* The record hash is the 64-bit xxHash (XXH64) of the record data with a seed of 0.
+ * It is used to detect identical records, such as duplicate records in carved or overlapping
+ * sources, without comparing the record data itself.
+ */
+
+#define LIBFTXF_RECORD_HASH_PRIME1			0x9e3779b185ebca87UL
+#define LIBFTXF_RECORD_HASH_PRIME2			0xc2b2ae3d27d4eb4fUL
+#define LIBFTXF_RECORD_HASH_PRIME3			0x165667b19e3779f9UL
+#define LIBFTXF_RECORD_HASH_PRIME4			0x85ebca77c2b2ae63UL
+#define LIBFTXF_RECORD_HASH_PRIME5			0x27d4eb2f165667c5UL
+
+#define libftxf_record_hash_rotate_left( value, number_of_bits ) \
+	( ( ( value ) << ( number_of_bits ) ) | ( ( value ) >> ( 64 - ( number_of_bits ) ) ) )
+
+/* Mixes a 64-bit input value into an accumulator
+ * Returns the accumulator
+ */
+static uint64_t libftxf_record_hash_round(
+                 uint64_t accumulator,
+                 uint64_t value )
+{
+	accumulator += value * LIBFTXF_RECORD_HASH_PRIME2;
+	accumulator  = libftxf_record_hash_rotate_left( accumulator, 31 );
+	accumulator *= LIBFTXF_RECORD_HASH_PRIME1;
+
+	return( accumulator );
+}
+
+/* Merges an accumulator into the hash
+ * Returns the hash
+ */
+static uint64_t libftxf_record_hash_merge_round(
+                 uint64_t hash,
+                 uint64_t accumulator )
+{
+	hash ^= libftxf_record_hash_round(
+	         0,
+	         accumulator );
+
+	hash = ( hash * LIBFTXF_RECORD_HASH_PRIME1 ) + LIBFTXF_RECORD_HASH_PRIME4;
+
+	return( hash );
+}
+
+/* Calculates the hash of record data
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_hash_calculate(
+     uint64_t *hash,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libftxf_record_hash_calculate";
+	size_t data_offset       = 0;
+	uint64_t accumulator1    = 0;
+	uint64_t accumulator2    = 0;
+	uint64_t accumulator3    = 0;
+	uint64_t accumulator4    = 0;
+	uint64_t calculated_hash = 0;
+	uint64_t value_64bit     = 0;
+	uint32_t value_32bit     = 0;
+
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size >= 32 )
+	{
+		accumulator1 = LIBFTXF_RECORD_HASH_PRIME1 + LIBFTXF_RECORD_HASH_PRIME2;
+		accumulator2 = LIBFTXF_RECORD_HASH_PRIME2;
+		accumulator3 = 0;
+		accumulator4 = (uint64_t) 0 - LIBFTXF_RECORD_HASH_PRIME1;
+
+		while( ( data_size - data_offset ) >= 32 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 value_64bit );
+
+			accumulator1 = libftxf_record_hash_round(
+			                accumulator1,
+			                value_64bit );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset + 8 ] ),
+			 value_64bit );
+
+			accumulator2 = libftxf_record_hash_round(
+			                accumulator2,
+			                value_64bit );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset + 16 ] ),
+			 value_64bit );
+
+			accumulator3 = libftxf_record_hash_round(
+			                accumulator3,
+			                value_64bit );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset + 24 ] ),
+			 value_64bit );
+
+			accumulator4 = libftxf_record_hash_round(
+			                accumulator4,
+			                value_64bit );
+
+			data_offset += 32;
+		}
+		calculated_hash = libftxf_record_hash_rotate_left( accumulator1, 1 )
+		                + libftxf_record_hash_rotate_left( accumulator2, 7 )
+		                + libftxf_record_hash_rotate_left( accumulator3, 12 )
+		                + libftxf_record_hash_rotate_left( accumulator4, 18 );
+
+		calculated_hash = libftxf_record_hash_merge_round(
+		                   calculated_hash,
+		                   accumulator1 );
+
+		calculated_hash = libftxf_record_hash_merge_round(
+		                   calculated_hash,
+		                   accumulator2 );
+
+		calculated_hash = libftxf_record_hash_merge_round(
+		                   calculated_hash,
+		                   accumulator3 );
+
+		calculated_hash = libftxf_record_hash_merge_round(
+		                   calculated_hash,
+		                   accumulator4 );
+	}
+	else
+	{
+		calculated_hash = LIBFTXF_RECORD_HASH_PRIME5;
+	}
+	calculated_hash += (uint64_t) data_size;
+
+	while( ( data_size - data_offset ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 value_64bit );
+
+		calculated_hash ^= libftxf_record_hash_round(
+		                    0,
+		                    value_64bit );
+
+		calculated_hash = ( libftxf_record_hash_rotate_left( calculated_hash, 27 ) * LIBFTXF_RECORD_HASH_PRIME1 ) + LIBFTXF_RECORD_HASH_PRIME4;
+
+		data_offset += 8;
+	}
+	if( ( data_size - data_offset ) >= 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 value_32bit );
+
+		calculated_hash ^= (uint64_t) value_32bit * LIBFTXF_RECORD_HASH_PRIME1;
+
+		calculated_hash = ( libftxf_record_hash_rotate_left( calculated_hash, 23 ) * LIBFTXF_RECORD_HASH_PRIME2 ) + LIBFTXF_RECORD_HASH_PRIME3;
+
+		data_offset += 4;
+	}
+	while( data_offset < data_size )
+	{
+		calculated_hash ^= (uint64_t) data[ data_offset ] * LIBFTXF_RECORD_HASH_PRIME5;
+
+		calculated_hash = libftxf_record_hash_rotate_left( calculated_hash, 11 ) * LIBFTXF_RECORD_HASH_PRIME1;
+
+		data_offset++;
+	}
+	/* Final avalanche
+	 */
+	calculated_hash ^= calculated_hash >> 33;
+	calculated_hash *= LIBFTXF_RECORD_HASH_PRIME2;
+	calculated_hash ^= calculated_hash >> 29;
+	calculated_hash *= LIBFTXF_RECORD_HASH_PRIME3;
+	calculated_hash ^= calculated_hash >> 32;
+
+	*hash = calculated_hash;
+
+	return( 1 );
+}
+
@@ -0,0 +1,1006 @@
+/*
+ * Record merger functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_record.h"
+#include "libftxf_record_merger.h"
+
+#include "ftxf_record.h"
+
+/* The record merger merges the records of multiple sources, such as the TxF logs
+ * of multiple volumes or volume snapshots, in (header) timestamp order by means of
+ * a binary min-heap. The records are provided one at a time by the caller, since
+ * the library does not read files itself.
+ *
+ * Alternatively only the record headers are provided, in which case the record merger
+ * only determines the order of the records and the caller reads the records, for
+ * example by multiple threads.
+ */
+
+/* Creates a record merger
+ * Make sure the value record_merger is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_merger_initialize(
+     libftxf_record_merger_t **record_merger,
+     int number_of_sources,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_record_merger_initialize";
+
+	if( libftxf_record_merger_initialize_with_allocator(
+	     record_merger,
+	     number_of_sources,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record merger.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a record merger that allocates its memory using the allocator functions
+ * Make sure the value record_merger is referencing, is set to NULL
+ * The allocator is copied into the record merger, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_merger_initialize_with_allocator(
+     libftxf_record_merger_t **record_merger,
+     int number_of_sources,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_merger_t *internal_record_merger = NULL;
+	static char *function                                    = "libftxf_record_merger_initialize_with_allocator";
+	int source_index                                         = 0;
+
+	if( record_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record merger.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_merger != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record merger value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_sources <= 0 )
+	 || ( (size_t) number_of_sources > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libftxf_record_merger_source_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sources value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_record_merger = (libftxf_internal_record_merger_t *) libftxf_allocator_allocate(
+	                                                               allocator,
+	                                                               sizeof( libftxf_internal_record_merger_t ) );
+
+	if( internal_record_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record merger.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_merger,
+	     0,
+	     sizeof( libftxf_internal_record_merger_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record merger.",
+		 function );
+
+		libftxf_allocator_free(
+		 allocator,
+		 internal_record_merger );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		internal_record_merger->allocator = *allocator;
+	}
+	internal_record_merger->sources = (libftxf_record_merger_source_t *) libftxf_allocator_allocate(
+	                                                                     &( internal_record_merger->allocator ),
+	                                                                     sizeof( libftxf_record_merger_source_t ) * number_of_sources );
+
+	if( internal_record_merger->sources == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sources.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_merger->sources,
+	     0,
+	     sizeof( libftxf_record_merger_source_t ) * number_of_sources ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sources.",
+		 function );
+
+		libftxf_allocator_free(
+		 &( internal_record_merger->allocator ),
+		 internal_record_merger->sources );
+
+		internal_record_merger->sources = NULL;
+
+		goto on_error;
+	}
+	internal_record_merger->number_of_sources = number_of_sources;
+
+	internal_record_merger->heap = (int *) libftxf_allocator_allocate(
+	                                        &( internal_record_merger->allocator ),
+	                                        sizeof( int ) * number_of_sources );
+
+	if( internal_record_merger->heap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create heap.",
+		 function );
+
+		goto on_error;
+	}
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		if( libftxf_record_initialize_with_allocator(
+		     &( internal_record_merger->sources[ source_index ].record ),
+		     &( internal_record_merger->allocator ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record of source: %d.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+	}
+	internal_record_merger->pending_source_index = -1;
+
+	*record_merger = (libftxf_record_merger_t *) internal_record_merger;
+
+	return( 1 );
+
+on_error:
+	if( internal_record_merger != NULL )
+	{
+		if( internal_record_merger->heap != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_record_merger->allocator ),
+			 internal_record_merger->heap );
+		}
+		if( internal_record_merger->sources != NULL )
+		{
+			for( source_index = 0;
+			     source_index < internal_record_merger->number_of_sources;
+			     source_index++ )
+			{
+				if( internal_record_merger->sources[ source_index ].record != NULL )
+				{
+					libftxf_record_free(
+					 &( internal_record_merger->sources[ source_index ].record ),
+					 NULL );
+				}
+			}
+			libftxf_allocator_free(
+			 &( internal_record_merger->allocator ),
+			 internal_record_merger->sources );
+		}
+		libftxf_allocator_free(
+		 allocator,
+		 internal_record_merger );
+	}
+	return( -1 );
+}
+
+/* Frees a record merger
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_merger_free(
+     libftxf_record_merger_t **record_merger,
+     libcerror_error_t **error )
+{
+	libftxf_allocator_t allocator;
+
+	libftxf_internal_record_merger_t *internal_record_merger = NULL;
+	static char *function                                    = "libftxf_record_merger_free";
+	int result                                               = 1;
+	int source_index                                         = 0;
+
+	if( record_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record merger.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_merger != NULL )
+	{
+		internal_record_merger = (libftxf_internal_record_merger_t *) *record_merger;
+		*record_merger         = NULL;
+
+		for( source_index = 0;
+		     source_index < internal_record_merger->number_of_sources;
+		     source_index++ )
+		{
+			if( libftxf_record_free(
+			     &( internal_record_merger->sources[ source_index ].record ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record of source: %d.",
+				 function,
+				 source_index );
+
+				result = -1;
+			}
+		}
+		libftxf_allocator_free(
+		 &( internal_record_merger->allocator ),
+		 internal_record_merger->heap );
+
+		libftxf_allocator_free(
+		 &( internal_record_merger->allocator ),
+		 internal_record_merger->sources );
+
+		/* The allocator is copied since it is stored in the record merger that is freed
+		 */
+		allocator = internal_record_merger->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
+		 internal_record_merger );
+	}
+	return( result );
+}
+
+/* Determines if the current record of the first source is less than that of the second source
+ * Records are ordered by (header) timestamp and equal timestamps are ordered by source index
+ * so that the merge is stable
+ * Returns 1 if less or 0 if not
+ */
+int libftxf_internal_record_merger_source_is_less(
+     libftxf_internal_record_merger_t *internal_record_merger,
+     int first_source_index,
+     int second_source_index )
+{
+	uint64_t first_timestamp  = 0;
+	uint64_t second_timestamp = 0;
+
+	first_timestamp  = internal_record_merger->sources[ first_source_index ].timestamp;
+	second_timestamp = internal_record_merger->sources[ second_source_index ].timestamp;
+
+	if( first_timestamp != second_timestamp )
+	{
+		return( (int) ( first_timestamp < second_timestamp ) );
+	}
+	return( (int) ( first_source_index < second_source_index ) );
+}
+
+/* Moves the source index at the heap index down the heap until the heap is ordered
+ */
+void libftxf_internal_record_merger_sift_down(
+      libftxf_internal_record_merger_t *internal_record_merger,
+      int heap_index )
+{
+	int *heap            = NULL;
+	int child_heap_index = 0;
+	int source_index     = 0;
+
+	heap         = internal_record_merger->heap;
+	source_index = heap[ heap_index ];
+
+	for( child_heap_index = ( 2 * heap_index ) + 1;
+	     child_heap_index < internal_record_merger->heap_size;
+	     child_heap_index = ( 2 * heap_index ) + 1 )
+	{
+		if( ( ( child_heap_index + 1 ) < internal_record_merger->heap_size )
+		 && ( libftxf_internal_record_merger_source_is_less(
+		       internal_record_merger,
+		       heap[ child_heap_index + 1 ],
+		       heap[ child_heap_index ] ) != 0 ) )
+		{
+			child_heap_index++;
+		}
+		if( libftxf_internal_record_merger_source_is_less(
+		     internal_record_merger,
+		     heap[ child_heap_index ],
+		     source_index ) == 0 )
+		{
+			break;
+		}
+		heap[ heap_index ] = heap[ child_heap_index ];
+
+		heap_index = child_heap_index;
+	}
+	heap[ heap_index ] = source_index;
+}
+
+/* Builds the heap from the sources that have a record
+ */
+void libftxf_internal_record_merger_build_heap(
+      libftxf_internal_record_merger_t *internal_record_merger )
+{
+	int heap_index   = 0;
+	int source_index = 0;
+
+	internal_record_merger->heap_size = 0;
+
+	for( source_index = 0;
+	     source_index < internal_record_merger->number_of_sources;
+	     source_index++ )
+	{
+		if( internal_record_merger->sources[ source_index ].state == LIBFTXF_RECORD_MERGER_SOURCE_STATE_HAS_RECORD )
+		{
+			internal_record_merger->heap[ internal_record_merger->heap_size ] = source_index;
+
+			internal_record_merger->heap_size += 1;
+		}
+	}
+	for( heap_index = ( internal_record_merger->heap_size / 2 ) - 1;
+	     heap_index >= 0;
+	     heap_index-- )
+	{
+		libftxf_internal_record_merger_sift_down(
+		 internal_record_merger,
+		 heap_index );
+	}
+	internal_record_merger->heap_is_built = 1;
+}
+
+/* Updates the heap after the next record of the source of the last retrieved record was set
+ */
+void libftxf_internal_record_merger_update_pending_source(
+      libftxf_internal_record_merger_t *internal_record_merger,
+      int source_index )
+{
+	if( internal_record_merger->pending_source_index != source_index )
+	{
+		return;
+	}
+	/* The source of the last retrieved record is at the top of the heap
+	 */
+	if( internal_record_merger->sources[ source_index ].state == LIBFTXF_RECORD_MERGER_SOURCE_STATE_EXHAUSTED )
+	{
+		internal_record_merger->heap_size -= 1;
+
+		internal_record_merger->heap[ 0 ] = internal_record_merger->heap[ internal_record_merger->heap_size ];
+	}
+	if( internal_record_merger->heap_size > 0 )
+	{
+		libftxf_internal_record_merger_sift_down(
+		 internal_record_merger,
+		 0 );
+	}
+	internal_record_merger->pending_source_index = -1;
+}
+
+/* Retrieves the index of the source with the next record in (header) timestamp order
+ * The source needs data afterwards
+ * Returns 1 if successful, 0 if all sources are exhausted or -1 on error
+ */
+int libftxf_internal_record_merger_get_next_source_index(
+     libftxf_internal_record_merger_t *internal_record_merger,
+     int *source_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_internal_record_merger_get_next_source_index";
+	int safe_source_index = 0;
+
+	if( internal_record_merger->heap_is_built == 0 )
+	{
+		for( safe_source_index = 0;
+		     safe_source_index < internal_record_merger->number_of_sources;
+		     safe_source_index++ )
+		{
+			if( internal_record_merger->sources[ safe_source_index ].state == LIBFTXF_RECORD_MERGER_SOURCE_STATE_NEEDS_DATA )
+			{
+				break;
+			}
+		}
+		if( safe_source_index < internal_record_merger->number_of_sources )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data of source: %d.",
+			 function,
+			 safe_source_index );
+
+			return( -1 );
+		}
+		libftxf_internal_record_merger_build_heap(
+		 internal_record_merger );
+	}
+	if( internal_record_merger->pending_source_index != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing data of source: %d.",
+		 function,
+		 internal_record_merger->pending_source_index );
+
+		return( -1 );
+	}
+	if( internal_record_merger->heap_size == 0 )
+	{
+		return( 0 );
+	}
+	safe_source_index = internal_record_merger->heap[ 0 ];
+
+	/* The heap is updated when the next record of the source is set
+	 */
+	internal_record_merger->sources[ safe_source_index ].state = LIBFTXF_RECORD_MERGER_SOURCE_STATE_NEEDS_DATA;
+
+	internal_record_merger->pending_source_index = safe_source_index;
+
+	*source_index = safe_source_index;
+
+	return( 1 );
+}
+
+/* Retrieves the index of a source that needs data
+ * Before the first record is retrieved every source needs data, afterwards only the source
+ * of the last retrieved record
+ * Returns 1 if successful, 0 if no source needs data or -1 on error
+ */
+int libftxf_record_merger_get_source_needing_data(
+     libftxf_record_merger_t *record_merger,
+     int *source_index,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_merger_t *internal_record_merger = NULL;
+	static char *function                                    = "libftxf_record_merger_get_source_needing_data";
+	int safe_source_index                                    = 0;
+
+	if( record_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record merger.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_merger = (libftxf_internal_record_merger_t *) record_merger;
+
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_merger->heap_is_built != 0 )
+	{
+		if( internal_record_merger->pending_source_index == -1 )
+		{
+			return( 0 );
+		}
+		*source_index = internal_record_merger->pending_source_index;
+
+		return( 1 );
+	}
+	for( safe_source_index = 0;
+	     safe_source_index < internal_record_merger->number_of_sources;
+	     safe_source_index++ )
+	{
+		if( internal_record_merger->sources[ safe_source_index ].state == LIBFTXF_RECORD_MERGER_SOURCE_STATE_NEEDS_DATA )
+		{
+			*source_index = safe_source_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Sets the data of the next record of a source
+ * The data contains a single record, a data size of 0 indicates the source is exhausted
+ * The record offset is not interpreted and is returned together with the record
+ * If the record cannot be read the source still needs data, which allows the caller
+ * to continue with the next record of the source
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_merger_set_source_record_data(
+     libftxf_record_merger_t *record_merger,
+     int source_index,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t record_offset,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_merger_t *internal_record_merger = NULL;
+	libftxf_record_merger_source_t *source                   = NULL;
+	static char *function                                    = "libftxf_record_merger_set_source_record_data";
+
+	if( record_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record merger.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_merger = (libftxf_internal_record_merger_t *) record_merger;
+
+	if( ( source_index < 0 )
+	 || ( source_index >= internal_record_merger->number_of_sources ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	source = &( internal_record_merger->sources[ source_index ] );
+
+	if( source->state != LIBFTXF_RECORD_MERGER_SOURCE_STATE_NEEDS_DATA )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source: %d - data already set.",
+		 function,
+		 source_index );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		source->state = LIBFTXF_RECORD_MERGER_SOURCE_STATE_EXHAUSTED;
+	}
+	else
+	{
+		if( libftxf_record_copy_from_byte_stream(
+		     source->record,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy record of source: %d from byte stream.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+		if( libftxf_record_get_timestamp(
+		     source->record,
+		     &( source->timestamp ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve timestamp of record of source: %d.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+		source->record_offset = record_offset;
+		source->state         = LIBFTXF_RECORD_MERGER_SOURCE_STATE_HAS_RECORD;
+	}
+	libftxf_internal_record_merger_update_pending_source(
+	 internal_record_merger,
+	 source_index );
+
+	return( 1 );
+}
+
+/* Sets the header of the next record of a source
+ * The data contains a single record, a data size of 0 indicates the source is exhausted
+ * Only the (header) timestamp is read, hence the record can only be retrieved by its
+ * source index and offset
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_record_merger_set_source_record_header(
+     libftxf_record_merger_t *record_merger,
+     int source_index,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t record_offset,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_merger_t *internal_record_merger = NULL;
+	libftxf_record_merger_source_t *source                   = NULL;
+	static char *function                                    = "libftxf_record_merger_set_source_record_header";
+
+	if( record_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record merger.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_merger = (libftxf_internal_record_merger_t *) record_merger;
+
+	if( ( source_index < 0 )
+	 || ( source_index >= internal_record_merger->number_of_sources ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size != 0 )
+	 && ( ( data_size < sizeof( ftxf_record_header_t ) )
+	  ||  ( data_size > (size_t) SSIZE_MAX ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	source = &( internal_record_merger->sources[ source_index ] );
+
+	if( source->state != LIBFTXF_RECORD_MERGER_SOURCE_STATE_NEEDS_DATA )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source: %d - data already set.",
+		 function,
+		 source_index );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		source->state = LIBFTXF_RECORD_MERGER_SOURCE_STATE_EXHAUSTED;
+	}
+	else
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ftxf_record_header_t *) data )->unknown8,
+		 source->timestamp );
+
+		source->record_offset = record_offset;
+		source->state         = LIBFTXF_RECORD_MERGER_SOURCE_STATE_HAS_RECORD;
+
+		internal_record_merger->record_headers_only = 1;
+	}
+	libftxf_internal_record_merger_update_pending_source(
+	 internal_record_merger,
+	 source_index );
+
+	return( 1 );
+}
+
+/* Retrieves the next record in (header) timestamp order
+ * The record is managed by the record merger and remains valid until the data of
+ * its source is set again
+ * Returns 1 if successful, 0 if all sources are exhausted or -1 on error
+ */
+int libftxf_record_merger_get_next_record(
+     libftxf_record_merger_t *record_merger,
+     int *source_index,
+     uint64_t *record_offset,
+     libftxf_record_t **record,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_merger_t *internal_record_merger = NULL;
+	libftxf_record_merger_source_t *source                   = NULL;
+	static char *function                                    = "libftxf_record_merger_get_next_record";
+	int result                                               = 0;
+	int safe_source_index                                    = 0;
+
+	if( record_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record merger.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_merger = (libftxf_internal_record_merger_t *) record_merger;
+
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_merger->record_headers_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid record merger - record headers were set instead of record data.",
+		 function );
+
+		return( -1 );
+	}
+	result = libftxf_internal_record_merger_get_next_source_index(
+	          internal_record_merger,
+	          &safe_source_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next source index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	source = &( internal_record_merger->sources[ safe_source_index ] );
+
+	*source_index  = safe_source_index;
+	*record_offset = source->record_offset;
+	*record        = source->record;
+
+	return( 1 );
+}
+
+
+/* Retrieves the source and offset of the next record in (header) timestamp order
+ * This function is intended to be used when the record headers are set
+ * Returns 1 if successful, 0 if all sources are exhausted or -1 on error
+ */
+int libftxf_record_merger_get_next_source(
+     libftxf_record_merger_t *record_merger,
+     int *source_index,
+     uint64_t *record_offset,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_merger_t *internal_record_merger = NULL;
+	static char *function                                    = "libftxf_record_merger_get_next_source";
+	int result                                               = 0;
+	int safe_source_index                                    = 0;
+
+	if( record_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record merger.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_merger = (libftxf_internal_record_merger_t *) record_merger;
+
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record offset.",
+		 function );
+
+		return( -1 );
+	}
+	result = libftxf_internal_record_merger_get_next_source_index(
+	          internal_record_merger,
+	          &safe_source_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next source index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	*source_index  = safe_source_index;
+	*record_offset = internal_record_merger->sources[ safe_source_index ].record_offset;
+
+	return( 1 );
+}
+
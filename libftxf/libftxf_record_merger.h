@@ -0,0 +1,188 @@
+/*
+ * Record merger functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_RECORD_MERGER_H )
+#define _LIBFTXF_RECORD_MERGER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum LIBFTXF_RECORD_MERGER_SOURCE_STATES
+{
+	LIBFTXF_RECORD_MERGER_SOURCE_STATE_NEEDS_DATA		= 0,
+	LIBFTXF_RECORD_MERGER_SOURCE_STATE_HAS_RECORD		= 1,
+	LIBFTXF_RECORD_MERGER_SOURCE_STATE_EXHAUSTED		= 2
+};
+
+typedef struct libftxf_record_merger_source libftxf_record_merger_source_t;
+
+struct libftxf_record_merger_source
+{
+	/* The current record
+	 */
+	libftxf_record_t *record;
+
+	/* The offset of the current record
+	 */
+	uint64_t record_offset;
+
+	/* The (header) timestamp of the current record
+	 */
+	uint64_t timestamp;
+
+	/* The state
+	 */
+	uint8_t state;
+};
+
+typedef struct libftxf_internal_record_merger libftxf_internal_record_merger_t;
+
+struct libftxf_internal_record_merger
+{
+	/* The number of sources
+	 */
+	int number_of_sources;
+
+	/* The sources
+	 */
+	libftxf_record_merger_source_t *sources;
+
+	/* The heap
+	 * Contains the source indexes of the sources that have a record,
+	 * where the first element contains the source index of the smallest record
+	 */
+	int *heap;
+
+	/* The number of elements in the heap
+	 */
+	int heap_size;
+
+	/* The index of the source that needs data before the heap can be updated
+	 * or -1 if not set
+	 */
+	int pending_source_index;
+
+	/* Value to indicate the heap was built
+	 */
+	uint8_t heap_is_built;
+
+	/* Value to indicate record headers were set instead of record data
+	 */
+	uint8_t record_headers_only;
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the record merger and its buffers
+	 */
+	libftxf_allocator_t allocator;
+};
+
+LIBFTXF_EXTERN \
+int libftxf_record_merger_initialize(
+     libftxf_record_merger_t **record_merger,
+     int number_of_sources,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_merger_initialize_with_allocator(
+     libftxf_record_merger_t **record_merger,
+     int number_of_sources,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_merger_free(
+     libftxf_record_merger_t **record_merger,
+     libcerror_error_t **error );
+
+int libftxf_internal_record_merger_source_is_less(
+     libftxf_internal_record_merger_t *internal_record_merger,
+     int first_source_index,
+     int second_source_index );
+
+void libftxf_internal_record_merger_sift_down(
+      libftxf_internal_record_merger_t *internal_record_merger,
+      int heap_index );
+
+void libftxf_internal_record_merger_build_heap(
+      libftxf_internal_record_merger_t *internal_record_merger );
+
+void libftxf_internal_record_merger_update_pending_source(
+      libftxf_internal_record_merger_t *internal_record_merger,
+      int source_index );
+
+int libftxf_internal_record_merger_get_next_source_index(
+     libftxf_internal_record_merger_t *internal_record_merger,
+     int *source_index,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_merger_get_source_needing_data(
+     libftxf_record_merger_t *record_merger,
+     int *source_index,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_merger_set_source_record_data(
+     libftxf_record_merger_t *record_merger,
+     int source_index,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t record_offset,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_merger_set_source_record_header(
+     libftxf_record_merger_t *record_merger,
+     int source_index,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t record_offset,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_merger_get_next_record(
+     libftxf_record_merger_t *record_merger,
+     int *source_index,
+     uint64_t *record_offset,
+     libftxf_record_t **txf_record,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_record_merger_get_next_source(
+     libftxf_record_merger_t *record_merger,
+     int *source_index,
+     uint64_t *record_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_RECORD_MERGER_H ) */
+
@@ -0,0 +1,107 @@
+/*
+ * Timeline entry functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libftxf_timeline_entry.h"
+#include "libftxf_types.h"
+
+/* A timeline entry is stored as a little-endian 24-byte sequence:
+ * the FILETIME, the record offset, the kind and the entry index
+ */
+
+/* Copies a timeline entry from a byte stream
+ * The byte stream must contain at least LIBFTXF_TIMELINE_ENTRY_SIZE bytes
+ */
+void libftxf_timeline_entry_copy_from_byte_stream(
+      libftxf_timeline_entry_t *timeline_entry,
+      const uint8_t *byte_stream )
+{
+	byte_stream_copy_to_uint64_little_endian(
+	 &( byte_stream[ 0 ] ),
+	 timeline_entry->filetime );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( byte_stream[ 8 ] ),
+	 timeline_entry->record_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 16 ] ),
+	 timeline_entry->kind );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 20 ] ),
+	 timeline_entry->entry_index );
+}
+
+/* Copies a timeline entry to a byte stream
+ * The byte stream must contain at least LIBFTXF_TIMELINE_ENTRY_SIZE bytes
+ */
+void libftxf_timeline_entry_copy_to_byte_stream(
+      const libftxf_timeline_entry_t *timeline_entry,
+      uint8_t *byte_stream )
+{
+	byte_stream_copy_from_uint64_little_endian(
+	 &( byte_stream[ 0 ] ),
+	 timeline_entry->filetime );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( byte_stream[ 8 ] ),
+	 timeline_entry->record_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ 16 ] ),
+	 timeline_entry->kind );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ 20 ] ),
+	 timeline_entry->entry_index );
+}
+
+/* Compares two timeline entries
+ * The entries are ordered by FILETIME, record offset, kind and entry index
+ * Returns -1 if the first entry is ordered before the second, 1 if after or 0 if equal
+ */
+int libftxf_timeline_entry_compare(
+     const libftxf_timeline_entry_t *first_timeline_entry,
+     const libftxf_timeline_entry_t *second_timeline_entry )
+{
+	if( first_timeline_entry->filetime != second_timeline_entry->filetime )
+	{
+		return( ( first_timeline_entry->filetime < second_timeline_entry->filetime ) ? -1 : 1 );
+	}
+	if( first_timeline_entry->record_offset != second_timeline_entry->record_offset )
+	{
+		return( ( first_timeline_entry->record_offset < second_timeline_entry->record_offset ) ? -1 : 1 );
+	}
+	if( first_timeline_entry->kind != second_timeline_entry->kind )
+	{
+		return( ( first_timeline_entry->kind < second_timeline_entry->kind ) ? -1 : 1 );
+	}
+	if( first_timeline_entry->entry_index != second_timeline_entry->entry_index )
+	{
+		return( ( first_timeline_entry->entry_index < second_timeline_entry->entry_index ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,52 @@
+/*
+ * Timeline entry functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_TIMELINE_ENTRY_H )
+#define _LIBFTXF_TIMELINE_ENTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+void libftxf_timeline_entry_copy_from_byte_stream(
+      libftxf_timeline_entry_t *timeline_entry,
+      const uint8_t *byte_stream );
+
+void libftxf_timeline_entry_copy_to_byte_stream(
+      const libftxf_timeline_entry_t *timeline_entry,
+      uint8_t *byte_stream );
+
+int libftxf_timeline_entry_compare(
+     const libftxf_timeline_entry_t *first_timeline_entry,
+     const libftxf_timeline_entry_t *second_timeline_entry );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_TIMELINE_ENTRY_H ) */
+
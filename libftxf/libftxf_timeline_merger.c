@@ -0,0 +1,702 @@
+/*
+ * Timeline merger functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_definitions.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_timeline_entry.h"
+#include "libftxf_timeline_merger.h"
+
+/* The timeline merger merges sorted runs of timeline entries by means of a loser tree.
+ * The runs are provided in blocks of serialized timeline entries by the caller, since
+ * the library does not read or write (temporary) files itself.
+ */
+
+/* Creates a timeline merger
+ * Make sure the value timeline_merger is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_timeline_merger_initialize(
+     libftxf_timeline_merger_t **timeline_merger,
+     int number_of_runs,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_timeline_merger_initialize";
+
+	if( libftxf_timeline_merger_initialize_with_allocator(
+	     timeline_merger,
+	     number_of_runs,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create timeline merger.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a timeline merger that allocates its memory using the allocator functions
+ * Make sure the value timeline_merger is referencing, is set to NULL
+ * The allocator is copied into the timeline merger, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_timeline_merger_initialize_with_allocator(
+     libftxf_timeline_merger_t **timeline_merger,
+     int number_of_runs,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	libftxf_internal_timeline_merger_t *internal_timeline_merger = NULL;
+	static char *function                                        = "libftxf_timeline_merger_initialize_with_allocator";
+
+	if( timeline_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline merger.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline_merger != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timeline merger value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_runs <= 0 )
+	 || ( (size_t) number_of_runs > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libftxf_timeline_merger_run_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of runs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_timeline_merger = (libftxf_internal_timeline_merger_t *) libftxf_allocator_allocate(
+	                                                                   allocator,
+	                                                                   sizeof( libftxf_internal_timeline_merger_t ) );
+
+	if( internal_timeline_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timeline merger.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_timeline_merger,
+	     0,
+	     sizeof( libftxf_internal_timeline_merger_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear timeline merger.",
+		 function );
+
+		libftxf_allocator_free(
+		 allocator,
+		 internal_timeline_merger );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		internal_timeline_merger->allocator = *allocator;
+	}
+	internal_timeline_merger->runs = (libftxf_timeline_merger_run_t *) libftxf_allocator_allocate(
+	                                                                    &( internal_timeline_merger->allocator ),
+	                                                                    sizeof( libftxf_timeline_merger_run_t ) * number_of_runs );
+
+	if( internal_timeline_merger->runs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create runs.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_timeline_merger->runs,
+	     0,
+	     sizeof( libftxf_timeline_merger_run_t ) * number_of_runs ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear runs.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timeline_merger->losers = (int *) libftxf_allocator_allocate(
+	                                            &( internal_timeline_merger->allocator ),
+	                                            sizeof( int ) * number_of_runs );
+
+	if( internal_timeline_merger->losers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create losers.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timeline_merger->winners = (int *) libftxf_allocator_allocate(
+	                                             &( internal_timeline_merger->allocator ),
+	                                             sizeof( int ) * 2 * number_of_runs );
+
+	if( internal_timeline_merger->winners == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create winners.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timeline_merger->number_of_runs    = number_of_runs;
+	internal_timeline_merger->pending_run_index = -1;
+
+	*timeline_merger = (libftxf_timeline_merger_t *) internal_timeline_merger;
+
+	return( 1 );
+
+on_error:
+	if( internal_timeline_merger != NULL )
+	{
+		if( internal_timeline_merger->losers != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_timeline_merger->allocator ),
+			 internal_timeline_merger->losers );
+		}
+		if( internal_timeline_merger->runs != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_timeline_merger->allocator ),
+			 internal_timeline_merger->runs );
+		}
+		libftxf_allocator_free(
+		 allocator,
+		 internal_timeline_merger );
+	}
+	return( -1 );
+}
+
+/* Frees a timeline merger
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_timeline_merger_free(
+     libftxf_timeline_merger_t **timeline_merger,
+     libcerror_error_t **error )
+{
+	libftxf_allocator_t allocator;
+
+	libftxf_internal_timeline_merger_t *internal_timeline_merger = NULL;
+	static char *function                                        = "libftxf_timeline_merger_free";
+
+	if( timeline_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline merger.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline_merger != NULL )
+	{
+		internal_timeline_merger = (libftxf_internal_timeline_merger_t *) *timeline_merger;
+		*timeline_merger         = NULL;
+
+		libftxf_allocator_free(
+		 &( internal_timeline_merger->allocator ),
+		 internal_timeline_merger->winners );
+
+		libftxf_allocator_free(
+		 &( internal_timeline_merger->allocator ),
+		 internal_timeline_merger->losers );
+
+		libftxf_allocator_free(
+		 &( internal_timeline_merger->allocator ),
+		 internal_timeline_merger->runs );
+
+		/* The allocator is copied since it is stored in the timeline merger that is freed
+		 */
+		allocator = internal_timeline_merger->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
+		 internal_timeline_merger );
+	}
+	return( 1 );
+}
+
+/* Determines if the current entry of the first run is less than that of the second run
+ * An exhausted run is greater than any entry and equal entries are ordered by run index
+ * so that the merge is stable
+ * Returns 1 if less or 0 if not
+ */
+int libftxf_internal_timeline_merger_run_is_less(
+     libftxf_internal_timeline_merger_t *internal_timeline_merger,
+     int first_run_index,
+     int second_run_index )
+{
+	libftxf_timeline_merger_run_t *first_run  = NULL;
+	libftxf_timeline_merger_run_t *second_run = NULL;
+	int result                                = 0;
+
+	first_run  = &( internal_timeline_merger->runs[ first_run_index ] );
+	second_run = &( internal_timeline_merger->runs[ second_run_index ] );
+
+	if( first_run->state == LIBFTXF_TIMELINE_MERGER_RUN_STATE_EXHAUSTED )
+	{
+		if( second_run->state != LIBFTXF_TIMELINE_MERGER_RUN_STATE_EXHAUSTED )
+		{
+			return( 0 );
+		}
+	}
+	else if( second_run->state == LIBFTXF_TIMELINE_MERGER_RUN_STATE_EXHAUSTED )
+	{
+		return( 1 );
+	}
+	else
+	{
+		result = libftxf_timeline_entry_compare(
+		          &( first_run->entry ),
+		          &( second_run->entry ) );
+
+		if( result != 0 )
+		{
+			return( (int) ( result < 0 ) );
+		}
+	}
+	return( (int) ( first_run_index < second_run_index ) );
+}
+
+/* Builds the loser tree
+ * The leaves of the tree are the nodes number of runs to 2 * number of runs - 1,
+ * the internal nodes are the nodes 1 to number of runs - 1
+ */
+void libftxf_internal_timeline_merger_build_tree(
+      libftxf_internal_timeline_merger_t *internal_timeline_merger )
+{
+	int first_run_index  = 0;
+	int node_index       = 0;
+	int number_of_runs   = 0;
+	int second_run_index = 0;
+
+	number_of_runs = internal_timeline_merger->number_of_runs;
+
+	for( node_index = 0;
+	     node_index < number_of_runs;
+	     node_index++ )
+	{
+		internal_timeline_merger->winners[ number_of_runs + node_index ] = node_index;
+	}
+	for( node_index = number_of_runs - 1;
+	     node_index >= 1;
+	     node_index-- )
+	{
+		first_run_index  = internal_timeline_merger->winners[ 2 * node_index ];
+		second_run_index = internal_timeline_merger->winners[ ( 2 * node_index ) + 1 ];
+
+		if( libftxf_internal_timeline_merger_run_is_less(
+		     internal_timeline_merger,
+		     second_run_index,
+		     first_run_index ) != 0 )
+		{
+			internal_timeline_merger->winners[ node_index ] = second_run_index;
+			internal_timeline_merger->losers[ node_index ]  = first_run_index;
+		}
+		else
+		{
+			internal_timeline_merger->winners[ node_index ] = first_run_index;
+			internal_timeline_merger->losers[ node_index ]  = second_run_index;
+		}
+	}
+	internal_timeline_merger->losers[ 0 ]   = internal_timeline_merger->winners[ 1 ];
+	internal_timeline_merger->tree_is_built = 1;
+}
+
+/* Replays the loser tree after the current entry of a run has changed
+ * Only the nodes on the path of the leaf of the run to the root are compared
+ */
+void libftxf_internal_timeline_merger_replay_tree(
+      libftxf_internal_timeline_merger_t *internal_timeline_merger,
+      int run_index )
+{
+	int loser_run_index = 0;
+	int node_index      = 0;
+
+	for( node_index = ( internal_timeline_merger->number_of_runs + run_index ) / 2;
+	     node_index >= 1;
+	     node_index /= 2 )
+	{
+		loser_run_index = internal_timeline_merger->losers[ node_index ];
+
+		if( libftxf_internal_timeline_merger_run_is_less(
+		     internal_timeline_merger,
+		     loser_run_index,
+		     run_index ) != 0 )
+		{
+			internal_timeline_merger->losers[ node_index ] = run_index;
+
+			run_index = loser_run_index;
+		}
+	}
+	internal_timeline_merger->losers[ 0 ] = run_index;
+}
+
+/* Retrieves the index of a run that needs data
+ * Before the first entry is retrieved every run needs data, afterwards only the run
+ * of which the block of the last retrieved entry was consumed
+ * Returns 1 if successful, 0 if no run needs data or -1 on error
+ */
+int libftxf_timeline_merger_get_run_needing_data(
+     libftxf_timeline_merger_t *timeline_merger,
+     int *run_index,
+     libcerror_error_t **error )
+{
+	libftxf_internal_timeline_merger_t *internal_timeline_merger = NULL;
+	static char *function                                        = "libftxf_timeline_merger_get_run_needing_data";
+	int safe_run_index                                           = 0;
+
+	if( timeline_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline merger.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline_merger = (libftxf_internal_timeline_merger_t *) timeline_merger;
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_timeline_merger->tree_is_built != 0 )
+	{
+		if( internal_timeline_merger->pending_run_index == -1 )
+		{
+			return( 0 );
+		}
+		*run_index = internal_timeline_merger->pending_run_index;
+
+		return( 1 );
+	}
+	for( safe_run_index = 0;
+	     safe_run_index < internal_timeline_merger->number_of_runs;
+	     safe_run_index++ )
+	{
+		if( internal_timeline_merger->runs[ safe_run_index ].state == LIBFTXF_TIMELINE_MERGER_RUN_STATE_NEEDS_DATA )
+		{
+			*run_index = safe_run_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Sets the data of the next block of a run
+ * The data contains consecutive timeline entries of LIBFTXF_TIMELINE_ENTRY_SIZE bytes,
+ * a data size of 0 indicates the run is exhausted
+ * The data is not copied and must remain available until the run needs data again
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_timeline_merger_set_run_data(
+     libftxf_timeline_merger_t *timeline_merger,
+     int run_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_timeline_merger_t *internal_timeline_merger = NULL;
+	libftxf_timeline_merger_run_t *run                           = NULL;
+	static char *function                                        = "libftxf_timeline_merger_set_run_data";
+
+	if( timeline_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline merger.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline_merger = (libftxf_internal_timeline_merger_t *) timeline_merger;
+
+	if( ( run_index < 0 )
+	 || ( run_index >= internal_timeline_merger->number_of_runs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid run index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size % LIBFTXF_TIMELINE_ENTRY_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	run = &( internal_timeline_merger->runs[ run_index ] );
+
+	if( run->state != LIBFTXF_TIMELINE_MERGER_RUN_STATE_NEEDS_DATA )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid run: %d - data already set.",
+		 function,
+		 run_index );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		run->data      = NULL;
+		run->data_size = 0;
+		run->state     = LIBFTXF_TIMELINE_MERGER_RUN_STATE_EXHAUSTED;
+	}
+	else
+	{
+		libftxf_timeline_entry_copy_from_byte_stream(
+		 &( run->entry ),
+		 data );
+
+		run->data        = data;
+		run->data_size   = data_size;
+		run->data_offset = 0;
+		run->state       = LIBFTXF_TIMELINE_MERGER_RUN_STATE_HAS_ENTRY;
+	}
+	if( internal_timeline_merger->pending_run_index == run_index )
+	{
+		libftxf_internal_timeline_merger_replay_tree(
+		 internal_timeline_merger,
+		 run_index );
+
+		internal_timeline_merger->pending_run_index = -1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the next entry in timeline order
+ * Returns 1 if successful, 0 if all runs are exhausted or -1 on error
+ */
+int libftxf_timeline_merger_get_next_entry(
+     libftxf_timeline_merger_t *timeline_merger,
+     libftxf_timeline_entry_t *timeline_entry,
+     libcerror_error_t **error )
+{
+	libftxf_internal_timeline_merger_t *internal_timeline_merger = NULL;
+	libftxf_timeline_merger_run_t *run                           = NULL;
+	static char *function                                        = "libftxf_timeline_merger_get_next_entry";
+	int run_index                                                = 0;
+
+	if( timeline_merger == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline merger.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline_merger = (libftxf_internal_timeline_merger_t *) timeline_merger;
+
+	if( timeline_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_timeline_merger->tree_is_built == 0 )
+	{
+		for( run_index = 0;
+		     run_index < internal_timeline_merger->number_of_runs;
+		     run_index++ )
+		{
+			if( internal_timeline_merger->runs[ run_index ].state == LIBFTXF_TIMELINE_MERGER_RUN_STATE_NEEDS_DATA )
+			{
+				break;
+			}
+		}
+		if( run_index < internal_timeline_merger->number_of_runs )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data of run: %d.",
+			 function,
+			 run_index );
+
+			return( -1 );
+		}
+		libftxf_internal_timeline_merger_build_tree(
+		 internal_timeline_merger );
+	}
+	if( internal_timeline_merger->pending_run_index != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing data of run: %d.",
+		 function,
+		 internal_timeline_merger->pending_run_index );
+
+		return( -1 );
+	}
+	run_index = internal_timeline_merger->losers[ 0 ];
+	run       = &( internal_timeline_merger->runs[ run_index ] );
+
+	/* Since an exhausted run is greater than any entry all runs are exhausted
+	 */
+	if( run->state == LIBFTXF_TIMELINE_MERGER_RUN_STATE_EXHAUSTED )
+	{
+		return( 0 );
+	}
+	*timeline_entry = run->entry;
+
+	run->data_offset += LIBFTXF_TIMELINE_ENTRY_SIZE;
+
+	if( run->data_offset < run->data_size )
+	{
+		libftxf_timeline_entry_copy_from_byte_stream(
+		 &( run->entry ),
+		 &( run->data[ run->data_offset ] ) );
+
+		libftxf_internal_timeline_merger_replay_tree(
+		 internal_timeline_merger,
+		 run_index );
+	}
+	else
+	{
+		/* The tree is replayed when the next block of the run is set
+		 */
+		run->data  = NULL;
+		run->state = LIBFTXF_TIMELINE_MERGER_RUN_STATE_NEEDS_DATA;
+
+		internal_timeline_merger->pending_run_index = run_index;
+	}
+	return( 1 );
+}
+
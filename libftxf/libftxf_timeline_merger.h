@@ -0,0 +1,161 @@
+/*
+ * Timeline merger functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_TIMELINE_MERGER_H )
+#define _LIBFTXF_TIMELINE_MERGER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum LIBFTXF_TIMELINE_MERGER_RUN_STATES
+{
+	LIBFTXF_TIMELINE_MERGER_RUN_STATE_NEEDS_DATA		= 0,
+	LIBFTXF_TIMELINE_MERGER_RUN_STATE_HAS_ENTRY		= 1,
+	LIBFTXF_TIMELINE_MERGER_RUN_STATE_EXHAUSTED		= 2
+};
+
+typedef struct libftxf_timeline_merger_run libftxf_timeline_merger_run_t;
+
+struct libftxf_timeline_merger_run
+{
+	/* The current entry
+	 */
+	libftxf_timeline_entry_t entry;
+
+	/* The data of the current block of the run
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data offset of the current entry
+	 */
+	size_t data_offset;
+
+	/* The state
+	 */
+	uint8_t state;
+};
+
+typedef struct libftxf_internal_timeline_merger libftxf_internal_timeline_merger_t;
+
+struct libftxf_internal_timeline_merger
+{
+	/* The number of runs
+	 */
+	int number_of_runs;
+
+	/* The runs
+	 */
+	libftxf_timeline_merger_run_t *runs;
+
+	/* The loser tree
+	 * Contains the run index of the loser of every internal node,
+	 * where the first element contains the run index of the winner
+	 */
+	int *losers;
+
+	/* The winners
+	 * Used to build the loser tree
+	 */
+	int *winners;
+
+	/* The index of the run that needs data before the loser tree can be replayed
+	 * or -1 if not set
+	 */
+	int pending_run_index;
+
+	/* Value to indicate the loser tree was built
+	 */
+	uint8_t tree_is_built;
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the timeline merger and its buffers
+	 */
+	libftxf_allocator_t allocator;
+};
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_merger_initialize(
+     libftxf_timeline_merger_t **timeline_merger,
+     int number_of_runs,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_merger_initialize_with_allocator(
+     libftxf_timeline_merger_t **timeline_merger,
+     int number_of_runs,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_merger_free(
+     libftxf_timeline_merger_t **timeline_merger,
+     libcerror_error_t **error );
+
+int libftxf_internal_timeline_merger_run_is_less(
+     libftxf_internal_timeline_merger_t *internal_timeline_merger,
+     int first_run_index,
+     int second_run_index );
+
+void libftxf_internal_timeline_merger_build_tree(
+      libftxf_internal_timeline_merger_t *internal_timeline_merger );
+
+void libftxf_internal_timeline_merger_replay_tree(
+      libftxf_internal_timeline_merger_t *internal_timeline_merger,
+      int run_index );
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_merger_get_run_needing_data(
+     libftxf_timeline_merger_t *timeline_merger,
+     int *run_index,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_merger_set_run_data(
+     libftxf_timeline_merger_t *timeline_merger,
+     int run_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_merger_get_next_entry(
+     libftxf_timeline_merger_t *timeline_merger,
+     libftxf_timeline_entry_t *timeline_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_TIMELINE_MERGER_H ) */
+
@@ -0,0 +1,795 @@
+/*
+ * Timeline run functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_definitions.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_libcthreads.h"
+#include "libftxf_record.h"
+#include "libftxf_timeline_entry.h"
+#include "libftxf_timeline_run.h"
+
+/* A timeline run contains a memory bounded number of timeline entries that can be sorted
+ * and written to a temporary file, after which the runs are merged by the timeline merger
+ */
+
+/* Creates a timeline run
+ * Make sure the value timeline_run is referencing, is set to NULL
+ * If maximum_number_of_entries is 0 the default maximum number of entries is used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_timeline_run_initialize(
+     libftxf_timeline_run_t **timeline_run,
+     uint32_t maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_timeline_run_initialize";
+
+	if( libftxf_timeline_run_initialize_with_allocator(
+	     timeline_run,
+	     maximum_number_of_entries,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create timeline run.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a timeline run that allocates its memory using the allocator functions
+ * Make sure the value timeline_run is referencing, is set to NULL
+ * If maximum_number_of_entries is 0 the default maximum number of entries is used
+ * The allocator is copied into the timeline run, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_timeline_run_initialize_with_allocator(
+     libftxf_timeline_run_t **timeline_run,
+     uint32_t maximum_number_of_entries,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	libftxf_internal_timeline_run_t *internal_timeline_run = NULL;
+	static char *function                                  = "libftxf_timeline_run_initialize_with_allocator";
+
+	if( timeline_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline run.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline_run != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timeline run value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries == 0 )
+	{
+		maximum_number_of_entries = LIBFTXF_DEFAULT_TIMELINE_RUN_MAXIMUM_NUMBER_OF_ENTRIES;
+	}
+	else if( (size_t) maximum_number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libftxf_timeline_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_timeline_run = (libftxf_internal_timeline_run_t *) libftxf_allocator_allocate(
+	                                                             allocator,
+	                                                             sizeof( libftxf_internal_timeline_run_t ) );
+
+	if( internal_timeline_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timeline run.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_timeline_run,
+	     0,
+	     sizeof( libftxf_internal_timeline_run_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear timeline run.",
+		 function );
+
+		libftxf_allocator_free(
+		 allocator,
+		 internal_timeline_run );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		internal_timeline_run->allocator = *allocator;
+	}
+	internal_timeline_run->entries = (libftxf_timeline_entry_t *) libftxf_allocator_allocate(
+	                                                               &( internal_timeline_run->allocator ),
+	                                                               sizeof( libftxf_timeline_entry_t ) * maximum_number_of_entries );
+
+	if( internal_timeline_run->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timeline_run->sort_entries = (libftxf_timeline_entry_t *) libftxf_allocator_allocate(
+	                                                                    &( internal_timeline_run->allocator ),
+	                                                                    sizeof( libftxf_timeline_entry_t ) * maximum_number_of_entries );
+
+	if( internal_timeline_run->sort_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sort entries.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timeline_run->maximum_number_of_entries = maximum_number_of_entries;
+	internal_timeline_run->is_sorted                 = 1;
+
+	*timeline_run = (libftxf_timeline_run_t *) internal_timeline_run;
+
+	return( 1 );
+
+on_error:
+	if( internal_timeline_run != NULL )
+	{
+		if( internal_timeline_run->entries != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_timeline_run->allocator ),
+			 internal_timeline_run->entries );
+		}
+		libftxf_allocator_free(
+		 allocator,
+		 internal_timeline_run );
+	}
+	return( -1 );
+}
+
+/* Frees a timeline run
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_timeline_run_free(
+     libftxf_timeline_run_t **timeline_run,
+     libcerror_error_t **error )
+{
+	libftxf_allocator_t allocator;
+
+	libftxf_internal_timeline_run_t *internal_timeline_run = NULL;
+	static char *function                                  = "libftxf_timeline_run_free";
+
+	if( timeline_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline run.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline_run != NULL )
+	{
+		internal_timeline_run = (libftxf_internal_timeline_run_t *) *timeline_run;
+		*timeline_run         = NULL;
+
+		libftxf_allocator_free(
+		 &( internal_timeline_run->allocator ),
+		 internal_timeline_run->sort_entries );
+
+		libftxf_allocator_free(
+		 &( internal_timeline_run->allocator ),
+		 internal_timeline_run->entries );
+
+		/* The allocator is copied since it is stored in the timeline run that is freed
+		 */
+		allocator = internal_timeline_run->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
+		 internal_timeline_run );
+	}
+	return( 1 );
+}
+
+/* Empties a timeline run
+ * The allocated entries are kept so that the timeline run can be reused for the next run
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_timeline_run_empty(
+     libftxf_timeline_run_t *timeline_run,
+     libcerror_error_t **error )
+{
+	libftxf_internal_timeline_run_t *internal_timeline_run = NULL;
+	static char *function                                  = "libftxf_timeline_run_empty";
+
+	if( timeline_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline run.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline_run = (libftxf_internal_timeline_run_t *) timeline_run;
+
+	internal_timeline_run->number_of_entries = 0;
+	internal_timeline_run->is_sorted         = 1;
+
+	return( 1 );
+}
+
+/* Appends an entry
+ * FILETIMEs of 0 are not set and are not appended
+ * The caller must ensure that the maximum number of entries is not exceeded
+ * Returns 1 if the entry was appended or 0 if not
+ */
+int libftxf_internal_timeline_run_append_entry(
+     libftxf_internal_timeline_run_t *internal_timeline_run,
+     uint64_t filetime,
+     uint64_t record_offset,
+     uint32_t kind,
+     uint32_t entry_index )
+{
+	libftxf_timeline_entry_t *timeline_entry = NULL;
+
+	if( filetime == 0 )
+	{
+		return( 0 );
+	}
+	timeline_entry = &( internal_timeline_run->entries[ internal_timeline_run->number_of_entries ] );
+
+	timeline_entry->filetime      = filetime;
+	timeline_entry->record_offset = record_offset;
+	timeline_entry->kind          = kind;
+	timeline_entry->entry_index   = entry_index;
+
+	internal_timeline_run->number_of_entries += 1;
+	internal_timeline_run->is_sorted          = 0;
+
+	return( 1 );
+}
+
+/* Appends the timestamps of a record
+ * The entries are the (header) timestamp, the file metadata times and the update times
+ * of the update journal entries, FILETIMEs of 0 are not appended
+ * Either all or none of the timestamps of the record are appended
+ * Returns 1 if successful, 0 if the timeline run is full or -1 on error
+ */
+int libftxf_timeline_run_append_record(
+     libftxf_timeline_run_t *timeline_run,
+     libftxf_record_t *record,
+     uint64_t record_offset,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record             = NULL;
+	libftxf_internal_timeline_run_t *internal_timeline_run = NULL;
+	static char *function                                  = "libftxf_timeline_run_append_record";
+	size_t number_of_record_entries                        = 0;
+	int entry_index                                        = 0;
+
+	if( timeline_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline run.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline_run = (libftxf_internal_timeline_run_t *) timeline_run;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Determine the number of entries of the record up front
+	 * so that the entries of a record are never split over runs
+	 */
+	number_of_record_entries = ( internal_record->timestamp != 0 ) ? 1 : 0;
+
+	if( ( internal_record->flags & LIBFTXF_RECORD_FLAG_HAS_FILE_METADATA ) != 0 )
+	{
+		number_of_record_entries += ( internal_record->file_metadata.creation_time != 0 ) ? 1 : 0;
+		number_of_record_entries += ( internal_record->file_metadata.modification_time != 0 ) ? 1 : 0;
+		number_of_record_entries += ( internal_record->file_metadata.entry_modification_time != 0 ) ? 1 : 0;
+		number_of_record_entries += ( internal_record->file_metadata.access_time != 0 ) ? 1 : 0;
+	}
+	for( entry_index = 0;
+	     entry_index < internal_record->number_of_update_journal_entries;
+	     entry_index++ )
+	{
+		number_of_record_entries += ( internal_record->update_journal_entries[ entry_index ].update_time != 0 ) ? 1 : 0;
+	}
+	if( number_of_record_entries > (size_t) ( internal_timeline_run->maximum_number_of_entries - internal_timeline_run->number_of_entries ) )
+	{
+		if( internal_timeline_run->number_of_entries == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid timeline run - maximum number of entries value too small for record.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		return( 0 );
+	}
+	libftxf_internal_timeline_run_append_entry(
+	 internal_timeline_run,
+	 internal_record->timestamp,
+	 record_offset,
+	 LIBFTXF_TIMELINE_ENTRY_KIND_TIMESTAMP,
+	 0 );
+
+	if( ( internal_record->flags & LIBFTXF_RECORD_FLAG_HAS_FILE_METADATA ) != 0 )
+	{
+		libftxf_internal_timeline_run_append_entry(
+		 internal_timeline_run,
+		 internal_record->file_metadata.creation_time,
+		 record_offset,
+		 LIBFTXF_TIMELINE_ENTRY_KIND_CREATION_TIME,
+		 0 );
+
+		libftxf_internal_timeline_run_append_entry(
+		 internal_timeline_run,
+		 internal_record->file_metadata.modification_time,
+		 record_offset,
+		 LIBFTXF_TIMELINE_ENTRY_KIND_MODIFICATION_TIME,
+		 0 );
+
+		libftxf_internal_timeline_run_append_entry(
+		 internal_timeline_run,
+		 internal_record->file_metadata.entry_modification_time,
+		 record_offset,
+		 LIBFTXF_TIMELINE_ENTRY_KIND_ENTRY_MODIFICATION_TIME,
+		 0 );
+
+		libftxf_internal_timeline_run_append_entry(
+		 internal_timeline_run,
+		 internal_record->file_metadata.access_time,
+		 record_offset,
+		 LIBFTXF_TIMELINE_ENTRY_KIND_ACCESS_TIME,
+		 0 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_record->number_of_update_journal_entries;
+	     entry_index++ )
+	{
+		libftxf_internal_timeline_run_append_entry(
+		 internal_timeline_run,
+		 internal_record->update_journal_entries[ entry_index ].update_time,
+		 record_offset,
+		 LIBFTXF_TIMELINE_ENTRY_KIND_UPDATE_TIME,
+		 (uint32_t) entry_index );
+	}
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_record->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sorts the entries
+ * The entries are sorted by a bottom-up merge sort that alternates between the entries
+ * and the sort entries, hence no allocations are needed
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_timeline_run_sort(
+     libftxf_timeline_run_t *timeline_run,
+     libcerror_error_t **error )
+{
+	libftxf_internal_timeline_run_t *internal_timeline_run = NULL;
+	libftxf_timeline_entry_t *destination_entries          = NULL;
+	libftxf_timeline_entry_t *source_entries               = NULL;
+	static char *function                                  = "libftxf_timeline_run_sort";
+	uint64_t merge_width                                   = 0;
+	uint32_t destination_index                             = 0;
+	uint32_t left_index                                    = 0;
+	uint32_t left_end_index                                = 0;
+	uint32_t number_of_entries                             = 0;
+	uint32_t right_index                                   = 0;
+	uint32_t right_end_index                               = 0;
+
+	if( timeline_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline run.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline_run = (libftxf_internal_timeline_run_t *) timeline_run;
+
+	if( internal_timeline_run->is_sorted != 0 )
+	{
+		return( 1 );
+	}
+	number_of_entries   = internal_timeline_run->number_of_entries;
+	source_entries      = internal_timeline_run->entries;
+	destination_entries = internal_timeline_run->sort_entries;
+
+	for( merge_width = 1;
+	     merge_width < (uint64_t) number_of_entries;
+	     merge_width *= 2 )
+	{
+		for( destination_index = 0;
+		     destination_index < number_of_entries;
+		     destination_index = right_end_index )
+		{
+			left_index      = destination_index;
+			left_end_index  = ( ( number_of_entries - left_index ) > merge_width ) ? left_index + (uint32_t) merge_width : number_of_entries;
+			right_index     = left_end_index;
+			right_end_index = ( ( number_of_entries - right_index ) > merge_width ) ? right_index + (uint32_t) merge_width : number_of_entries;
+
+			while( ( left_index < left_end_index )
+			    && ( right_index < right_end_index ) )
+			{
+				if( libftxf_timeline_entry_compare(
+				     &( source_entries[ right_index ] ),
+				     &( source_entries[ left_index ] ) ) < 0 )
+				{
+					destination_entries[ destination_index++ ] = source_entries[ right_index++ ];
+				}
+				else
+				{
+					destination_entries[ destination_index++ ] = source_entries[ left_index++ ];
+				}
+			}
+			while( left_index < left_end_index )
+			{
+				destination_entries[ destination_index++ ] = source_entries[ left_index++ ];
+			}
+			while( right_index < right_end_index )
+			{
+				destination_entries[ destination_index++ ] = source_entries[ right_index++ ];
+			}
+		}
+		source_entries      = destination_entries;
+		destination_entries = ( source_entries == internal_timeline_run->entries ) ? internal_timeline_run->sort_entries : internal_timeline_run->entries;
+	}
+	/* The sorted entries end up in the last destination of the merge passes
+	 */
+	internal_timeline_run->sort_entries = destination_entries;
+	internal_timeline_run->entries      = source_entries;
+	internal_timeline_run->is_sorted    = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_timeline_run_get_number_of_entries(
+     libftxf_timeline_run_t *timeline_run,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error )
+{
+	libftxf_internal_timeline_run_t *internal_timeline_run = NULL;
+	static char *function                                  = "libftxf_timeline_run_get_number_of_entries";
+
+	if( timeline_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline run.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline_run = (libftxf_internal_timeline_run_t *) timeline_run;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = internal_timeline_run->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_timeline_run_get_entry_by_index(
+     libftxf_timeline_run_t *timeline_run,
+     uint32_t entry_index,
+     libftxf_timeline_entry_t *timeline_entry,
+     libcerror_error_t **error )
+{
+	libftxf_internal_timeline_run_t *internal_timeline_run = NULL;
+	static char *function                                  = "libftxf_timeline_run_get_entry_by_index";
+
+	if( timeline_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline run.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline_run = (libftxf_internal_timeline_run_t *) timeline_run;
+
+	if( entry_index >= internal_timeline_run->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( timeline_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline entry.",
+		 function );
+
+		return( -1 );
+	}
+	*timeline_entry = internal_timeline_run->entries[ entry_index ];
+
+	return( 1 );
+}
+
+/* Copies entries to a byte stream
+ * Copies as many entries, starting with the first entry index, as fit in the byte stream,
+ * where every entry is stored in LIBFTXF_TIMELINE_ENTRY_SIZE bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_timeline_run_copy_to_byte_stream(
+     libftxf_timeline_run_t *timeline_run,
+     uint32_t first_entry_index,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error )
+{
+	libftxf_internal_timeline_run_t *internal_timeline_run = NULL;
+	static char *function                                  = "libftxf_timeline_run_copy_to_byte_stream";
+	size_t byte_stream_offset                              = 0;
+	uint32_t entry_index                                   = 0;
+	uint32_t number_of_copied_entries                      = 0;
+
+	if( timeline_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline run.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline_run = (libftxf_internal_timeline_run_t *) timeline_run;
+
+	if( first_entry_index > internal_timeline_run->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size < LIBFTXF_TIMELINE_ENTRY_SIZE )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_copied_entries = internal_timeline_run->number_of_entries - first_entry_index;
+
+	if( (size_t) number_of_copied_entries > ( byte_stream_size / LIBFTXF_TIMELINE_ENTRY_SIZE ) )
+	{
+		number_of_copied_entries = (uint32_t) ( byte_stream_size / LIBFTXF_TIMELINE_ENTRY_SIZE );
+	}
+	for( entry_index = first_entry_index;
+	     entry_index < ( first_entry_index + number_of_copied_entries );
+	     entry_index++ )
+	{
+		libftxf_timeline_entry_copy_to_byte_stream(
+		 &( internal_timeline_run->entries[ entry_index ] ),
+		 &( byte_stream[ byte_stream_offset ] ) );
+
+		byte_stream_offset += LIBFTXF_TIMELINE_ENTRY_SIZE;
+	}
+	*number_of_entries = number_of_copied_entries;
+
+	return( 1 );
+}
+
@@ -0,0 +1,136 @@
+/*
+ * Timeline run functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_TIMELINE_RUN_H )
+#define _LIBFTXF_TIMELINE_RUN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libftxf_internal_timeline_run libftxf_internal_timeline_run_t;
+
+struct libftxf_internal_timeline_run
+{
+	/* The maximum number of entries
+	 */
+	uint32_t maximum_number_of_entries;
+
+	/* The entries
+	 */
+	libftxf_timeline_entry_t *entries;
+
+	/* The sort entries
+	 * Used as the destination of the merge passes of the sort
+	 */
+	libftxf_timeline_entry_t *sort_entries;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* Value to indicate the entries are sorted
+	 */
+	uint8_t is_sorted;
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the timeline run and its buffers
+	 */
+	libftxf_allocator_t allocator;
+};
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_run_initialize(
+     libftxf_timeline_run_t **timeline_run,
+     uint32_t maximum_number_of_entries,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_run_initialize_with_allocator(
+     libftxf_timeline_run_t **timeline_run,
+     uint32_t maximum_number_of_entries,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_run_free(
+     libftxf_timeline_run_t **timeline_run,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_run_empty(
+     libftxf_timeline_run_t *timeline_run,
+     libcerror_error_t **error );
+
+int libftxf_internal_timeline_run_append_entry(
+     libftxf_internal_timeline_run_t *internal_timeline_run,
+     uint64_t filetime,
+     uint64_t record_offset,
+     uint32_t kind,
+     uint32_t entry_index );
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_run_append_record(
+     libftxf_timeline_run_t *timeline_run,
+     libftxf_record_t *txf_record,
+     uint64_t record_offset,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_run_sort(
+     libftxf_timeline_run_t *timeline_run,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_run_get_number_of_entries(
+     libftxf_timeline_run_t *timeline_run,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_run_get_entry_by_index(
+     libftxf_timeline_run_t *timeline_run,
+     uint32_t entry_index,
+     libftxf_timeline_entry_t *timeline_entry,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_timeline_run_copy_to_byte_stream(
+     libftxf_timeline_run_t *timeline_run,
+     uint32_t first_entry_index,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_TIMELINE_RUN_H ) */
+
@@ -34,13 +34,143 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
-typedef struct libftxf_record {}	libftxf_record_t;
+typedef struct libftxf_block_index {}		libftxf_block_index_t;
+typedef struct libftxf_column_reader {}		libftxf_column_reader_t;
+typedef struct libftxf_column_writer {}		libftxf_column_writer_t;
+typedef struct libftxf_duplicate_filter {}	libftxf_duplicate_filter_t;
+typedef struct libftxf_name_pool {}		libftxf_name_pool_t;
+typedef struct libftxf_name_search {}		libftxf_name_search_t;
+typedef struct libftxf_path_resolver {}		libftxf_path_resolver_t;
+typedef struct libftxf_record {}		libftxf_record_t;
+typedef struct libftxf_record_diff {}		libftxf_record_diff_t;
+typedef struct libftxf_record_filter {}		libftxf_record_filter_t;
+typedef struct libftxf_record_merger {}		libftxf_record_merger_t;
+typedef struct libftxf_timeline_merger {}	libftxf_timeline_merger_t;
+typedef struct libftxf_timeline_run {}		libftxf_timeline_run_t;
+typedef struct libftxf_usn_join {}		libftxf_usn_join_t;
 
 #else
+typedef intptr_t libftxf_block_index_t;
+typedef intptr_t libftxf_column_reader_t;
+typedef intptr_t libftxf_column_writer_t;
+typedef intptr_t libftxf_duplicate_filter_t;
+typedef intptr_t libftxf_name_pool_t;
+typedef intptr_t libftxf_name_search_t;
+typedef intptr_t libftxf_path_resolver_t;
 typedef intptr_t libftxf_record_t;
+typedef intptr_t libftxf_record_diff_t;
+typedef intptr_t libftxf_record_filter_t;
+typedef intptr_t libftxf_record_merger_t;
+typedef intptr_t libftxf_timeline_merger_t;
+typedef intptr_t libftxf_timeline_run_t;
+typedef intptr_t libftxf_usn_join_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The file metadata of a record
+ * The values are ordered by size, hence the structure has a fixed size of 56 bytes without padding
+ */
+typedef struct libftxf_file_metadata libftxf_file_metadata_t;
+
+struct libftxf_file_metadata
+{
+	/* The creation time
+	 * Contains a FILETIME
+	 */
+	uint64_t creation_time;
+
+	/* The modification time
+	 * Contains a FILETIME
+	 */
+	uint64_t modification_time;
+
+	/* The entry modification time
+	 * Contains a FILETIME
+	 */
+	uint64_t entry_modification_time;
+
+	/* The access time
+	 * Contains a FILETIME
+	 */
+	uint64_t access_time;
+
+	/* The allocated file size
+	 */
+	uint64_t allocated_file_size;
+
+	/* The file size
+	 */
+	uint64_t file_size;
+
+	/* The file attribute flags
+	 */
+	uint32_t file_attribute_flags;
+
+	/* Reserved
+	 * Always 0
+	 */
+	uint32_t reserved;
+};
+
+/* A timeline entry
+ */
+typedef struct libftxf_timeline_entry libftxf_timeline_entry_t;
+
+struct libftxf_timeline_entry
+{
+	/* The FILETIME
+	 */
+	uint64_t filetime;
+
+	/* The offset of the record in the log
+	 */
+	uint64_t record_offset;
+
+	/* The kind of timestamp
+	 * Contains a LIBFTXF_TIMELINE_ENTRY_KIND value
+	 */
+	uint32_t kind;
+
+	/* The index of the update journal entry
+	 * Only used for the LIBFTXF_TIMELINE_ENTRY_KIND_UPDATE_TIME kind, 0 otherwise
+	 */
+	uint32_t entry_index;
+};
+
+/* The allocator functions
+ * The user context is passed to the functions, for example to route the allocations
+ * of an object to a specific memory pool
+ */
+typedef struct libftxf_allocator libftxf_allocator_t;
+
+struct libftxf_allocator
+{
+	/* The allocate function
+	 * Returns a pointer to the allocated memory or NULL on error
+	 */
+	void *(*allocate_function)(
+	         intptr_t *user_context,
+	         size_t size );
+
+	/* The reallocate function
+	 * Returns a pointer to the reallocated memory or NULL on error
+	 */
+	void *(*reallocate_function)(
+	         intptr_t *user_context,
+	         void *memory,
+	         size_t size );
+
+	/* The free function
+	 */
+	void (*free_function)(
+	        intptr_t *user_context,
+	        void *memory );
+
+	/* The user context
+	 */
+	intptr_t *user_context;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBFTXF ) */
 
 #endif /* !defined( _LIBFTXF_INTERNAL_TYPES_H ) */
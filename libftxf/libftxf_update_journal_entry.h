@@ -0,0 +1,81 @@
+/*
+ * Update journal entry
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_UPDATE_JOURNAL_ENTRY_H )
+#define _LIBFTXF_UPDATE_JOURNAL_ENTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libftxf_update_journal_entry libftxf_update_journal_entry_t;
+
+/* The values of an update journal (USN) entry stored in an update journal entries list record
+ */
+struct libftxf_update_journal_entry
+{
+	/* The update sequence number
+	 */
+	uint64_t update_sequence_number;
+
+	/* The update time
+	 * Contains a FILETIME
+	 */
+	uint64_t update_time;
+
+	/* The file reference
+	 */
+	uint64_t file_reference;
+
+	/* The parent file reference
+	 */
+	uint64_t parent_file_reference;
+
+	/* The update reason flags
+	 */
+	uint32_t update_reason_flags;
+
+	/* The update source flags
+	 */
+	uint32_t update_source_flags;
+
+	/* The file attribute flags
+	 */
+	uint32_t file_attribute_flags;
+
+	/* The offset of the UTF-8 encoded name in the update journal entry names of the record
+	 */
+	size_t name_offset;
+
+	/* The size of the UTF-8 encoded name including the end-of-string character
+	 */
+	size_t name_size;
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_UPDATE_JOURNAL_ENTRY_H ) */
+
@@ -0,0 +1,1448 @@
+/*
+ * Update journal (USN) join functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libftxf_allocator.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_libcthreads.h"
+#include "libftxf_libfusn.h"
+#include "libftxf_record.h"
+#include "libftxf_update_journal_entry.h"
+#include "libftxf_usn_join.h"
+
+/* The initial allocated number of entries
+ */
+#define LIBFTXF_USN_JOIN_INITIAL_NUMBER_OF_ENTRIES	1024
+
+/* The initial hash table size, must be a power of 2
+ */
+#define LIBFTXF_USN_JOIN_INITIAL_HASH_TABLE_SIZE	4096
+
+/* The minimum size of an USN record, which is the size of the version 2 record header
+ */
+#define LIBFTXF_USN_JOIN_MINIMUM_RECORD_SIZE		60
+
+/* The maximum size of an USN record, which is the size of the version 2 record header
+ * with a name of 255 UTF-16 characters aligned to 8 bytes
+ */
+#define LIBFTXF_USN_JOIN_MAXIMUM_RECORD_SIZE		576
+
+/* Calculates the hash table index of a file reference and update sequence number
+ */
+#define libftxf_usn_join_entry_hash( file_reference, update_sequence_number, hash_table_mask ) \
+	( (uint32_t) ( ( ( ( file_reference ) ^ ( ( update_sequence_number ) * 0x9e3779b97f4a7c15UL ) ) * 0xff51afd7ed558ccdUL ) >> 32 ) & ( hash_table_mask ) )
+
+/* Calculates the hash table index of a file reference
+ */
+#define libftxf_usn_join_file_hash( file_reference, hash_table_mask ) \
+	( (uint32_t) ( ( ( file_reference ) * 0xff51afd7ed558ccdUL ) >> 32 ) & ( hash_table_mask ) )
+
+/* The USN join reads the records of a standalone $UsnJrnl:$J stream in a single pass
+ * and stores the values of every record in journal order. An entry hash table keyed
+ * on the file reference and update sequence number (USN) is used to look up the USN
+ * record of an update journal entry embedded in a TxF record, a file hash table keyed
+ * on the file reference is used to iterate the USN records of the file reference of
+ * a TxF record header. The names of the USN records are not stored.
+ */
+
+/* Creates an USN join
+ * Make sure the value usn_join is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_usn_join_initialize(
+     libftxf_usn_join_t **usn_join,
+     libcerror_error_t **error )
+{
+	static char *function = "libftxf_usn_join_initialize";
+
+	if( libftxf_usn_join_initialize_with_allocator(
+	     usn_join,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create USN join.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates an USN join that allocates its memory using the allocator functions
+ * Make sure the value usn_join is referencing, is set to NULL
+ * The allocator is copied into the USN join, if no allocator is provided
+ * the default memory functions are used
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_usn_join_initialize_with_allocator(
+     libftxf_usn_join_t **usn_join,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	libftxf_internal_usn_join_t *internal_usn_join = NULL;
+	static char *function                          = "libftxf_usn_join_initialize_with_allocator";
+
+	if( usn_join == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN join.",
+		 function );
+
+		return( -1 );
+	}
+	if( *usn_join != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid USN join value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		if( libftxf_allocator_check(
+		     allocator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid allocator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_usn_join = (libftxf_internal_usn_join_t *) libftxf_allocator_allocate(
+	                                                     allocator,
+	                                                     sizeof( libftxf_internal_usn_join_t ) );
+
+	if( internal_usn_join == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create USN join.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_usn_join,
+	     0,
+	     sizeof( libftxf_internal_usn_join_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear USN join.",
+		 function );
+
+		libftxf_allocator_free(
+		 allocator,
+		 internal_usn_join );
+
+		return( -1 );
+	}
+	if( allocator != NULL )
+	{
+		internal_usn_join->allocator = *allocator;
+	}
+	internal_usn_join->entry_hash_table_size = LIBFTXF_USN_JOIN_INITIAL_HASH_TABLE_SIZE;
+
+	internal_usn_join->entry_hash_table = (uint32_t *) libftxf_allocator_allocate(
+	                                                    &( internal_usn_join->allocator ),
+	                                                    sizeof( uint32_t ) * internal_usn_join->entry_hash_table_size );
+
+	if( internal_usn_join->entry_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_usn_join->entry_hash_table,
+	     0,
+	     sizeof( uint32_t ) * internal_usn_join->entry_hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry hash table.",
+		 function );
+
+		goto on_error;
+	}
+	internal_usn_join->file_hash_table_size = LIBFTXF_USN_JOIN_INITIAL_HASH_TABLE_SIZE;
+
+	internal_usn_join->file_hash_table = (libftxf_usn_join_file_t *) libftxf_allocator_allocate(
+	                                                                  &( internal_usn_join->allocator ),
+	                                                                  sizeof( libftxf_usn_join_file_t ) * internal_usn_join->file_hash_table_size );
+
+	if( internal_usn_join->file_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_usn_join->file_hash_table,
+	     0,
+	     sizeof( libftxf_usn_join_file_t ) * internal_usn_join->file_hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfusn_record_initialize(
+	     &( internal_usn_join->usn_record ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create USN record.",
+		 function );
+
+		goto on_error;
+	}
+	*usn_join = (libftxf_usn_join_t *) internal_usn_join;
+
+	return( 1 );
+
+on_error:
+	if( internal_usn_join != NULL )
+	{
+		if( internal_usn_join->file_hash_table != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_usn_join->allocator ),
+			 internal_usn_join->file_hash_table );
+		}
+		if( internal_usn_join->entry_hash_table != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_usn_join->allocator ),
+			 internal_usn_join->entry_hash_table );
+		}
+		libftxf_allocator_free(
+		 allocator,
+		 internal_usn_join );
+	}
+	return( -1 );
+}
+
+/* Frees an USN join
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_usn_join_free(
+     libftxf_usn_join_t **usn_join,
+     libcerror_error_t **error )
+{
+	libftxf_allocator_t allocator;
+
+	libftxf_internal_usn_join_t *internal_usn_join = NULL;
+	static char *function                          = "libftxf_usn_join_free";
+	int result                                     = 1;
+
+	if( usn_join == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN join.",
+		 function );
+
+		return( -1 );
+	}
+	if( *usn_join != NULL )
+	{
+		internal_usn_join = (libftxf_internal_usn_join_t *) *usn_join;
+		*usn_join         = NULL;
+
+		if( libfusn_record_free(
+		     &( internal_usn_join->usn_record ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free USN record.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_usn_join->entries != NULL )
+		{
+			libftxf_allocator_free(
+			 &( internal_usn_join->allocator ),
+			 internal_usn_join->entries );
+		}
+		libftxf_allocator_free(
+		 &( internal_usn_join->allocator ),
+		 internal_usn_join->file_hash_table );
+
+		libftxf_allocator_free(
+		 &( internal_usn_join->allocator ),
+		 internal_usn_join->entry_hash_table );
+
+		/* The allocator is copied since it is stored in the USN join that is freed
+		 */
+		allocator = internal_usn_join->allocator;
+
+		libftxf_allocator_free(
+		 &allocator,
+		 internal_usn_join );
+	}
+	return( result );
+}
+
+/* Doubles the size of the entry hash table and re-inserts the entries
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_usn_join_resize_entry_hash_table(
+     libftxf_internal_usn_join_t *internal_usn_join,
+     libcerror_error_t **error )
+{
+	libftxf_usn_join_entry_t *entry = NULL;
+	uint32_t *hash_table            = NULL;
+	static char *function           = "libftxf_internal_usn_join_resize_entry_hash_table";
+	uint32_t entry_index            = 0;
+	uint32_t hash_table_index       = 0;
+	uint32_t hash_table_mask        = 0;
+	uint32_t hash_table_size        = 0;
+
+	if( internal_usn_join == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN join.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_usn_join->entry_hash_table_size > ( (uint32_t) INT32_MAX ) )
+	 || ( (size_t) internal_usn_join->entry_hash_table_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( uint32_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN join - entry hash table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_size = internal_usn_join->entry_hash_table_size * 2;
+	hash_table_mask = hash_table_size - 1;
+
+	hash_table = (uint32_t *) libftxf_allocator_allocate(
+	                           &( internal_usn_join->allocator ),
+	                           sizeof( uint32_t ) * hash_table_size );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( uint32_t ) * hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry hash table.",
+		 function );
+
+		libftxf_allocator_free(
+		 &( internal_usn_join->allocator ),
+		 hash_table );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_usn_join->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( internal_usn_join->entries[ entry_index ] );
+
+		hash_table_index = libftxf_usn_join_entry_hash(
+		                    entry->file_reference,
+		                    entry->update_sequence_number,
+		                    hash_table_mask );
+
+		while( hash_table[ hash_table_index ] != 0 )
+		{
+			hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+		}
+		hash_table[ hash_table_index ] = entry_index + 1;
+	}
+	libftxf_allocator_free(
+	 &( internal_usn_join->allocator ),
+	 internal_usn_join->entry_hash_table );
+
+	internal_usn_join->entry_hash_table      = hash_table;
+	internal_usn_join->entry_hash_table_size = hash_table_size;
+
+	return( 1 );
+}
+
+/* Doubles the size of the file hash table and re-inserts the files
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_usn_join_resize_file_hash_table(
+     libftxf_internal_usn_join_t *internal_usn_join,
+     libcerror_error_t **error )
+{
+	libftxf_usn_join_file_t *file       = NULL;
+	libftxf_usn_join_file_t *hash_table = NULL;
+	static char *function               = "libftxf_internal_usn_join_resize_file_hash_table";
+	uint32_t file_index                 = 0;
+	uint32_t hash_table_index           = 0;
+	uint32_t hash_table_mask            = 0;
+	uint32_t hash_table_size            = 0;
+
+	if( internal_usn_join == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN join.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_usn_join->file_hash_table_size > ( (uint32_t) INT32_MAX ) )
+	 || ( (size_t) internal_usn_join->file_hash_table_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libftxf_usn_join_file_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN join - file hash table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_size = internal_usn_join->file_hash_table_size * 2;
+	hash_table_mask = hash_table_size - 1;
+
+	hash_table = (libftxf_usn_join_file_t *) libftxf_allocator_allocate(
+	                                          &( internal_usn_join->allocator ),
+	                                          sizeof( libftxf_usn_join_file_t ) * hash_table_size );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( libftxf_usn_join_file_t ) * hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file hash table.",
+		 function );
+
+		libftxf_allocator_free(
+		 &( internal_usn_join->allocator ),
+		 hash_table );
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     file_index < internal_usn_join->file_hash_table_size;
+	     file_index++ )
+	{
+		file = &( internal_usn_join->file_hash_table[ file_index ] );
+
+		if( file->first_entry_index == 0 )
+		{
+			continue;
+		}
+		hash_table_index = libftxf_usn_join_file_hash(
+		                    internal_usn_join->entries[ file->first_entry_index - 1 ].file_reference,
+		                    hash_table_mask );
+
+		while( hash_table[ hash_table_index ].first_entry_index != 0 )
+		{
+			hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+		}
+		hash_table[ hash_table_index ] = *file;
+	}
+	libftxf_allocator_free(
+	 &( internal_usn_join->allocator ),
+	 internal_usn_join->file_hash_table );
+
+	internal_usn_join->file_hash_table      = hash_table;
+	internal_usn_join->file_hash_table_size = hash_table_size;
+
+	return( 1 );
+}
+
+/* Appends the values of the USN record as an entry
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_internal_usn_join_append_entry(
+     libftxf_internal_usn_join_t *internal_usn_join,
+     uint64_t journal_offset,
+     libcerror_error_t **error )
+{
+	libftxf_usn_join_entry_t *entry      = NULL;
+	libftxf_usn_join_file_t *file        = NULL;
+	void *reallocation                   = NULL;
+	static char *function                = "libftxf_internal_usn_join_append_entry";
+	uint32_t allocated_number_of_entries = 0;
+	uint32_t entry_index                 = 0;
+	uint32_t hash_table_index            = 0;
+	uint32_t hash_table_mask             = 0;
+
+	if( internal_usn_join == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN join.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_usn_join->number_of_entries >= ( (uint32_t) INT32_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid USN join - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_usn_join->number_of_entries >= internal_usn_join->allocated_number_of_entries )
+	{
+		allocated_number_of_entries = internal_usn_join->allocated_number_of_entries * 2;
+
+		if( allocated_number_of_entries == 0 )
+		{
+			allocated_number_of_entries = LIBFTXF_USN_JOIN_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		if( (size_t) allocated_number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libftxf_usn_join_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = libftxf_allocator_reallocate(
+		                &( internal_usn_join->allocator ),
+		                internal_usn_join->entries,
+		                sizeof( libftxf_usn_join_entry_t ) * allocated_number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_usn_join->entries                     = (libftxf_usn_join_entry_t *) reallocation;
+		internal_usn_join->allocated_number_of_entries = allocated_number_of_entries;
+	}
+	entry_index = internal_usn_join->number_of_entries;
+	entry       = &( internal_usn_join->entries[ entry_index ] );
+
+	if( memory_set(
+	     entry,
+	     0,
+	     sizeof( libftxf_usn_join_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		return( -1 );
+	}
+	entry->journal_offset = journal_offset;
+
+	if( libfusn_record_get_update_sequence_number(
+	     internal_usn_join->usn_record,
+	     &( entry->update_sequence_number ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_update_time(
+	     internal_usn_join->usn_record,
+	     &( entry->update_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_file_reference(
+	     internal_usn_join->usn_record,
+	     &( entry->file_reference ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_parent_file_reference(
+	     internal_usn_join->usn_record,
+	     &( entry->parent_file_reference ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_update_reason_flags(
+	     internal_usn_join->usn_record,
+	     &( entry->update_reason_flags ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update reason flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_update_source_flags(
+	     internal_usn_join->usn_record,
+	     &( entry->update_source_flags ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update source flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfusn_record_get_file_attribute_flags(
+	     internal_usn_join->usn_record,
+	     &( entry->file_attribute_flags ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file attribute flags.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_mask  = internal_usn_join->entry_hash_table_size - 1;
+	hash_table_index = libftxf_usn_join_entry_hash(
+	                    entry->file_reference,
+	                    entry->update_sequence_number,
+	                    hash_table_mask );
+
+	while( internal_usn_join->entry_hash_table[ hash_table_index ] != 0 )
+	{
+		hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+	}
+	internal_usn_join->entry_hash_table[ hash_table_index ] = entry_index + 1;
+
+	/* Link the entry to the previous entry of the same file reference
+	 */
+	hash_table_mask  = internal_usn_join->file_hash_table_size - 1;
+	hash_table_index = libftxf_usn_join_file_hash(
+	                    entry->file_reference,
+	                    hash_table_mask );
+
+	file = &( internal_usn_join->file_hash_table[ hash_table_index ] );
+
+	while( file->first_entry_index != 0 )
+	{
+		if( internal_usn_join->entries[ file->first_entry_index - 1 ].file_reference == entry->file_reference )
+		{
+			break;
+		}
+		hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+
+		file = &( internal_usn_join->file_hash_table[ hash_table_index ] );
+	}
+	if( file->first_entry_index == 0 )
+	{
+		file->first_entry_index = entry_index + 1;
+
+		internal_usn_join->number_of_files += 1;
+	}
+	else
+	{
+		internal_usn_join->entries[ file->last_entry_index ].next_file_entry_index = entry_index + 1;
+	}
+	file->last_entry_index = entry_index;
+
+	internal_usn_join->number_of_entries += 1;
+
+	/* Keep the load factor of the hash tables at or below 0.5
+	 */
+	if( ( internal_usn_join->number_of_entries * 2 ) > internal_usn_join->entry_hash_table_size )
+	{
+		if( libftxf_internal_usn_join_resize_entry_hash_table(
+		     internal_usn_join,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize entry hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_usn_join->number_of_files * 2 ) > internal_usn_join->file_hash_table_size )
+	{
+		if( libftxf_internal_usn_join_resize_file_hash_table(
+		     internal_usn_join,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize file hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the USN records in a chunk of $UsnJrnl:$J stream data
+ * The data offset is the offset of the data in the stream and should be a multiple of 8
+ * Sparse or zero padded data and corrupted USN records are skipped in steps of 8 bytes,
+ * records with an unsupported version are skipped entirely
+ * Reading stops at a record that is not fully contained in the data, the read size is
+ * set to the number of bytes that were consumed so that the caller can read the remainder
+ * with the next chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_usn_join_read_journal_data(
+     libftxf_usn_join_t *usn_join,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t data_offset,
+     size_t *read_size,
+     libcerror_error_t **error )
+{
+	libftxf_internal_usn_join_t *internal_usn_join = NULL;
+	static char *function                          = "libftxf_usn_join_read_journal_data";
+	size_t record_data_offset                      = 0;
+	uint32_t record_size                           = 0;
+	uint16_t major_version                         = 0;
+
+	if( usn_join == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN join.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_join = (libftxf_internal_usn_join_t *) usn_join;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( data_size - record_data_offset ) >= 8 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ record_data_offset ] ),
+		 record_size );
+
+		if( ( record_size < LIBFTXF_USN_JOIN_MINIMUM_RECORD_SIZE )
+		 || ( record_size > LIBFTXF_USN_JOIN_MAXIMUM_RECORD_SIZE )
+		 || ( ( record_size % 8 ) != 0 ) )
+		{
+			record_data_offset += 8;
+
+			continue;
+		}
+		if( (size_t) record_size > ( data_size - record_data_offset ) )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ record_data_offset + 4 ] ),
+		 major_version );
+
+		if( major_version != 2 )
+		{
+			record_data_offset += (size_t) record_size;
+
+			continue;
+		}
+		if( libfusn_record_copy_from_byte_stream(
+		     internal_usn_join->usn_record,
+		     &( data[ record_data_offset ] ),
+		     (size_t) record_size,
+		     error ) != 1 )
+		{
+			/* The USN record is corrupted, for example the name is out of bounds
+			 */
+			libcerror_error_free(
+			 error );
+
+			record_data_offset += 8;
+
+			continue;
+		}
+		if( libftxf_internal_usn_join_append_entry(
+		     internal_usn_join,
+		     data_offset + (uint64_t) record_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry.",
+			 function );
+
+			return( -1 );
+		}
+		record_data_offset += (size_t) record_size;
+	}
+	*read_size = record_data_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_usn_join_get_number_of_entries(
+     libftxf_usn_join_t *usn_join,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libftxf_internal_usn_join_t *internal_usn_join = NULL;
+	static char *function                          = "libftxf_usn_join_get_number_of_entries";
+
+	if( usn_join == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN join.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_join = (libftxf_internal_usn_join_t *) usn_join;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = (int) internal_usn_join->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the values of a specific entry
+ * The update time is a FILETIME value
+ * Returns 1 if successful or -1 on error
+ */
+int libftxf_usn_join_get_entry_values(
+     libftxf_usn_join_t *usn_join,
+     int entry_index,
+     uint64_t *journal_offset,
+     uint64_t *update_sequence_number,
+     uint64_t *update_time,
+     uint64_t *file_reference,
+     uint64_t *parent_file_reference,
+     uint32_t *update_reason_flags,
+     uint32_t *update_source_flags,
+     uint32_t *file_attribute_flags,
+     libcerror_error_t **error )
+{
+	libftxf_internal_usn_join_t *internal_usn_join = NULL;
+	libftxf_usn_join_entry_t *entry                = NULL;
+	static char *function                          = "libftxf_usn_join_get_entry_values";
+
+	if( usn_join == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN join.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_join = (libftxf_internal_usn_join_t *) usn_join;
+
+	if( ( entry_index < 0 )
+	 || ( (uint32_t) entry_index >= internal_usn_join->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_sequence_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update time.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_reason_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update reason flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_source_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update source flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_attribute_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file attribute flags.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_usn_join->entries[ entry_index ] );
+
+	*journal_offset         = entry->journal_offset;
+	*update_sequence_number = entry->update_sequence_number;
+	*update_time            = entry->update_time;
+	*file_reference         = entry->file_reference;
+	*parent_file_reference  = entry->parent_file_reference;
+	*update_reason_flags    = entry->update_reason_flags;
+	*update_source_flags    = entry->update_source_flags;
+	*file_attribute_flags   = entry->file_attribute_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the entry with a specific file reference and update sequence number
+ * If the journal contains the same USN record multiple times the index of the first entry is returned
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libftxf_usn_join_get_entry_index_by_update_sequence_number(
+     libftxf_usn_join_t *usn_join,
+     uint64_t file_reference,
+     uint64_t update_sequence_number,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libftxf_internal_usn_join_t *internal_usn_join = NULL;
+	libftxf_usn_join_entry_t *entry                = NULL;
+	static char *function                          = "libftxf_usn_join_get_entry_index_by_update_sequence_number";
+	uint32_t hash_table_index                      = 0;
+	uint32_t hash_table_mask                       = 0;
+
+	if( usn_join == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN join.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_join = (libftxf_internal_usn_join_t *) usn_join;
+
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_mask  = internal_usn_join->entry_hash_table_size - 1;
+	hash_table_index = libftxf_usn_join_entry_hash(
+	                    file_reference,
+	                    update_sequence_number,
+	                    hash_table_mask );
+
+	while( internal_usn_join->entry_hash_table[ hash_table_index ] != 0 )
+	{
+		entry = &( internal_usn_join->entries[ internal_usn_join->entry_hash_table[ hash_table_index ] - 1 ] );
+
+		if( ( entry->file_reference == file_reference )
+		 && ( entry->update_sequence_number == update_sequence_number ) )
+		{
+			*entry_index = (int) ( internal_usn_join->entry_hash_table[ hash_table_index ] - 1 );
+
+			return( 1 );
+		}
+		hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the entry that corresponds to a specific update journal entry of a record
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libftxf_usn_join_match_update_journal_entry(
+     libftxf_usn_join_t *usn_join,
+     libftxf_record_t *record,
+     int update_journal_entry_index,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libftxf_internal_record_t *internal_record           = NULL;
+	libftxf_update_journal_entry_t *update_journal_entry = NULL;
+	static char *function                                = "libftxf_usn_join_match_update_journal_entry";
+	uint64_t file_reference                              = 0;
+	uint64_t update_sequence_number                      = 0;
+	int result                                           = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libftxf_internal_record_t *) record;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libftxf_internal_record_get_update_journal_entry_by_index(
+	     internal_record,
+	     update_journal_entry_index,
+	     &update_journal_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve update journal entry: %d.",
+		 function,
+		 update_journal_entry_index );
+
+		goto on_error;
+	}
+	file_reference         = update_journal_entry->file_reference;
+	update_sequence_number = update_journal_entry->update_sequence_number;
+
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libftxf_usn_join_get_entry_index_by_update_sequence_number(
+	          usn_join,
+	          file_reference,
+	          update_sequence_number,
+	          entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry index.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFTXF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_record->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the index of the first entry, in journal order, with a specific file reference
+ * Use with the file reference of a record to correlate the record with the journal
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libftxf_usn_join_get_first_file_entry_index(
+     libftxf_usn_join_t *usn_join,
+     uint64_t file_reference,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libftxf_internal_usn_join_t *internal_usn_join = NULL;
+	libftxf_usn_join_file_t *file                  = NULL;
+	static char *function                          = "libftxf_usn_join_get_first_file_entry_index";
+	uint32_t hash_table_index                      = 0;
+	uint32_t hash_table_mask                       = 0;
+
+	if( usn_join == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN join.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_join = (libftxf_internal_usn_join_t *) usn_join;
+
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_mask  = internal_usn_join->file_hash_table_size - 1;
+	hash_table_index = libftxf_usn_join_file_hash(
+	                    file_reference,
+	                    hash_table_mask );
+
+	file = &( internal_usn_join->file_hash_table[ hash_table_index ] );
+
+	while( file->first_entry_index != 0 )
+	{
+		if( internal_usn_join->entries[ file->first_entry_index - 1 ].file_reference == file_reference )
+		{
+			*entry_index = (int) ( file->first_entry_index - 1 );
+
+			return( 1 );
+		}
+		hash_table_index = ( hash_table_index + 1 ) & hash_table_mask;
+
+		file = &( internal_usn_join->file_hash_table[ hash_table_index ] );
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the next entry, in journal order, with the same file reference as a specific entry
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libftxf_usn_join_get_next_file_entry_index(
+     libftxf_usn_join_t *usn_join,
+     int entry_index,
+     int *next_entry_index,
+     libcerror_error_t **error )
+{
+	libftxf_internal_usn_join_t *internal_usn_join = NULL;
+	static char *function                          = "libftxf_usn_join_get_next_file_entry_index";
+	uint32_t next_file_entry_index                 = 0;
+
+	if( usn_join == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN join.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_join = (libftxf_internal_usn_join_t *) usn_join;
+
+	if( ( entry_index < 0 )
+	 || ( (uint32_t) entry_index >= internal_usn_join->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next entry index.",
+		 function );
+
+		return( -1 );
+	}
+	next_file_entry_index = internal_usn_join->entries[ entry_index ].next_file_entry_index;
+
+	if( next_file_entry_index == 0 )
+	{
+		return( 0 );
+	}
+	*next_entry_index = (int) ( next_file_entry_index - 1 );
+
+	return( 1 );
+}
+
@@ -0,0 +1,241 @@
+/*
+ * Update journal (USN) join functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFTXF_USN_JOIN_H )
+#define _LIBFTXF_USN_JOIN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libftxf_extern.h"
+#include "libftxf_libcerror.h"
+#include "libftxf_libfusn.h"
+#include "libftxf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libftxf_usn_join_entry libftxf_usn_join_entry_t;
+
+/* The values of an update journal (USN) entry stored in a $UsnJrnl:$J stream
+ */
+struct libftxf_usn_join_entry
+{
+	/* The offset of the entry in the journal
+	 */
+	uint64_t journal_offset;
+
+	/* The update sequence number
+	 */
+	uint64_t update_sequence_number;
+
+	/* The update time
+	 * Contains a FILETIME
+	 */
+	uint64_t update_time;
+
+	/* The file reference
+	 */
+	uint64_t file_reference;
+
+	/* The parent file reference
+	 */
+	uint64_t parent_file_reference;
+
+	/* The update reason flags
+	 */
+	uint32_t update_reason_flags;
+
+	/* The update source flags
+	 */
+	uint32_t update_source_flags;
+
+	/* The file attribute flags
+	 */
+	uint32_t file_attribute_flags;
+
+	/* The index of the next entry with the same file reference + 1 or 0 if none
+	 */
+	uint32_t next_file_entry_index;
+};
+
+typedef struct libftxf_usn_join_file libftxf_usn_join_file_t;
+
+/* The entries of a file reference
+ */
+struct libftxf_usn_join_file
+{
+	/* The index of the first entry of the file reference + 1 or 0 for an unused file
+	 */
+	uint32_t first_entry_index;
+
+	/* The index of the last entry of the file reference
+	 */
+	uint32_t last_entry_index;
+};
+
+typedef struct libftxf_internal_usn_join libftxf_internal_usn_join_t;
+
+struct libftxf_internal_usn_join
+{
+	/* The entries
+	 * The entries are stored in journal order
+	 */
+	libftxf_usn_join_entry_t *entries;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The allocated number of entries
+	 */
+	uint32_t allocated_number_of_entries;
+
+	/* The entry hash table
+	 * Contains the entry index + 1 or 0 for an unused entry, keyed on file reference and update sequence number
+	 */
+	uint32_t *entry_hash_table;
+
+	/* The entry hash table size
+	 * Contains a power of 2
+	 */
+	uint32_t entry_hash_table_size;
+
+	/* The file hash table
+	 * Keyed on file reference
+	 */
+	libftxf_usn_join_file_t *file_hash_table;
+
+	/* The file hash table size
+	 * Contains a power of 2
+	 */
+	uint32_t file_hash_table_size;
+
+	/* The number of files
+	 */
+	uint32_t number_of_files;
+
+	/* The USN record
+	 * This record is reused for every entry that is read
+	 */
+	libfusn_record_t *usn_record;
+
+	/* The allocator
+	 * Contains the allocator functions used to allocate the USN join and its buffers
+	 */
+	libftxf_allocator_t allocator;
+};
+
+LIBFTXF_EXTERN \
+int libftxf_usn_join_initialize(
+     libftxf_usn_join_t **usn_join,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_usn_join_initialize_with_allocator(
+     libftxf_usn_join_t **usn_join,
+     const libftxf_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_usn_join_free(
+     libftxf_usn_join_t **usn_join,
+     libcerror_error_t **error );
+
+int libftxf_internal_usn_join_resize_entry_hash_table(
+     libftxf_internal_usn_join_t *internal_usn_join,
+     libcerror_error_t **error );
+
+int libftxf_internal_usn_join_resize_file_hash_table(
+     libftxf_internal_usn_join_t *internal_usn_join,
+     libcerror_error_t **error );
+
+int libftxf_internal_usn_join_append_entry(
+     libftxf_internal_usn_join_t *internal_usn_join,
+     uint64_t journal_offset,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_usn_join_read_journal_data(
+     libftxf_usn_join_t *usn_join,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t data_offset,
+     size_t *read_size,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_usn_join_get_number_of_entries(
+     libftxf_usn_join_t *usn_join,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_usn_join_get_entry_values(
+     libftxf_usn_join_t *usn_join,
+     int entry_index,
+     uint64_t *journal_offset,
+     uint64_t *update_sequence_number,
+     uint64_t *update_time,
+     uint64_t *file_reference,
+     uint64_t *parent_file_reference,
+     uint32_t *update_reason_flags,
+     uint32_t *update_source_flags,
+     uint32_t *file_attribute_flags,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_usn_join_get_entry_index_by_update_sequence_number(
+     libftxf_usn_join_t *usn_join,
+     uint64_t file_reference,
+     uint64_t update_sequence_number,
+     int *entry_index,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_usn_join_match_update_journal_entry(
+     libftxf_usn_join_t *usn_join,
+     libftxf_record_t *txf_record,
+     int update_journal_entry_index,
+     int *entry_index,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_usn_join_get_first_file_entry_index(
+     libftxf_usn_join_t *usn_join,
+     uint64_t file_reference,
+     int *entry_index,
+     libcerror_error_t **error );
+
+LIBFTXF_EXTERN \
+int libftxf_usn_join_get_next_file_entry_index(
+     libftxf_usn_join_t *usn_join,
+     int entry_index,
+     int *next_entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFTXF_USN_JOIN_H ) */
+
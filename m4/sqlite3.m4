@@ -0,0 +1,122 @@
+dnl Checks for sqlite3 required headers and functions
+dnl
+dnl Version: 20261019
+
+dnl Function to detect if sqlite3 is available
+dnl ac_sqlite3_dummy is used to prevent AC_CHECK_LIB adding unnecessary -l<library> arguments
+AC_DEFUN([AX_SQLITE3_CHECK_LIB],
+  [AS_IF(
+    [test "x$ac_cv_with_sqlite3" = xno],
+    [ac_cv_sqlite3=no],
+    [ac_cv_sqlite3=check
+    dnl Check if the directory provided as parameter exists
+    dnl For both --with-sqlite3 which returns "yes" and --with-sqlite3= which returns ""
+    dnl treat them as auto-detection.
+    AS_IF(
+      [test "x$ac_cv_with_sqlite3" != x && test "x$ac_cv_with_sqlite3" != xauto-detect && test "x$ac_cv_with_sqlite3" != xyes],
+      [AX_CHECK_LIB_DIRECTORY_EXISTS([sqlite3])],
+      [dnl Check for a pkg-config file
+      AS_IF(
+        [test "x$cross_compiling" != "xyes" && test "x$PKGCONFIG" != "x"],
+        [PKG_CHECK_MODULES(
+          [sqlite3],
+          [sqlite3 >= 3.7.15],
+          [ac_cv_sqlite3=yes],
+          [ac_cv_sqlite3=check])
+        ])
+      AS_IF(
+        [test "x$ac_cv_sqlite3" = xyes],
+        [ac_cv_sqlite3_CPPFLAGS="$pkg_cv_sqlite3_CFLAGS"
+        ac_cv_sqlite3_LIBADD="$pkg_cv_sqlite3_LIBS"])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_sqlite3" = xcheck],
+      [dnl Check for headers
+      AC_CHECK_HEADERS([sqlite3.h])
+
+      AS_IF(
+        [test "x$ac_cv_header_sqlite3_h" = xno],
+        [ac_cv_sqlite3=no],
+        [ac_cv_sqlite3=yes
+
+        AX_CHECK_LIB_FUNCTIONS(
+          [sqlite3],
+          [sqlite3],
+          [[sqlite3_open_v2],
+           [sqlite3_close],
+           [sqlite3_exec],
+           [sqlite3_prepare_v2],
+           [sqlite3_bind_int],
+           [sqlite3_bind_int64],
+           [sqlite3_bind_blob],
+           [sqlite3_bind_null],
+           [sqlite3_bind_text],
+           [sqlite3_step],
+           [sqlite3_reset],
+           [sqlite3_finalize],
+           [sqlite3_errmsg],
+           [sqlite3_errstr],
+           [sqlite3_free]])
+
+        ac_cv_sqlite3_LIBADD="-lsqlite3"])
+      ])
+
+    AX_CHECK_LIB_DIRECTORY_MSG_ON_FAILURE([sqlite3])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_sqlite3" = xyes],
+    [AC_DEFINE(
+      [HAVE_LIBSQLITE3],
+      [1],
+      [Define to 1 if you have the `sqlite3' library (-lsqlite3).])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_sqlite3" = xyes],
+    [AC_SUBST(
+      [HAVE_LIBSQLITE3],
+      [1]) ],
+    [AC_SUBST(
+      [HAVE_LIBSQLITE3],
+      [0])
+    ])
+  ])
+
+dnl Function to detect how to enable sqlite3
+AC_DEFUN([AX_SQLITE3_CHECK_ENABLE],
+  [AX_COMMON_ARG_WITH(
+    [sqlite3],
+    [sqlite3],
+    [search for sqlite3 in includedir and libdir or in the specified DIR, or no if not to use sqlite3],
+    [auto-detect],
+    [DIR])
+
+  dnl Check for a shared library version
+  AX_SQLITE3_CHECK_LIB
+
+  AS_IF(
+    [test "x$ac_cv_sqlite3_CPPFLAGS" != "x"],
+    [AC_SUBST(
+      [SQLITE3_CPPFLAGS],
+      [$ac_cv_sqlite3_CPPFLAGS])
+    ])
+  AS_IF(
+    [test "x$ac_cv_sqlite3_LIBADD" != "x"],
+    [AC_SUBST(
+      [SQLITE3_LIBADD],
+      [$ac_cv_sqlite3_LIBADD])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_sqlite3" = xyes],
+    [AC_SUBST(
+      [ax_sqlite3_spec_requires],
+      [sqlite])
+    AC_SUBST(
+      [ax_sqlite3_spec_build_requires],
+      [sqlite-devel])
+    ])
+  ])
+
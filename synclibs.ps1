@@ -7,7 +7,7 @@ Param (
 )
 
 $GitUrlPrefix = "https://github.com/libyal"
-$LocalLibs = "libcerror libcnotify libfdatetime libfguid libfusn libuna"
+$LocalLibs = "libcerror libcnotify libcthreads libfdatetime libfguid libfusn libuna"
 $LocalLibs = ${LocalLibs} -split " "
 
 $Git = "git"
@@ -0,0 +1,359 @@
+/*
+ * Library allocator functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_allocator.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+/* Allocates memory using the test allocator
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *ftxf_test_allocator_allocate_memory(
+       intptr_t *user_context,
+       size_t size )
+{
+	*( (int *) user_context ) += 1;
+
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Reallocates memory using the test allocator
+ * Returns a pointer to the reallocated memory or NULL on error
+ */
+void *ftxf_test_allocator_reallocate_memory(
+       intptr_t *user_context,
+       void *memory,
+       size_t size )
+{
+	*( (int *) user_context ) += 1;
+
+	return( memory_reallocate(
+	         memory,
+	         size ) );
+}
+
+/* Frees memory using the test allocator
+ */
+void ftxf_test_allocator_free_memory(
+      intptr_t *user_context,
+      void *memory )
+{
+	*( (int *) user_context ) -= 1;
+
+	memory_free(
+	 memory );
+}
+
+/* Tests the libftxf_allocator_check function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_allocator_check(
+     void )
+{
+	libftxf_allocator_t allocator;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	allocator.allocate_function   = NULL;
+	allocator.reallocate_function = NULL;
+	allocator.free_function       = NULL;
+	allocator.user_context        = NULL;
+
+	result = libftxf_allocator_check(
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	allocator.allocate_function   = &ftxf_test_allocator_allocate_memory;
+	allocator.reallocate_function = &ftxf_test_allocator_reallocate_memory;
+	allocator.free_function       = &ftxf_test_allocator_free_memory;
+
+	result = libftxf_allocator_check(
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_allocator_check(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	allocator.allocate_function = NULL;
+
+	result = libftxf_allocator_check(
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	allocator.allocate_function   = &ftxf_test_allocator_allocate_memory;
+	allocator.reallocate_function = NULL;
+
+	result = libftxf_allocator_check(
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	allocator.reallocate_function = &ftxf_test_allocator_reallocate_memory;
+	allocator.free_function       = NULL;
+
+	result = libftxf_allocator_check(
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_allocator_allocate, libftxf_allocator_reallocate and libftxf_allocator_free functions
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_allocator_allocate(
+     void )
+{
+	libftxf_allocator_t allocator;
+
+	uint8_t *memory           = NULL;
+	uint8_t *reallocated_data = NULL;
+	int number_of_allocations = 0;
+
+	/* Test regular cases with the default memory functions
+	 */
+	memory = (uint8_t *) libftxf_allocator_allocate(
+	                      NULL,
+	                      16 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	reallocated_data = (uint8_t *) libftxf_allocator_reallocate(
+	                                NULL,
+	                                memory,
+	                                32 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "reallocated_data",
+	 reallocated_data );
+
+	memory = reallocated_data;
+
+	libftxf_allocator_free(
+	 NULL,
+	 memory );
+
+	memory = NULL;
+
+	/* Test regular cases with the allocator functions
+	 */
+	allocator.allocate_function   = &ftxf_test_allocator_allocate_memory;
+	allocator.reallocate_function = &ftxf_test_allocator_reallocate_memory;
+	allocator.free_function       = &ftxf_test_allocator_free_memory;
+	allocator.user_context        = (intptr_t *) &number_of_allocations;
+
+	memory = (uint8_t *) libftxf_allocator_allocate(
+	                      &allocator,
+	                      16 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 1 );
+
+	reallocated_data = (uint8_t *) libftxf_allocator_reallocate(
+	                                &allocator,
+	                                memory,
+	                                32 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "reallocated_data",
+	 reallocated_data );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 2 );
+
+	memory = reallocated_data;
+
+	libftxf_allocator_free(
+	 &allocator,
+	 memory );
+
+	memory = NULL;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 1 );
+
+	/* Freeing NULL does not call the free function
+	 */
+	libftxf_allocator_free(
+	 &allocator,
+	 NULL );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( memory != NULL )
+	{
+		memory_free(
+		 memory );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+	FTXF_TEST_RUN(
+	 "libftxf_allocator_check",
+	 ftxf_test_allocator_check );
+
+	FTXF_TEST_RUN(
+	 "libftxf_allocator_allocate",
+	 ftxf_test_allocator_allocate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1448 @@
+/*
+ * Library block_index type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_memory.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_block_index.h"
+#include "../libftxf/libftxf_record_filter.h"
+
+uint8_t ftxf_test_block_index_data1[ 80 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19, 0x20, 0x38, 0x49, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libftxf_block_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_block_index_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libftxf_block_index_t *block_index = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libftxf_block_index_initialize(
+	          &block_index,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "block_index",
+	 block_index );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_block_index_free(
+	          &block_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "block_index",
+	 block_index );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_block_index_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_index = (libftxf_block_index_t *) 0x12345678UL;
+
+	result = libftxf_block_index_initialize(
+	          &block_index,
+	          0,
+	          &error );
+
+	block_index = NULL;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_initialize(
+	          &block_index,
+	          16,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "block_index",
+	 block_index );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_block_index_initialize with malloc failing
+		 */
+		ftxf_test_malloc_attempts_before_fail = test_number;
+
+		result = libftxf_block_index_initialize(
+		          &block_index,
+		          0,
+		          &error );
+
+		if( ftxf_test_malloc_attempts_before_fail != -1 )
+		{
+			ftxf_test_malloc_attempts_before_fail = -1;
+
+			if( block_index != NULL )
+			{
+				libftxf_block_index_free(
+				 &block_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "block_index",
+			 block_index );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_block_index_initialize with memset failing
+		 */
+		ftxf_test_memset_attempts_before_fail = test_number;
+
+		result = libftxf_block_index_initialize(
+		          &block_index,
+		          0,
+		          &error );
+
+		if( ftxf_test_memset_attempts_before_fail != -1 )
+		{
+			ftxf_test_memset_attempts_before_fail = -1;
+
+			if( block_index != NULL )
+			{
+				libftxf_block_index_free(
+				 &block_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "block_index",
+			 block_index );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_index != NULL )
+	{
+		libftxf_block_index_free(
+		 &block_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_block_index_initialize_with_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_block_index_initialize_with_allocator(
+     void )
+{
+	ftxf_test_memory_allocator_context_t allocator_context;
+	libftxf_allocator_t allocator;
+
+	libcerror_error_t *error           = NULL;
+	libftxf_block_index_t *block_index = NULL;
+	int block_number                   = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	ftxf_test_memory_allocator_initialize(
+	 &allocator,
+	 &allocator_context );
+
+	/* Test regular cases
+	 */
+	result = libftxf_block_index_initialize_with_allocator(
+	          &block_index,
+	          4096,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "block_index",
+	 block_index );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Records are appended to enough blocks to resize the block summaries
+	 */
+	for( block_number = 0;
+	     block_number < 64;
+	     block_number++ )
+	{
+		result = libftxf_block_index_append_record(
+		          block_index,
+		          (off64_t) block_number * 4096,
+		          ftxf_test_block_index_data1,
+		          80,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FTXF_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_reallocations",
+	 allocator_context.number_of_reallocations,
+	 0 );
+
+	result = libftxf_block_index_free(
+	          &block_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "block_index",
+	 block_index );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The resized block summaries of the block index are freed using the allocator
+	 */
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_index != NULL )
+	{
+		libftxf_block_index_free(
+		 &block_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_block_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_block_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libftxf_block_index_free(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_block_index_append_record function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_block_index_append_record(
+     libftxf_block_index_t *block_index )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_block_index_append_record(
+	          block_index,
+	          0,
+	          ftxf_test_block_index_data1,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record in a block beyond the next block
+	 */
+	result = libftxf_block_index_append_record(
+	          block_index,
+	          ( 2 * 65536 ) + 80,
+	          ftxf_test_block_index_data1,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_blocks",
+	 ( (libftxf_internal_block_index_t *) block_index )->number_of_blocks,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libftxf_block_index_append_record(
+	          NULL,
+	          0,
+	          ftxf_test_block_index_data1,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_append_record(
+	          block_index,
+	          -1,
+	          ftxf_test_block_index_data1,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_append_record(
+	          block_index,
+	          0,
+	          NULL,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_append_record(
+	          block_index,
+	          0,
+	          ftxf_test_block_index_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_append_record(
+	          block_index,
+	          0,
+	          ftxf_test_block_index_data1,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_block_index_get_block_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_block_index_get_block_size(
+     libftxf_block_index_t *block_index )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t block_size      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_block_index_get_block_size(
+	          block_index,
+	          &block_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "block_size",
+	 block_size,
+	 65536 );
+
+	/* Test error cases
+	 */
+	result = libftxf_block_index_get_block_size(
+	          NULL,
+	          &block_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_get_block_size(
+	          block_index,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_block_index_get_number_of_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_block_index_get_number_of_blocks(
+     libftxf_block_index_t *block_index )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_blocks     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_block_index_get_number_of_blocks(
+	          block_index,
+	          &number_of_blocks,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libftxf_block_index_get_number_of_blocks(
+	          NULL,
+	          &number_of_blocks,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_get_number_of_blocks(
+	          block_index,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_block_index_get_block_number_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_block_index_get_block_number_by_offset(
+     libftxf_block_index_t *block_index )
+{
+	libcerror_error_t *error = NULL;
+	int block_number         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_block_index_get_block_number_by_offset(
+	          block_index,
+	          65536,
+	          &block_number,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "block_number",
+	 block_number,
+	 1 );
+
+	/* Test with an offset beyond the indexed blocks
+	 */
+	result = libftxf_block_index_get_block_number_by_offset(
+	          block_index,
+	          3 * 65536,
+	          &block_number,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_block_index_get_block_number_by_offset(
+	          NULL,
+	          0,
+	          &block_number,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_get_block_number_by_offset(
+	          block_index,
+	          -1,
+	          &block_number,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_get_block_number_by_offset(
+	          block_index,
+	          0,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_block_index_get_block_timestamp_range function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_block_index_get_block_timestamp_range(
+     libftxf_block_index_t *block_index )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t first_timestamp = 0;
+	uint64_t last_timestamp  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_block_index_get_block_timestamp_range(
+	          block_index,
+	          0,
+	          &first_timestamp,
+	          &last_timestamp,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "first_timestamp",
+	 first_timestamp,
+	 (uint64_t) 0x01cf1d10c643bce0UL );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "last_timestamp",
+	 last_timestamp,
+	 (uint64_t) 0x01cf1d10c643bce0UL );
+
+	/* Test with a block without records
+	 */
+	result = libftxf_block_index_get_block_timestamp_range(
+	          block_index,
+	          1,
+	          &first_timestamp,
+	          &last_timestamp,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_block_index_get_block_timestamp_range(
+	          NULL,
+	          0,
+	          &first_timestamp,
+	          &last_timestamp,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_get_block_timestamp_range(
+	          block_index,
+	          -1,
+	          &first_timestamp,
+	          &last_timestamp,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_get_block_timestamp_range(
+	          block_index,
+	          3,
+	          &first_timestamp,
+	          &last_timestamp,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_get_block_timestamp_range(
+	          block_index,
+	          0,
+	          NULL,
+	          &last_timestamp,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_get_block_timestamp_range(
+	          block_index,
+	          0,
+	          &first_timestamp,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_block_index_block_matches_filter function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_block_index_block_matches_filter(
+     libftxf_block_index_t *block_index )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_record_filter_t *record_filter = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_filter_initialize(
+	          &record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_block_index_block_matches_filter(
+	          block_index,
+	          0,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a block without records
+	 */
+	result = libftxf_block_index_block_matches_filter(
+	          block_index,
+	          1,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a non-matching record type
+	 */
+	result = libftxf_record_filter_append_record_type(
+	          record_filter,
+	          0x0002,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libftxf_block_index_block_matches_filter(
+	          block_index,
+	          0,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a matching record type
+	 */
+	result = libftxf_record_filter_append_record_type(
+	          record_filter,
+	          0x0017,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libftxf_block_index_block_matches_filter(
+	          block_index,
+	          0,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a non-matching timestamp range
+	 */
+	result = libftxf_record_filter_set_timestamp_range(
+	          record_filter,
+	          0x01cf1d10c643bce1UL,
+	          0x01cf1d1100000000UL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libftxf_block_index_block_matches_filter(
+	          block_index,
+	          0,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a matching timestamp range
+	 */
+	result = libftxf_record_filter_set_timestamp_range(
+	          record_filter,
+	          0x01cf1d0000000000UL,
+	          0x01cf1d10c643bce0UL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libftxf_block_index_block_matches_filter(
+	          block_index,
+	          0,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a non-matching file reference
+	 */
+	result = libftxf_record_filter_append_file_reference(
+	          record_filter,
+	          0x0001000000004217UL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libftxf_block_index_block_matches_filter(
+	          block_index,
+	          0,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a matching file reference
+	 */
+	result = libftxf_record_filter_append_file_reference(
+	          record_filter,
+	          0x0001000000004216UL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libftxf_block_index_block_matches_filter(
+	          block_index,
+	          2,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_block_index_block_matches_filter(
+	          NULL,
+	          0,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_block_matches_filter(
+	          block_index,
+	          3,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_block_index_block_matches_filter(
+	          block_index,
+	          0,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_filter_free(
+	          &record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_filter",
+	 record_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_filter != NULL )
+	{
+		libftxf_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error           = NULL;
+	libftxf_block_index_t *block_index = NULL;
+	int result                         = 0;
+
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FTXF_TEST_RUN(
+	 "libftxf_block_index_initialize",
+	 ftxf_test_block_index_initialize );
+
+	FTXF_TEST_RUN(
+	 "libftxf_block_index_initialize_with_allocator",
+	 ftxf_test_block_index_initialize_with_allocator );
+
+	FTXF_TEST_RUN(
+	 "libftxf_block_index_free",
+	 ftxf_test_block_index_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize block index for tests
+	 */
+	result = libftxf_block_index_initialize(
+	          &block_index,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "block_index",
+	 block_index );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_block_index_append_record",
+	 ftxf_test_block_index_append_record,
+	 block_index );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_block_index_get_block_size",
+	 ftxf_test_block_index_get_block_size,
+	 block_index );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_block_index_get_number_of_blocks",
+	 ftxf_test_block_index_get_number_of_blocks,
+	 block_index );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_block_index_get_block_number_by_offset",
+	 ftxf_test_block_index_get_block_number_by_offset,
+	 block_index );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_block_index_get_block_timestamp_range",
+	 ftxf_test_block_index_get_block_timestamp_range,
+	 block_index );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_block_index_block_matches_filter",
+	 ftxf_test_block_index_block_matches_filter,
+	 block_index );
+
+	/* Clean up
+	 */
+	result = libftxf_block_index_free(
+	          &block_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "block_index",
+	 block_index );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_index != NULL )
+	{
+		libftxf_block_index_free(
+		 &block_index,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2027 @@
+/*
+ * Library column_reader type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_memory.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_column_reader.h"
+
+uint8_t ftxf_test_column_reader_record_data1[ 208 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x20, 0x38, 0x49, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x49, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x93, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00,
+	0x28, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x43, 0x00, 0x61, 0x00,
+	0x63, 0x00, 0x68, 0x00, 0x65, 0x00, 0x2d, 0x00, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00,
+	0x65, 0x00, 0x6d, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x61, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t ftxf_test_column_reader_record_data2[ 176 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01, 0xe1, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xe2, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01, 0xe3, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x52, 0x00, 0xe9, 0x00, 0x73, 0x00, 0x75, 0x00, 0x6d, 0x00, 0xe9, 0x00,
+	0x20, 0x00, 0x22, 0x00, 0x31, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x63, 0x00 };
+
+/* Writes a columnar export file for testing
+ * The file contains the first and second record in the first chunk and the second record in the second chunk
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_reader_write_file(
+     uint8_t *data,
+     size_t data_size,
+     size_t *file_size )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_column_writer_t *column_writer = NULL;
+	libftxf_record_t *record               = NULL;
+	size_t chunk_size                      = 0;
+	size_t data_offset                     = 0;
+	int record_index                       = 0;
+	int result                             = 0;
+
+	result = libftxf_column_writer_initialize(
+	          &column_writer,
+	          2,
+	          LIBFTXF_COLUMN_WRITER_FLAG_STATISTICS,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libftxf_column_writer_copy_file_header_to_byte_stream(
+	          column_writer,
+	          data,
+	          data_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data_offset = LIBFTXF_COLUMN_FILE_HEADER_SIZE;
+
+	for( record_index = 0;
+	     record_index < 3;
+	     record_index++ )
+	{
+		if( record_index == 0 )
+		{
+			result = libftxf_record_copy_from_byte_stream(
+			          record,
+			          ftxf_test_column_reader_record_data1,
+			          208,
+			          &error );
+		}
+		else
+		{
+			result = libftxf_record_copy_from_byte_stream(
+			          record,
+			          ftxf_test_column_reader_record_data2,
+			          176,
+			          &error );
+		}
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libftxf_column_writer_append_record(
+		          column_writer,
+		          record,
+		          &error );
+
+		FTXF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		if( result == 0 )
+		{
+			result = libftxf_column_writer_get_chunk_size(
+			          column_writer,
+			          &chunk_size,
+			          &error );
+
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = libftxf_column_writer_copy_chunk_to_byte_stream(
+			          column_writer,
+			          &( data[ data_offset ] ),
+			          data_size - data_offset,
+			          &error );
+
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			data_offset += chunk_size;
+
+			result = libftxf_column_writer_append_record(
+			          column_writer,
+			          record,
+			          &error );
+
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	result = libftxf_column_writer_get_chunk_size(
+	          column_writer,
+	          &chunk_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libftxf_column_writer_copy_chunk_to_byte_stream(
+	          column_writer,
+	          &( data[ data_offset ] ),
+	          data_size - data_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data_offset += chunk_size;
+
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libftxf_column_writer_free(
+	          &column_writer,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	*file_size = data_offset;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	if( column_writer != NULL )
+	{
+		libftxf_column_writer_free(
+		 &column_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_reader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_reader_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_column_reader_t *column_reader = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_reader_initialize(
+	          &column_reader,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "column_reader",
+	 column_reader );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_reader_free(
+	          &column_reader,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "column_reader",
+	 column_reader );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_column_reader_initialize(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	column_reader = (libftxf_column_reader_t *) 0x12345678UL;
+
+	result = libftxf_column_reader_initialize(
+	          &column_reader,
+	          &error );
+
+	column_reader = NULL;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_column_reader_initialize with malloc failing
+		 */
+		ftxf_test_malloc_attempts_before_fail = test_number;
+
+		result = libftxf_column_reader_initialize(
+		          &column_reader,
+		          &error );
+
+		if( ftxf_test_malloc_attempts_before_fail != -1 )
+		{
+			ftxf_test_malloc_attempts_before_fail = -1;
+
+			if( column_reader != NULL )
+			{
+				libftxf_column_reader_free(
+				 &column_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "column_reader",
+			 column_reader );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_column_reader_initialize with memset failing
+		 */
+		ftxf_test_memset_attempts_before_fail = test_number;
+
+		result = libftxf_column_reader_initialize(
+		          &column_reader,
+		          &error );
+
+		if( ftxf_test_memset_attempts_before_fail != -1 )
+		{
+			ftxf_test_memset_attempts_before_fail = -1;
+
+			if( column_reader != NULL )
+			{
+				libftxf_column_reader_free(
+				 &column_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "column_reader",
+			 column_reader );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_reader != NULL )
+	{
+		libftxf_column_reader_free(
+		 &column_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_reader_initialize_with_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_reader_initialize_with_allocator(
+     uint8_t *data,
+     size_t data_size )
+{
+	ftxf_test_memory_allocator_context_t allocator_context;
+	libftxf_allocator_t allocator;
+
+	libcerror_error_t *error               = NULL;
+	libftxf_column_reader_t *column_reader = NULL;
+	int iteration                          = 0;
+	int number_of_allocations              = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	ftxf_test_memory_allocator_initialize(
+	 &allocator,
+	 &allocator_context );
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_reader_initialize_with_allocator(
+	          &column_reader,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "column_reader",
+	 column_reader );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Opening the byte stream again after it was closed replaces the chunk offsets
+	 */
+	number_of_allocations = allocator_context.number_of_allocations;
+
+	for( iteration = 0;
+	     iteration < 2;
+	     iteration++ )
+	{
+		result = libftxf_column_reader_open_byte_stream(
+		          column_reader,
+		          data,
+		          data_size,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libftxf_column_reader_close(
+		          column_reader,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FTXF_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_allocations",
+	 allocator_context.number_of_allocations,
+	 number_of_allocations );
+
+	FTXF_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 0 );
+
+	result = libftxf_column_reader_free(
+	          &column_reader,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "column_reader",
+	 column_reader );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The chunk offsets of the column reader are freed using the allocator
+	 */
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_reader != NULL )
+	{
+		libftxf_column_reader_free(
+		 &column_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_reader_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_reader_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libftxf_column_reader_free(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_reader_open_byte_stream and libftxf_column_reader_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_reader_open_byte_stream(
+     uint8_t *data,
+     size_t data_size )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_column_reader_t *column_reader = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_column_reader_initialize(
+	          &column_reader,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "column_reader",
+	 column_reader );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_reader_open_byte_stream(
+	          column_reader,
+	          data,
+	          data_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_column_reader_open_byte_stream(
+	          column_reader,
+	          data,
+	          data_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_close(
+	          column_reader,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_reader_open_byte_stream(
+	          NULL,
+	          data,
+	          data_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_open_byte_stream(
+	          column_reader,
+	          NULL,
+	          data_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_open_byte_stream(
+	          column_reader,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_open_byte_stream(
+	          column_reader,
+	          data,
+	          8,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a truncated chunk
+	 */
+	result = libftxf_column_reader_open_byte_stream(
+	          column_reader,
+	          data,
+	          data_size - 8,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid file signature
+	 */
+	data[ 0 ] = 'X';
+
+	result = libftxf_column_reader_open_byte_stream(
+	          column_reader,
+	          data,
+	          data_size,
+	          &error );
+
+	data[ 0 ] = 'F';
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported format version
+	 */
+	data[ 8 ] = 2;
+
+	result = libftxf_column_reader_open_byte_stream(
+	          column_reader,
+	          data,
+	          data_size,
+	          &error );
+
+	data[ 8 ] = 1;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid chunk signature
+	 */
+	data[ LIBFTXF_COLUMN_FILE_HEADER_SIZE ] = 'X';
+
+	result = libftxf_column_reader_open_byte_stream(
+	          column_reader,
+	          data,
+	          data_size,
+	          &error );
+
+	data[ LIBFTXF_COLUMN_FILE_HEADER_SIZE ] = 'C';
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a number of GUIDs that exceeds the number of records
+	 */
+	data[ LIBFTXF_COLUMN_FILE_HEADER_SIZE + 16 ] = 3;
+
+	result = libftxf_column_reader_open_byte_stream(
+	          column_reader,
+	          data,
+	          data_size,
+	          &error );
+
+	data[ LIBFTXF_COLUMN_FILE_HEADER_SIZE + 16 ] = 1;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a name data size that exceeds the chunk size
+	 */
+	data[ LIBFTXF_COLUMN_FILE_HEADER_SIZE + 25 ] = 0x01;
+
+	result = libftxf_column_reader_open_byte_stream(
+	          column_reader,
+	          data,
+	          data_size,
+	          &error );
+
+	data[ LIBFTXF_COLUMN_FILE_HEADER_SIZE + 25 ] = 0x00;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_close(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_column_reader_free(
+	          &column_reader,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "column_reader",
+	 column_reader );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_reader != NULL )
+	{
+		libftxf_column_reader_free(
+		 &column_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_reader_get_number_of_chunks function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_reader_get_number_of_chunks(
+     libftxf_column_reader_t *column_reader )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_chunks     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_reader_get_number_of_chunks(
+	          column_reader,
+	          &number_of_chunks,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 2 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_column_reader_get_number_of_chunks(
+	          NULL,
+	          &number_of_chunks,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_number_of_chunks(
+	          column_reader,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_reader_get_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_reader_get_number_of_records(
+     libftxf_column_reader_t *column_reader )
+{
+	libcerror_error_t *error         = NULL;
+	uint64_t number_of_records       = 0;
+	uint32_t chunk_number_of_records = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_reader_get_number_of_records(
+	          column_reader,
+	          &number_of_records,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_records",
+	 number_of_records,
+	 (uint64_t) 3 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_reader_get_chunk_number_of_records(
+	          column_reader,
+	          1,
+	          &chunk_number_of_records,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_number_of_records",
+	 chunk_number_of_records,
+	 (uint32_t) 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_column_reader_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_number_of_records(
+	          column_reader,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_chunk_number_of_records(
+	          column_reader,
+	          2,
+	          &chunk_number_of_records,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_reader_get_chunk_timestamp_range and libftxf_column_reader_get_chunk_file_reference_range functions
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_reader_get_chunk_ranges(
+     libftxf_column_reader_t *column_reader )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t maximum_value   = 0;
+	uint64_t minimum_value   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_reader_get_chunk_timestamp_range(
+	          column_reader,
+	          0,
+	          &minimum_value,
+	          &maximum_value,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "minimum_value",
+	 minimum_value,
+	 (uint64_t) 0x01cf1d10c643bce0UL );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_value",
+	 maximum_value,
+	 (uint64_t) 0x01cf1d10c643bce0UL );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_reader_get_chunk_file_reference_range(
+	          column_reader,
+	          0,
+	          &minimum_value,
+	          &maximum_value,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "minimum_value",
+	 minimum_value,
+	 (uint64_t) 0 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_value",
+	 maximum_value,
+	 (uint64_t) 0x0001000000004216UL );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_column_reader_get_chunk_timestamp_range(
+	          NULL,
+	          0,
+	          &minimum_value,
+	          &maximum_value,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_chunk_timestamp_range(
+	          column_reader,
+	          -1,
+	          &minimum_value,
+	          &maximum_value,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_chunk_timestamp_range(
+	          column_reader,
+	          0,
+	          NULL,
+	          &maximum_value,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_chunk_file_reference_range(
+	          column_reader,
+	          0,
+	          &minimum_value,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_reader_get_column_data and libftxf_column_reader_get_integer_value functions
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_reader_get_integer_value(
+     libftxf_column_reader_t *column_reader )
+{
+	libcerror_error_t *error   = NULL;
+	const uint8_t *column_data = NULL;
+	size_t column_data_size    = 0;
+	uint64_t value             = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_reader_get_column_data(
+	          column_reader,
+	          0,
+	          LIBFTXF_COLUMN_TYPE_RECORD_TYPE,
+	          &column_data,
+	          &column_data_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "column_data",
+	 column_data );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "column_data_size",
+	 column_data_size,
+	 (size_t) 4 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          column_data,
+	          "\x17\x00\x07\x00",
+	          4 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libftxf_column_reader_get_integer_value(
+	          column_reader,
+	          0,
+	          LIBFTXF_COLUMN_TYPE_FILE_REFERENCE,
+	          1,
+	          &value,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0x0001000000004216UL );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_reader_get_integer_value(
+	          column_reader,
+	          1,
+	          LIBFTXF_COLUMN_TYPE_FILE_SIZE,
+	          0,
+	          &value,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 1234 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_reader_get_integer_value(
+	          column_reader,
+	          0,
+	          LIBFTXF_COLUMN_TYPE_RECORD_SIZE,
+	          0,
+	          &value,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 208 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_reader_get_integer_value(
+	          column_reader,
+	          0,
+	          LIBFTXF_COLUMN_TYPE_RECORD_FLAGS,
+	          1,
+	          &value,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) LIBFTXF_RECORD_FLAG_HAS_FILE_METADATA );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_column_reader_get_column_data(
+	          NULL,
+	          0,
+	          LIBFTXF_COLUMN_TYPE_RECORD_TYPE,
+	          &column_data,
+	          &column_data_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_column_data(
+	          column_reader,
+	          0,
+	          -1,
+	          &column_data,
+	          &column_data_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_column_data(
+	          column_reader,
+	          0,
+	          LIBFTXF_COLUMN_TYPE_RECORD_TYPE,
+	          NULL,
+	          &column_data_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_column_data(
+	          column_reader,
+	          0,
+	          LIBFTXF_COLUMN_TYPE_RECORD_TYPE,
+	          &column_data,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_integer_value(
+	          column_reader,
+	          0,
+	          LIBFTXF_COLUMN_TYPE_FILE_REFERENCE,
+	          2,
+	          &value,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_integer_value(
+	          column_reader,
+	          0,
+	          LIBFTXF_COLUMN_TYPE_FILE_REFERENCE,
+	          0,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_reader_get_guid function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_reader_get_guid(
+     libftxf_column_reader_t *column_reader )
+{
+	uint8_t guid_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_reader_get_guid(
+	          column_reader,
+	          0,
+	          1,
+	          guid_data,
+	          16,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          guid_data,
+	          &( ftxf_test_column_reader_record_data2[ 32 ] ),
+	          16 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_column_reader_get_guid(
+	          NULL,
+	          0,
+	          1,
+	          guid_data,
+	          16,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_guid(
+	          column_reader,
+	          0,
+	          1,
+	          NULL,
+	          16,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_guid(
+	          column_reader,
+	          0,
+	          1,
+	          guid_data,
+	          15,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_reader_get_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_reader_get_utf16_name(
+     libftxf_column_reader_t *column_reader )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *name      = NULL;
+	size_t name_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_reader_get_utf16_name(
+	          column_reader,
+	          1,
+	          0,
+	          &name,
+	          &name_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "name_size",
+	 name_size,
+	 (size_t) 28 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          name,
+	          &( ftxf_test_column_reader_record_data2[ 148 ] ),
+	          28 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a record without a name
+	 */
+	result = libftxf_column_reader_get_utf16_name(
+	          column_reader,
+	          0,
+	          0,
+	          &name,
+	          &name_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_column_reader_get_utf16_name(
+	          NULL,
+	          1,
+	          0,
+	          &name,
+	          &name_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_utf16_name(
+	          column_reader,
+	          1,
+	          0,
+	          NULL,
+	          &name_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_utf16_name(
+	          column_reader,
+	          1,
+	          0,
+	          &name,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_reader_get_utf16_name(
+	          column_reader,
+	          1,
+	          1,
+	          &name,
+	          &name_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	uint8_t file_data[ 1024 ];
+
+	libcerror_error_t *error               = NULL;
+	libftxf_column_reader_t *column_reader = NULL;
+	size_t file_size                       = 0;
+	int result                             = 0;
+
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FTXF_TEST_RUN(
+	 "libftxf_column_reader_initialize",
+	 ftxf_test_column_reader_initialize );
+
+	FTXF_TEST_RUN(
+	 "libftxf_column_reader_free",
+	 ftxf_test_column_reader_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize column reader for tests
+	 */
+	result = ftxf_test_column_reader_write_file(
+	          file_data,
+	          1024,
+	          &file_size );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "file_size",
+	 file_size,
+	 (size_t) 528 );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_column_reader_initialize_with_allocator",
+	 ftxf_test_column_reader_initialize_with_allocator,
+	 file_data,
+	 file_size );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_column_reader_open_byte_stream",
+	 ftxf_test_column_reader_open_byte_stream,
+	 file_data,
+	 file_size );
+
+	result = libftxf_column_reader_initialize(
+	          &column_reader,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "column_reader",
+	 column_reader );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_reader_open_byte_stream(
+	          column_reader,
+	          file_data,
+	          file_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_column_reader_get_number_of_chunks",
+	 ftxf_test_column_reader_get_number_of_chunks,
+	 column_reader );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_column_reader_get_number_of_records",
+	 ftxf_test_column_reader_get_number_of_records,
+	 column_reader );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_column_reader_get_chunk_timestamp_range",
+	 ftxf_test_column_reader_get_chunk_ranges,
+	 column_reader );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_column_reader_get_integer_value",
+	 ftxf_test_column_reader_get_integer_value,
+	 column_reader );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_column_reader_get_guid",
+	 ftxf_test_column_reader_get_guid,
+	 column_reader );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_column_reader_get_utf16_name",
+	 ftxf_test_column_reader_get_utf16_name,
+	 column_reader );
+
+	/* Clean up
+	 */
+	result = libftxf_column_reader_close(
+	          column_reader,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_reader_free(
+	          &column_reader,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "column_reader",
+	 column_reader );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_reader != NULL )
+	{
+		libftxf_column_reader_free(
+		 &column_reader,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1365 @@
+/*
+ * Library column_writer type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_memory.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_column_writer.h"
+
+uint8_t ftxf_test_column_writer_record_data1[ 208 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x20, 0x38, 0x49, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x49, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x93, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00,
+	0x28, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x43, 0x00, 0x61, 0x00,
+	0x63, 0x00, 0x68, 0x00, 0x65, 0x00, 0x2d, 0x00, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00,
+	0x65, 0x00, 0x6d, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x61, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t ftxf_test_column_writer_record_data2[ 176 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01, 0xe1, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xe2, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01, 0xe3, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x52, 0x00, 0xe9, 0x00, 0x73, 0x00, 0x75, 0x00, 0x6d, 0x00, 0xe9, 0x00,
+	0x20, 0x00, 0x22, 0x00, 0x31, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x63, 0x00 };
+
+/* Tests the libftxf_column_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_writer_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_column_writer_t *column_writer = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 6;
+	int number_of_memset_fail_tests        = 3;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_writer_initialize(
+	          &column_writer,
+	          0,
+	          LIBFTXF_COLUMN_WRITER_FLAG_STATISTICS,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "column_writer",
+	 column_writer );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_writer_free(
+	          &column_writer,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "column_writer",
+	 column_writer );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_column_writer_initialize(
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	column_writer = (libftxf_column_writer_t *) 0x12345678UL;
+
+	result = libftxf_column_writer_initialize(
+	          &column_writer,
+	          0,
+	          0,
+	          &error );
+
+	column_writer = NULL;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_writer_initialize(
+	          &column_writer,
+	          0xffffffffUL,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "column_writer",
+	 column_writer );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_writer_initialize(
+	          &column_writer,
+	          0,
+	          0xff,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "column_writer",
+	 column_writer );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_column_writer_initialize with malloc failing
+		 */
+		ftxf_test_malloc_attempts_before_fail = test_number;
+
+		result = libftxf_column_writer_initialize(
+		          &column_writer,
+		          16,
+		          0,
+		          &error );
+
+		if( ftxf_test_malloc_attempts_before_fail != -1 )
+		{
+			ftxf_test_malloc_attempts_before_fail = -1;
+
+			if( column_writer != NULL )
+			{
+				libftxf_column_writer_free(
+				 &column_writer,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "column_writer",
+			 column_writer );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_column_writer_initialize with memset failing
+		 */
+		ftxf_test_memset_attempts_before_fail = test_number;
+
+		result = libftxf_column_writer_initialize(
+		          &column_writer,
+		          16,
+		          0,
+		          &error );
+
+		if( ftxf_test_memset_attempts_before_fail != -1 )
+		{
+			ftxf_test_memset_attempts_before_fail = -1;
+
+			if( column_writer != NULL )
+			{
+				libftxf_column_writer_free(
+				 &column_writer,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "column_writer",
+			 column_writer );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_writer != NULL )
+	{
+		libftxf_column_writer_free(
+		 &column_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_writer_initialize_with_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_writer_initialize_with_allocator(
+     void )
+{
+	ftxf_test_memory_allocator_context_t allocator_context;
+	libftxf_allocator_t allocator;
+	uint8_t record_data[ 176 ];
+
+	libcerror_error_t *error               = NULL;
+	libftxf_column_writer_t *column_writer = NULL;
+	libftxf_record_t *record               = NULL;
+	int data_index                         = 0;
+	int record_index                       = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	ftxf_test_memory_allocator_initialize(
+	 &allocator,
+	 &allocator_context );
+
+	for( data_index = 0;
+	     data_index < 176;
+	     data_index++ )
+	{
+		record_data[ data_index ] = ftxf_test_column_writer_record_data2[ data_index ];
+	}
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_writer_initialize_with_allocator(
+	          &column_writer,
+	          0,
+	          LIBFTXF_COLUMN_WRITER_FLAG_STATISTICS,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "column_writer",
+	 column_writer );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Enough records with distinct names are appended to resize the names data
+	 */
+	for( record_index = 0;
+	     record_index < 512;
+	     record_index++ )
+	{
+		record_data[ 150 ] = (uint8_t) ( 'a' + ( record_index % 26 ) );
+		record_data[ 152 ] = (uint8_t) ( 'a' + ( record_index / 26 ) );
+
+		result = libftxf_record_copy_from_byte_stream(
+		          record,
+		          record_data,
+		          176,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libftxf_column_writer_append_record(
+		          column_writer,
+		          record,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FTXF_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_reallocations",
+	 allocator_context.number_of_reallocations,
+	 0 );
+
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_writer_free(
+	          &column_writer,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "column_writer",
+	 column_writer );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The resized memory of the column writer is freed using the allocator
+	 */
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	if( column_writer != NULL )
+	{
+		libftxf_column_writer_free(
+		 &column_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_writer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_writer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libftxf_column_writer_free(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_writer_copy_file_header_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_writer_copy_file_header_to_byte_stream(
+     libftxf_column_writer_t *column_writer )
+{
+	uint8_t expected_file_header[ LIBFTXF_COLUMN_FILE_HEADER_SIZE ] = {
+		'F', 'T', 'X', 'F', 'C', 'O', 'L', 'S', 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 };
+
+	uint8_t file_header[ LIBFTXF_COLUMN_FILE_HEADER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_writer_copy_file_header_to_byte_stream(
+	          column_writer,
+	          file_header,
+	          LIBFTXF_COLUMN_FILE_HEADER_SIZE,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          file_header,
+	          expected_file_header,
+	          LIBFTXF_COLUMN_FILE_HEADER_SIZE );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_column_writer_copy_file_header_to_byte_stream(
+	          NULL,
+	          file_header,
+	          LIBFTXF_COLUMN_FILE_HEADER_SIZE,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_writer_copy_file_header_to_byte_stream(
+	          column_writer,
+	          NULL,
+	          LIBFTXF_COLUMN_FILE_HEADER_SIZE,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_writer_copy_file_header_to_byte_stream(
+	          column_writer,
+	          file_header,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_writer_copy_file_header_to_byte_stream(
+	          column_writer,
+	          file_header,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_writer_append_record function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_writer_append_record(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_column_writer_t *column_writer = NULL;
+	libftxf_record_t *record               = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_column_writer_initialize(
+	          &column_writer,
+	          2,
+	          LIBFTXF_COLUMN_WRITER_FLAG_STATISTICS,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "column_writer",
+	 column_writer );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_column_writer_record_data2,
+	          176,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_writer_append_record(
+	          column_writer,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the GUID and name are only stored once
+	 */
+	result = libftxf_column_writer_append_record(
+	          column_writer,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "column_writer->number_of_records",
+	 ( (libftxf_internal_column_writer_t *) column_writer )->number_of_records,
+	 2 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "column_writer->number_of_guids",
+	 ( (libftxf_internal_column_writer_t *) column_writer )->number_of_guids,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "column_writer->number_of_names",
+	 ( (libftxf_internal_column_writer_t *) column_writer )->number_of_names,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "column_writer->names_data_size",
+	 ( (libftxf_internal_column_writer_t *) column_writer )->names_data_size,
+	 (size_t) 28 );
+
+	/* Test that a full chunk is signalled
+	 */
+	result = libftxf_column_writer_append_record(
+	          column_writer,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_column_writer_append_record(
+	          NULL,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_writer_append_record(
+	          column_writer,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_writer_free(
+	          &column_writer,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "column_writer",
+	 column_writer );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	if( column_writer != NULL )
+	{
+		libftxf_column_writer_free(
+		 &column_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_column_writer_get_chunk_size and libftxf_column_writer_copy_chunk_to_byte_stream functions
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_column_writer_copy_chunk_to_byte_stream(
+     void )
+{
+	uint8_t chunk_data[ 512 ];
+
+	libcerror_error_t *error               = NULL;
+	libftxf_column_writer_t *column_writer = NULL;
+	libftxf_record_t *record               = NULL;
+	size_t chunk_size                      = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_column_writer_initialize(
+	          &column_writer,
+	          0,
+	          LIBFTXF_COLUMN_WRITER_FLAG_STATISTICS,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "column_writer",
+	 column_writer );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an empty chunk has no size
+	 */
+	result = libftxf_column_writer_get_chunk_size(
+	          column_writer,
+	          &chunk_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_size",
+	 chunk_size,
+	 (size_t) 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an empty chunk cannot be copied
+	 */
+	result = libftxf_column_writer_copy_chunk_to_byte_stream(
+	          column_writer,
+	          chunk_data,
+	          512,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_column_writer_record_data1,
+	          208,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_writer_append_record(
+	          column_writer,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_column_writer_record_data2,
+	          176,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_writer_append_record(
+	          column_writer,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_writer_get_chunk_size(
+	          column_writer,
+	          &chunk_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_size",
+	 chunk_size,
+	 (size_t) 304 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_column_writer_get_chunk_size(
+	          NULL,
+	          &chunk_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_writer_get_chunk_size(
+	          column_writer,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_writer_copy_chunk_to_byte_stream(
+	          NULL,
+	          chunk_data,
+	          512,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_writer_copy_chunk_to_byte_stream(
+	          column_writer,
+	          NULL,
+	          512,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_writer_copy_chunk_to_byte_stream(
+	          column_writer,
+	          chunk_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_column_writer_copy_chunk_to_byte_stream(
+	          column_writer,
+	          chunk_data,
+	          303,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_column_writer_copy_chunk_to_byte_stream(
+	          column_writer,
+	          chunk_data,
+	          512,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          chunk_data,
+	          "CHNK\x30\x01\x00\x00\x02\x00\x00\x00\x01\x00\x00\x00\x01\x00\x00\x00\x01\x00\x00\x00\x1c\x00\x00\x00",
+	          28 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the column writer was reset
+	 */
+	result = libftxf_column_writer_get_chunk_size(
+	          column_writer,
+	          &chunk_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_size",
+	 chunk_size,
+	 (size_t) 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_column_writer_free(
+	          &column_writer,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "column_writer",
+	 column_writer );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	if( column_writer != NULL )
+	{
+		libftxf_column_writer_free(
+		 &column_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_column_writer_t *column_writer = NULL;
+	int result                             = 0;
+
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FTXF_TEST_RUN(
+	 "libftxf_column_writer_initialize",
+	 ftxf_test_column_writer_initialize );
+
+	FTXF_TEST_RUN(
+	 "libftxf_column_writer_initialize_with_allocator",
+	 ftxf_test_column_writer_initialize_with_allocator );
+
+	FTXF_TEST_RUN(
+	 "libftxf_column_writer_free",
+	 ftxf_test_column_writer_free );
+
+	FTXF_TEST_RUN(
+	 "libftxf_column_writer_append_record",
+	 ftxf_test_column_writer_append_record );
+
+	FTXF_TEST_RUN(
+	 "libftxf_column_writer_copy_chunk_to_byte_stream",
+	 ftxf_test_column_writer_copy_chunk_to_byte_stream );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize column writer for tests
+	 */
+	result = libftxf_column_writer_initialize(
+	          &column_writer,
+	          0,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "column_writer",
+	 column_writer );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_column_writer_copy_file_header_to_byte_stream",
+	 ftxf_test_column_writer_copy_file_header_to_byte_stream,
+	 column_writer );
+
+	/* Clean up
+	 */
+	result = libftxf_column_writer_free(
+	          &column_writer,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "column_writer",
+	 column_writer );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_writer != NULL )
+	{
+		libftxf_column_writer_free(
+		 &column_writer,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2264 @@
+/*
+ * Library duplicate_filter type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_memory.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_duplicate_filter.h"
+
+/* Tests the libftxf_duplicate_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_duplicate_filter_initialize(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libftxf_duplicate_filter_t *duplicate_filter = NULL;
+	int result                                   = 0;
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libftxf_duplicate_filter_initialize(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_duplicate_filter_free(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_duplicate_filter_initialize(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	duplicate_filter = (libftxf_duplicate_filter_t *) 0x12345678UL;
+
+	result = libftxf_duplicate_filter_initialize(
+	          &duplicate_filter,
+	          &error );
+
+	duplicate_filter = NULL;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_duplicate_filter_initialize with malloc failing
+		 */
+		ftxf_test_malloc_attempts_before_fail = test_number;
+
+		result = libftxf_duplicate_filter_initialize(
+		          &duplicate_filter,
+		          &error );
+
+		if( ftxf_test_malloc_attempts_before_fail != -1 )
+		{
+			ftxf_test_malloc_attempts_before_fail = -1;
+
+			if( duplicate_filter != NULL )
+			{
+				libftxf_duplicate_filter_free(
+				 &duplicate_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "duplicate_filter",
+			 duplicate_filter );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_duplicate_filter_initialize with memset failing
+		 */
+		ftxf_test_memset_attempts_before_fail = test_number;
+
+		result = libftxf_duplicate_filter_initialize(
+		          &duplicate_filter,
+		          &error );
+
+		if( ftxf_test_memset_attempts_before_fail != -1 )
+		{
+			ftxf_test_memset_attempts_before_fail = -1;
+
+			if( duplicate_filter != NULL )
+			{
+				libftxf_duplicate_filter_free(
+				 &duplicate_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "duplicate_filter",
+			 duplicate_filter );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( duplicate_filter != NULL )
+	{
+		libftxf_duplicate_filter_free(
+		 &duplicate_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_duplicate_filter_initialize_with_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_duplicate_filter_initialize_with_allocator(
+     void )
+{
+	ftxf_test_memory_allocator_context_t allocator_context;
+	libftxf_allocator_t allocator;
+
+	libcerror_error_t *error                     = NULL;
+	libftxf_duplicate_filter_t *duplicate_filter = NULL;
+	int entry_index                              = 0;
+	int number_of_allocations                    = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	ftxf_test_memory_allocator_initialize(
+	 &allocator,
+	 &allocator_context );
+
+	/* Test regular cases
+	 */
+	result = libftxf_duplicate_filter_initialize_with_allocator(
+	          &duplicate_filter,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Enough entries are checked to resize the hash table
+	 */
+	number_of_allocations = allocator_context.number_of_allocations;
+
+	for( entry_index = 0;
+	     entry_index < 5000;
+	     entry_index++ )
+	{
+		result = libftxf_duplicate_filter_check_entry(
+		          duplicate_filter,
+		          (uint64_t) ( entry_index + 1 ) * 0x9e3779b97f4a7c15ULL,
+		          80,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FTXF_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_allocations",
+	 allocator_context.number_of_allocations,
+	 number_of_allocations );
+
+	FTXF_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 0 );
+
+	result = libftxf_duplicate_filter_free(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The resized hash table of the duplicate filter is freed using the allocator
+	 */
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( duplicate_filter != NULL )
+	{
+		libftxf_duplicate_filter_free(
+		 &duplicate_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_duplicate_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_duplicate_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libftxf_duplicate_filter_free(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_duplicate_filter_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_duplicate_filter_empty(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libftxf_duplicate_filter_t *duplicate_filter = NULL;
+	uint32_t number_of_records                   = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_duplicate_filter_initialize(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_duplicate_filter_check_entry(
+	          duplicate_filter,
+	          0x0123456789abcdefULL,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_duplicate_filter_empty(
+	          duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_duplicate_filter_get_number_of_records(
+	          duplicate_filter,
+	          &number_of_records,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_records",
+	 number_of_records,
+	 (uint32_t) 0 );
+
+	result = libftxf_duplicate_filter_check_entry(
+	          duplicate_filter,
+	          0x0123456789abcdefULL,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_duplicate_filter_empty(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_duplicate_filter_free(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( duplicate_filter != NULL )
+	{
+		libftxf_duplicate_filter_free(
+		 &duplicate_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_duplicate_filter_calculate_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_duplicate_filter_calculate_entry(
+     void )
+{
+	uint8_t record_data[ 96 ];
+
+	libcerror_error_t *error = NULL;
+	uint64_t content_hash    = 0;
+	uint64_t expected_hash   = 0;
+	uint32_t record_size     = 0;
+	int data_index           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 96;
+	     data_index++ )
+	{
+		record_data[ data_index ] = (uint8_t) data_index;
+	}
+	record_data[ 64 ] = 80;
+	record_data[ 65 ] = 0;
+	record_data[ 66 ] = 0;
+	record_data[ 67 ] = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_duplicate_filter_calculate_entry(
+	          record_data,
+	          80,
+	          &expected_hash,
+	          &record_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "record_size",
+	 record_size,
+	 (uint32_t) 80 );
+
+	/* Test calculate entry with data beyond the record size
+	 */
+	result = libftxf_duplicate_filter_calculate_entry(
+	          record_data,
+	          96,
+	          &content_hash,
+	          &record_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "content_hash",
+	 content_hash,
+	 expected_hash );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "record_size",
+	 record_size,
+	 (uint32_t) 80 );
+
+	/* Test error cases
+	 */
+	result = libftxf_duplicate_filter_calculate_entry(
+	          NULL,
+	          80,
+	          &content_hash,
+	          &record_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_calculate_entry(
+	          record_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &content_hash,
+	          &record_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_calculate_entry(
+	          record_data,
+	          79,
+	          &content_hash,
+	          &record_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_calculate_entry(
+	          record_data,
+	          80,
+	          NULL,
+	          &record_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_calculate_entry(
+	          record_data,
+	          80,
+	          &content_hash,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test calculate entry with a record size value out of bounds
+	 */
+	record_data[ 64 ] = 96;
+
+	result = libftxf_duplicate_filter_calculate_entry(
+	          record_data,
+	          80,
+	          &content_hash,
+	          &record_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_duplicate_filter_check_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_duplicate_filter_check_entry(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libftxf_duplicate_filter_t *duplicate_filter = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_duplicate_filter_initialize(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_duplicate_filter_check_entry(
+	          duplicate_filter,
+	          0x0123456789abcdefULL,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_duplicate_filter_check_entry(
+	          duplicate_filter,
+	          0x0123456789abcdefULL,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check entry with the same content hash and a different record size
+	 */
+	result = libftxf_duplicate_filter_check_entry(
+	          duplicate_filter,
+	          0x0123456789abcdefULL,
+	          96,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_duplicate_filter_check_entry(
+	          NULL,
+	          0x0123456789abcdefULL,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_check_entry(
+	          duplicate_filter,
+	          0x0123456789abcdefULL,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_duplicate_filter_free(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( duplicate_filter != NULL )
+	{
+		libftxf_duplicate_filter_free(
+		 &duplicate_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_duplicate_filter_check_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_duplicate_filter_check_byte_stream(
+     void )
+{
+	uint8_t record_data[ 96 ];
+
+	libcerror_error_t *error                     = NULL;
+	libftxf_duplicate_filter_t *duplicate_filter = NULL;
+	uint32_t number_of_records                   = 0;
+	int data_index                               = 0;
+	int record_index                             = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 96;
+	     data_index++ )
+	{
+		record_data[ data_index ] = 0;
+	}
+	record_data[ 64 ] = 80;
+
+	result = libftxf_duplicate_filter_initialize(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          duplicate_filter,
+	          record_data,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          duplicate_filter,
+	          record_data,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record_data[ 0 ] = 1;
+
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          duplicate_filter,
+	          record_data,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check byte stream with data beyond the record size
+	 */
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          duplicate_filter,
+	          record_data,
+	          96,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check byte stream with enough records to resize the hash table
+	 */
+	for( record_index = 0;
+	     record_index < 4096;
+	     record_index++ )
+	{
+		record_data[ 0 ] = (uint8_t) ( record_index & 0xff );
+		record_data[ 1 ] = (uint8_t) ( ( record_index >> 8 ) + 1 );
+
+		result = libftxf_duplicate_filter_check_byte_stream(
+		          duplicate_filter,
+		          record_data,
+		          80,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libftxf_duplicate_filter_get_number_of_records(
+	          duplicate_filter,
+	          &number_of_records,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_records",
+	 number_of_records,
+	 (uint32_t) 4098 );
+
+	record_data[ 0 ] = 0;
+	record_data[ 1 ] = 0;
+
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          duplicate_filter,
+	          record_data,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          NULL,
+	          record_data,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          duplicate_filter,
+	          NULL,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          duplicate_filter,
+	          record_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          duplicate_filter,
+	          record_data,
+	          79,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test check byte stream with a record size value out of bounds
+	 */
+	record_data[ 64 ] = 96;
+
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          duplicate_filter,
+	          record_data,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_data[ 64 ] = 16;
+
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          duplicate_filter,
+	          record_data,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_duplicate_filter_free(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( duplicate_filter != NULL )
+	{
+		libftxf_duplicate_filter_free(
+		 &duplicate_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_duplicate_filter_check_record function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_duplicate_filter_check_record(
+     void )
+{
+	uint8_t record_data[ 80 ];
+
+	libcerror_error_t *error                     = NULL;
+	libftxf_duplicate_filter_t *duplicate_filter = NULL;
+	libftxf_record_t *record                     = NULL;
+	int data_index                               = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 80;
+	     data_index++ )
+	{
+		record_data[ data_index ] = 0;
+	}
+	record_data[ 64 ] = 80;
+
+	result = libftxf_duplicate_filter_initialize(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check record without record data
+	 */
+	result = libftxf_duplicate_filter_check_record(
+	          duplicate_filter,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          record_data,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_duplicate_filter_check_record(
+	          duplicate_filter,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_duplicate_filter_check_record(
+	          duplicate_filter,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check record with a record that was checked as byte stream
+	 */
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          duplicate_filter,
+	          record_data,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_duplicate_filter_check_record(
+	          NULL,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_check_record(
+	          duplicate_filter,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_duplicate_filter_free(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	if( duplicate_filter != NULL )
+	{
+		libftxf_duplicate_filter_free(
+		 &duplicate_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_duplicate_filter_get_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_duplicate_filter_get_number_of_records(
+     void )
+{
+	uint8_t record_data[ 80 ];
+
+	libcerror_error_t *error                     = NULL;
+	libftxf_duplicate_filter_t *duplicate_filter = NULL;
+	uint32_t number_of_records                   = 0;
+	int data_index                               = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 80;
+	     data_index++ )
+	{
+		record_data[ data_index ] = 0;
+	}
+	record_data[ 64 ] = 80;
+
+	result = libftxf_duplicate_filter_initialize(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_duplicate_filter_get_number_of_records(
+	          duplicate_filter,
+	          &number_of_records,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_records",
+	 number_of_records,
+	 (uint32_t) 0 );
+
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          duplicate_filter,
+	          record_data,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_duplicate_filter_check_byte_stream(
+	          duplicate_filter,
+	          record_data,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_duplicate_filter_get_number_of_records(
+	          duplicate_filter,
+	          &number_of_records,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_records",
+	 number_of_records,
+	 (uint32_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libftxf_duplicate_filter_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_get_number_of_records(
+	          duplicate_filter,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_duplicate_filter_free(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( duplicate_filter != NULL )
+	{
+		libftxf_duplicate_filter_free(
+		 &duplicate_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_duplicate_filter_sort function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_duplicate_filter_sort(
+     void )
+{
+	uint8_t byte_stream[ 256 * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE ];
+
+	libcerror_error_t *error                     = NULL;
+	libftxf_duplicate_filter_t *duplicate_filter = NULL;
+	size_t byte_stream_offset                    = 0;
+	uint64_t content_hash                        = 0;
+	uint64_t previous_content_hash               = 0;
+	uint32_t entry_index                         = 0;
+	uint32_t number_of_entries                   = 0;
+	uint32_t previous_record_size                = 0;
+	uint32_t record_size                         = 0;
+	uint32_t total_number_of_entries             = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_duplicate_filter_initialize(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Add enough entries to resize the hash table, with some entries that only differ in size
+	 */
+	for( entry_index = 0;
+	     entry_index < 5000;
+	     entry_index++ )
+	{
+		result = libftxf_duplicate_filter_check_entry(
+		          duplicate_filter,
+		          (uint64_t) ( 5000 - ( entry_index / 2 ) ) * 0x9e3779b97f4a7c15ULL,
+		          80 + ( ( entry_index % 2 ) * 8 ),
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libftxf_duplicate_filter_sort(
+	          duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	while( total_number_of_entries < 5000 )
+	{
+		result = libftxf_duplicate_filter_copy_to_byte_stream(
+		          duplicate_filter,
+		          total_number_of_entries,
+		          byte_stream,
+		          256 * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE,
+		          &number_of_entries,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FTXF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "number_of_entries",
+		 (int) number_of_entries,
+		 0 );
+
+		for( byte_stream_offset = 0;
+		     byte_stream_offset < ( (size_t) number_of_entries * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE );
+		     byte_stream_offset += LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( byte_stream[ byte_stream_offset ] ),
+			 content_hash );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( byte_stream[ byte_stream_offset + 8 ] ),
+			 record_size );
+
+			if( ( total_number_of_entries > 0 )
+			 || ( byte_stream_offset > 0 ) )
+			{
+				result = ( content_hash > previous_content_hash )
+				      || ( ( content_hash == previous_content_hash )
+				       && ( record_size > previous_record_size ) );
+
+				FTXF_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+			}
+			previous_content_hash = content_hash;
+			previous_record_size  = record_size;
+		}
+		total_number_of_entries += number_of_entries;
+	}
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "total_number_of_entries",
+	 total_number_of_entries,
+	 (uint32_t) 5000 );
+
+	/* Test sort of sorted entries
+	 */
+	result = libftxf_duplicate_filter_sort(
+	          duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check entry with sorted entries
+	 */
+	result = libftxf_duplicate_filter_check_entry(
+	          duplicate_filter,
+	          0x0123456789abcdefULL,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test check entry after the sorted entries were emptied
+	 */
+	result = libftxf_duplicate_filter_empty(
+	          duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_duplicate_filter_check_entry(
+	          duplicate_filter,
+	          0x0123456789abcdefULL,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_duplicate_filter_sort(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_duplicate_filter_free(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( duplicate_filter != NULL )
+	{
+		libftxf_duplicate_filter_free(
+		 &duplicate_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_duplicate_filter_copy_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_duplicate_filter_copy_to_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 3 * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE ];
+
+	libcerror_error_t *error                     = NULL;
+	libftxf_duplicate_filter_t *duplicate_filter = NULL;
+	uint64_t content_hash                        = 0;
+	uint32_t number_of_entries                   = 0;
+	uint32_t record_size                         = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_duplicate_filter_initialize(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_duplicate_filter_check_entry(
+	          duplicate_filter,
+	          0x0000000000000003ULL,
+	          80,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_duplicate_filter_check_entry(
+	          duplicate_filter,
+	          0x0000000000000001ULL,
+	          96,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test copy to byte stream with entries that are not sorted
+	 */
+	result = libftxf_duplicate_filter_copy_to_byte_stream(
+	          duplicate_filter,
+	          0,
+	          byte_stream,
+	          3 * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_sort(
+	          duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_duplicate_filter_copy_to_byte_stream(
+	          duplicate_filter,
+	          0,
+	          byte_stream,
+	          3 * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_entries",
+	 number_of_entries,
+	 (uint32_t) 2 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 byte_stream,
+	 content_hash );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "content_hash",
+	 content_hash,
+	 (uint64_t) 0x0000000000000001ULL );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 8 ] ),
+	 record_size );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "record_size",
+	 record_size,
+	 (uint32_t) 96 );
+
+	/* Test copy to byte stream with a byte stream that fits a single entry
+	 */
+	result = libftxf_duplicate_filter_copy_to_byte_stream(
+	          duplicate_filter,
+	          1,
+	          byte_stream,
+	          LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE + 1,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_entries",
+	 number_of_entries,
+	 (uint32_t) 1 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 byte_stream,
+	 content_hash );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "content_hash",
+	 content_hash,
+	 (uint64_t) 0x0000000000000003ULL );
+
+	/* Test error cases
+	 */
+	result = libftxf_duplicate_filter_copy_to_byte_stream(
+	          NULL,
+	          0,
+	          byte_stream,
+	          3 * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_copy_to_byte_stream(
+	          duplicate_filter,
+	          3,
+	          byte_stream,
+	          3 * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_copy_to_byte_stream(
+	          duplicate_filter,
+	          0,
+	          NULL,
+	          3 * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_copy_to_byte_stream(
+	          duplicate_filter,
+	          0,
+	          byte_stream,
+	          LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE - 1,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_duplicate_filter_copy_to_byte_stream(
+	          duplicate_filter,
+	          0,
+	          byte_stream,
+	          3 * LIBFTXF_DUPLICATE_FILTER_ENTRY_SIZE,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_duplicate_filter_free(
+	          &duplicate_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "duplicate_filter",
+	 duplicate_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( duplicate_filter != NULL )
+	{
+		libftxf_duplicate_filter_free(
+		 &duplicate_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FTXF_TEST_RUN(
+	 "libftxf_duplicate_filter_initialize",
+	 ftxf_test_duplicate_filter_initialize );
+
+	FTXF_TEST_RUN(
+	 "libftxf_duplicate_filter_initialize_with_allocator",
+	 ftxf_test_duplicate_filter_initialize_with_allocator );
+
+	FTXF_TEST_RUN(
+	 "libftxf_duplicate_filter_free",
+	 ftxf_test_duplicate_filter_free );
+
+	FTXF_TEST_RUN(
+	 "libftxf_duplicate_filter_empty",
+	 ftxf_test_duplicate_filter_empty );
+
+	FTXF_TEST_RUN(
+	 "libftxf_duplicate_filter_calculate_entry",
+	 ftxf_test_duplicate_filter_calculate_entry );
+
+	FTXF_TEST_RUN(
+	 "libftxf_duplicate_filter_check_entry",
+	 ftxf_test_duplicate_filter_check_entry );
+
+	FTXF_TEST_RUN(
+	 "libftxf_duplicate_filter_check_byte_stream",
+	 ftxf_test_duplicate_filter_check_byte_stream );
+
+	FTXF_TEST_RUN(
+	 "libftxf_duplicate_filter_check_record",
+	 ftxf_test_duplicate_filter_check_record );
+
+	FTXF_TEST_RUN(
+	 "libftxf_duplicate_filter_get_number_of_records",
+	 ftxf_test_duplicate_filter_get_number_of_records );
+
+	FTXF_TEST_RUN(
+	 "libftxf_duplicate_filter_sort",
+	 ftxf_test_duplicate_filter_sort );
+
+	FTXF_TEST_RUN(
+	 "libftxf_duplicate_filter_copy_to_byte_stream",
+	 ftxf_test_duplicate_filter_copy_to_byte_stream );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,522 @@
+/*
+ * Library FILETIME functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_filetime.h"
+
+/* The FILETIMEs are: 1601-01-01 00:00:00, 1970-01-01 00:00:00, 1900-03-01 00:00:00,
+ * 2000-02-29 12:34:56.1234567, 2014-01-29 16:40:10.0044 and 9999-12-31 23:59:59.9999999
+ */
+uint64_t ftxf_test_filetime_filetimes[ 6 ] = {
+	0x0000000000000000UL, 0x019db1ded53e8000UL, 0x014f6598c43f8000UL,
+	0x01bf82b162646e87UL, 0x01cf1d10c643bce0UL, 0x24c85a5ed1c03fffUL };
+
+/* Tests the libftxf_filetime_copy_to_posix_times function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_filetime_copy_to_posix_times(
+     void )
+{
+	uint64_t filetimes[ 4 ];
+	int64_t posix_times[ 6 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_filetime_copy_to_posix_times(
+	          ftxf_test_filetime_filetimes,
+	          posix_times,
+	          6,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times[ 0 ]",
+	 posix_times[ 0 ],
+	 (int64_t) INT64_MIN );
+
+	FTXF_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times[ 1 ]",
+	 posix_times[ 1 ],
+	 (int64_t) 0 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times[ 2 ]",
+	 posix_times[ 2 ],
+	 (int64_t) -2203891200000000000L );
+
+	FTXF_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times[ 3 ]",
+	 posix_times[ 3 ],
+	 (int64_t) 951827696123456700L );
+
+	FTXF_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times[ 4 ]",
+	 posix_times[ 4 ],
+	 (int64_t) 1391013610004400000L );
+
+	FTXF_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times[ 5 ]",
+	 posix_times[ 5 ],
+	 (int64_t) INT64_MAX );
+
+	/* Test the smallest and largest FILETIME that can be represented
+	 */
+	filetimes[ 0 ] = LIBFTXF_FILETIME_MINIMUM_POSIX_TIME_FILETIME;
+	filetimes[ 1 ] = LIBFTXF_FILETIME_MINIMUM_POSIX_TIME_FILETIME - 1;
+	filetimes[ 2 ] = LIBFTXF_FILETIME_MAXIMUM_POSIX_TIME_FILETIME;
+	filetimes[ 3 ] = LIBFTXF_FILETIME_MAXIMUM_POSIX_TIME_FILETIME + 1;
+
+	result = libftxf_filetime_copy_to_posix_times(
+	          filetimes,
+	          posix_times,
+	          4,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times[ 0 ]",
+	 posix_times[ 0 ],
+	 (int64_t) -9223372036854775800L );
+
+	FTXF_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times[ 1 ]",
+	 posix_times[ 1 ],
+	 (int64_t) INT64_MIN );
+
+	FTXF_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times[ 2 ]",
+	 posix_times[ 2 ],
+	 (int64_t) 9223372036854775800L );
+
+	FTXF_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times[ 3 ]",
+	 posix_times[ 3 ],
+	 (int64_t) INT64_MAX );
+
+	/* Test error cases
+	 */
+	result = libftxf_filetime_copy_to_posix_times(
+	          NULL,
+	          posix_times,
+	          6,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_filetime_copy_to_posix_times(
+	          ftxf_test_filetime_filetimes,
+	          NULL,
+	          6,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_filetime_copy_to_posix_times(
+	          ftxf_test_filetime_filetimes,
+	          posix_times,
+	          (size_t) SSIZE_MAX,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+/* Tests the libftxf_filetime_copy_to_utf8_iso8601_string function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_filetime_copy_to_utf8_iso8601_string(
+     void )
+{
+	uint8_t utf8_string[ LIBFTXF_FILETIME_ISO8601_STRING_SIZE ];
+
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_filetime_copy_to_utf8_iso8601_string(
+	          ftxf_test_filetime_filetimes[ 3 ],
+	          utf8_string );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "2000-02-29T12:34:56.1234567Z",
+	          29 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_filetime_copy_to_utf8_iso8601_string(
+	          LIBFTXF_FILETIME_MAXIMUM_ISO8601_FILETIME + 1,
+	          utf8_string );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+
+/* Tests the libftxf_filetime_copy_to_utf8_iso8601_strings function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_filetime_copy_to_utf8_iso8601_strings(
+     void )
+{
+	uint8_t utf8_strings[ 6 * LIBFTXF_FILETIME_ISO8601_STRING_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	uint64_t filetime        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_filetime_copy_to_utf8_iso8601_strings(
+	          ftxf_test_filetime_filetimes,
+	          6,
+	          utf8_strings,
+	          6 * LIBFTXF_FILETIME_ISO8601_STRING_SIZE,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( utf8_strings[ 0 * LIBFTXF_FILETIME_ISO8601_STRING_SIZE ] ),
+	          "1601-01-01T00:00:00.0000000Z",
+	          LIBFTXF_FILETIME_ISO8601_STRING_SIZE );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( utf8_strings[ 1 * LIBFTXF_FILETIME_ISO8601_STRING_SIZE ] ),
+	          "1970-01-01T00:00:00.0000000Z",
+	          LIBFTXF_FILETIME_ISO8601_STRING_SIZE );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( utf8_strings[ 2 * LIBFTXF_FILETIME_ISO8601_STRING_SIZE ] ),
+	          "1900-03-01T00:00:00.0000000Z",
+	          LIBFTXF_FILETIME_ISO8601_STRING_SIZE );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( utf8_strings[ 3 * LIBFTXF_FILETIME_ISO8601_STRING_SIZE ] ),
+	          "2000-02-29T12:34:56.1234567Z",
+	          LIBFTXF_FILETIME_ISO8601_STRING_SIZE );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( utf8_strings[ 4 * LIBFTXF_FILETIME_ISO8601_STRING_SIZE ] ),
+	          "2014-01-29T16:40:10.0044000Z",
+	          LIBFTXF_FILETIME_ISO8601_STRING_SIZE );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( utf8_strings[ 5 * LIBFTXF_FILETIME_ISO8601_STRING_SIZE ] ),
+	          "9999-12-31T23:59:59.9999999Z",
+	          LIBFTXF_FILETIME_ISO8601_STRING_SIZE );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_filetime_copy_to_utf8_iso8601_strings(
+	          NULL,
+	          6,
+	          utf8_strings,
+	          6 * LIBFTXF_FILETIME_ISO8601_STRING_SIZE,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_filetime_copy_to_utf8_iso8601_strings(
+	          ftxf_test_filetime_filetimes,
+	          (size_t) SSIZE_MAX,
+	          utf8_strings,
+	          6 * LIBFTXF_FILETIME_ISO8601_STRING_SIZE,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_filetime_copy_to_utf8_iso8601_strings(
+	          ftxf_test_filetime_filetimes,
+	          6,
+	          NULL,
+	          6 * LIBFTXF_FILETIME_ISO8601_STRING_SIZE,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_filetime_copy_to_utf8_iso8601_strings(
+	          ftxf_test_filetime_filetimes,
+	          6,
+	          utf8_strings,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_filetime_copy_to_utf8_iso8601_strings(
+	          ftxf_test_filetime_filetimes,
+	          6,
+	          utf8_strings,
+	          ( 6 * LIBFTXF_FILETIME_ISO8601_STRING_SIZE ) - 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test FILETIME value out of bounds
+	 */
+	filetime = LIBFTXF_FILETIME_MAXIMUM_ISO8601_FILETIME + 1;
+
+	result = libftxf_filetime_copy_to_utf8_iso8601_strings(
+	          &filetime,
+	          1,
+	          utf8_strings,
+	          6 * LIBFTXF_FILETIME_ISO8601_STRING_SIZE,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FTXF_TEST_RUN(
+	 "libftxf_filetime_copy_to_posix_times",
+	 ftxf_test_filetime_copy_to_posix_times );
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+	FTXF_TEST_RUN(
+	 "libftxf_filetime_copy_to_utf8_iso8601_string",
+	 ftxf_test_filetime_copy_to_utf8_iso8601_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+
+	FTXF_TEST_RUN(
+	 "libftxf_filetime_copy_to_utf8_iso8601_strings",
+	 ftxf_test_filetime_copy_to_utf8_iso8601_strings );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
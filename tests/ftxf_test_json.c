@@ -0,0 +1,429 @@
+/*
+ * Library JSON functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_json.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+/* Tests the libftxf_json_append_characters function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_json_append_characters(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_json_append_characters(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          "{\"a\":",
+	          4 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 4 );
+	result = memory_compare(
+	          utf8_string,
+	          "{\"a\":",
+	          4 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with an UTF-8 string that is too small
+	 */
+	result = libftxf_json_append_characters(
+	          utf8_string,
+	          6,
+	          &utf8_string_index,
+	          "{\"a\":",
+	          4 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 4 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libftxf_json_append_integer function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_json_append_integer(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_json_append_integer(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          0 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 1 );
+
+	result = libftxf_json_append_integer(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          0xffffffffffffffffUL );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 21 );
+	result = memory_compare(
+	          utf8_string,
+	          "018446744073709551615",
+	          21 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with an UTF-8 string that is too small
+	 */
+	result = libftxf_json_append_integer(
+	          utf8_string,
+	          24,
+	          &utf8_string_index,
+	          1234 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 21 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libftxf_json_append_guid function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_json_append_guid(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+	uint8_t guid_data[ 16 ] = {
+		0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56 };
+
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_json_append_guid(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          guid_data );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 38 );
+	result = memory_compare(
+	          utf8_string,
+	          "\"82f0c3fc-88fb-11e3-8b6e-525400123456\"",
+	          38 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with an UTF-8 string that is too small
+	 */
+	result = libftxf_json_append_guid(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          guid_data );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 38 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libftxf_json_append_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_json_append_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_json_append_utf8_string(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          (uint8_t *) "FontCache-System.dat\x09\"q\"\\\x01",
+	          26 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 37 );
+	result = memory_compare(
+	          utf8_string,
+	          "\"FontCache-System.dat\\t\\\"q\\\"\\\\\\u0001\"",
+	          37 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with an UTF-8 string that is too small
+	 */
+	utf8_string_index = 0;
+
+	result = libftxf_json_append_utf8_string(
+	          utf8_string,
+	          36,
+	          &utf8_string_index,
+	          (uint8_t *) "FontCache-System.dat\x09\"q\"\\\x01",
+	          26 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libftxf_json_append_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_json_append_utf16_stream(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+	uint8_t utf16_stream[ 24 ] = {
+		0x52, 0x00, 0xe9, 0x00, 0x73, 0x00, 0x75, 0x00, 0x6d, 0x00, 0xe9, 0x00, 0x20, 0x00, 0x3d, 0xd8, 0x00, 0xde, 0x00, 0xd8, 0x22, 0x00, 0x78, 0x00 };
+
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_json_append_utf16_stream(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          utf16_stream,
+	          24 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 24 );
+	result = memory_compare(
+	          utf8_string,
+	          "\"R\xc3\xa9sum\xc3\xa9 \xf0\x9f\x98\x80\\ud800\\\"x\"",
+	          24 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with an UTF-8 string that is too small
+	 */
+	utf8_string_index = 0;
+
+	result = libftxf_json_append_utf16_stream(
+	          utf8_string,
+	          23,
+	          &utf8_string_index,
+	          utf16_stream,
+	          24 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+	FTXF_TEST_RUN(
+	 "libftxf_json_append_characters",
+	 ftxf_test_json_append_characters );
+
+	FTXF_TEST_RUN(
+	 "libftxf_json_append_integer",
+	 ftxf_test_json_append_integer );
+
+	FTXF_TEST_RUN(
+	 "libftxf_json_append_guid",
+	 ftxf_test_json_append_guid );
+
+	FTXF_TEST_RUN(
+	 "libftxf_json_append_utf8_string",
+	 ftxf_test_json_append_utf8_string );
+
+	FTXF_TEST_RUN(
+	 "libftxf_json_append_utf16_stream",
+	 ftxf_test_json_append_utf16_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+}
+
@@ -92,6 +92,20 @@
 		goto on_error; \
 	}
 
+#define FTXF_TEST_ASSERT_GREATER_THAN_SIZE( name, value, expected_value ) \
+	if( value <= expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (%" PRIzd ") <= %" PRIzd "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
+#define FTXF_TEST_ASSERT_LESS_THAN_SIZE( name, value, expected_value ) \
+	if( value >= expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (%" PRIzd ") >= %" PRIzd "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
 #define FTXF_TEST_ASSERT_EQUAL_SSIZE( name, value, expected_value ) \
 	if( value != expected_value ) \
 	{ \
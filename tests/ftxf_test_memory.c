@@ -20,6 +20,8 @@
  */
 
 #include <common.h>
+#include <memory.h>
+#include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
@@ -31,10 +33,136 @@
 #undef __USE_GNU
 #endif
 
+#include "ftxf_test_libftxf.h"
 #include "ftxf_test_memory.h"
 
 #if defined( HAVE_FTXF_TEST_MEMORY )
 
+/* The maximum number of allocations of which the size is tracked while accounting
+ */
+#define FTXF_TEST_MEMORY_MAXIMUM_NUMBER_OF_TRACKED_ALLOCATIONS	1024
+
+typedef struct ftxf_test_memory_allocation ftxf_test_memory_allocation_t;
+
+struct ftxf_test_memory_allocation
+{
+	/* The pointer
+	 */
+	void *ptr;
+
+	/* The size
+	 */
+	size_t size;
+};
+
+static ftxf_test_memory_allocation_t ftxf_test_memory_tracked_allocations[ FTXF_TEST_MEMORY_MAXIMUM_NUMBER_OF_TRACKED_ALLOCATIONS ];
+
+static int ftxf_test_memory_accounting               = 0;
+static size_t ftxf_test_memory_allocated_size        = 0;
+int ftxf_test_memory_number_of_allocations           = 0;
+int ftxf_test_memory_number_of_untracked_allocations = 0;
+size_t ftxf_test_memory_maximum_allocated_size       = 0;
+
+/* Adds an allocation to the accounting
+ */
+static void ftxf_test_memory_account_allocation(
+             void *ptr,
+             size_t size )
+{
+	int allocation_index = 0;
+
+	if( ( ftxf_test_memory_accounting == 0 )
+	 || ( ptr == NULL ) )
+	{
+		return;
+	}
+	ftxf_test_memory_number_of_allocations++;
+
+	ftxf_test_memory_allocated_size += size;
+
+	if( ftxf_test_memory_allocated_size > ftxf_test_memory_maximum_allocated_size )
+	{
+		ftxf_test_memory_maximum_allocated_size = ftxf_test_memory_allocated_size;
+	}
+	for( allocation_index = 0;
+	     allocation_index < FTXF_TEST_MEMORY_MAXIMUM_NUMBER_OF_TRACKED_ALLOCATIONS;
+	     allocation_index++ )
+	{
+		if( ftxf_test_memory_tracked_allocations[ allocation_index ].ptr == NULL )
+		{
+			ftxf_test_memory_tracked_allocations[ allocation_index ].ptr  = ptr;
+			ftxf_test_memory_tracked_allocations[ allocation_index ].size = size;
+
+			return;
+		}
+	}
+	/* The size of an allocation that cannot be tracked is never subtracted,
+	 * hence the maximum allocated size is no longer accurate
+	 */
+	ftxf_test_memory_number_of_untracked_allocations++;
+}
+
+/* Removes an allocation from the accounting
+ * Allocations that were made before the accounting was started are ignored
+ */
+static void ftxf_test_memory_account_free(
+             void *ptr )
+{
+	int allocation_index = 0;
+
+	if( ( ftxf_test_memory_accounting == 0 )
+	 || ( ptr == NULL ) )
+	{
+		return;
+	}
+	for( allocation_index = 0;
+	     allocation_index < FTXF_TEST_MEMORY_MAXIMUM_NUMBER_OF_TRACKED_ALLOCATIONS;
+	     allocation_index++ )
+	{
+		if( ftxf_test_memory_tracked_allocations[ allocation_index ].ptr == ptr )
+		{
+			ftxf_test_memory_allocated_size -= ftxf_test_memory_tracked_allocations[ allocation_index ].size;
+
+			ftxf_test_memory_tracked_allocations[ allocation_index ].ptr  = NULL;
+			ftxf_test_memory_tracked_allocations[ allocation_index ].size = 0;
+
+			break;
+		}
+	}
+}
+
+/* Starts the accounting of allocations
+ * Resets the number of allocations and the maximum allocated size
+ * The maximum allocated size is only accurate if there are no untracked allocations
+ */
+void ftxf_test_memory_start_accounting(
+      void )
+{
+	int allocation_index = 0;
+
+	for( allocation_index = 0;
+	     allocation_index < FTXF_TEST_MEMORY_MAXIMUM_NUMBER_OF_TRACKED_ALLOCATIONS;
+	     allocation_index++ )
+	{
+		ftxf_test_memory_tracked_allocations[ allocation_index ].ptr  = NULL;
+		ftxf_test_memory_tracked_allocations[ allocation_index ].size = 0;
+	}
+	ftxf_test_memory_allocated_size                  = 0;
+	ftxf_test_memory_number_of_allocations           = 0;
+	ftxf_test_memory_number_of_untracked_allocations = 0;
+	ftxf_test_memory_maximum_allocated_size          = 0;
+	ftxf_test_memory_accounting                      = 1;
+}
+
+/* Stops the accounting of allocations
+ * The number of allocations and the maximum allocated size remain available
+ */
+void ftxf_test_memory_stop_accounting(
+      void )
+{
+	ftxf_test_memory_accounting = 0;
+}
+
 static void *(*ftxf_test_real_malloc)(size_t) = NULL;
 int ftxf_test_malloc_attempts_before_fail     = -1;
 
@@ -71,9 +199,40 @@ void *malloc(
 	ptr = ftxf_test_real_malloc(
 	       size );
 
+	ftxf_test_memory_account_allocation(
+	 ptr,
+	 size );
+
 	return( ptr );
 }
 
+static void (*ftxf_test_real_free)(void *) = NULL;
+
+/* Custom free for accounting allocations
+ * Note this function might fail if compiled with optimization
+ * Aborts if the free function cannot be found since free cannot report an error
+ */
+void free(
+      void *ptr )
+{
+	if( ftxf_test_real_free == NULL )
+	{
+		ftxf_test_real_free = dlsym(
+		                       RTLD_NEXT,
+		                       "free" );
+
+		if( ftxf_test_real_free == NULL )
+		{
+			abort();
+		}
+	}
+	ftxf_test_memory_account_free(
+	 ptr );
+
+	ftxf_test_real_free(
+	 ptr );
+}
+
 static void *(*ftxf_test_real_memcpy)(void *, const void *, size_t) = NULL;
 int ftxf_test_memcpy_attempts_before_fail                           = -1;
 
@@ -167,6 +326,8 @@ void *realloc(
        void *ptr,
        size_t size )
 {
+	void *reallocated_ptr = NULL;
+
 	if( ftxf_test_real_realloc == NULL )
 	{
 		ftxf_test_real_realloc = dlsym(
@@ -188,12 +349,95 @@ void *realloc(
 	{
 		ftxf_test_realloc_attempts_before_fail--;
 	}
-	ptr = ftxf_test_real_realloc(
-	       ptr,
-	       size );
+	reallocated_ptr = ftxf_test_real_realloc(
+	                   ptr,
+	                   size );
 
-	return( ptr );
+	if( reallocated_ptr != NULL )
+	{
+		ftxf_test_memory_account_free(
+		 ptr );
+
+		ftxf_test_memory_account_allocation(
+		 reallocated_ptr,
+		 size );
+	}
+	return( reallocated_ptr );
 }
 
 #endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
 
+/* Allocates memory using the test allocator
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+static void *ftxf_test_memory_allocator_allocate(
+              intptr_t *user_context,
+              size_t size )
+{
+	ftxf_test_memory_allocator_context_t *allocator_context = NULL;
+
+	allocator_context = (ftxf_test_memory_allocator_context_t *) user_context;
+
+	allocator_context->number_of_allocations += 1;
+
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Reallocates memory using the test allocator
+ * Returns a pointer to the reallocated memory or NULL on error
+ */
+static void *ftxf_test_memory_allocator_reallocate(
+              intptr_t *user_context,
+              void *memory,
+              size_t size )
+{
+	ftxf_test_memory_allocator_context_t *allocator_context = NULL;
+
+	allocator_context = (ftxf_test_memory_allocator_context_t *) user_context;
+
+	if( memory == NULL )
+	{
+		allocator_context->number_of_allocations += 1;
+	}
+	else
+	{
+		allocator_context->number_of_reallocations += 1;
+	}
+	return( memory_reallocate(
+	         memory,
+	         size ) );
+}
+
+/* Frees memory using the test allocator
+ */
+static void ftxf_test_memory_allocator_free(
+             intptr_t *user_context,
+             void *memory )
+{
+	ftxf_test_memory_allocator_context_t *allocator_context = NULL;
+
+	allocator_context = (ftxf_test_memory_allocator_context_t *) user_context;
+
+	allocator_context->number_of_frees += 1;
+
+	memory_free(
+	 memory );
+}
+
+/* Initializes a test allocator that counts the allocations, reallocations and frees in the allocator context
+ */
+void ftxf_test_memory_allocator_initialize(
+      libftxf_allocator_t *allocator,
+      ftxf_test_memory_allocator_context_t *allocator_context )
+{
+	allocator_context->number_of_allocations   = 0;
+	allocator_context->number_of_reallocations = 0;
+	allocator_context->number_of_frees         = 0;
+
+	allocator->allocate_function   = &ftxf_test_memory_allocator_allocate;
+	allocator->reallocate_function = &ftxf_test_memory_allocator_reallocate;
+	allocator->free_function       = &ftxf_test_memory_allocator_free;
+	allocator->user_context        = (intptr_t *) allocator_context;
+}
+
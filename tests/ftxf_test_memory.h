@@ -23,6 +23,9 @@
 #define _FTXF_TEST_MEMORY_H
 
 #include <common.h>
+#include <types.h>
+
+#include "ftxf_test_libftxf.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -56,8 +59,41 @@ extern int ftxf_test_memset_attempts_before_fail;
 
 extern int ftxf_test_realloc_attempts_before_fail;
 
+extern int ftxf_test_memory_number_of_allocations;
+
+extern int ftxf_test_memory_number_of_untracked_allocations;
+
+extern size_t ftxf_test_memory_maximum_allocated_size;
+
+void ftxf_test_memory_start_accounting(
+      void );
+
+void ftxf_test_memory_stop_accounting(
+      void );
+
 #endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
 
+typedef struct ftxf_test_memory_allocator_context ftxf_test_memory_allocator_context_t;
+
+struct ftxf_test_memory_allocator_context
+{
+	/* The number of allocations
+	 */
+	int number_of_allocations;
+
+	/* The number of reallocations
+	 */
+	int number_of_reallocations;
+
+	/* The number of frees
+	 */
+	int number_of_frees;
+};
+
+void ftxf_test_memory_allocator_initialize(
+      libftxf_allocator_t *allocator,
+      ftxf_test_memory_allocator_context_t *allocator_context );
+
 #if defined( __cplusplus )
 }
 #endif
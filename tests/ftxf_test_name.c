@@ -0,0 +1,711 @@
+/*
+ * Library name functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_name.h"
+
+/* An ASCII name that covers both the 16 and the 4 code units at a time conversion
+ */
+uint8_t ftxf_test_name_utf16_stream1[ 72 ] = {
+	0x54, 0x00, 0x72, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x61, 0x00, 0x63, 0x00, 0x74, 0x00,
+	0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x4e, 0x00, 0x54, 0x00,
+	0x46, 0x00, 0x53, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x20, 0x00, 0x66, 0x00,
+	0x69, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x65, 0x00,
+	0x2e, 0x00, 0x74, 0x00, 0x78, 0x00, 0x74, 0x00 };
+
+/* A name with characters of the Basic Multilingual Plane
+ */
+uint8_t ftxf_test_name_utf16_stream2[ 24 ] = {
+	0x52, 0x00, 0xe9, 0x00, 0x73, 0x00, 0x75, 0x00, 0x6d, 0x00, 0xe9, 0x00, 0x20, 0x00, 0xac, 0x20,
+	0x2e, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x63, 0x00 };
+
+/* A name with a surrogate pair
+ */
+uint8_t ftxf_test_name_utf16_stream3[ 10 ] = {
+	0x61, 0x00, 0x62, 0x00, 0x3d, 0xd8, 0x00, 0xde, 0x63, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+/* Tests the libftxf_name_get_utf8_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_get_utf8_string_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_get_utf8_string_size(
+	          ftxf_test_name_utf16_stream1,
+	          72,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 37 );
+
+	result = libftxf_name_get_utf8_string_size(
+	          ftxf_test_name_utf16_stream2,
+	          24,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 17 );
+
+	result = libftxf_name_get_utf8_string_size(
+	          ftxf_test_name_utf16_stream3,
+	          10,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 8 );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_get_utf8_string_size(
+	          NULL,
+	          72,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_get_utf8_string_size(
+	          ftxf_test_name_utf16_stream1,
+	          71,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_get_utf8_string_size(
+	          ftxf_test_name_utf16_stream1,
+	          72,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_copy_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_copy_to_utf8_string(
+	          ftxf_test_name_utf16_stream1,
+	          72,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "Transactional NTFS log file name.txt",
+	          37 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libftxf_name_copy_to_utf8_string(
+	          ftxf_test_name_utf16_stream2,
+	          24,
+	          utf8_string,
+	          17,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "R\xc3\xa9sum\xc3\xa9 \xe2\x82\xac.doc",
+	          17 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libftxf_name_copy_to_utf8_string(
+	          ftxf_test_name_utf16_stream3,
+	          10,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "ab\xf0\x9f\x98\x80" "c",
+	          8 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_copy_to_utf8_string(
+	          NULL,
+	          72,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_copy_to_utf8_string(
+	          ftxf_test_name_utf16_stream1,
+	          72,
+	          NULL,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_copy_to_utf8_string(
+	          ftxf_test_name_utf16_stream1,
+	          72,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* UTF-8 string too small for the end of string character
+	 */
+	result = libftxf_name_copy_to_utf8_string(
+	          ftxf_test_name_utf16_stream1,
+	          72,
+	          utf8_string,
+	          36,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* UTF-8 string too small for a multi byte character
+	 */
+	result = libftxf_name_copy_to_utf8_string(
+	          ftxf_test_name_utf16_stream2,
+	          24,
+	          utf8_string,
+	          2,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_get_utf16_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_get_utf16_string_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_get_utf16_string_size(
+	          ftxf_test_name_utf16_stream1,
+	          72,
+	          &utf16_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 37 );
+
+	result = libftxf_name_get_utf16_string_size(
+	          ftxf_test_name_utf16_stream3,
+	          10,
+	          &utf16_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 6 );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_get_utf16_string_size(
+	          NULL,
+	          72,
+	          &utf16_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_get_utf16_string_size(
+	          ftxf_test_name_utf16_stream1,
+	          72,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_copy_to_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_copy_to_utf16_string(
+     void )
+{
+	uint16_t expected_utf16_string[ 13 ] = {
+		0x0052, 0x00e9, 0x0073, 0x0075, 0x006d, 0x00e9, 0x0020, 0x20ac, 0x002e, 0x0064, 0x006f, 0x0063, 0 };
+
+	uint16_t expected_utf16_string_with_surrogate[ 6 ] = {
+		0x0061, 0x0062, 0xd83d, 0xde00, 0x0063, 0 };
+
+	uint16_t utf16_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_copy_to_utf16_string(
+	          ftxf_test_name_utf16_stream2,
+	          24,
+	          utf16_string,
+	          13,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          expected_utf16_string,
+	          sizeof( uint16_t ) * 13 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libftxf_name_copy_to_utf16_string(
+	          ftxf_test_name_utf16_stream3,
+	          10,
+	          utf16_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          expected_utf16_string_with_surrogate,
+	          sizeof( uint16_t ) * 6 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_copy_to_utf16_string(
+	          NULL,
+	          24,
+	          utf16_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_copy_to_utf16_string(
+	          ftxf_test_name_utf16_stream2,
+	          24,
+	          NULL,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_copy_to_utf16_string(
+	          ftxf_test_name_utf16_stream2,
+	          24,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* UTF-16 string too small for the end of string character
+	 */
+	result = libftxf_name_copy_to_utf16_string(
+	          ftxf_test_name_utf16_stream2,
+	          24,
+	          utf16_string,
+	          12,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_get_utf8_string_size",
+	 ftxf_test_name_get_utf8_string_size );
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_copy_to_utf8_string",
+	 ftxf_test_name_copy_to_utf8_string );
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_get_utf16_string_size",
+	 ftxf_test_name_get_utf16_string_size );
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_copy_to_utf16_string",
+	 ftxf_test_name_copy_to_utf16_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1708 @@
+/*
+ * Library name_pool type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_memory.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_name_pool.h"
+
+uint8_t ftxf_test_name_pool_record_data1[ 208 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x20, 0x38, 0x49, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x49, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x93, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00,
+	0x28, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x43, 0x00, 0x61, 0x00,
+	0x63, 0x00, 0x68, 0x00, 0x65, 0x00, 0x2d, 0x00, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00,
+	0x65, 0x00, 0x6d, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x61, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t ftxf_test_name_pool_record_data2[ 176 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01, 0xe1, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xe2, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01, 0xe3, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x52, 0x00, 0xe9, 0x00, 0x73, 0x00, 0x75, 0x00, 0x6d, 0x00, 0xe9, 0x00,
+	0x20, 0x00, 0x22, 0x00, 0x31, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x63, 0x00 };
+
+/* Tests the libftxf_name_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_pool_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libftxf_name_pool_t *name_pool = NULL;
+	int result                     = 0;
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_pool_initialize(
+	          &name_pool,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_pool",
+	 name_pool );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_pool_free(
+	          &name_pool,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "name_pool",
+	 name_pool );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_pool_initialize(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_pool = (libftxf_name_pool_t *) 0x12345678UL;
+
+	result = libftxf_name_pool_initialize(
+	          &name_pool,
+	          &error );
+
+	name_pool = NULL;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_name_pool_initialize with malloc failing
+		 */
+		ftxf_test_malloc_attempts_before_fail = test_number;
+
+		result = libftxf_name_pool_initialize(
+		          &name_pool,
+		          &error );
+
+		if( ftxf_test_malloc_attempts_before_fail != -1 )
+		{
+			ftxf_test_malloc_attempts_before_fail = -1;
+
+			if( name_pool != NULL )
+			{
+				libftxf_name_pool_free(
+				 &name_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "name_pool",
+			 name_pool );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_name_pool_initialize with memset failing
+		 */
+		ftxf_test_memset_attempts_before_fail = test_number;
+
+		result = libftxf_name_pool_initialize(
+		          &name_pool,
+		          &error );
+
+		if( ftxf_test_memset_attempts_before_fail != -1 )
+		{
+			ftxf_test_memset_attempts_before_fail = -1;
+
+			if( name_pool != NULL )
+			{
+				libftxf_name_pool_free(
+				 &name_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "name_pool",
+			 name_pool );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_pool != NULL )
+	{
+		libftxf_name_pool_free(
+		 &name_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_pool_initialize_with_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_pool_initialize_with_allocator(
+     void )
+{
+	ftxf_test_memory_allocator_context_t allocator_context;
+	libftxf_allocator_t allocator;
+
+	uint8_t utf16_stream[ 8 ] = {
+		0, 0, 0, 0, 0, 0, 0, 0 };
+
+	libcerror_error_t *error       = NULL;
+	libftxf_name_pool_t *name_pool = NULL;
+	uint32_t name_index            = 0;
+	int name_number                = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	ftxf_test_memory_allocator_initialize(
+	 &allocator,
+	 &allocator_context );
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_pool_initialize_with_allocator(
+	          &name_pool,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_pool",
+	 name_pool );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Enough distinct names are appended to resize the entries and the data
+	 */
+	for( name_number = 0;
+	     name_number < 3000;
+	     name_number++ )
+	{
+		utf16_stream[ 0 ] = 'n';
+		utf16_stream[ 2 ] = (uint8_t) ( 'a' + ( name_number % 26 ) );
+		utf16_stream[ 4 ] = (uint8_t) ( 'a' + ( ( name_number / 26 ) % 26 ) );
+		utf16_stream[ 6 ] = (uint8_t) ( 'a' + ( name_number / 676 ) );
+
+		result = libftxf_name_pool_append_utf16_stream(
+		          name_pool,
+		          utf16_stream,
+		          8,
+		          &name_index,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FTXF_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_reallocations",
+	 allocator_context.number_of_reallocations,
+	 0 );
+
+	result = libftxf_name_pool_free(
+	          &name_pool,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "name_pool",
+	 name_pool );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The resized memory of the name pool is freed using the allocator
+	 */
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_pool != NULL )
+	{
+		libftxf_name_pool_free(
+		 &name_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libftxf_name_pool_free(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+/* Tests the libftxf_name_pool_append_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_pool_append_utf16_stream(
+     void )
+{
+	uint8_t utf16_stream[ 8 ] = {
+		0, 0, 0, 0, 0, 0, 0, 0 };
+
+	libcerror_error_t *error       = NULL;
+	libftxf_name_pool_t *name_pool = NULL;
+	uint32_t name_index            = 0;
+	int iteration                  = 0;
+	int name_number                = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_name_pool_initialize(
+	          &name_pool,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_pool",
+	 name_pool );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Enough distinct names are appended to resize the hash table and the data multiple times
+	 */
+	for( iteration = 0;
+	     iteration < 2;
+	     iteration++ )
+	{
+		for( name_number = 0;
+		     name_number < 3000;
+		     name_number++ )
+		{
+			utf16_stream[ 0 ] = 'n';
+			utf16_stream[ 2 ] = (uint8_t) ( 'a' + ( name_number % 26 ) );
+			utf16_stream[ 4 ] = (uint8_t) ( 'a' + ( ( name_number / 26 ) % 26 ) );
+			utf16_stream[ 6 ] = (uint8_t) ( 'a' + ( name_number / 676 ) );
+
+			result = libftxf_name_pool_append_utf16_stream(
+			          name_pool,
+			          utf16_stream,
+			          8,
+			          &name_index,
+			          &error );
+
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			FTXF_TEST_ASSERT_EQUAL_UINT32(
+			 "name_index",
+			 name_index,
+			 (uint32_t) name_number );
+		}
+	}
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "name_pool->number_of_entries",
+	 ( (libftxf_internal_name_pool_t *) name_pool )->number_of_entries,
+	 (uint32_t) 3000 );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_pool_append_utf16_stream(
+	          NULL,
+	          utf16_stream,
+	          8,
+	          &name_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_append_utf16_stream(
+	          name_pool,
+	          NULL,
+	          8,
+	          &name_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_append_utf16_stream(
+	          name_pool,
+	          utf16_stream,
+	          0,
+	          &name_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_append_utf16_stream(
+	          name_pool,
+	          utf16_stream,
+	          7,
+	          &name_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_append_utf16_stream(
+	          name_pool,
+	          utf16_stream,
+	          8,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_name_pool_free(
+	          &name_pool,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "name_pool",
+	 name_pool );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_pool != NULL )
+	{
+		libftxf_name_pool_free(
+		 &name_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+
+/* Tests the libftxf_name_pool_append_record_name function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_pool_append_record_name(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libftxf_name_pool_t *name_pool = NULL;
+	libftxf_record_t *record       = NULL;
+	uint32_t name_index            = 0;
+	int iteration                  = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_name_pool_initialize(
+	          &name_pool,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_pool",
+	 name_pool );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_name_pool_record_data1,
+	          208,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_pool_append_record_name(
+	          name_pool,
+	          record,
+	          &name_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_name_pool_record_data2,
+	          176,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( iteration = 0;
+	     iteration < 2;
+	     iteration++ )
+	{
+		result = libftxf_name_pool_append_record_name(
+		          name_pool,
+		          record,
+		          &name_index,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FTXF_TEST_ASSERT_EQUAL_UINT32(
+		 "name_index",
+		 name_index,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libftxf_name_pool_append_record_name(
+	          NULL,
+	          record,
+	          &name_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_append_record_name(
+	          name_pool,
+	          NULL,
+	          &name_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_append_record_name(
+	          name_pool,
+	          record,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_pool_free(
+	          &name_pool,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "name_pool",
+	 name_pool );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	if( name_pool != NULL )
+	{
+		libftxf_name_pool_free(
+		 &name_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_pool_get_number_of_names function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_pool_get_number_of_names(
+     libftxf_name_pool_t *name_pool )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t number_of_names = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_pool_get_number_of_names(
+	          name_pool,
+	          &number_of_names,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_names",
+	 number_of_names,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_pool_get_number_of_names(
+	          NULL,
+	          &number_of_names,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_number_of_names(
+	          name_pool,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_pool_get_allocated_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_pool_get_allocated_size(
+     libftxf_name_pool_t *name_pool )
+{
+	libcerror_error_t *error = NULL;
+	size_t allocated_size    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_pool_get_allocated_size(
+	          name_pool,
+	          &allocated_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_GREATER_THAN_SIZE(
+	 "allocated_size",
+	 allocated_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_pool_get_allocated_size(
+	          NULL,
+	          &allocated_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_allocated_size(
+	          name_pool,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_pool_get_utf8_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_pool_get_utf8_name_size(
+     libftxf_name_pool_t *name_pool )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_pool_get_utf8_name_size(
+	          name_pool,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 17 );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_pool_get_utf8_name_size(
+	          NULL,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_utf8_name_size(
+	          name_pool,
+	          1,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_utf8_name_size(
+	          name_pool,
+	          0,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_pool_get_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_pool_get_utf8_name(
+     libftxf_name_pool_t *name_pool )
+{
+	uint8_t expected_utf8_string[ 17 ] = {
+		'R', 0xc3, 0xa9, 's', 'u', 'm', 0xc3, 0xa9, ' ', '"', '1', '"', '.', 'd', 'o', 'c', 0 };
+
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_pool_get_utf8_name(
+	          name_pool,
+	          0,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          17 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_pool_get_utf8_name(
+	          NULL,
+	          0,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_utf8_name(
+	          name_pool,
+	          1,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_utf8_name(
+	          name_pool,
+	          0,
+	          NULL,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_utf8_name(
+	          name_pool,
+	          0,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_utf8_name(
+	          name_pool,
+	          0,
+	          utf8_string,
+	          4,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_pool_get_utf16_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_pool_get_utf16_name_size(
+     libftxf_name_pool_t *name_pool )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_pool_get_utf16_name_size(
+	          name_pool,
+	          0,
+	          &utf16_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 15 );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_pool_get_utf16_name_size(
+	          NULL,
+	          0,
+	          &utf16_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_utf16_name_size(
+	          name_pool,
+	          1,
+	          &utf16_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_utf16_name_size(
+	          name_pool,
+	          0,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_pool_get_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_pool_get_utf16_name(
+     libftxf_name_pool_t *name_pool )
+{
+	uint16_t expected_utf16_string[ 15 ] = {
+		'R', 0x00e9, 's', 'u', 'm', 0x00e9, ' ', '"', '1', '"', '.', 'd', 'o', 'c', 0 };
+
+	uint16_t utf16_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_pool_get_utf16_name(
+	          name_pool,
+	          0,
+	          utf16_string,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          expected_utf16_string,
+	          sizeof( uint16_t ) * 15 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_pool_get_utf16_name(
+	          NULL,
+	          0,
+	          utf16_string,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_utf16_name(
+	          name_pool,
+	          1,
+	          utf16_string,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_utf16_name(
+	          name_pool,
+	          0,
+	          NULL,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_utf16_name(
+	          name_pool,
+	          0,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_pool_get_utf16_name(
+	          name_pool,
+	          0,
+	          utf16_string,
+	          4,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error       = NULL;
+	libftxf_name_pool_t *name_pool = NULL;
+	libftxf_record_t *record       = NULL;
+	uint32_t name_index            = 0;
+	int result                     = 0;
+
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_pool_initialize",
+	 ftxf_test_name_pool_initialize );
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_pool_initialize_with_allocator",
+	 ftxf_test_name_pool_initialize_with_allocator );
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_pool_free",
+	 ftxf_test_name_pool_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_pool_append_utf16_stream",
+	 ftxf_test_name_pool_append_utf16_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_pool_append_record_name",
+	 ftxf_test_name_pool_append_record_name );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize name pool for tests
+	 */
+	result = libftxf_name_pool_initialize(
+	          &name_pool,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_pool",
+	 name_pool );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_name_pool_record_data2,
+	          176,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_pool_append_record_name(
+	          name_pool,
+	          record,
+	          &name_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_name_pool_get_number_of_names",
+	 ftxf_test_name_pool_get_number_of_names,
+	 name_pool );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_name_pool_get_allocated_size",
+	 ftxf_test_name_pool_get_allocated_size,
+	 name_pool );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_name_pool_get_utf8_name_size",
+	 ftxf_test_name_pool_get_utf8_name_size,
+	 name_pool );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_name_pool_get_utf8_name",
+	 ftxf_test_name_pool_get_utf8_name,
+	 name_pool );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_name_pool_get_utf16_name_size",
+	 ftxf_test_name_pool_get_utf16_name_size,
+	 name_pool );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_name_pool_get_utf16_name",
+	 ftxf_test_name_pool_get_utf16_name,
+	 name_pool );
+
+	/* Clean up
+	 */
+	result = libftxf_name_pool_free(
+	          &name_pool,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "name_pool",
+	 name_pool );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	if( name_pool != NULL )
+	{
+		libftxf_name_pool_free(
+		 &name_pool,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1940 @@
+/*
+ * Library name_search type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_memory.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_name_search.h"
+
+uint8_t ftxf_test_name_search_record_data1[ 208 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x20, 0x38, 0x49, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x49, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x93, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00,
+	0x28, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x43, 0x00, 0x61, 0x00,
+	0x63, 0x00, 0x68, 0x00, 0x65, 0x00, 0x2d, 0x00, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00,
+	0x65, 0x00, 0x6d, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x61, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t ftxf_test_name_search_record_data2[ 176 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01, 0xe1, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xe2, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01, 0xe3, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x52, 0x00, 0xe9, 0x00, 0x73, 0x00, 0x75, 0x00, 0x6d, 0x00, 0xe9, 0x00,
+	0x20, 0x00, 0x22, 0x00, 0x31, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x63, 0x00 };
+
+/* Copies an ISO 8859-1 string to an UTF-16 little-endian stream
+ * Returns the size of the UTF-16 little-endian stream
+ */
+size_t ftxf_test_name_search_copy_utf16_stream(
+        const char *string,
+        uint8_t *utf16_stream )
+{
+	size_t utf16_stream_size = 0;
+
+	while( *string != 0 )
+	{
+		utf16_stream[ utf16_stream_size++ ] = (uint8_t) *string++;
+		utf16_stream[ utf16_stream_size++ ] = 0;
+	}
+	return( utf16_stream_size );
+}
+
+/* Tests the libftxf_name_search_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_search_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libftxf_name_search_t *name_search = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 2;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_search_initialize(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_search",
+	 name_search );
+
+	result = libftxf_name_search_free(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "name_search",
+	 name_search );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_search_initialize(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_search = (libftxf_name_search_t *) 0x12345678UL;
+
+	result = libftxf_name_search_initialize(
+	          &name_search,
+	          &error );
+
+	name_search = NULL;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_name_search_initialize with malloc failing
+		 */
+		ftxf_test_malloc_attempts_before_fail = test_number;
+
+		result = libftxf_name_search_initialize(
+		          &name_search,
+		          &error );
+
+		if( ftxf_test_malloc_attempts_before_fail != -1 )
+		{
+			ftxf_test_malloc_attempts_before_fail = -1;
+
+			if( name_search != NULL )
+			{
+				libftxf_name_search_free(
+				 &name_search,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "name_search",
+			 name_search );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_name_search_initialize with memset failing
+		 */
+		ftxf_test_memset_attempts_before_fail = test_number;
+
+		result = libftxf_name_search_initialize(
+		          &name_search,
+		          &error );
+
+		if( ftxf_test_memset_attempts_before_fail != -1 )
+		{
+			ftxf_test_memset_attempts_before_fail = -1;
+
+			if( name_search != NULL )
+			{
+				libftxf_name_search_free(
+				 &name_search,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "name_search",
+			 name_search );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_search != NULL )
+	{
+		libftxf_name_search_free(
+		 &name_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_search_initialize_with_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_search_initialize_with_allocator(
+     void )
+{
+	ftxf_test_memory_allocator_context_t allocator_context;
+	libftxf_allocator_t allocator;
+
+	libcerror_error_t *error           = NULL;
+	libftxf_name_search_t *name_search = NULL;
+	int iteration                      = 0;
+	int number_of_allocations          = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	ftxf_test_memory_allocator_initialize(
+	 &allocator,
+	 &allocator_context );
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_search_initialize_with_allocator(
+	          &name_search,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_search",
+	 name_search );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Setting the pattern again replaces the pattern, the conversion of the pattern
+	 * uses a scratch buffer that is freed afterwards
+	 */
+	number_of_allocations = allocator_context.number_of_allocations;
+
+	for( iteration = 0;
+	     iteration < 2;
+	     iteration++ )
+	{
+		result = libftxf_name_search_set_utf8_pattern(
+		          name_search,
+		          (uint8_t *) "*.docx",
+		          6,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FTXF_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_allocations",
+	 allocator_context.number_of_allocations,
+	 number_of_allocations );
+
+	FTXF_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 0 );
+
+	result = libftxf_name_search_free(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "name_search",
+	 name_search );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The pattern of the name search is freed using the allocator
+	 */
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_search != NULL )
+	{
+		libftxf_name_search_free(
+		 &name_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_search_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_search_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libftxf_name_search_free(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_search_set_upcase_table function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_search_set_upcase_table(
+     void )
+{
+	uint8_t utf16_stream[ 64 ];
+
+	libcerror_error_t *error           = NULL;
+	libftxf_name_search_t *name_search = NULL;
+	uint8_t *upcase_table_data         = NULL;
+	size_t utf16_stream_size           = 0;
+	uint32_t code_unit                 = 0;
+	uint16_t upcase_value              = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_name_search_initialize(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_search",
+	 name_search );
+
+	upcase_table_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * 131072 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "upcase_table_data",
+	 upcase_table_data );
+
+	/* An upcase table that only maps the Basic Latin characters
+	 */
+	for( code_unit = 0;
+	     code_unit < 65536;
+	     code_unit++ )
+	{
+		upcase_value = (uint16_t) code_unit;
+
+		if( ( code_unit >= 0x0061 )
+		 && ( code_unit <= 0x007a ) )
+		{
+			upcase_value -= 0x0020;
+		}
+		upcase_table_data[ code_unit * 2 ]       = (uint8_t) ( upcase_value & 0x00ff );
+		upcase_table_data[ ( code_unit * 2 ) + 1 ] = (uint8_t) ( upcase_value >> 8 );
+	}
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "R\xc3\x89SUM\xc3\x89*",
+	          9,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "r\xe9sum\xe9.doc",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_set_upcase_table(
+	          name_search,
+	          upcase_table_data,
+	          131072,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_search_set_upcase_table(
+	          NULL,
+	          upcase_table_data,
+	          131072,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_search_set_upcase_table(
+	          name_search,
+	          NULL,
+	          131072,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_search_set_upcase_table(
+	          name_search,
+	          upcase_table_data,
+	          131071,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 upcase_table_data );
+
+	upcase_table_data = NULL;
+
+	result = libftxf_name_search_free(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "name_search",
+	 name_search );
+
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( upcase_table_data != NULL )
+	{
+		memory_free(
+		 upcase_table_data );
+	}
+	if( name_search != NULL )
+	{
+		libftxf_name_search_free(
+		 &name_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+/* Tests the libftxf_name_search_set_utf8_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_search_set_utf8_pattern(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libftxf_name_search_t *name_search = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_name_search_initialize(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_search",
+	 name_search );
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "*.docx",
+	          6,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "pattern_length",
+	 ( (libftxf_internal_name_search_t *) name_search )->pattern_length,
+	 (size_t) 6 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "minimum_name_length",
+	 ( (libftxf_internal_name_search_t *) name_search )->minimum_name_length,
+	 (size_t) 5 );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "suffix_length",
+	 ( (libftxf_internal_name_search_t *) name_search )->suffix_length,
+	 (size_t) 5 );
+
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "*cache*",
+	          7,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_prefilter_code_units",
+	 ( (libftxf_internal_name_search_t *) name_search )->number_of_prefilter_code_units,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_search_set_utf8_pattern(
+	          NULL,
+	          (uint8_t *) "*.docx",
+	          6,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          NULL,
+	          6,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "*.docx",
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "*.docx",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_name_search_free(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "name_search",
+	 name_search );
+
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_search != NULL )
+	{
+		libftxf_name_search_free(
+		 &name_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+
+/* Tests the libftxf_name_search_set_utf16_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_search_set_utf16_pattern(
+     void )
+{
+	uint16_t utf16_pattern[ 6 ] = {
+		'*', '.', 'd', 'o', 'c', 'x' };
+
+	libcerror_error_t *error           = NULL;
+	libftxf_name_search_t *name_search = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_name_search_initialize(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_search",
+	 name_search );
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_search_set_utf16_pattern(
+	          name_search,
+	          utf16_pattern,
+	          6,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_search_set_utf16_pattern(
+	          NULL,
+	          utf16_pattern,
+	          6,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_search_set_utf16_pattern(
+	          name_search,
+	          NULL,
+	          6,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_search_set_utf16_pattern(
+	          name_search,
+	          utf16_pattern,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_name_search_free(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "name_search",
+	 name_search );
+
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_search != NULL )
+	{
+		libftxf_name_search_free(
+		 &name_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_search_match_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_search_match_utf16_stream(
+     void )
+{
+	uint8_t utf16_stream[ 64 ];
+
+	libcerror_error_t *error           = NULL;
+	libftxf_name_search_t *name_search = NULL;
+	size_t utf16_stream_size           = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_name_search_initialize(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_search",
+	 name_search );
+
+	/* Test regular cases
+	 */
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "*.docx",
+	          6,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "Report.DocX",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "Report.doc",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "docx",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "a.docx.tmp",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "*cache*",
+	          7,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "FontCache-System.dat",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "Report.docx",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "xxxxcAchexx",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "cach",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "r?sum?.doc",
+	          10,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "R\xe9sum\xe9.doc",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "Resume.docx",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "R\xc3\x89SUM\xc3\x89*",
+	          9,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "r\xe9sum\xe9 \"1\".doc",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "a*b*c",
+	          5,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "aXbYc",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "aXcYb",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "abbbc",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "*",
+	          1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "x",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "abc",
+	          3,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "ABC",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "ABCD",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = ftxf_test_name_search_copy_utf16_stream(
+	                     "ABD",
+	                     utf16_stream );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_search_match_utf16_stream(
+	          NULL,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          NULL,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          3,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_name_search_free(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "name_search",
+	 name_search );
+
+
+	/* Test name search without pattern
+	 */
+	result = libftxf_name_search_initialize(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_search",
+	 name_search );
+
+	result = libftxf_name_search_match_utf16_stream(
+	          name_search,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_search_free(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "name_search",
+	 name_search );
+
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_search != NULL )
+	{
+		libftxf_name_search_free(
+		 &name_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_name_search_match_record function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_name_search_match_record(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libftxf_name_search_t *name_search = NULL;
+	libftxf_record_t *record           = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_name_search_initialize(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_search",
+	 name_search );
+
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "*.DOC",
+	          5,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_name_search_record_data2,
+	          176,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_match_record(
+	          name_search,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_set_utf8_pattern(
+	          name_search,
+	          (uint8_t *) "*.docx",
+	          6,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_match_record(
+	          name_search,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_name_search_record_data1,
+	          208,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_match_record(
+	          name_search,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_name_search_match_record(
+	          NULL,
+	          record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_name_search_match_record(
+	          name_search,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_name_search_free(
+	          &name_search,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "name_search",
+	 name_search );
+
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	if( name_search != NULL )
+	{
+		libftxf_name_search_free(
+		 &name_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_search_initialize",
+	 ftxf_test_name_search_initialize );
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_search_initialize_with_allocator",
+	 ftxf_test_name_search_initialize_with_allocator );
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_search_free",
+	 ftxf_test_name_search_free );
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_search_set_upcase_table",
+	 ftxf_test_name_search_set_upcase_table );
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_search_set_utf8_pattern",
+	 ftxf_test_name_search_set_utf8_pattern );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_search_set_utf16_pattern",
+	 ftxf_test_name_search_set_utf16_pattern );
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_search_match_utf16_stream",
+	 ftxf_test_name_search_match_utf16_stream );
+
+	FTXF_TEST_RUN(
+	 "libftxf_name_search_match_record",
+	 ftxf_test_name_search_match_record );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1823 @@
+/*
+ * Library path_resolver type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_memory.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_path_resolver.h"
+
+/* Tests the libftxf_path_resolver_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_path_resolver_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_path_resolver_t *path_resolver = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 4;
+	int number_of_memset_fail_tests = 3;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libftxf_path_resolver_initialize(
+	          &path_resolver,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "path_resolver",
+	 path_resolver );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_free(
+	          &path_resolver,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "path_resolver",
+	 path_resolver );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_path_resolver_initialize(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_resolver = (libftxf_path_resolver_t *) 0x12345678UL;
+
+	result = libftxf_path_resolver_initialize(
+	          &path_resolver,
+	          &error );
+
+	path_resolver = NULL;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_path_resolver_initialize with malloc failing
+		 */
+		ftxf_test_malloc_attempts_before_fail = test_number;
+
+		result = libftxf_path_resolver_initialize(
+		          &path_resolver,
+		          &error );
+
+		if( ftxf_test_malloc_attempts_before_fail != -1 )
+		{
+			ftxf_test_malloc_attempts_before_fail = -1;
+
+			if( path_resolver != NULL )
+			{
+				libftxf_path_resolver_free(
+				 &path_resolver,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "path_resolver",
+			 path_resolver );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_path_resolver_initialize with memset failing
+		 */
+		ftxf_test_memset_attempts_before_fail = test_number;
+
+		result = libftxf_path_resolver_initialize(
+		          &path_resolver,
+		          &error );
+
+		if( ftxf_test_memset_attempts_before_fail != -1 )
+		{
+			ftxf_test_memset_attempts_before_fail = -1;
+
+			if( path_resolver != NULL )
+			{
+				libftxf_path_resolver_free(
+				 &path_resolver,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "path_resolver",
+			 path_resolver );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_resolver != NULL )
+	{
+		libftxf_path_resolver_free(
+		 &path_resolver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_path_resolver_initialize_with_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_path_resolver_initialize_with_allocator(
+     void )
+{
+	ftxf_test_memory_allocator_context_t allocator_context;
+	libftxf_allocator_t allocator;
+
+	libcerror_error_t *error               = NULL;
+	libftxf_path_resolver_t *path_resolver = NULL;
+	int entry_index                        = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	ftxf_test_memory_allocator_initialize(
+	 &allocator,
+	 &allocator_context );
+
+	/* Test regular cases
+	 */
+	result = libftxf_path_resolver_initialize_with_allocator(
+	          &path_resolver,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "path_resolver",
+	 path_resolver );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Enough entries are appended to resize the entries
+	 */
+	for( entry_index = 0;
+	     entry_index < 2000;
+	     entry_index++ )
+	{
+		result = libftxf_path_resolver_append_entry(
+		          path_resolver,
+		          (uint64_t) 0x0001000000000040UL + (uint64_t) entry_index,
+		          (uint64_t) 0x0005000000000005UL,
+		          (uint8_t *) "Windows",
+		          7,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FTXF_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_reallocations",
+	 allocator_context.number_of_reallocations,
+	 0 );
+
+	result = libftxf_path_resolver_free(
+	          &path_resolver,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "path_resolver",
+	 path_resolver );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The resized memory of the path resolver is freed using the allocator
+	 */
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_resolver != NULL )
+	{
+		libftxf_path_resolver_free(
+		 &path_resolver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_path_resolver_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_path_resolver_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libftxf_path_resolver_free(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_path_resolver_append_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_path_resolver_append_entry(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_path_resolver_t *path_resolver = NULL;
+	uint32_t number_of_entries             = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_path_resolver_initialize(
+	          &path_resolver,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "path_resolver",
+	 path_resolver );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0005000000000005UL,
+	          (uint64_t) 0x0005000000000005UL,
+	          (uint8_t *) ".",
+	          1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000040UL,
+	          (uint64_t) 0x0005000000000005UL,
+	          (uint8_t *) "Windows",
+	          7,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000041UL,
+	          (uint64_t) 0x0001000000000040UL,
+	          (uint8_t *) "Fonts",
+	          5,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000042UL,
+	          (uint64_t) 0x0001000000000041UL,
+	          (uint8_t *) "arial.ttf",
+	          9,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000050UL,
+	          (uint64_t) 0x0001000000000099UL,
+	          (uint8_t *) "lost.txt",
+	          8,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000060UL,
+	          (uint64_t) 0x0001000000000061UL,
+	          (uint8_t *) "loop1",
+	          5,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000061UL,
+	          (uint64_t) 0x0001000000000060UL,
+	          (uint8_t *) "loop2",
+	          5,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000070UL,
+	          (uint64_t) 0x0005000000000005UL,
+	          (uint8_t *) "",
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_get_number_of_entries(
+	          path_resolver,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_entries",
+	 number_of_entries,
+	 (uint32_t) 8 );
+
+	/* Test error cases
+	 */
+	result = libftxf_path_resolver_append_entry(
+	          NULL,
+	          (uint64_t) 0x0001000000000042UL,
+	          (uint64_t) 0x0001000000000041UL,
+	          (uint8_t *) "arial.ttf",
+	          9,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000042UL,
+	          (uint64_t) 0x0001000000000041UL,
+	          NULL,
+	          9,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000042UL,
+	          (uint64_t) 0x0001000000000041UL,
+	          (uint8_t *) "arial.ttf",
+	          (size_t) UINT16_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_path_resolver_free(
+	          &path_resolver,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "path_resolver",
+	 path_resolver );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_resolver != NULL )
+	{
+		libftxf_path_resolver_free(
+		 &path_resolver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_path_resolver_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_path_resolver_get_number_of_entries(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_path_resolver_t *path_resolver = NULL;
+	uint32_t number_of_entries             = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_path_resolver_initialize(
+	          &path_resolver,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "path_resolver",
+	 path_resolver );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_path_resolver_get_number_of_entries(
+	          path_resolver,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_entries",
+	 number_of_entries,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_path_resolver_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_path_resolver_get_number_of_entries(
+	          path_resolver,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_path_resolver_free(
+	          &path_resolver,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "path_resolver",
+	 path_resolver );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_resolver != NULL )
+	{
+		libftxf_path_resolver_free(
+		 &path_resolver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_path_resolver_get_utf8_path_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_path_resolver_get_utf8_path_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_path_resolver_t *path_resolver = NULL;
+	size_t utf8_string_size                = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_path_resolver_initialize(
+	          &path_resolver,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "path_resolver",
+	 path_resolver );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0005000000000005UL,
+	          (uint64_t) 0x0005000000000005UL,
+	          (uint8_t *) ".",
+	          1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000040UL,
+	          (uint64_t) 0x0005000000000005UL,
+	          (uint8_t *) "Windows",
+	          7,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000041UL,
+	          (uint64_t) 0x0001000000000040UL,
+	          (uint8_t *) "Fonts",
+	          5,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000042UL,
+	          (uint64_t) 0x0001000000000041UL,
+	          (uint8_t *) "arial.ttf",
+	          9,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000050UL,
+	          (uint64_t) 0x0001000000000099UL,
+	          (uint8_t *) "lost.txt",
+	          8,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000060UL,
+	          (uint64_t) 0x0001000000000061UL,
+	          (uint8_t *) "loop1",
+	          5,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000061UL,
+	          (uint64_t) 0x0001000000000060UL,
+	          (uint8_t *) "loop2",
+	          5,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_path_resolver_get_utf8_path_size(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000042UL,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 25 );
+
+	result = libftxf_path_resolver_get_utf8_path_size(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000099UL,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_path_resolver_get_utf8_path_size(
+	          NULL,
+	          (uint64_t) 0x0001000000000042UL,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_path_resolver_get_utf8_path_size(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000042UL,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test get UTF-8 path size with a parent chain that contains a loop
+	 */
+	result = libftxf_path_resolver_get_utf8_path_size(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000060UL,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_path_resolver_free(
+	          &path_resolver,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "path_resolver",
+	 path_resolver );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_resolver != NULL )
+	{
+		libftxf_path_resolver_free(
+		 &path_resolver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_path_resolver_get_utf8_path function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_path_resolver_get_utf8_path(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error               = NULL;
+	libftxf_path_resolver_t *path_resolver = NULL;
+	size_t utf8_string_size                = 0;
+	uint32_t entry_index                   = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_path_resolver_initialize(
+	          &path_resolver,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "path_resolver",
+	 path_resolver );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0005000000000005UL,
+	          (uint64_t) 0x0005000000000005UL,
+	          (uint8_t *) ".",
+	          1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000040UL,
+	          (uint64_t) 0x0005000000000005UL,
+	          (uint8_t *) "Windows",
+	          7,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000041UL,
+	          (uint64_t) 0x0001000000000040UL,
+	          (uint8_t *) "Fonts",
+	          5,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000042UL,
+	          (uint64_t) 0x0001000000000041UL,
+	          (uint8_t *) "arial.ttf",
+	          9,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000050UL,
+	          (uint64_t) 0x0001000000000099UL,
+	          (uint8_t *) "lost.txt",
+	          8,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000060UL,
+	          (uint64_t) 0x0001000000000061UL,
+	          (uint8_t *) "loop1",
+	          5,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000061UL,
+	          (uint64_t) 0x0001000000000060UL,
+	          (uint8_t *) "loop2",
+	          5,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_path_resolver_get_utf8_path_size(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000042UL,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 25 );
+
+	result = libftxf_path_resolver_get_utf8_path(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000042UL,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "\\Windows\\Fonts\\arial.ttf",
+	          25 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libftxf_path_resolver_get_utf8_path_size(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000041UL,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 15 );
+
+	result = libftxf_path_resolver_get_utf8_path(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000041UL,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "\\Windows\\Fonts",
+	          15 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libftxf_path_resolver_get_utf8_path_size(
+	          path_resolver,
+	          (uint64_t) 0x0005000000000005UL,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 2 );
+
+	result = libftxf_path_resolver_get_utf8_path(
+	          path_resolver,
+	          (uint64_t) 0x0005000000000005UL,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "\\",
+	          2 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libftxf_path_resolver_get_utf8_path(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000099UL,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test get UTF-8 path with a parent that is missing
+	 */
+	result = libftxf_path_resolver_get_utf8_path_size(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000050UL,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 9 );
+
+	result = libftxf_path_resolver_get_utf8_path(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000050UL,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "lost.txt",
+	          9 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test get UTF-8 path with a parent that was appended after the path was cached
+	 */
+	result = libftxf_path_resolver_append_entry(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000099UL,
+	          (uint64_t) 0x0005000000000005UL,
+	          (uint8_t *) "found",
+	          5,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_path_resolver_get_utf8_path_size(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000050UL,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 16 );
+
+	result = libftxf_path_resolver_get_utf8_path(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000050UL,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "\\found\\lost.txt",
+	          16 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test get UTF-8 path with more directories than fit in the cache
+	 */
+	for( entry_index = 0;
+	     entry_index < 2048;
+	     entry_index++ )
+	{
+		result = libftxf_path_resolver_append_entry(
+		          path_resolver,
+		          (uint64_t) 0x0001000000001000UL + entry_index,
+		          (uint64_t) 0x0001000000000041UL,
+		          (uint8_t *) "d",
+		          1,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libftxf_path_resolver_append_entry(
+		          path_resolver,
+		          (uint64_t) 0x0001000000010000UL + entry_index,
+		          (uint64_t) 0x0001000000001000UL + entry_index,
+		          (uint8_t *) "f",
+		          1,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( entry_index = 0;
+	     entry_index < 2048;
+	     entry_index++ )
+	{
+		result = libftxf_path_resolver_get_utf8_path(
+		          path_resolver,
+		          (uint64_t) 0x0001000000010000UL + entry_index,
+		          utf8_string,
+		          64,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libftxf_path_resolver_get_utf8_path_size(
+	          path_resolver,
+	          (uint64_t) 0x0001000000010000UL,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 19 );
+
+	result = libftxf_path_resolver_get_utf8_path(
+	          path_resolver,
+	          (uint64_t) 0x0001000000010000UL,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "\\Windows\\Fonts\\d\\f",
+	          19 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libftxf_path_resolver_get_utf8_path_size(
+	          path_resolver,
+	          (uint64_t) 0x00010000000107ffUL,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 19 );
+
+	result = libftxf_path_resolver_get_utf8_path(
+	          path_resolver,
+	          (uint64_t) 0x00010000000107ffUL,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "\\Windows\\Fonts\\d\\f",
+	          19 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_path_resolver_get_utf8_path(
+	          NULL,
+	          (uint64_t) 0x0001000000000042UL,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_path_resolver_get_utf8_path(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000042UL,
+	          NULL,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_path_resolver_get_utf8_path(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000042UL,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_path_resolver_get_utf8_path(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000042UL,
+	          utf8_string,
+	          24,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_path_resolver_get_utf8_path(
+	          path_resolver,
+	          (uint64_t) 0x0001000000000061UL,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_path_resolver_free(
+	          &path_resolver,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "path_resolver",
+	 path_resolver );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_resolver != NULL )
+	{
+		libftxf_path_resolver_free(
+		 &path_resolver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FTXF_TEST_RUN(
+	 "libftxf_path_resolver_initialize",
+	 ftxf_test_path_resolver_initialize );
+
+	FTXF_TEST_RUN(
+	 "libftxf_path_resolver_initialize_with_allocator",
+	 ftxf_test_path_resolver_initialize_with_allocator );
+
+	FTXF_TEST_RUN(
+	 "libftxf_path_resolver_free",
+	 ftxf_test_path_resolver_free );
+
+	FTXF_TEST_RUN(
+	 "libftxf_path_resolver_append_entry",
+	 ftxf_test_path_resolver_append_entry );
+
+	FTXF_TEST_RUN(
+	 "libftxf_path_resolver_get_number_of_entries",
+	 ftxf_test_path_resolver_get_number_of_entries );
+
+	FTXF_TEST_RUN(
+	 "libftxf_path_resolver_get_utf8_path_size",
+	 ftxf_test_path_resolver_get_utf8_path_size );
+
+	FTXF_TEST_RUN(
+	 "libftxf_path_resolver_get_utf8_path",
+	 ftxf_test_path_resolver_get_utf8_path );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
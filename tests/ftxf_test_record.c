@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -35,6 +36,22 @@
 
 #include "../libftxf/libftxf_record.h"
 
+/* The allocation budget of the buffers of a record, which are the name,
+ * the update journal entries and the update journal entry names
+ */
+#define FTXF_TEST_RECORD_MAXIMUM_NUMBER_OF_BUFFER_ALLOCATIONS	3
+#define FTXF_TEST_RECORD_MAXIMUM_BUFFERS_SIZE			1024
+
+/* The allocation budget of the USN record that is read per update journal entry,
+ * which are the libfusn record and its name
+ */
+#define FTXF_TEST_RECORD_USN_RECORD_NUMBER_OF_ALLOCATIONS	2
+#define FTXF_TEST_RECORD_USN_RECORD_MAXIMUM_ALLOCATED_SIZE	1024
+
+/* The number of times the test records are read to test the allocations of a record that is reused
+ */
+#define FTXF_TEST_RECORD_NUMBER_OF_ACCOUNTED_READS	16
+
 uint8_t ftxf_test_record_data1[ 208 ] = {
 	0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x20, 0x38, 0x49, 0x00, 0x00, 0x00, 0x00,
@@ -50,6 +67,33 @@ uint8_t ftxf_test_record_data1[ 208 ] = {
 	0x63, 0x00, 0x68, 0x00, 0x65, 0x00, 0x2d, 0x00, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00,
 	0x65, 0x00, 0x6d, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x61, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
+uint8_t ftxf_test_record_data2[ 176 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01, 0xe1, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xe2, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01, 0xe3, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x52, 0x00, 0xe9, 0x00, 0x73, 0x00, 0x75, 0x00, 0x6d, 0x00, 0xe9, 0x00,
+	0x20, 0x00, 0x22, 0x00, 0x31, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x63, 0x00 };
+
+uint8_t ftxf_test_record_json_string1[ 414 ] =
+	 "{\"record_type\":23,\"record_size\":208,\"file_identifier\":0,\"file_reference\":0,\"guid\":\"82f0c3"
+	 "fc-88fb-11e3-8b6e-525400123456\",\"timestamp\":130354872100044000,\"update_journal_entries\":[{\"upd"
+	 "ate_sequence_number\":0,\"update_time\":0,\"file_reference\":281474976727574,\"parent_file_reference"
+	 "\":281474976712339,\"update_reason_flags\":2147483654,\"update_source_flags\":0,\"file_attribute_fla"
+	 "gs\":8224,\"name\":\"FontCache-System.dat\"}]}\n";
+
+uint8_t ftxf_test_record_json_string2[ 417 ] =
+	 "{\"record_type\":7,\"record_size\":176,\"file_identifier\":5,\"file_reference\":281474976727574,\"gu"
+	 "id\":\"82f0c3fc-88fb-11e3-8b6e-525400123456\",\"timestamp\":130354872100044000,\"name\":\"R\xc3\xa9s"
+	 "um\xc3\xa9 \\\"1\\\".doc\",\"creation_time\":130354872100044000,\"modification_time\":13035487210004"
+	 "4001,\"entry_modification_time\":130354872100044002,\"access_time\":130354872100044003,\"allocated_f"
+	 "ile_size\":4096,\"file_size\":1234,\"file_attribute_flags\":32}\n";
+
 /* Tests the libftxf_record_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -245,6 +289,216 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libftxf_record_initialize_with_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_initialize_with_allocator(
+     void )
+{
+	ftxf_test_memory_allocator_context_t allocator_context;
+	libftxf_allocator_t allocator;
+
+	libcerror_error_t *error = NULL;
+	libftxf_record_t *record = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	ftxf_test_memory_allocator_initialize(
+	 &allocator,
+	 &allocator_context );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_initialize_with_allocator(
+	          &record,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_allocations",
+	 allocator_context.number_of_allocations,
+	 1 );
+
+	/* The buffers of the record are allocated using the allocator
+	 */
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_record_data1,
+	          208,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_record_data2,
+	          176,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_allocations",
+	 allocator_context.number_of_allocations,
+	 4 );
+
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 4 );
+
+	/* An allocator without functions uses the default memory functions
+	 */
+	allocator.allocate_function   = NULL;
+	allocator.reallocate_function = NULL;
+	allocator.free_function       = NULL;
+
+	result = libftxf_record_initialize_with_allocator(
+	          &record,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_allocations",
+	 allocator_context.number_of_allocations,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_initialize_with_allocator(
+	          NULL,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* An allocator with only some of the functions is not supported
+	 */
+	ftxf_test_memory_allocator_initialize(
+	 &allocator,
+	 &allocator_context );
+
+	allocator.free_function = NULL;
+
+	result = libftxf_record_initialize_with_allocator(
+	          &record,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libftxf_record_free function
  * Returns 1 if successful or 0 if not
  */
@@ -637,44 +891,2841 @@ on_error:
 	return( 0 );
 }
 
-/* The main program
+/* Tests the libftxf_record_copy_from_byte_stream_with_filter function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
-#endif
+int ftxf_test_record_copy_from_byte_stream_with_filter(
+     void )
 {
-	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
-	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+	libcerror_error_t *error               = NULL;
+	libftxf_record_t *record               = NULL;
+	libftxf_record_filter_t *record_filter = NULL;
+	uint64_t content_hash                  = 0;
+	int number_of_entries                  = 0;
+	int result                             = 0;
 
-	FTXF_TEST_RUN(
-	 "libftxf_record_initialize",
-	 ftxf_test_record_initialize );
+	/* Initialize test
+	 */
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
 
-	FTXF_TEST_RUN(
-	 "libftxf_record_free",
-	 ftxf_test_record_free );
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
 
-	FTXF_TEST_RUN(
-	 "libftxf_internal_record_read_update_journal_entry_list_data",
-	 ftxf_test_internal_record_read_update_journal_entry_list_data );
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+	result = libftxf_record_filter_initialize(
+	          &record_filter,
+	          &error );
 
-	FTXF_TEST_RUN(
-	 "libftxf_record_copy_from_byte_stream",
-	 ftxf_test_record_copy_from_byte_stream );
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	return( EXIT_SUCCESS );
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
 
-on_error:
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_filter_append_record_type(
+	          record_filter,
+	          0x0002,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_copy_from_byte_stream_with_filter(
+	          record,
+	          ftxf_test_record_data1,
+	          208,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a record that does not match the filter
+	 */
+	result = libftxf_record_copy_from_byte_stream_with_filter(
+	          record,
+	          ftxf_test_record_data1,
+	          208,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The values of the previous record are not retained
+	 */
+	result = libftxf_record_get_number_of_update_journal_entries(
+	          record,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	result = libftxf_record_get_content_hash(
+	          record,
+	          &content_hash,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "content_hash",
+	 content_hash,
+	 (uint64_t) 0 );
+
+	/* Test with a record that matches the filter
+	 */
+	result = libftxf_record_filter_append_record_type(
+	          record_filter,
+	          0x0017,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_copy_from_byte_stream_with_filter(
+	          record,
+	          ftxf_test_record_data1,
+	          208,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_copy_from_byte_stream_with_filter(
+	          NULL,
+	          ftxf_test_record_data1,
+	          208,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Byte stream too small
+	 */
+	result = libftxf_record_copy_from_byte_stream_with_filter(
+	          record,
+	          ftxf_test_record_data1,
+	          0,
+	          record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_filter_free(
+	          &record_filter,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_filter",
+	 record_filter );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_filter != NULL )
+	{
+		libftxf_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+
+/* Tests the allocations of the libftxf_record_copy_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_copy_from_byte_stream_allocations(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libftxf_record_t *record          = NULL;
+	size_t maximum_allocated_size     = 0;
+	int maximum_number_of_allocations = 0;
+	int number_of_entries             = 0;
+	int read_number                   = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the allocations of the first record read into the record
+	 */
+	ftxf_test_memory_start_accounting();
+
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_record_data1,
+	          208,
+	          &error );
+
+	ftxf_test_memory_stop_accounting();
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_get_number_of_update_journal_entries(
+	          record,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "ftxf_test_memory_number_of_untracked_allocations",
+	 ftxf_test_memory_number_of_untracked_allocations,
+	 0 );
+
+	maximum_number_of_allocations = FTXF_TEST_RECORD_MAXIMUM_NUMBER_OF_BUFFER_ALLOCATIONS
+	                              + ( number_of_entries * FTXF_TEST_RECORD_USN_RECORD_NUMBER_OF_ALLOCATIONS );
+
+	FTXF_TEST_ASSERT_LESS_THAN_INT(
+	 "ftxf_test_memory_number_of_allocations",
+	 ftxf_test_memory_number_of_allocations,
+	 maximum_number_of_allocations + 1 );
+
+	/* The USN records are freed after an update journal entry has been read
+	 */
+	maximum_allocated_size = (size_t) FTXF_TEST_RECORD_MAXIMUM_BUFFERS_SIZE + FTXF_TEST_RECORD_USN_RECORD_MAXIMUM_ALLOCATED_SIZE;
+
+	FTXF_TEST_ASSERT_LESS_THAN_SIZE(
+	 "ftxf_test_memory_maximum_allocated_size",
+	 ftxf_test_memory_maximum_allocated_size,
+	 maximum_allocated_size + 1 );
+
+	/* Test the allocations of records read into a record that was used before,
+	 * the buffers of the record are only allocated when they need to grow
+	 * but a USN record is allocated for every update journal entry read
+	 */
+	ftxf_test_memory_start_accounting();
+
+	for( read_number = 0;
+	     read_number < FTXF_TEST_RECORD_NUMBER_OF_ACCOUNTED_READS;
+	     read_number++ )
+	{
+		result = libftxf_record_copy_from_byte_stream(
+		          record,
+		          ftxf_test_record_data1,
+		          208,
+		          &error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+		result = libftxf_record_copy_from_byte_stream(
+		          record,
+		          ftxf_test_record_data2,
+		          176,
+		          &error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+	}
+	ftxf_test_memory_stop_accounting();
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "ftxf_test_memory_number_of_untracked_allocations",
+	 ftxf_test_memory_number_of_untracked_allocations,
+	 0 );
+
+	maximum_number_of_allocations = FTXF_TEST_RECORD_MAXIMUM_NUMBER_OF_BUFFER_ALLOCATIONS
+	                              + ( FTXF_TEST_RECORD_NUMBER_OF_ACCOUNTED_READS * number_of_entries * FTXF_TEST_RECORD_USN_RECORD_NUMBER_OF_ALLOCATIONS );
+
+	FTXF_TEST_ASSERT_LESS_THAN_INT(
+	 "ftxf_test_memory_number_of_allocations",
+	 ftxf_test_memory_number_of_allocations,
+	 maximum_number_of_allocations + 1 );
+
+	FTXF_TEST_ASSERT_LESS_THAN_SIZE(
+	 "ftxf_test_memory_maximum_allocated_size",
+	 ftxf_test_memory_maximum_allocated_size,
+	 maximum_allocated_size + 1 );
+
+	/* Clean up
+	 */
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	ftxf_test_memory_stop_accounting();
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
+
+/* Tests the libftxf_record_set_notify_verbose function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_set_notify_verbose(
+     libftxf_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_set_notify_verbose(
+	          record,
+	          LIBFTXF_NOTIFY_VERBOSE_DISABLED,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_set_notify_verbose(
+	          record,
+	          LIBFTXF_NOTIFY_VERBOSE_DEFAULT,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_set_notify_verbose(
+	          NULL,
+	          LIBFTXF_NOTIFY_VERBOSE_DISABLED,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_set_notify_verbose(
+	          record,
+	          2,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_size(
+     libftxf_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t size            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_get_size(
+	          record,
+	          &size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "size",
+	 size,
+	 208 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_size(
+	          record,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_content_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_content_hash(
+     libftxf_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t content_hash    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_get_content_hash(
+	          record,
+	          &content_hash,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "content_hash",
+	 content_hash,
+	 (uint64_t) 0x52fa2880d650817dUL );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_content_hash(
+	          NULL,
+	          &content_hash,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_content_hash(
+	          record,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_type function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_type(
+     libftxf_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t type            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_get_type(
+	          record,
+	          &type,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT16(
+	 "type",
+	 type,
+	 0x0017 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_type(
+	          NULL,
+	          &type,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_type(
+	          record,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_file_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_file_identifier(
+     libftxf_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t file_identifier = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_get_file_identifier(
+	          record,
+	          &file_identifier,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "file_identifier",
+	 file_identifier,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_file_identifier(
+	          NULL,
+	          &file_identifier,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_file_identifier(
+	          record,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_file_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_file_reference(
+     libftxf_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t file_reference  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_get_file_reference(
+	          record,
+	          &file_reference,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "file_reference",
+	 file_reference,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_file_reference(
+	          NULL,
+	          &file_reference,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_file_reference(
+	          record,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_timestamp function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_timestamp(
+     libftxf_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t timestamp       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_get_timestamp(
+	          record,
+	          &timestamp,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 0x01cf1d10c643bce0UL );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_timestamp(
+	          NULL,
+	          &timestamp,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_timestamp(
+	          record,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_guid function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_guid(
+     libftxf_record_t *record )
+{
+	uint8_t expected_guid_data[ 16 ] = {
+		0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56 };
+
+	uint8_t guid_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_get_guid(
+	          record,
+	          guid_data,
+	          16,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          guid_data,
+	          expected_guid_data,
+	          16 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_guid(
+	          NULL,
+	          guid_data,
+	          16,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_guid(
+	          record,
+	          NULL,
+	          16,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_guid(
+	          record,
+	          guid_data,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_guid(
+	          record,
+	          guid_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_file_metadata function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_file_metadata(
+     void )
+{
+	libftxf_file_metadata_t file_metadata;
+
+	libcerror_error_t *error = NULL;
+	libftxf_record_t *record = NULL;
+	int result               = 0;
+
+	/* Test the size of the file metadata structure
+	 */
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "sizeof( libftxf_file_metadata_t )",
+	 sizeof( libftxf_file_metadata_t ),
+	 (size_t) 56 );
+
+	/* Initialize test
+	 */
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record without file metadata
+	 */
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_record_data1,
+	          208,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_get_file_metadata(
+	          record,
+	          &file_metadata,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_record_data2,
+	          176,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_get_file_metadata(
+	          record,
+	          &file_metadata,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "file_metadata.creation_time",
+	 file_metadata.creation_time,
+	 (uint64_t) 0x01cf1d10c643bce0UL );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "file_metadata.modification_time",
+	 file_metadata.modification_time,
+	 (uint64_t) 0x01cf1d10c643bce1UL );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "file_metadata.entry_modification_time",
+	 file_metadata.entry_modification_time,
+	 (uint64_t) 0x01cf1d10c643bce2UL );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "file_metadata.access_time",
+	 file_metadata.access_time,
+	 (uint64_t) 0x01cf1d10c643bce3UL );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "file_metadata.allocated_file_size",
+	 file_metadata.allocated_file_size,
+	 (uint64_t) 4096 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "file_metadata.file_size",
+	 file_metadata.file_size,
+	 (uint64_t) 1234 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metadata.file_attribute_flags",
+	 file_metadata.file_attribute_flags,
+	 (uint32_t) 0x00000020UL );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metadata.reserved",
+	 file_metadata.reserved,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_file_metadata(
+	          NULL,
+	          &file_metadata,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_file_metadata(
+	          record,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_utf8_name_size and libftxf_record_get_utf8_name functions
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_utf8_name(
+     void )
+{
+	uint8_t expected_utf8_string[ 17 ] = {
+		'R', 0xc3, 0xa9, 's', 'u', 'm', 0xc3, 0xa9, ' ', '"', '1', '"', '.', 'd', 'o', 'c', 0 };
+
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	libftxf_record_t *record = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record without a name
+	 */
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_record_data1,
+	          208,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_get_utf8_name_size(
+	          record,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_record_data2,
+	          176,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_get_utf8_name_size(
+	          record,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 17 );
+
+	result = libftxf_record_get_utf8_name(
+	          record,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          17 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_utf8_name_size(
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_utf8_name_size(
+	          record,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_utf8_name(
+	          NULL,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_utf8_name(
+	          record,
+	          NULL,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_utf8_name(
+	          record,
+	          utf8_string,
+	          4,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_utf16_name_size and libftxf_record_get_utf16_name functions
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_utf16_name(
+     void )
+{
+	uint16_t expected_utf16_string[ 15 ] = {
+		'R', 0x00e9, 's', 'u', 'm', 0x00e9, ' ', '"', '1', '"', '.', 'd', 'o', 'c', 0 };
+
+	uint16_t utf16_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	libftxf_record_t *record = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record without a name
+	 */
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_record_data1,
+	          208,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_get_utf16_name_size(
+	          record,
+	          &utf16_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_record_data2,
+	          176,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_get_utf16_name_size(
+	          record,
+	          &utf16_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 15 );
+
+	result = libftxf_record_get_utf16_name(
+	          record,
+	          utf16_string,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          expected_utf16_string,
+	          sizeof( uint16_t ) * 15 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_utf16_name_size(
+	          NULL,
+	          &utf16_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_utf16_name_size(
+	          record,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_utf16_name(
+	          NULL,
+	          utf16_string,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_utf16_name(
+	          record,
+	          NULL,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_utf16_name(
+	          record,
+	          utf16_string,
+	          4,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_number_of_update_journal_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_number_of_update_journal_entries(
+     libftxf_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_get_number_of_update_journal_entries(
+	          record,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_number_of_update_journal_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_number_of_update_journal_entries(
+	          record,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_update_journal_entry_values function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_update_journal_entry_values(
+     libftxf_record_t *record )
+{
+	libcerror_error_t *error        = NULL;
+	uint64_t file_reference         = 0;
+	uint64_t parent_file_reference  = 0;
+	uint64_t update_sequence_number = 0;
+	uint64_t update_time            = 0;
+	uint32_t file_attribute_flags   = 0;
+	uint32_t update_reason_flags    = 0;
+	uint32_t update_source_flags    = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_get_update_journal_entry_values(
+	          record,
+	          0,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "update_sequence_number",
+	 update_sequence_number,
+	 (uint64_t) 0 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "file_reference",
+	 file_reference,
+	 (uint64_t) 281474976727574UL );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "parent_file_reference",
+	 parent_file_reference,
+	 (uint64_t) 281474976712339UL );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "update_reason_flags",
+	 update_reason_flags,
+	 (uint32_t) 0x80000006UL );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "file_attribute_flags",
+	 file_attribute_flags,
+	 (uint32_t) 0x00002020UL );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_update_journal_entry_values(
+	          NULL,
+	          0,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_update_journal_entry_values(
+	          record,
+	          1,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_update_journal_entry_values(
+	          record,
+	          0,
+	          NULL,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_update_journal_entry_values(
+	          record,
+	          0,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_update_journal_entry_utf8_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_update_journal_entry_utf8_name_size(
+     libftxf_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_get_update_journal_entry_utf8_name_size(
+	          record,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 21 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_update_journal_entry_utf8_name_size(
+	          NULL,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_update_journal_entry_utf8_name_size(
+	          record,
+	          -1,
+	          &utf8_string_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_update_journal_entry_utf8_name_size(
+	          record,
+	          0,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_get_update_journal_entry_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_get_update_journal_entry_utf8_name(
+     libftxf_record_t *record )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_get_update_journal_entry_utf8_name(
+	          record,
+	          0,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "FontCache-System.dat",
+	          21 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_get_update_journal_entry_utf8_name(
+	          NULL,
+	          0,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_update_journal_entry_utf8_name(
+	          record,
+	          0,
+	          NULL,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_update_journal_entry_utf8_name(
+	          record,
+	          0,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_get_update_journal_entry_utf8_name(
+	          record,
+	          0,
+	          utf8_string,
+	          4,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_copy_to_utf8_json_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_copy_to_utf8_json_string_with_index(
+     void )
+{
+	uint8_t utf8_string[ 1024 ];
+
+	libcerror_error_t *error = NULL;
+	libftxf_record_t *record = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_record_data1,
+	          208,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_copy_to_utf8_json_string_with_index(
+	          record,
+	          utf8_string,
+	          1024,
+	          &utf8_string_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 413 );
+
+	result = memory_compare(
+	          utf8_string,
+	          ftxf_test_record_json_string1,
+	          413 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with a record that contains a name and file metadata, reusing the record
+	 */
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_record_data2,
+	          176,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_copy_to_utf8_json_string_with_index(
+	          record,
+	          utf8_string,
+	          1024,
+	          &utf8_string_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 829 );
+
+	result = memory_compare(
+	          &( utf8_string[ 413 ] ),
+	          ftxf_test_record_json_string2,
+	          416 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with an UTF-8 string that is too small
+	 */
+	utf8_string_index = 0;
+
+	result = libftxf_record_copy_to_utf8_json_string_with_index(
+	          record,
+	          utf8_string,
+	          415,
+	          &utf8_string_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_copy_to_utf8_json_string_with_index(
+	          NULL,
+	          utf8_string,
+	          1024,
+	          &utf8_string_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_copy_to_utf8_json_string_with_index(
+	          record,
+	          NULL,
+	          1024,
+	          &utf8_string_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_copy_to_utf8_json_string_with_index(
+	          record,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_copy_to_utf8_json_string_with_index(
+	          record,
+	          utf8_string,
+	          1024,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_string_index = 1025;
+
+	result = libftxf_record_copy_to_utf8_json_string_with_index(
+	          record,
+	          utf8_string,
+	          1024,
+	          &utf8_string_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libftxf_record_t *record = NULL;
+	int result               = 0;
+
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_initialize",
+	 ftxf_test_record_initialize );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_initialize_with_allocator",
+	 ftxf_test_record_initialize_with_allocator );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_free",
+	 ftxf_test_record_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT )
+
+	FTXF_TEST_RUN(
+	 "libftxf_internal_record_read_update_journal_entry_list_data",
+	 ftxf_test_internal_record_read_update_journal_entry_list_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFTXF_DLL_IMPORT ) */
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_copy_from_byte_stream",
+	 ftxf_test_record_copy_from_byte_stream );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_copy_from_byte_stream_with_filter",
+	 ftxf_test_record_copy_from_byte_stream_with_filter );
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_copy_from_byte_stream_allocations",
+	 ftxf_test_record_copy_from_byte_stream_allocations );
+
+#endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize record for tests
+	 */
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_record_data1,
+	          208,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_record_set_notify_verbose",
+	 ftxf_test_record_set_notify_verbose,
+	 record );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_record_get_size",
+	 ftxf_test_record_get_size,
+	 record );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_record_get_content_hash",
+	 ftxf_test_record_get_content_hash,
+	 record );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_record_get_type",
+	 ftxf_test_record_get_type,
+	 record );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_record_get_file_identifier",
+	 ftxf_test_record_get_file_identifier,
+	 record );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_record_get_file_reference",
+	 ftxf_test_record_get_file_reference,
+	 record );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_record_get_timestamp",
+	 ftxf_test_record_get_timestamp,
+	 record );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_record_get_guid",
+	 ftxf_test_record_get_guid,
+	 record );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_record_get_number_of_update_journal_entries",
+	 ftxf_test_record_get_number_of_update_journal_entries,
+	 record );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_record_get_update_journal_entry_values",
+	 ftxf_test_record_get_update_journal_entry_values,
+	 record );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_record_get_update_journal_entry_utf8_name_size",
+	 ftxf_test_record_get_update_journal_entry_utf8_name_size,
+	 record );
+
+	FTXF_TEST_RUN_WITH_ARGS(
+	 "libftxf_record_get_update_journal_entry_utf8_name",
+	 ftxf_test_record_get_update_journal_entry_utf8_name,
+	 record );
+
+	/* Clean up
+	 */
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_get_file_metadata",
+	 ftxf_test_record_get_file_metadata );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_get_utf8_name",
+	 ftxf_test_record_get_utf8_name );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_get_utf16_name",
+	 ftxf_test_record_get_utf16_name );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_copy_to_utf8_json_string_with_index",
+	 ftxf_test_record_copy_to_utf8_json_string_with_index );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
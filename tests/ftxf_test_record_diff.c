@@ -0,0 +1,1361 @@
+/*
+ * Library record_diff type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_memory.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_record_diff.h"
+
+uint8_t ftxf_test_record_diff_record_data1[ 16 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t ftxf_test_record_diff_record_data2[ 16 ] = {
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t ftxf_test_record_diff_record_data3[ 16 ] = {
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libftxf_record_diff_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_diff_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libftxf_record_diff_t *record_diff = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_diff_initialize(
+	          &record_diff,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_diff",
+	 record_diff );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_diff_free(
+	          &record_diff,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_diff",
+	 record_diff );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_diff_initialize(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_diff = (libftxf_record_diff_t *) 0x12345678UL;
+
+	result = libftxf_record_diff_initialize(
+	          &record_diff,
+	          &error );
+
+	record_diff = NULL;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_record_diff_initialize with malloc failing
+		 */
+		ftxf_test_malloc_attempts_before_fail = test_number;
+
+		result = libftxf_record_diff_initialize(
+		          &record_diff,
+		          &error );
+
+		if( ftxf_test_malloc_attempts_before_fail != -1 )
+		{
+			ftxf_test_malloc_attempts_before_fail = -1;
+
+			if( record_diff != NULL )
+			{
+				libftxf_record_diff_free(
+				 &record_diff,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "record_diff",
+			 record_diff );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_record_diff_initialize with memset failing
+		 */
+		ftxf_test_memset_attempts_before_fail = test_number;
+
+		result = libftxf_record_diff_initialize(
+		          &record_diff,
+		          &error );
+
+		if( ftxf_test_memset_attempts_before_fail != -1 )
+		{
+			ftxf_test_memset_attempts_before_fail = -1;
+
+			if( record_diff != NULL )
+			{
+				libftxf_record_diff_free(
+				 &record_diff,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "record_diff",
+			 record_diff );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_diff != NULL )
+	{
+		libftxf_record_diff_free(
+		 &record_diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_diff_initialize_with_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_diff_initialize_with_allocator(
+     void )
+{
+	ftxf_test_memory_allocator_context_t allocator_context;
+	libftxf_allocator_t allocator;
+	uint8_t record_data[ 16 ];
+
+	libcerror_error_t *error           = NULL;
+	libftxf_record_diff_t *record_diff = NULL;
+	int data_index                     = 0;
+	int record_index                   = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	ftxf_test_memory_allocator_initialize(
+	 &allocator,
+	 &allocator_context );
+
+	for( data_index = 0;
+	     data_index < 16;
+	     data_index++ )
+	{
+		record_data[ data_index ] = ftxf_test_record_diff_record_data1[ data_index ];
+	}
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_diff_initialize_with_allocator(
+	          &record_diff,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_diff",
+	 record_diff );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Enough records are appended to resize the entries
+	 */
+	for( record_index = 1;
+	     record_index < 2048;
+	     record_index++ )
+	{
+		record_data[ 0 ] = (uint8_t) ( record_index & 0xff );
+		record_data[ 1 ] = (uint8_t) ( record_index >> 8 );
+
+		result = libftxf_record_diff_append_old_record_data(
+		          record_diff,
+		          record_data,
+		          16,
+		          (uint64_t) record_index * 16,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FTXF_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_reallocations",
+	 allocator_context.number_of_reallocations,
+	 0 );
+
+	result = libftxf_record_diff_free(
+	          &record_diff,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_diff",
+	 record_diff );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The resized memory of the record diff is freed using the allocator
+	 */
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_diff != NULL )
+	{
+		libftxf_record_diff_free(
+		 &record_diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_diff_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_diff_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libftxf_record_diff_free(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_diff_append_old_record_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_diff_append_old_record_data(
+     void )
+{
+	uint8_t record_data[ 16 ];
+
+	libcerror_error_t *error           = NULL;
+	libftxf_record_diff_t *record_diff = NULL;
+	uint64_t old_record_offset         = 0;
+	uint32_t number_of_records         = 0;
+	uint32_t record_index              = 0;
+	int data_index                     = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_diff_initialize(
+	          &record_diff,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_diff",
+	 record_diff );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_diff_append_old_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data1,
+	          16,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test append old record data with enough records to resize the hash table
+	 */
+	for( data_index = 0;
+	     data_index < 16;
+	     data_index++ )
+	{
+		record_data[ data_index ] = ftxf_test_record_diff_record_data1[ data_index ];
+	}
+	for( record_index = 1;
+	     record_index < 4096;
+	     record_index++ )
+	{
+		record_data[ 0 ] = (uint8_t) ( record_index & 0xff );
+		record_data[ 1 ] = (uint8_t) ( record_index >> 8 );
+
+		result = libftxf_record_diff_append_old_record_data(
+		          record_diff,
+		          record_data,
+		          16,
+		          (uint64_t) record_index * 16,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libftxf_record_diff_get_number_of_old_records(
+	          record_diff,
+	          &number_of_records,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_records",
+	 number_of_records,
+	 (uint32_t) 4096 );
+
+	result = libftxf_record_diff_match_new_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data3,
+	          16,
+	          &old_record_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "old_record_offset",
+	 old_record_offset,
+	 (uint64_t) 48 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_diff_append_old_record_data(
+	          NULL,
+	          ftxf_test_record_diff_record_data1,
+	          16,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_diff_append_old_record_data(
+	          record_diff,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_diff_append_old_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data1,
+	          0,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_diff_free(
+	          &record_diff,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_diff",
+	 record_diff );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_diff != NULL )
+	{
+		libftxf_record_diff_free(
+		 &record_diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_diff_match_new_record_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_diff_match_new_record_data(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libftxf_record_diff_t *record_diff = NULL;
+	uint64_t old_record_offset         = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_diff_initialize(
+	          &record_diff,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_diff",
+	 record_diff );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_diff_append_old_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data1,
+	          16,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_diff_append_old_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data2,
+	          16,
+	          16,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_diff_append_old_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data1,
+	          16,
+	          32,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_diff_match_new_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data1,
+	          16,
+	          &old_record_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "old_record_offset",
+	 old_record_offset,
+	 (uint64_t) 0 );
+
+	result = libftxf_record_diff_match_new_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data3,
+	          16,
+	          &old_record_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_diff_match_new_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data1,
+	          16,
+	          &old_record_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "old_record_offset",
+	 old_record_offset,
+	 (uint64_t) 32 );
+
+	/* Test match new record data with all equal old records matched
+	 */
+	result = libftxf_record_diff_match_new_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data1,
+	          16,
+	          &old_record_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test match new record data with a different size
+	 */
+	result = libftxf_record_diff_match_new_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data2,
+	          8,
+	          &old_record_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_diff_match_new_record_data(
+	          NULL,
+	          ftxf_test_record_diff_record_data1,
+	          16,
+	          &old_record_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_diff_match_new_record_data(
+	          record_diff,
+	          NULL,
+	          16,
+	          &old_record_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_diff_match_new_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data1,
+	          0,
+	          &old_record_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_diff_match_new_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data1,
+	          16,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_diff_free(
+	          &record_diff,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_diff",
+	 record_diff );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_diff != NULL )
+	{
+		libftxf_record_diff_free(
+		 &record_diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_diff_get_number_of_old_records function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_diff_get_number_of_old_records(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libftxf_record_diff_t *record_diff = NULL;
+	uint32_t number_of_records         = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_diff_initialize(
+	          &record_diff,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_diff",
+	 record_diff );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_diff_get_number_of_old_records(
+	          record_diff,
+	          &number_of_records,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_records",
+	 number_of_records,
+	 (uint32_t) 0 );
+
+	result = libftxf_record_diff_append_old_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data1,
+	          16,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_diff_get_number_of_old_records(
+	          record_diff,
+	          &number_of_records,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_records",
+	 number_of_records,
+	 (uint32_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_diff_get_number_of_old_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_diff_get_number_of_old_records(
+	          record_diff,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_diff_free(
+	          &record_diff,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_diff",
+	 record_diff );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_diff != NULL )
+	{
+		libftxf_record_diff_free(
+		 &record_diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_diff_get_old_record_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_diff_get_old_record_by_index(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libftxf_record_diff_t *record_diff = NULL;
+	uint64_t record_offset             = 0;
+	uint8_t is_common                  = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_diff_initialize(
+	          &record_diff,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_diff",
+	 record_diff );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_diff_append_old_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data1,
+	          16,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_diff_append_old_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data2,
+	          16,
+	          16,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_diff_match_new_record_data(
+	          record_diff,
+	          ftxf_test_record_diff_record_data2,
+	          16,
+	          &record_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_diff_get_old_record_by_index(
+	          record_diff,
+	          0,
+	          &record_offset,
+	          &is_common,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "record_offset",
+	 record_offset,
+	 (uint64_t) 0 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT8(
+	 "is_common",
+	 is_common,
+	 (uint8_t) 0 );
+
+	result = libftxf_record_diff_get_old_record_by_index(
+	          record_diff,
+	          1,
+	          &record_offset,
+	          &is_common,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "record_offset",
+	 record_offset,
+	 (uint64_t) 16 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT8(
+	 "is_common",
+	 is_common,
+	 (uint8_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_diff_get_old_record_by_index(
+	          NULL,
+	          0,
+	          &record_offset,
+	          &is_common,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_diff_get_old_record_by_index(
+	          record_diff,
+	          2,
+	          &record_offset,
+	          &is_common,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_diff_get_old_record_by_index(
+	          record_diff,
+	          0,
+	          NULL,
+	          &is_common,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_diff_get_old_record_by_index(
+	          record_diff,
+	          0,
+	          &record_offset,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_diff_free(
+	          &record_diff,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_diff",
+	 record_diff );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_diff != NULL )
+	{
+		libftxf_record_diff_free(
+		 &record_diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_diff_initialize",
+	 ftxf_test_record_diff_initialize );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_diff_initialize_with_allocator",
+	 ftxf_test_record_diff_initialize_with_allocator );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_diff_free",
+	 ftxf_test_record_diff_free );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_diff_append_old_record_data",
+	 ftxf_test_record_diff_append_old_record_data );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_diff_match_new_record_data",
+	 ftxf_test_record_diff_match_new_record_data );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_diff_get_number_of_old_records",
+	 ftxf_test_record_diff_get_number_of_old_records );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_diff_get_old_record_by_index",
+	 ftxf_test_record_diff_get_old_record_by_index );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
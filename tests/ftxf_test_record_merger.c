@@ -0,0 +1,1753 @@
+/*
+ * Library record_merger type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_memory.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_record.h"
+#include "../libftxf/libftxf_record_merger.h"
+
+uint8_t ftxf_test_record_merger_source_data1[ 240 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t ftxf_test_record_merger_source_data2[ 240 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t ftxf_test_record_merger_source_data3[ 80 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t ftxf_test_record_merger_record_data1[ 176 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01, 0xe1, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xe2, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01, 0xe3, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x52, 0x00, 0xe9, 0x00, 0x73, 0x00, 0x75, 0x00, 0x6d, 0x00, 0xe9, 0x00,
+	0x20, 0x00, 0x22, 0x00, 0x31, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x63, 0x00 };
+
+uint64_t ftxf_test_record_merger_expected_timestamps[ 7 ] = {
+	1, 2, 3, 4, 4, 7, 9 };
+
+int ftxf_test_record_merger_expected_source_indexes[ 7 ] = {
+	0, 1, 2, 0, 1, 0, 1 };
+
+uint64_t ftxf_test_record_merger_expected_record_offsets[ 7 ] = {
+	0, 0, 0, 80, 80, 160, 160 };
+
+/* Tests the libftxf_record_merger_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_merger_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_record_merger_t *record_merger = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 6;
+	int number_of_memset_fail_tests = 5;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_merger_initialize(
+	          &record_merger,
+	          3,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_merger_free(
+	          &record_merger,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_merger_initialize(
+	          NULL,
+	          3,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_merger = (libftxf_record_merger_t *) 0x12345678UL;
+
+	result = libftxf_record_merger_initialize(
+	          &record_merger,
+	          3,
+	          &error );
+
+	record_merger = NULL;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_initialize(
+	          &record_merger,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_record_merger_initialize with malloc failing
+		 */
+		ftxf_test_malloc_attempts_before_fail = test_number;
+
+		result = libftxf_record_merger_initialize(
+		          &record_merger,
+		          3,
+		          &error );
+
+		if( ftxf_test_malloc_attempts_before_fail != -1 )
+		{
+			ftxf_test_malloc_attempts_before_fail = -1;
+
+			if( record_merger != NULL )
+			{
+				libftxf_record_merger_free(
+				 &record_merger,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "record_merger",
+			 record_merger );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_record_merger_initialize with memset failing
+		 */
+		ftxf_test_memset_attempts_before_fail = test_number;
+
+		result = libftxf_record_merger_initialize(
+		          &record_merger,
+		          3,
+		          &error );
+
+		if( ftxf_test_memset_attempts_before_fail != -1 )
+		{
+			ftxf_test_memset_attempts_before_fail = -1;
+
+			if( record_merger != NULL )
+			{
+				libftxf_record_merger_free(
+				 &record_merger,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "record_merger",
+			 record_merger );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_merger != NULL )
+	{
+		libftxf_record_merger_free(
+		 &record_merger,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_merger_initialize_with_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_merger_initialize_with_allocator(
+     void )
+{
+	ftxf_test_memory_allocator_context_t allocator_context;
+	libftxf_allocator_t allocator;
+
+	libcerror_error_t *error               = NULL;
+	libftxf_record_merger_t *record_merger = NULL;
+	libftxf_record_t *record               = NULL;
+	uint64_t record_offset                 = 0;
+	size_t record_data_offset              = 0;
+	int number_of_allocations              = 0;
+	int result                             = 0;
+	int source_index                       = 0;
+
+	/* Initialize test
+	 */
+	ftxf_test_memory_allocator_initialize(
+	 &allocator,
+	 &allocator_context );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_merger_initialize_with_allocator(
+	          &record_merger,
+	          1,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The name of the record of a source is allocated when a record with a name is merged
+	 */
+	number_of_allocations = allocator_context.number_of_allocations;
+
+	do
+	{
+		result = libftxf_record_merger_get_source_needing_data(
+		          record_merger,
+		          &source_index,
+		          &error );
+
+		while( result == 1 )
+		{
+			result = libftxf_record_merger_set_source_record_data(
+			          record_merger,
+			          source_index,
+			          ftxf_test_record_merger_record_data1,
+			          ( record_data_offset == 0 ) ? 176 : 0,
+			          (uint64_t) record_data_offset,
+			          &error );
+
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			record_data_offset += 176;
+
+			result = libftxf_record_merger_get_source_needing_data(
+			          record_merger,
+			          &source_index,
+			          &error );
+		}
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libftxf_record_merger_get_next_record(
+		          record_merger,
+		          &source_index,
+		          &record_offset,
+		          &record,
+		          &error );
+
+		FTXF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	while( result == 1 );
+
+	FTXF_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_allocations",
+	 allocator_context.number_of_allocations,
+	 number_of_allocations );
+
+	result = libftxf_record_merger_free(
+	          &record_merger,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The records of the sources of the record merger are freed using the allocator
+	 */
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_merger != NULL )
+	{
+		libftxf_record_merger_free(
+		 &record_merger,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_merger_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_merger_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libftxf_record_merger_free(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_merger_get_source_needing_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_merger_get_source_needing_data(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_record_merger_t *record_merger = NULL;
+	int result                             = 0;
+	int source_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_merger_initialize(
+	          &record_merger,
+	          2,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_merger_get_source_needing_data(
+	          record_merger,
+	          &source_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "source_index",
+	 source_index,
+	 0 );
+
+	result = libftxf_record_merger_set_source_record_data(
+	          record_merger,
+	          0,
+	          ftxf_test_record_merger_source_data3,
+	          80,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_merger_get_source_needing_data(
+	          record_merger,
+	          &source_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "source_index",
+	 source_index,
+	 1 );
+
+	result = libftxf_record_merger_set_source_record_data(
+	          record_merger,
+	          1,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_merger_get_source_needing_data(
+	          record_merger,
+	          &source_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_merger_get_source_needing_data(
+	          NULL,
+	          &source_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_get_source_needing_data(
+	          record_merger,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_merger_free(
+	          &record_merger,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_merger != NULL )
+	{
+		libftxf_record_merger_free(
+		 &record_merger,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_merger_set_source_record_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_merger_set_source_record_data(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_record_merger_t *record_merger = NULL;
+	int result                             = 0;
+	int source_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_merger_initialize(
+	          &record_merger,
+	          2,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_merger_set_source_record_data(
+	          record_merger,
+	          0,
+	          ftxf_test_record_merger_source_data1,
+	          80,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_merger_set_source_record_data(
+	          NULL,
+	          1,
+	          ftxf_test_record_merger_source_data2,
+	          80,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_set_source_record_data(
+	          record_merger,
+	          -1,
+	          ftxf_test_record_merger_source_data2,
+	          80,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_set_source_record_data(
+	          record_merger,
+	          2,
+	          ftxf_test_record_merger_source_data2,
+	          80,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_set_source_record_data(
+	          record_merger,
+	          1,
+	          NULL,
+	          80,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test set source record data with record data too small
+	 */
+	result = libftxf_record_merger_set_source_record_data(
+	          record_merger,
+	          1,
+	          ftxf_test_record_merger_source_data2,
+	          16,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_get_source_needing_data(
+	          record_merger,
+	          &source_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "source_index",
+	 source_index,
+	 1 );
+
+	/* Test set source record data with record data already set
+	 */
+	result = libftxf_record_merger_set_source_record_data(
+	          record_merger,
+	          0,
+	          ftxf_test_record_merger_source_data1,
+	          80,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_merger_free(
+	          &record_merger,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_merger != NULL )
+	{
+		libftxf_record_merger_free(
+		 &record_merger,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_merger_set_source_record_header function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_merger_set_source_record_header(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libftxf_record_merger_t *record_merger = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_merger_initialize(
+	          &record_merger,
+	          2,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_record_merger_set_source_record_header(
+	          record_merger,
+	          0,
+	          ftxf_test_record_merger_source_data1,
+	          80,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_record_merger_set_source_record_header(
+	          NULL,
+	          1,
+	          ftxf_test_record_merger_source_data2,
+	          80,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_set_source_record_header(
+	          record_merger,
+	          -1,
+	          ftxf_test_record_merger_source_data2,
+	          80,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_set_source_record_header(
+	          record_merger,
+	          2,
+	          ftxf_test_record_merger_source_data2,
+	          80,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_set_source_record_header(
+	          record_merger,
+	          1,
+	          NULL,
+	          80,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test set source record header with record data too small
+	 */
+	result = libftxf_record_merger_set_source_record_header(
+	          record_merger,
+	          1,
+	          ftxf_test_record_merger_source_data2,
+	          16,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test set source record header with record data already set
+	 */
+	result = libftxf_record_merger_set_source_record_header(
+	          record_merger,
+	          0,
+	          ftxf_test_record_merger_source_data1,
+	          80,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_merger_free(
+	          &record_merger,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_merger != NULL )
+	{
+		libftxf_record_merger_free(
+		 &record_merger,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_merger_get_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_merger_get_next_record(
+     void )
+{
+	const uint8_t *source_data[ 3 ];
+	size_t source_data_offset[ 3 ];
+	size_t source_data_size[ 3 ];
+
+	libcerror_error_t *error               = NULL;
+	libftxf_record_merger_t *record_merger = NULL;
+	libftxf_record_t *record               = NULL;
+	uint64_t record_offset                 = 0;
+	uint64_t timestamp                     = 0;
+	int record_index                       = 0;
+	int result                             = 0;
+	int source_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_merger_initialize(
+	          &record_merger,
+	          3,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_data[ 0 ]        = ftxf_test_record_merger_source_data1;
+	source_data[ 1 ]        = ftxf_test_record_merger_source_data2;
+	source_data[ 2 ]        = ftxf_test_record_merger_source_data3;
+	source_data_size[ 0 ]   = 240;
+	source_data_size[ 1 ]   = 240;
+	source_data_size[ 2 ]   = 80;
+	source_data_offset[ 0 ] = 0;
+	source_data_offset[ 1 ] = 0;
+	source_data_offset[ 2 ] = 0;
+
+	/* Test get next record with missing source data
+	 */
+	result = libftxf_record_merger_get_next_record(
+	          record_merger,
+	          &source_index,
+	          &record_offset,
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 * The records of the sources are provided one at a time
+	 */
+	for( record_index = 0;
+	     record_index < 8;
+	     record_index++ )
+	{
+		result = libftxf_record_merger_get_source_needing_data(
+		          record_merger,
+		          &source_index,
+		          &error );
+
+		while( result == 1 )
+		{
+			result = libftxf_record_merger_set_source_record_data(
+			          record_merger,
+			          source_index,
+			          &( ( source_data[ source_index ] )[ source_data_offset[ source_index ] ] ),
+			          ( source_data_offset[ source_index ] < source_data_size[ source_index ] ) ? 80 : 0,
+			          (uint64_t) source_data_offset[ source_index ],
+			          &error );
+
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			source_data_offset[ source_index ] += 80;
+
+			result = libftxf_record_merger_get_source_needing_data(
+			          record_merger,
+			          &source_index,
+			          &error );
+		}
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libftxf_record_merger_get_next_record(
+		          record_merger,
+		          &source_index,
+		          &record_offset,
+		          &record,
+		          &error );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( record_index == 7 )
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "source_index",
+			 source_index,
+			 ftxf_test_record_merger_expected_source_indexes[ record_index ] );
+
+			FTXF_TEST_ASSERT_EQUAL_UINT64(
+			 "record_offset",
+			 record_offset,
+			 ftxf_test_record_merger_expected_record_offsets[ record_index ] );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "record",
+			 record );
+
+			result = libftxf_record_get_timestamp(
+			          record,
+			          &timestamp,
+			          &error );
+
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			FTXF_TEST_ASSERT_EQUAL_UINT64(
+			 "timestamp",
+			 timestamp,
+			 ftxf_test_record_merger_expected_timestamps[ record_index ] );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libftxf_record_merger_get_next_record(
+	          NULL,
+	          &source_index,
+	          &record_offset,
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_get_next_record(
+	          record_merger,
+	          NULL,
+	          &record_offset,
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_get_next_record(
+	          record_merger,
+	          &source_index,
+	          NULL,
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_get_next_record(
+	          record_merger,
+	          &source_index,
+	          &record_offset,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_merger_free(
+	          &record_merger,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_merger != NULL )
+	{
+		libftxf_record_merger_free(
+		 &record_merger,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_record_merger_get_next_source function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_record_merger_get_next_source(
+     void )
+{
+	const uint8_t *source_data[ 3 ];
+	size_t source_data_offset[ 3 ];
+	size_t source_data_size[ 3 ];
+
+	libcerror_error_t *error               = NULL;
+	libftxf_record_merger_t *record_merger = NULL;
+	libftxf_record_t *record               = NULL;
+	uint64_t record_offset                 = 0;
+	int record_index                       = 0;
+	int result                             = 0;
+	int source_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_record_merger_initialize(
+	          &record_merger,
+	          3,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_data[ 0 ]        = ftxf_test_record_merger_source_data1;
+	source_data[ 1 ]        = ftxf_test_record_merger_source_data2;
+	source_data[ 2 ]        = ftxf_test_record_merger_source_data3;
+	source_data_size[ 0 ]   = 240;
+	source_data_size[ 1 ]   = 240;
+	source_data_size[ 2 ]   = 80;
+	source_data_offset[ 0 ] = 0;
+	source_data_offset[ 1 ] = 0;
+	source_data_offset[ 2 ] = 0;
+
+	/* Test get next source with missing source data
+	 */
+	result = libftxf_record_merger_get_next_source(
+	          record_merger,
+	          &source_index,
+	          &record_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 * The record headers of the sources are provided one at a time
+	 */
+	for( record_index = 0;
+	     record_index < 8;
+	     record_index++ )
+	{
+		result = libftxf_record_merger_get_source_needing_data(
+		          record_merger,
+		          &source_index,
+		          &error );
+
+		while( result == 1 )
+		{
+			result = libftxf_record_merger_set_source_record_header(
+			          record_merger,
+			          source_index,
+			          &( ( source_data[ source_index ] )[ source_data_offset[ source_index ] ] ),
+			          ( source_data_offset[ source_index ] < source_data_size[ source_index ] ) ? 80 : 0,
+			          (uint64_t) source_data_offset[ source_index ],
+			          &error );
+
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			source_data_offset[ source_index ] += 80;
+
+			result = libftxf_record_merger_get_source_needing_data(
+			          record_merger,
+			          &source_index,
+			          &error );
+		}
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( record_index == 0 )
+		{
+			/* Test get next record with only the record headers set
+			 */
+			result = libftxf_record_merger_get_next_record(
+			          record_merger,
+			          &source_index,
+			          &record_offset,
+			          &record,
+			          &error );
+
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+		result = libftxf_record_merger_get_next_source(
+		          record_merger,
+		          &source_index,
+		          &record_offset,
+		          &error );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( record_index == 7 )
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "source_index",
+			 source_index,
+			 ftxf_test_record_merger_expected_source_indexes[ record_index ] );
+
+			FTXF_TEST_ASSERT_EQUAL_UINT64(
+			 "record_offset",
+			 record_offset,
+			 ftxf_test_record_merger_expected_record_offsets[ record_index ] );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libftxf_record_merger_get_next_source(
+	          NULL,
+	          &source_index,
+	          &record_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_get_next_source(
+	          record_merger,
+	          NULL,
+	          &record_offset,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_record_merger_get_next_source(
+	          record_merger,
+	          &source_index,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_merger_free(
+	          &record_merger,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record_merger",
+	 record_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_merger != NULL )
+	{
+		libftxf_record_merger_free(
+		 &record_merger,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_merger_initialize",
+	 ftxf_test_record_merger_initialize );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_merger_initialize_with_allocator",
+	 ftxf_test_record_merger_initialize_with_allocator );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_merger_free",
+	 ftxf_test_record_merger_free );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_merger_get_source_needing_data",
+	 ftxf_test_record_merger_get_source_needing_data );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_merger_set_source_record_data",
+	 ftxf_test_record_merger_set_source_record_data );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_merger_set_source_record_header",
+	 ftxf_test_record_merger_set_source_record_header );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_merger_get_next_record",
+	 ftxf_test_record_merger_get_next_record );
+
+	FTXF_TEST_RUN(
+	 "libftxf_record_merger_get_next_source",
+	 ftxf_test_record_merger_get_next_source );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1159 @@
+/*
+ * Library timeline_merger type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_memory.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_timeline_merger.h"
+
+uint8_t ftxf_test_timeline_merger_run_data1[ 72 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t ftxf_test_timeline_merger_run_data2[ 72 ] = {
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 };
+
+uint8_t ftxf_test_timeline_merger_run_data3[ 24 ] = {
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint64_t ftxf_test_timeline_merger_expected_filetimes[ 7 ] = {
+	1, 2, 3, 4, 4, 7, 9 };
+
+uint64_t ftxf_test_timeline_merger_expected_record_offsets[ 7 ] = {
+	0x100, 0x200, 0x300, 0x100, 0x200, 0x100, 0x200 };
+
+/* Tests the libftxf_timeline_merger_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_timeline_merger_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libftxf_timeline_merger_t *timeline_merger = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 4;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libftxf_timeline_merger_initialize(
+	          &timeline_merger,
+	          3,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "timeline_merger",
+	 timeline_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_timeline_merger_free(
+	          &timeline_merger,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "timeline_merger",
+	 timeline_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_timeline_merger_initialize(
+	          NULL,
+	          3,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	timeline_merger = (libftxf_timeline_merger_t *) 0x12345678UL;
+
+	result = libftxf_timeline_merger_initialize(
+	          &timeline_merger,
+	          3,
+	          &error );
+
+	timeline_merger = NULL;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_timeline_merger_initialize(
+	          &timeline_merger,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_timeline_merger_initialize with malloc failing
+		 */
+		ftxf_test_malloc_attempts_before_fail = test_number;
+
+		result = libftxf_timeline_merger_initialize(
+		          &timeline_merger,
+		          3,
+		          &error );
+
+		if( ftxf_test_malloc_attempts_before_fail != -1 )
+		{
+			ftxf_test_malloc_attempts_before_fail = -1;
+
+			if( timeline_merger != NULL )
+			{
+				libftxf_timeline_merger_free(
+				 &timeline_merger,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "timeline_merger",
+			 timeline_merger );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_timeline_merger_initialize with memset failing
+		 */
+		ftxf_test_memset_attempts_before_fail = test_number;
+
+		result = libftxf_timeline_merger_initialize(
+		          &timeline_merger,
+		          3,
+		          &error );
+
+		if( ftxf_test_memset_attempts_before_fail != -1 )
+		{
+			ftxf_test_memset_attempts_before_fail = -1;
+
+			if( timeline_merger != NULL )
+			{
+				libftxf_timeline_merger_free(
+				 &timeline_merger,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "timeline_merger",
+			 timeline_merger );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline_merger != NULL )
+	{
+		libftxf_timeline_merger_free(
+		 &timeline_merger,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_timeline_merger_initialize_with_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_timeline_merger_initialize_with_allocator(
+     void )
+{
+	ftxf_test_memory_allocator_context_t allocator_context;
+	libftxf_allocator_t allocator;
+	const uint8_t *run_data[ 3 ];
+	size_t run_data_offset[ 3 ];
+	size_t run_data_size[ 3 ];
+	libftxf_timeline_entry_t timeline_entry;
+
+	libcerror_error_t *error                   = NULL;
+	libftxf_timeline_merger_t *timeline_merger = NULL;
+	int number_of_allocations                  = 0;
+	int result                                 = 0;
+	int run_index                              = 0;
+
+	/* Initialize test
+	 */
+	ftxf_test_memory_allocator_initialize(
+	 &allocator,
+	 &allocator_context );
+
+	run_data[ 0 ]        = ftxf_test_timeline_merger_run_data1;
+	run_data[ 1 ]        = ftxf_test_timeline_merger_run_data2;
+	run_data[ 2 ]        = ftxf_test_timeline_merger_run_data3;
+	run_data_size[ 0 ]   = 72;
+	run_data_size[ 1 ]   = 72;
+	run_data_size[ 2 ]   = 24;
+	run_data_offset[ 0 ] = 0;
+	run_data_offset[ 1 ] = 0;
+	run_data_offset[ 2 ] = 0;
+
+	/* Test regular cases
+	 */
+	result = libftxf_timeline_merger_initialize_with_allocator(
+	          &timeline_merger,
+	          3,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "timeline_merger",
+	 timeline_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The runs are allocated up front and the run data is not copied, hence merging
+	 * the runs does not allocate
+	 */
+	number_of_allocations = allocator_context.number_of_allocations;
+
+	do
+	{
+		result = libftxf_timeline_merger_get_run_needing_data(
+		          timeline_merger,
+		          &run_index,
+		          &error );
+
+		while( result == 1 )
+		{
+			result = libftxf_timeline_merger_set_run_data(
+			          timeline_merger,
+			          run_index,
+			          &( ( run_data[ run_index ] )[ run_data_offset[ run_index ] ] ),
+			          ( run_data_offset[ run_index ] < run_data_size[ run_index ] ) ? 24 : 0,
+			          &error );
+
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			run_data_offset[ run_index ] += 24;
+
+			result = libftxf_timeline_merger_get_run_needing_data(
+			          timeline_merger,
+			          &run_index,
+			          &error );
+		}
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libftxf_timeline_merger_get_next_entry(
+		          timeline_merger,
+		          &timeline_entry,
+		          &error );
+
+		FTXF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	while( result == 1 );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_allocations",
+	 allocator_context.number_of_allocations,
+	 number_of_allocations );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_reallocations",
+	 allocator_context.number_of_reallocations,
+	 0 );
+
+	result = libftxf_timeline_merger_free(
+	          &timeline_merger,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "timeline_merger",
+	 timeline_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The runs of the timeline merger are freed using the allocator
+	 */
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline_merger != NULL )
+	{
+		libftxf_timeline_merger_free(
+		 &timeline_merger,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_timeline_merger_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_timeline_merger_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libftxf_timeline_merger_free(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_timeline_merger_get_run_needing_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_timeline_merger_get_run_needing_data(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libftxf_timeline_merger_t *timeline_merger = NULL;
+	int result                                 = 0;
+	int run_index                              = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_timeline_merger_initialize(
+	          &timeline_merger,
+	          2,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "timeline_merger",
+	 timeline_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_timeline_merger_get_run_needing_data(
+	          timeline_merger,
+	          &run_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "run_index",
+	 run_index,
+	 0 );
+
+	result = libftxf_timeline_merger_set_run_data(
+	          timeline_merger,
+	          0,
+	          ftxf_test_timeline_merger_run_data3,
+	          24,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_timeline_merger_get_run_needing_data(
+	          timeline_merger,
+	          &run_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "run_index",
+	 run_index,
+	 1 );
+
+	result = libftxf_timeline_merger_set_run_data(
+	          timeline_merger,
+	          1,
+	          NULL,
+	          0,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_timeline_merger_get_run_needing_data(
+	          timeline_merger,
+	          &run_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_timeline_merger_get_run_needing_data(
+	          NULL,
+	          &run_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_timeline_merger_get_run_needing_data(
+	          timeline_merger,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_timeline_merger_free(
+	          &timeline_merger,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "timeline_merger",
+	 timeline_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline_merger != NULL )
+	{
+		libftxf_timeline_merger_free(
+		 &timeline_merger,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_timeline_merger_set_run_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_timeline_merger_set_run_data(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libftxf_timeline_merger_t *timeline_merger = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_timeline_merger_initialize(
+	          &timeline_merger,
+	          2,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "timeline_merger",
+	 timeline_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_timeline_merger_set_run_data(
+	          timeline_merger,
+	          0,
+	          ftxf_test_timeline_merger_run_data1,
+	          72,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_timeline_merger_set_run_data(
+	          NULL,
+	          1,
+	          ftxf_test_timeline_merger_run_data2,
+	          72,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_timeline_merger_set_run_data(
+	          timeline_merger,
+	          -1,
+	          ftxf_test_timeline_merger_run_data2,
+	          72,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_timeline_merger_set_run_data(
+	          timeline_merger,
+	          2,
+	          ftxf_test_timeline_merger_run_data2,
+	          72,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_timeline_merger_set_run_data(
+	          timeline_merger,
+	          1,
+	          NULL,
+	          72,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_timeline_merger_set_run_data(
+	          timeline_merger,
+	          1,
+	          ftxf_test_timeline_merger_run_data2,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_timeline_merger_set_run_data(
+	          timeline_merger,
+	          1,
+	          ftxf_test_timeline_merger_run_data2,
+	          71,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test set run data with run data already set
+	 */
+	result = libftxf_timeline_merger_set_run_data(
+	          timeline_merger,
+	          0,
+	          ftxf_test_timeline_merger_run_data1,
+	          72,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_timeline_merger_free(
+	          &timeline_merger,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "timeline_merger",
+	 timeline_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline_merger != NULL )
+	{
+		libftxf_timeline_merger_free(
+		 &timeline_merger,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_timeline_merger_get_next_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_timeline_merger_get_next_entry(
+     void )
+{
+	const uint8_t *run_data[ 3 ];
+	size_t run_data_offset[ 3 ];
+	size_t run_data_size[ 3 ];
+	libftxf_timeline_entry_t timeline_entry;
+
+	libcerror_error_t *error                   = NULL;
+	libftxf_timeline_merger_t *timeline_merger = NULL;
+	int entry_index                            = 0;
+	int result                                 = 0;
+	int run_index                              = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_timeline_merger_initialize(
+	          &timeline_merger,
+	          3,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "timeline_merger",
+	 timeline_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	run_data[ 0 ]        = ftxf_test_timeline_merger_run_data1;
+	run_data[ 1 ]        = ftxf_test_timeline_merger_run_data2;
+	run_data[ 2 ]        = ftxf_test_timeline_merger_run_data3;
+	run_data_size[ 0 ]   = 72;
+	run_data_size[ 1 ]   = 72;
+	run_data_size[ 2 ]   = 24;
+	run_data_offset[ 0 ] = 0;
+	run_data_offset[ 1 ] = 0;
+	run_data_offset[ 2 ] = 0;
+
+	/* Test get next entry with missing run data
+	 */
+	result = libftxf_timeline_merger_get_next_entry(
+	          timeline_merger,
+	          &timeline_entry,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 * The run data is provided in blocks of a single entry
+	 */
+	for( entry_index = 0;
+	     entry_index < 8;
+	     entry_index++ )
+	{
+		result = libftxf_timeline_merger_get_run_needing_data(
+		          timeline_merger,
+		          &run_index,
+		          &error );
+
+		while( result == 1 )
+		{
+			result = libftxf_timeline_merger_set_run_data(
+			          timeline_merger,
+			          run_index,
+			          &( ( run_data[ run_index ] )[ run_data_offset[ run_index ] ] ),
+			          ( run_data_offset[ run_index ] < run_data_size[ run_index ] ) ? 24 : 0,
+			          &error );
+
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			run_data_offset[ run_index ] += 24;
+
+			result = libftxf_timeline_merger_get_run_needing_data(
+			          timeline_merger,
+			          &run_index,
+			          &error );
+		}
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libftxf_timeline_merger_get_next_entry(
+		          timeline_merger,
+		          &timeline_entry,
+		          &error );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( entry_index == 7 )
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FTXF_TEST_ASSERT_EQUAL_UINT64(
+			 "timeline_entry.filetime",
+			 timeline_entry.filetime,
+			 ftxf_test_timeline_merger_expected_filetimes[ entry_index ] );
+
+			FTXF_TEST_ASSERT_EQUAL_UINT64(
+			 "timeline_entry.record_offset",
+			 timeline_entry.record_offset,
+			 ftxf_test_timeline_merger_expected_record_offsets[ entry_index ] );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libftxf_timeline_merger_get_next_entry(
+	          NULL,
+	          &timeline_entry,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_timeline_merger_get_next_entry(
+	          timeline_merger,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_timeline_merger_free(
+	          &timeline_merger,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "timeline_merger",
+	 timeline_merger );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline_merger != NULL )
+	{
+		libftxf_timeline_merger_free(
+		 &timeline_merger,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FTXF_TEST_RUN(
+	 "libftxf_timeline_merger_initialize",
+	 ftxf_test_timeline_merger_initialize );
+
+	FTXF_TEST_RUN(
+	 "libftxf_timeline_merger_initialize_with_allocator",
+	 ftxf_test_timeline_merger_initialize_with_allocator );
+
+	FTXF_TEST_RUN(
+	 "libftxf_timeline_merger_free",
+	 ftxf_test_timeline_merger_free );
+
+	FTXF_TEST_RUN(
+	 "libftxf_timeline_merger_get_run_needing_data",
+	 ftxf_test_timeline_merger_get_run_needing_data );
+
+	FTXF_TEST_RUN(
+	 "libftxf_timeline_merger_set_run_data",
+	 ftxf_test_timeline_merger_set_run_data );
+
+	FTXF_TEST_RUN(
+	 "libftxf_timeline_merger_get_next_entry",
+	 ftxf_test_timeline_merger_get_next_entry );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
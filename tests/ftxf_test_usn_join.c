@@ -0,0 +1,2594 @@
+/*
+ * Library usn_join type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ftxf_test_libcerror.h"
+#include "ftxf_test_libftxf.h"
+#include "ftxf_test_macros.h"
+#include "ftxf_test_memory.h"
+#include "ftxf_test_unused.h"
+
+#include "../libftxf/libftxf_usn_join.h"
+
+uint8_t ftxf_test_usn_join_record_data1[ 208 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x20, 0x38, 0x49, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xc3, 0xf0, 0x82, 0xfb, 0x88, 0xe3, 0x11, 0x8b, 0x6e, 0x52, 0x54, 0x00, 0x12, 0x34, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbc, 0x43, 0xc6, 0x10, 0x1d, 0xcf, 0x01,
+	0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x49, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x16, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x93, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00,
+	0x28, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x43, 0x00, 0x61, 0x00,
+	0x63, 0x00, 0x68, 0x00, 0x65, 0x00, 0x2d, 0x00, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00,
+	0x65, 0x00, 0x6d, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x61, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libftxf_usn_join_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_usn_join_initialize(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libftxf_usn_join_t *usn_join = NULL;
+	int result                   = 0;
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 3;
+	int number_of_memset_fail_tests = 3;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libftxf_usn_join_initialize(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_usn_join_free(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_usn_join_initialize(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	usn_join = (libftxf_usn_join_t *) 0x12345678UL;
+
+	result = libftxf_usn_join_initialize(
+	          &usn_join,
+	          &error );
+
+	usn_join = NULL;
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FTXF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_usn_join_initialize with malloc failing
+		 */
+		ftxf_test_malloc_attempts_before_fail = test_number;
+
+		result = libftxf_usn_join_initialize(
+		          &usn_join,
+		          &error );
+
+		if( ftxf_test_malloc_attempts_before_fail != -1 )
+		{
+			ftxf_test_malloc_attempts_before_fail = -1;
+
+			if( usn_join != NULL )
+			{
+				libftxf_usn_join_free(
+				 &usn_join,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "usn_join",
+			 usn_join );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libftxf_usn_join_initialize with memset failing
+		 */
+		ftxf_test_memset_attempts_before_fail = test_number;
+
+		result = libftxf_usn_join_initialize(
+		          &usn_join,
+		          &error );
+
+		if( ftxf_test_memset_attempts_before_fail != -1 )
+		{
+			ftxf_test_memset_attempts_before_fail = -1;
+
+			if( usn_join != NULL )
+			{
+				libftxf_usn_join_free(
+				 &usn_join,
+				 NULL );
+			}
+		}
+		else
+		{
+			FTXF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FTXF_TEST_ASSERT_IS_NULL(
+			 "usn_join",
+			 usn_join );
+
+			FTXF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FTXF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_join != NULL )
+	{
+		libftxf_usn_join_free(
+		 &usn_join,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_usn_join_initialize_with_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_usn_join_initialize_with_allocator(
+     void )
+{
+	ftxf_test_memory_allocator_context_t allocator_context;
+	libftxf_allocator_t allocator;
+	uint8_t journal_data[ 104 ];
+
+	libcerror_error_t *error     = NULL;
+	libftxf_usn_join_t *usn_join = NULL;
+	size_t read_size             = 0;
+	int data_index               = 0;
+	int entry_index              = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	ftxf_test_memory_allocator_initialize(
+	 &allocator,
+	 &allocator_context );
+
+	for( data_index = 0;
+	     data_index < 104;
+	     data_index++ )
+	{
+		journal_data[ data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+	}
+
+	/* Test regular cases
+	 */
+	result = libftxf_usn_join_initialize_with_allocator(
+	          &usn_join,
+	          &allocator,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Enough records are read to resize the entries
+	 */
+	for( entry_index = 0;
+	     entry_index < 2048;
+	     entry_index++ )
+	{
+		journal_data[ 8 ] = (uint8_t) ( entry_index & 0xff );
+		journal_data[ 9 ] = (uint8_t) ( ( entry_index >> 8 ) + 1 );
+
+		result = libftxf_usn_join_read_journal_data(
+		          usn_join,
+		          journal_data,
+		          104,
+		          0,
+		          &read_size,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FTXF_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_reallocations",
+	 allocator_context.number_of_reallocations,
+	 0 );
+
+	result = libftxf_usn_join_free(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The resized memory of the USN join is freed using the allocator
+	 */
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_join != NULL )
+	{
+		libftxf_usn_join_free(
+		 &usn_join,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_usn_join_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_usn_join_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libftxf_usn_join_free(
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_usn_join_read_journal_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_usn_join_read_journal_data(
+     void )
+{
+	uint8_t journal_data[ 536 ];
+
+	libcerror_error_t *error     = NULL;
+	libftxf_usn_join_t *usn_join = NULL;
+	size_t read_size             = 0;
+	int data_index               = 0;
+	int entry_index              = 0;
+	int number_of_entries        = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 536;
+	     data_index++ )
+	{
+		journal_data[ data_index ] = 0;
+	}
+	for( data_index = 0;
+	     data_index < 104;
+	     data_index++ )
+	{
+		journal_data[ 8 + data_index ]   = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 120 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 224 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 328 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 432 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+	}
+	journal_data[ 112 ] = 0xff;
+	journal_data[ 145 ] = 0x10;
+	journal_data[ 228 ] = 3;
+	journal_data[ 386 ] = 0xff;
+	journal_data[ 457 ] = 0x20;
+
+	result = libftxf_usn_join_initialize(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          journal_data,
+	          496,
+	          4096,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 432 );
+
+	result = libftxf_usn_join_get_number_of_entries(
+	          usn_join,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	/* Test read journal data with the remainder of the incomplete record
+	 */
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          &( journal_data[ 432 ] ),
+	          104,
+	          4096 + 432,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 104 );
+
+	result = libftxf_usn_join_get_number_of_entries(
+	          usn_join,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	/* Test read journal data with data that only contains zero padding
+	 */
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          journal_data,
+	          8,
+	          0,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 8 );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          journal_data,
+	          7,
+	          0,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 0 );
+
+	result = libftxf_usn_join_get_number_of_entries(
+	          usn_join,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	/* Test read journal data with enough records to resize the hash tables
+	 */
+	for( entry_index = 0;
+	     entry_index < 4096;
+	     entry_index++ )
+	{
+		journal_data[ 8 + 8 ] = (uint8_t) ( entry_index & 0xff );
+		journal_data[ 8 + 9 ] = (uint8_t) ( ( entry_index >> 8 ) + 1 );
+
+		result = libftxf_usn_join_read_journal_data(
+		          usn_join,
+		          &( journal_data[ 8 ] ),
+		          104,
+		          0,
+		          &read_size,
+		          &error );
+
+		FTXF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FTXF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libftxf_usn_join_get_number_of_entries(
+	          usn_join,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 4099 );
+
+	result = libftxf_usn_join_get_first_file_entry_index(
+	          usn_join,
+	          (uint64_t) 0x0001000000000116UL,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 3 + 0x16 );
+
+	result = libftxf_usn_join_get_entry_index_by_update_sequence_number(
+	          usn_join,
+	          (uint64_t) 0x0001000000000fffUL,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 3 + 0x0eff );
+
+	result = libftxf_usn_join_get_first_file_entry_index(
+	          usn_join,
+	          (uint64_t) 281474976727574UL,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_usn_join_read_journal_data(
+	          NULL,
+	          journal_data,
+	          536,
+	          0,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          NULL,
+	          536,
+	          0,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          journal_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          journal_data,
+	          536,
+	          0,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_usn_join_free(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_join != NULL )
+	{
+		libftxf_usn_join_free(
+		 &usn_join,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_usn_join_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_usn_join_get_number_of_entries(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libftxf_usn_join_t *usn_join = NULL;
+	int number_of_entries        = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libftxf_usn_join_initialize(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_usn_join_get_number_of_entries(
+	          usn_join,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_usn_join_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_number_of_entries(
+	          usn_join,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_usn_join_free(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_join != NULL )
+	{
+		libftxf_usn_join_free(
+		 &usn_join,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_usn_join_get_entry_values function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_usn_join_get_entry_values(
+     void )
+{
+	uint8_t journal_data[ 536 ];
+
+	libcerror_error_t *error        = NULL;
+	libftxf_usn_join_t *usn_join    = NULL;
+	size_t read_size                = 0;
+	uint64_t file_reference         = 0;
+	uint64_t journal_offset         = 0;
+	uint64_t parent_file_reference  = 0;
+	uint64_t update_sequence_number = 0;
+	uint64_t update_time            = 0;
+	uint32_t file_attribute_flags   = 0;
+	uint32_t update_reason_flags    = 0;
+	uint32_t update_source_flags    = 0;
+	int data_index                  = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 536;
+	     data_index++ )
+	{
+		journal_data[ data_index ] = 0;
+	}
+	for( data_index = 0;
+	     data_index < 104;
+	     data_index++ )
+	{
+		journal_data[ 8 + data_index ]   = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 120 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 224 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 328 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 432 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+	}
+	journal_data[ 112 ] = 0xff;
+	journal_data[ 145 ] = 0x10;
+	journal_data[ 228 ] = 3;
+	journal_data[ 386 ] = 0xff;
+	journal_data[ 457 ] = 0x20;
+
+	result = libftxf_usn_join_initialize(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          journal_data,
+	          496,
+	          4096,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 432 );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          &( journal_data[ 432 ] ),
+	          104,
+	          4096 + 432,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 104 );
+
+	/* Test regular cases
+	 */
+	result = libftxf_usn_join_get_entry_values(
+	          usn_join,
+	          1,
+	          &journal_offset,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "journal_offset",
+	 journal_offset,
+	 (uint64_t) 4096 + 120 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "update_sequence_number",
+	 update_sequence_number,
+	 (uint64_t) 0x1000 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "update_time",
+	 update_time,
+	 (uint64_t) 0 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "file_reference",
+	 file_reference,
+	 (uint64_t) 281474976727574UL );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "parent_file_reference",
+	 parent_file_reference,
+	 (uint64_t) 281474976712339UL );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "update_reason_flags",
+	 update_reason_flags,
+	 (uint32_t) 0x80000006UL );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "update_source_flags",
+	 update_source_flags,
+	 (uint32_t) 0 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT32(
+	 "file_attribute_flags",
+	 file_attribute_flags,
+	 (uint32_t) 0x00002020UL );
+
+	result = libftxf_usn_join_get_entry_values(
+	          usn_join,
+	          2,
+	          &journal_offset,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "journal_offset",
+	 journal_offset,
+	 (uint64_t) 4096 + 432 );
+
+	FTXF_TEST_ASSERT_EQUAL_UINT64(
+	 "update_sequence_number",
+	 update_sequence_number,
+	 (uint64_t) 0x2000 );
+
+	/* Test error cases
+	 */
+	result = libftxf_usn_join_get_entry_values(
+	          NULL,
+	          0,
+	          &journal_offset,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_entry_values(
+	          usn_join,
+	          -1,
+	          &journal_offset,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_entry_values(
+	          usn_join,
+	          3,
+	          &journal_offset,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_entry_values(
+	          usn_join,
+	          0,
+	          NULL,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_entry_values(
+	          usn_join,
+	          0,
+	          &journal_offset,
+	          NULL,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_entry_values(
+	          usn_join,
+	          0,
+	          &journal_offset,
+	          &update_sequence_number,
+	          NULL,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_entry_values(
+	          usn_join,
+	          0,
+	          &journal_offset,
+	          &update_sequence_number,
+	          &update_time,
+	          NULL,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_entry_values(
+	          usn_join,
+	          0,
+	          &journal_offset,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          NULL,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_entry_values(
+	          usn_join,
+	          0,
+	          &journal_offset,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          NULL,
+	          &update_source_flags,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_entry_values(
+	          usn_join,
+	          0,
+	          &journal_offset,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          NULL,
+	          &file_attribute_flags,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_entry_values(
+	          usn_join,
+	          0,
+	          &journal_offset,
+	          &update_sequence_number,
+	          &update_time,
+	          &file_reference,
+	          &parent_file_reference,
+	          &update_reason_flags,
+	          &update_source_flags,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_usn_join_free(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_join != NULL )
+	{
+		libftxf_usn_join_free(
+		 &usn_join,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_usn_join_get_entry_index_by_update_sequence_number function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_usn_join_get_entry_index_by_update_sequence_number(
+     void )
+{
+	uint8_t journal_data[ 536 ];
+
+	libcerror_error_t *error     = NULL;
+	libftxf_usn_join_t *usn_join = NULL;
+	size_t read_size             = 0;
+	int data_index               = 0;
+	int entry_index              = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 536;
+	     data_index++ )
+	{
+		journal_data[ data_index ] = 0;
+	}
+	for( data_index = 0;
+	     data_index < 104;
+	     data_index++ )
+	{
+		journal_data[ 8 + data_index ]   = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 120 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 224 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 328 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 432 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+	}
+	journal_data[ 112 ] = 0xff;
+	journal_data[ 145 ] = 0x10;
+	journal_data[ 228 ] = 3;
+	journal_data[ 386 ] = 0xff;
+	journal_data[ 457 ] = 0x20;
+
+	result = libftxf_usn_join_initialize(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          journal_data,
+	          496,
+	          4096,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 432 );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          &( journal_data[ 432 ] ),
+	          104,
+	          4096 + 432,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 104 );
+
+	/* Test regular cases
+	 */
+	result = libftxf_usn_join_get_entry_index_by_update_sequence_number(
+	          usn_join,
+	          (uint64_t) 281474976727574UL,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	result = libftxf_usn_join_get_entry_index_by_update_sequence_number(
+	          usn_join,
+	          (uint64_t) 281474976727574UL,
+	          0x2000,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 2 );
+
+	result = libftxf_usn_join_get_entry_index_by_update_sequence_number(
+	          usn_join,
+	          (uint64_t) 281474976727574UL,
+	          0x3000,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_usn_join_get_entry_index_by_update_sequence_number(
+	          usn_join,
+	          (uint64_t) 281474976712339UL,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_usn_join_get_entry_index_by_update_sequence_number(
+	          NULL,
+	          0,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_entry_index_by_update_sequence_number(
+	          usn_join,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_usn_join_free(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_join != NULL )
+	{
+		libftxf_usn_join_free(
+		 &usn_join,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_usn_join_match_update_journal_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_usn_join_match_update_journal_entry(
+     void )
+{
+	uint8_t journal_data[ 536 ];
+
+	libcerror_error_t *error     = NULL;
+	libftxf_usn_join_t *usn_join = NULL;
+	libftxf_record_t *record     = NULL;
+	size_t read_size             = 0;
+	int data_index               = 0;
+	int entry_index              = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 536;
+	     data_index++ )
+	{
+		journal_data[ data_index ] = 0;
+	}
+	for( data_index = 0;
+	     data_index < 104;
+	     data_index++ )
+	{
+		journal_data[ 8 + data_index ]   = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 120 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 224 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 328 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 432 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+	}
+	journal_data[ 112 ] = 0xff;
+	journal_data[ 145 ] = 0x10;
+	journal_data[ 228 ] = 3;
+	journal_data[ 386 ] = 0xff;
+	journal_data[ 457 ] = 0x20;
+
+	result = libftxf_usn_join_initialize(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_initialize(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_record_copy_from_byte_stream(
+	          record,
+	          ftxf_test_usn_join_record_data1,
+	          208,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_usn_join_match_update_journal_entry(
+	          usn_join,
+	          record,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          journal_data,
+	          496,
+	          4096,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 432 );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          &( journal_data[ 432 ] ),
+	          104,
+	          4096 + 432,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 104 );
+
+	result = libftxf_usn_join_match_update_journal_entry(
+	          usn_join,
+	          record,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libftxf_usn_join_match_update_journal_entry(
+	          NULL,
+	          record,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_match_update_journal_entry(
+	          usn_join,
+	          NULL,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_match_update_journal_entry(
+	          usn_join,
+	          record,
+	          1,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_match_update_journal_entry(
+	          usn_join,
+	          record,
+	          0,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_record_free(
+	          &record,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_usn_join_free(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libftxf_record_free(
+		 &record,
+		 NULL );
+	}
+	if( usn_join != NULL )
+	{
+		libftxf_usn_join_free(
+		 &usn_join,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_usn_join_get_first_file_entry_index function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_usn_join_get_first_file_entry_index(
+     void )
+{
+	uint8_t journal_data[ 536 ];
+
+	libcerror_error_t *error     = NULL;
+	libftxf_usn_join_t *usn_join = NULL;
+	size_t read_size             = 0;
+	int data_index               = 0;
+	int entry_index              = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 536;
+	     data_index++ )
+	{
+		journal_data[ data_index ] = 0;
+	}
+	for( data_index = 0;
+	     data_index < 104;
+	     data_index++ )
+	{
+		journal_data[ 8 + data_index ]   = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 120 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 224 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 328 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 432 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+	}
+	journal_data[ 112 ] = 0xff;
+	journal_data[ 145 ] = 0x10;
+	journal_data[ 228 ] = 3;
+	journal_data[ 386 ] = 0xff;
+	journal_data[ 457 ] = 0x20;
+
+	result = libftxf_usn_join_initialize(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libftxf_usn_join_get_first_file_entry_index(
+	          usn_join,
+	          (uint64_t) 281474976727574UL,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          journal_data,
+	          496,
+	          4096,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 432 );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          &( journal_data[ 432 ] ),
+	          104,
+	          4096 + 432,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 104 );
+
+	result = libftxf_usn_join_get_first_file_entry_index(
+	          usn_join,
+	          (uint64_t) 281474976727574UL,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	result = libftxf_usn_join_get_first_file_entry_index(
+	          usn_join,
+	          (uint64_t) 281474976712339UL,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_usn_join_get_first_file_entry_index(
+	          NULL,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_first_file_entry_index(
+	          usn_join,
+	          0,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_usn_join_free(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_join != NULL )
+	{
+		libftxf_usn_join_free(
+		 &usn_join,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libftxf_usn_join_get_next_file_entry_index function
+ * Returns 1 if successful or 0 if not
+ */
+int ftxf_test_usn_join_get_next_file_entry_index(
+     void )
+{
+	uint8_t journal_data[ 536 ];
+
+	libcerror_error_t *error     = NULL;
+	libftxf_usn_join_t *usn_join = NULL;
+	size_t read_size             = 0;
+	int data_index               = 0;
+	int entry_index              = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 536;
+	     data_index++ )
+	{
+		journal_data[ data_index ] = 0;
+	}
+	for( data_index = 0;
+	     data_index < 104;
+	     data_index++ )
+	{
+		journal_data[ 8 + data_index ]   = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 120 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 224 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 328 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+		journal_data[ 432 + data_index ] = ftxf_test_usn_join_record_data1[ 104 + data_index ];
+	}
+	journal_data[ 112 ] = 0xff;
+	journal_data[ 145 ] = 0x10;
+	journal_data[ 228 ] = 3;
+	journal_data[ 386 ] = 0xff;
+	journal_data[ 457 ] = 0x20;
+
+	result = libftxf_usn_join_initialize(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          journal_data,
+	          496,
+	          4096,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 432 );
+
+	result = libftxf_usn_join_read_journal_data(
+	          usn_join,
+	          &( journal_data[ 432 ] ),
+	          104,
+	          4096 + 432,
+	          &read_size,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_size",
+	 read_size,
+	 (size_t) 104 );
+
+	/* Test regular cases
+	 */
+	result = libftxf_usn_join_get_next_file_entry_index(
+	          usn_join,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	result = libftxf_usn_join_get_next_file_entry_index(
+	          usn_join,
+	          entry_index,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 2 );
+
+	result = libftxf_usn_join_get_next_file_entry_index(
+	          usn_join,
+	          entry_index,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libftxf_usn_join_get_next_file_entry_index(
+	          NULL,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_next_file_entry_index(
+	          usn_join,
+	          -1,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_next_file_entry_index(
+	          usn_join,
+	          3,
+	          &entry_index,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libftxf_usn_join_get_next_file_entry_index(
+	          usn_join,
+	          0,
+	          NULL,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FTXF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libftxf_usn_join_free(
+	          &usn_join,
+	          &error );
+
+	FTXF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "usn_join",
+	 usn_join );
+
+	FTXF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_join != NULL )
+	{
+		libftxf_usn_join_free(
+		 &usn_join,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FTXF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FTXF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FTXF_TEST_UNREFERENCED_PARAMETER( argc )
+	FTXF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FTXF_TEST_RUN(
+	 "libftxf_usn_join_initialize",
+	 ftxf_test_usn_join_initialize );
+
+	FTXF_TEST_RUN(
+	 "libftxf_usn_join_initialize_with_allocator",
+	 ftxf_test_usn_join_initialize_with_allocator );
+
+	FTXF_TEST_RUN(
+	 "libftxf_usn_join_free",
+	 ftxf_test_usn_join_free );
+
+	FTXF_TEST_RUN(
+	 "libftxf_usn_join_read_journal_data",
+	 ftxf_test_usn_join_read_journal_data );
+
+	FTXF_TEST_RUN(
+	 "libftxf_usn_join_get_number_of_entries",
+	 ftxf_test_usn_join_get_number_of_entries );
+
+	FTXF_TEST_RUN(
+	 "libftxf_usn_join_get_entry_values",
+	 ftxf_test_usn_join_get_entry_values );
+
+	FTXF_TEST_RUN(
+	 "libftxf_usn_join_get_entry_index_by_update_sequence_number",
+	 ftxf_test_usn_join_get_entry_index_by_update_sequence_number );
+
+	FTXF_TEST_RUN(
+	 "libftxf_usn_join_match_update_journal_entry",
+	 ftxf_test_usn_join_match_update_journal_entry );
+
+	FTXF_TEST_RUN(
+	 "libftxf_usn_join_get_first_file_entry_index",
+	 ftxf_test_usn_join_get_first_file_entry_index );
+
+	FTXF_TEST_RUN(
+	 "libftxf_usn_join_get_next_file_entry_index",
+	 ftxf_test_usn_join_get_next_file_entry_index );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
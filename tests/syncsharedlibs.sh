@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 
 GIT_URL_PREFIX="https://github.com/libyal";
-SHARED_LIBS="libcerror libcnotify libuna libfdatetime libfguid libfusn";
+SHARED_LIBS="libcerror libcnotify libcthreads libuna libfdatetime libfguid libfusn";
 
 USE_HEAD="";
 
@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "error record support"
+$LibraryTests = "allocator block_index column_reader column_writer duplicate_filter error filetime json name name_pool name_search notify path_resolver record record_diff record_filter record_hash record_merger support timeline_merger timeline_run usn_join"
 $LibraryTestsWithInput = ""
 $OptionSets = "" -split " "
 